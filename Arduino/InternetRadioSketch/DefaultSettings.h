@@ -13,15 +13,42 @@ const char *default_settings =
     "listen_icecast_port = 8000\n"
     "listen_icecast_mountpoint = /wgxc.mp3\n"
     "listen_volume = 0.88\n"
+    "listen_rtp_address = 239.255.77.1\n"
+    "listen_rtp_port = 5004\n"
+    "listen_rtp_jitter_ms = 200\n"
+    "listen_rtp_sync = 1\n"
+    "listen_rtp_delay_ms = 500\n"
     "remote_icecast_url = somewhereinspace.net\n"
     "remote_icecast_port = 8080\n"
     "remote_icecast_user = source\n"
     "remote_icecast_password = YourIcecastPassword\n"
     "remote_icecast_mountpoint = live\n"
+    "remote_icecast_stall_ms = 3000\n"
+    "remote_icecast_catchup = 4\n"
+    "remote_icecast_spill = 0\n"
+    "remote_rtp = 0\n"
+    "remote_rtp_host = \n"
+    "remote_rtp_port = 5004\n"
+    "remote_whip = 0\n"
+    "remote_whip_url = \n"
+    "remote_whip_token = \n"
+    "local_icecast_name = Wave Farm Toolkit\n"
+    "local_icecast_mount = /stream.mp3\n"
+    "local_hls = 1\n"
+    "local_rtp = 0\n"
+    "local_rtp_address = 239.255.77.1\n"
+    "local_rtp_port = 5004\n"
+    "local_rtp_fec = 4\n"
+    "local_ws_audio = 1\n"
+    "local_ws_audio_lag_ms = 250\n"
+    "local_asset_cache_kb = 128\n"
     "mic_not_line = 0\n"
     "channels = 1\n"
     "bitrate = 128\n"
     "sample_rate = 44100\n"
+    "codec = mp3\n"
+    "opus_bitrate = 64\n"
+    "opus_complexity = 3\n"
     "agc_not_manual = 1\n"
     "manual_gain_level = 32.0\n"
     "agc_maximum_gain = 24.0\n"
@@ -18,7 +18,10 @@
 // VLSI VS10xx
 #include "Streamer.h"
 #include "src/ToolkitFiles/ToolkitFiles.h"
+#include "src/ToolkitVLSI/opus_stream.h"
 #include "src/ToolkitWiFi/ToolkitWiFi_Server.h"
+#include "src/ToolkitWiFi/rtp_receiver.h"
+#include "src/ToolkitWiFi/rtp_sync.h"
 
 // Include hardware controls (volume knob and mode switch)
 #if USE_PIN_CONTROLS
@@ -33,6 +36,8 @@ ToolkitWiFi_Server wifi_thing;
 //------------------------------------------------------------------------------------
 //
 // There are four main tasks that we need to run in the loop()
+// (plus the uplink spill, which only writes to flash when the
+// icecast uplink is down)
 //
 
 void server_task(void *params)
@@ -44,8 +49,64 @@ void server_task(void *params)
   }
 }
 
+void stream_task(void *params)
+{
+  const int delay_in_ms = RTOS_DELAY_STREAM_TASK;
+  while (true) {
+    wifi_thing.runStreaming();
+    vTaskDelay(portTICK_PERIOD_MS * delay_in_ms);
+  }
+}
+
+void spill_task(void *params)
+{
+  const int delay_in_ms = RTOS_DELAY_SPILL_TASK;
+  while (true) {
+    wifi_thing.runSpill();
+    vTaskDelay(portTICK_PERIOD_MS * delay_in_ms);
+  }
+}
+
+// Multicast listening .. the packets wait in the jitter buffer and
+// come out in order, in time with the other rooms, see rtp_receiver.h
+void listen_multicast()
+{
+  static uint32_t last_adjust = 0;
+
+  rtp_receiver_run();
+  while (stream_thing.readyForData()) {
+    size_t remaining = 0;
+    uint8_t *buffer = stream_thing.getNextInBuffer(&remaining);
+    if (remaining > 32) {
+      remaining = 32;
+    }
+    size_t bytesused = rtp_receiver_read(buffer, remaining);
+    if (0==bytesused) {
+      break;  // nothing due yet
+    }
+    if (rtp_sync_restarted()) {
+      stream_thing.clearSampleCounter();  // counting from this frame
+    }
+    stream_thing.playData(buffer, bytesused); // send to the VS1063a audio output
+    stream_thing.advanceInBuffer(bytesused);
+  }
+
+  // nudge the VS1063a's rate to keep it on the master's timeline
+  if ((millis() - last_adjust) >= RTP_SYNC_ADJUST_MS) {
+    last_adjust = millis();
+    int32_t ppm;
+    if (rtp_sync_adjust(stream_thing.getSampleCounter(), &ppm)) {
+      stream_thing.setRateTune(ppm);
+    }
+  }
+}
+
 void listen()
 {
+  if (stream_thing.multicast_not_tcp) {
+    listen_multicast();
+    return;
+  }
   while (stream_thing.readyForData()) { // wait till mp3 wants more data
     //wants more data! check we have something available from the stream
     if (stream_thing.reconnect_listener_if_needed()) {
@@ -78,9 +139,46 @@ void listener_task(void *params)
   } // end of while (true)
 }
 
+// Relay mode .. the remote stream goes straight into the ring for the
+// local listeners and the uplinks, without going through the VS1063a.
+// Nothing waits on DREQ, we take whatever the socket has.
+void relay()
+{
+  if (!stream_thing.reconnect_listener_if_needed()) {
+    Serial.println("Relay has disconnected .. will try to reconnect in 10 seconds.");
+    vTaskDelay(portTICK_PERIOD_MS * 10000);
+    return;
+  }
+  int available;
+  while ((available = stream_thing.listener.available()) > 0) {
+    size_t remaining = 0;
+    uint8_t *buffer = stream_thing.getNextInBuffer(&remaining);
+    if (remaining > (size_t) available) {
+      remaining = available;
+    }
+    int bytesused = stream_thing.listener.read(buffer, remaining);
+    if (bytesused <= 0) {
+      break;
+    }
+    stream_thing.advanceInBuffer(bytesused);
+  }
+}
+
+void relay_task(void *params)
+{
+  const int delay_in_ms = RTOS_DELAY_RELAY_TASK;
+  while (true) {
+    relay();
+    vTaskDelay(portTICK_PERIOD_MS * delay_in_ms);
+  }
+}
+
 void encode()
 {
-  if (stream_thing.readyForData()) {
+  if (stream_thing.opus_not_mp3) {
+    // PCM for the Opus task, see opus_stream.h
+    opus_stream_capture(&stream_thing);
+  } else if (stream_thing.readyForData()) {
     size_t remaining = 0;
     uint8_t *buffer = stream_thing.getNextInBuffer(&remaining);
     size_t bytesused = stream_thing.encoder_getData(buffer, remaining);  // reads as much as we ask for
@@ -90,29 +188,22 @@ void encode()
 
 void encoder_task(void *params)
 {
-  const int delay_in_ms = RTOS_DELAY_ENCODER_TASK;  // 250ms per 128kbps buffer, 167ms per 192kbps buffer
+  const int delay_in_ms = stream_thing.opus_not_mp3 ?
+    RTOS_DELAY_PCM_TASK : RTOS_DELAY_ENCODER_TASK;  // 250ms per 128kbps buffer, 167ms per 192kbps buffer
   while (true) {
     encode();
     vTaskDelay(portTICK_PERIOD_MS * delay_in_ms);
   }
 }
 
-void icy_task(void *params)
+// Opus encoding runs on the other core from the VS1063a tasks
+void opus_task(void *params)
 {
-  const int delay_in_ms = 10000;  // 10 seconds
+  const int delay_in_ms = RTOS_DELAY_OPUS_TASK;
   while (true) {
-    // do the delay at the top of the loop, so that we aren't checking for 
-    // a lost connection as soon as the task starts
+    opus_stream_run();
     vTaskDelay(portTICK_PERIOD_MS * delay_in_ms);
-    if (!wifi_thing.isIcecastBroadcastStillConnected()) {
-      Serial.println("Remote icecast server has disconnected .. trying to reconnect");
-      if (wifi_thing.startIcecastBroadcast()) {
-        Serial.println("ICY Broadcast started!");
-      } else {
-        Serial.println("ICY failed to start!");
-      }
-    }
-  }  
+  }
 }
 
 #if USE_PIN_CONTROLS
@@ -132,13 +223,19 @@ void pins_task(void *params)
 void start_rtos_tasks()
 {
   xTaskCreatePinnedToCore(server_task, "Server Task", 4096+EXTRAHEAP, NULL, 1, NULL, 0); // changed to processor 0 !! from 1
+  xTaskCreatePinnedToCore(stream_task, "Stream Task", 4096+EXTRAHEAP, NULL, RTOS_PRIORITY_STREAM_TASK, NULL, RTOS_CORE_STREAM_TASK);
+  xTaskCreatePinnedToCore(spill_task, "Spill Task", 4096+EXTRAHEAP, NULL, 0, NULL, 0);
 
   if (stream_thing.run_not_wait) {
-    if (stream_thing.listen_dont_encode) {
+    if (stream_thing.relay_dont_play) {
+      xTaskCreatePinnedToCore(relay_task, "Relay Task", 2048+EXTRAHEAP, NULL, 1+RTOS_HIPRIORITY_VLSI, NULL, 1);
+    } else if (stream_thing.listen_dont_encode) {
       xTaskCreatePinnedToCore(listener_task, "Listener Task", 2048+EXTRAHEAP, NULL, 1+RTOS_HIPRIORITY_VLSI, NULL, 1);
     } else {
       xTaskCreatePinnedToCore(encoder_task, "Encoder Task", 2048+EXTRAHEAP, NULL, 1+RTOS_HIPRIORITY_VLSI, NULL, 1);
-      xTaskCreatePinnedToCore(icy_task, "Icy Reconnect Task", 4096+EXTRAHEAP, NULL, 1, NULL, 0); // changed to processor 0 !! from 1
+      if (stream_thing.opus_not_mp3) { // libopus keeps its work space on the stack
+        xTaskCreatePinnedToCore(opus_task, "Opus Task", 32768+EXTRAHEAP, NULL, 1, NULL, RTOS_CORE_OPUS_TASK);
+      }
     }
   }
 
@@ -252,16 +349,32 @@ void setup() {
   wifi_thing.setDefaultIndexPage(default_index_page, DEFAULT_INDEX_PAGE_SIZE);
   wifi_thing.begin();
 
+  //--------------------------------------------------
+  // Link the WiFi STUFF to the Streamer and the live updates function
+
+  wifi_thing.setMP3SequenceFunctions(Streamer::getSequenceHead,
+    Streamer::getOldestSequence, Streamer::getBufferBySequence);
+  wifi_thing.setMP3FillingFunction(Streamer::getFillingBuffer);
+  wifi_thing.setWSLiveChangesFunction(update_volumes);
+
   //--------------------------------------------------
   // Setup the Streamer
   
   if (stream_thing.run_not_wait) {
-    if (stream_thing.listen_dont_encode) {
+    if (stream_thing.relay_dont_play) {
+      Serial.println("Starting in relay mode.");
+      stream_thing.start_listener();
+      // passing it on is optional, only uplinks with a url start
+      if (wifi_thing.startIcecastBroadcast()) {
+        Serial.println("ICY Broadcast is connecting.");
+      }
+    } else if (stream_thing.listen_dont_encode) {
       stream_thing.start_listener();
     } else { // startup as encoder
       Serial.println("Starting in transmitter mode.");
+      // connects in the background, see ToolkitWiFi_Uplink
       if (wifi_thing.startIcecastBroadcast()) {
-        Serial.println("ICY Broadcast started!");
+        Serial.println("ICY Broadcast is connecting.");
       } else {
         Serial.println("ICY failed to start!");
       }
@@ -271,13 +384,6 @@ void setup() {
     Serial.println("Starting in Waiting mode.");
   }
 
-  //--------------------------------------------------
-  // Link the WiFi STUFF to the Streamer and the live updates function
-
-  wifi_thing.setMP3DataStreamFunction(Streamer::getNextOutBuffer);
-  wifi_thing.setWSLiveChangesFunction(update_volumes);
-
-
 #if USE_PIN_CONTROLS
   pins_thing.begin();
 #endif 
@@ -307,18 +413,25 @@ void loop() {
 #else
 
   wifi_thing.run();
+  wifi_thing.runStreaming();
+  wifi_thing.runSpill();
 
   if (!stream_thing.run_not_wait) {
     return;
   }
   
-  if (stream_thing.listen_dont_encode) { // LISTENING
+  if (stream_thing.relay_dont_play) { // RELAYING
+
+    relay();
+
+  } else if (stream_thing.listen_dont_encode) { // LISTENING
 
     listen();
 
   } else { // ENCODING
 
     encode();
+    opus_stream_run();
 
   } // end of ENCODING
   
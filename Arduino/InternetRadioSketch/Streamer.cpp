@@ -2,10 +2,13 @@
 // Setup the MP3 Encoder - VS1063a
 //
 
+#include "config.h"
 #include "Streamer.h"
 
 #include "src/ToolkitVLSI/ToolkitVLSI.h"
 #include "src/ToolkitFiles/ToolkitFiles.h"
+#include "src/ToolkitVLSI/opus_stream.h"
+#include "src/ToolkitWiFi/rtp_receiver.h"
 
 // Hardware pins
 // We are using the default SPI I/O pins, so we don't have to define them
@@ -23,6 +26,9 @@ Streamer::Streamer()
 {
     run_not_wait = false;
     listen_dont_encode = false;
+    relay_dont_play = false;
+    multicast_not_tcp = false;
+    opus_not_mp3 = false;
     initBuffers();
 }
 
@@ -39,9 +45,16 @@ void Streamer::encoder_setup()
 {   // run mode states
     run_not_wait = (0!=strcmp(
         SettingItem::findString("startup_auto_mode"),"waiting"));
-    listen_dont_encode = (0==strcmp(
+    relay_dont_play = (0==strcmp(
+        SettingItem::findString("startup_auto_mode"),"relay"));
+    multicast_not_tcp = (0==strcmp(
+        SettingItem::findString("startup_auto_mode"),"multicast"));
+    listen_dont_encode = relay_dont_play || multicast_not_tcp || (0==strcmp(
         SettingItem::findString("startup_auto_mode"),"listener"));
 
+    // a longer ring lets the icecast uplink ride out longer outages
+    usePSRAMBuffers();
+
     // configure the SPI control and request lines for ALL SPI devices
     // NOTE: player1053 might need to exists outside the scope of
     // this function. i.e. it may kill the SPI port when it is destroyed
@@ -91,11 +104,26 @@ void Streamer::encoder_setup()
         encoder_setManualGain(
             SettingItem::findFloat("manual_gain_level",1.0));
     }
+
+    // codec = opus .. the VS1063a gives us PCM and we encode it
+    const char *codec = SettingItem::findString("codec");
+    if (run_not_wait && !listen_dont_encode && codec && (0==strcmp(codec, "opus"))) {
+        uint16_t channels = SettingItem::findUInt("channels",0);
+        if (opus_stream_begin((channels >= LEFT_MONO) ? 1 : 2, writeStream)) {
+            encoder_setFormat(FORMAT_PCM);
+            encoder_setSamplerate(SAMPLE_48K);  // all Opus is 48kHz
+            opus_not_mp3 = true;
+        }
+    }
 } // end of setup()
 
 
 boolean Streamer::start_listener()
 {   // Connect to a remote icecast stream for listening
+    if (multicast_not_tcp) {
+        Serial.println("Starting in multicast listener mode");
+        return rtp_receiver_begin();
+    }
     Serial.println("Starting in listener mode");
     Serial.print("Connecting to ");
     Serial.println(SettingItem::findString("listen_icecast_url"));
@@ -146,6 +174,9 @@ boolean Streamer::start_listener()
 
 boolean Streamer::reconnect_listener_if_needed()
 {
+    if (multicast_not_tcp) {
+        return rtp_receiver_begin();    // UDP, nothing to reconnect
+    }
     if (!listener.connected()) {
         listener.stop();
         vTaskDelay(portTICK_PERIOD_MS * 500);
@@ -177,11 +208,20 @@ void Streamer::update_recordVolume()
 
 SemaphoreHandle_t Streamer::buffer_mutex = NULL;
 
-uint8_t Streamer::buffer[NUMBER_OF_BUFFERS][BUFFER_SIZE];
+static uint8_t internal_buffers[Streamer::NUMBER_OF_BUFFERS][Streamer::BUFFER_STRIDE];
+
+uint8_t *Streamer::buffer = &internal_buffers[0][0];
+size_t Streamer::number_of_buffers = NUMBER_OF_BUFFERS;
 
 size_t Streamer::buffer_in_index = 0;
 size_t Streamer::buffer_in_address = 0;
-size_t Streamer::buffer_out_index = 0;
+uint32_t Streamer::buffer_sequence = 0;
+
+// readers stay this many slots clear of the one being filled, so a
+// slow send isn't overwritten under them
+#define SEQUENCE_MARGIN 2
+
+#define SLOT(I) (&buffer[(I) * BUFFER_STRIDE])
 
 boolean Streamer::initBuffers()
 {
@@ -196,10 +236,34 @@ boolean Streamer::mutexExists()
     return (NULL!=buffer_mutex);
 }
 
+// PSRAM isn't ready until setup(), so the ring starts out in internal
+// RAM and moves before anything has been written to it
+void Streamer::usePSRAMBuffers()
+{
+#if PSRAM_BUFFER_SECONDS
+    if (!psramFound() || (buffer != &internal_buffers[0][0])) {
+        return;
+    }
+    size_t count = PSRAM_BUFFER_SECONDS * BUFFERS_PER_SECOND;
+    uint8_t *big = (uint8_t *) ps_malloc(count * BUFFER_STRIDE);
+    if (NULL==big) {
+        Serial.println("No room in PSRAM for the stream buffers.");
+        return;
+    }
+    bufferLock(buffer_mutex);
+    buffer = big;
+    number_of_buffers = count;
+    buffer_in_index = 0;
+    buffer_in_address = 0;
+    bufferUnlock(buffer_mutex);
+    Serial.printf("Stream buffers in PSRAM: %u x %u bytes\n", count, BUFFER_SIZE);
+#endif
+}
+
 uint8_t *Streamer::getNextInBuffer(size_t *remaining)
 {
     *remaining = BUFFER_SIZE - buffer_in_address;
-    return &buffer[buffer_in_index][buffer_in_address];
+    return SLOT(buffer_in_index) + BUFFER_HEADROOM + buffer_in_address;
 }
 
 // NOTE: for tasks running on the same processor, we can
@@ -208,35 +272,67 @@ uint8_t *Streamer::getNextInBuffer(size_t *remaining)
 
 void Streamer::advanceInBuffer(size_t bytesused)
 {
-    buffer_in_address += bytesused;
-    if (buffer_in_address >= BUFFER_SIZE) {
+    __sync_synchronize();   // the data before the count (getFillingBuffer)
+    if ((buffer_in_address + bytesused) >= BUFFER_SIZE) {
         bufferLock(buffer_mutex);
-        buffer_in_index = (buffer_in_index + 1) % NUMBER_OF_BUFFERS;
-        bufferUnlock(buffer_mutex);
+        buffer_in_index = (buffer_in_index + 1) % number_of_buffers;
+        buffer_sequence++;
         buffer_in_address = 0;
+        bufferUnlock(buffer_mutex);
+    } else {
+        buffer_in_address += bytesused;
     }
 }
 
-uint8_t *Streamer::getNextOutBuffer(size_t *bytestostream)
+void Streamer::writeStream(const uint8_t *data, size_t length)
 {
-    uint8_t *result = NULL;
-    *bytestostream = 0;
-    boolean ready;
-    size_t compare_index;
-    // we only need to lock around the acces to buffer_in_index
+    while (length > 0) {
+        size_t remaining;
+        uint8_t *where = getNextInBuffer(&remaining);
+        size_t part = (length < remaining) ? length : remaining;
+        memcpy(where, data, part);
+        advanceInBuffer(part);
+        data += part;
+        length -= part;
+    }
+}
+
+uint32_t Streamer::getSequenceHead()
+{
+    uint32_t head;
     bufferLock(buffer_mutex);
-    compare_index = buffer_in_index;
+    head = buffer_sequence;
     bufferUnlock(buffer_mutex);
-    if (buffer_out_index > compare_index) {
-        compare_index += NUMBER_OF_BUFFERS;
-    }
-    ready = ((compare_index-buffer_out_index)>2);
-    if (ready) {
-        *bytestostream = BUFFER_SIZE;
-        result = buffer[buffer_out_index];
-        buffer_out_index = (buffer_out_index + 1) % NUMBER_OF_BUFFERS;
+    return head;
+}
+
+uint32_t Streamer::getOldestSequence()
+{
+    uint32_t head = getSequenceHead();
+    uint32_t window = number_of_buffers - SEQUENCE_MARGIN;
+    return (head > window) ? (head - window) : 0;
+}
+
+uint8_t *Streamer::getBufferBySequence(uint32_t sequence, size_t *length)
+{
+    *length = 0;
+    uint32_t head = getSequenceHead();
+    if ((sequence >= head) ||
+        ((head - sequence) > (number_of_buffers - SEQUENCE_MARGIN))) {
+        return NULL;
     }
-    return result;
+    *length = BUFFER_SIZE;
+    return SLOT(sequence % number_of_buffers) + BUFFER_HEADROOM;
+}
+
+uint8_t *Streamer::getFillingBuffer(uint32_t *sequence, size_t *length)
+{
+    bufferLock(buffer_mutex);
+    *sequence = buffer_sequence;
+    *length = buffer_in_address;
+    size_t index = buffer_in_index;
+    bufferUnlock(buffer_mutex);
+    return SLOT(index) + BUFFER_HEADROOM;
 }
 
 //
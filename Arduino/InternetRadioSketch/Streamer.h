@@ -6,6 +6,7 @@
 
 #include <WiFi.h>
 #include "src/ToolkitVLSI/ToolkitVLSI.h"
+#include "src/ToolkitWiFi/mp3_chunk.h"
 
 class Streamer : public ToolkitVS1063
 {
@@ -30,6 +31,9 @@ class Streamer : public ToolkitVS1063
 
         boolean run_not_wait;
         boolean listen_dont_encode;
+        boolean relay_dont_play;    // listening, but only to pass it on
+        boolean multicast_not_tcp;  // listening to RTP, see rtp_receiver.h
+        boolean opus_not_mp3;       // encoding PCM to Opus, see opus_stream.h
 
     public:
         WiFiClient listener;
@@ -39,30 +43,49 @@ class Streamer : public ToolkitVS1063
             BUFFER_SIZE         = 4096,
             BUFFERS_PER_SECOND  = 4,        // at 128kbps
             BUFFER_SECONDS      = 3,
-            NUMBER_OF_BUFFERS   = 12        // BUFFERS_PER_SECOND * BUFFER_SECONDS
+            NUMBER_OF_BUFFERS   = 12,       // BUFFERS_PER_SECOND * BUFFER_SECONDS
+            // room around each buffer for the icecast chunk framing
+            BUFFER_HEADROOM     = MP3_CHUNK_HEADROOM,
+            BUFFER_TAILROOM     = MP3_CHUNK_TAILROOM,
+            BUFFER_STRIDE       = BUFFER_HEADROOM + BUFFER_SIZE + BUFFER_TAILROOM
         };
 
         static SemaphoreHandle_t buffer_mutex;
 
-        static uint8_t buffer[NUMBER_OF_BUFFERS][BUFFER_SIZE];
+        // NUMBER_OF_BUFFERS in internal RAM, or a longer ring in
+        // PSRAM if there is some (see PSRAM_BUFFER_SECONDS)
+        static uint8_t *buffer;             // number_of_buffers * BUFFER_STRIDE
+        static size_t number_of_buffers;
 
         static size_t buffer_in_index;
         static size_t buffer_in_address;
-        static size_t buffer_out_index;
+        static uint32_t buffer_sequence;    // buffers filled so far
 
         static boolean initBuffers();
         static boolean mutexExists();
+        static void usePSRAMBuffers();      // call before the encoder starts
 
         static uint8_t *getNextInBuffer(size_t *remaining);
             // buffer to stream encoded audio into
         static void advanceInBuffer(size_t bytesused);
             // advances the buffer when the current buffer is full
-
-        static uint8_t *getNextOutBuffer(size_t *bytestostream);
-            // pull out the next buffer that is ready to stream
-            // returns NULL if there is nothing ready to go
-            // advances to the next output buffer automatically
-            // SET this as ToolkitWiFi::setMP3DataStreamFunction(..)
+        static void writeStream(const uint8_t *data, size_t length);
+            // copy into the ring, across buffers (the Opus pages)
+
+        // Random access by sequence number, for readers that keep their
+        // own place in the ring (the uplinks, the local listeners).
+        // Buffer n lives in slot n % number_of_buffers until the
+        // encoder comes round again.
+        // SET these as ToolkitWiFi::setMP3SequenceFunctions(..)
+        static uint32_t getSequenceHead();
+            // the buffer being filled right now, all before it are full
+        static uint32_t getOldestSequence();
+            // the oldest buffer that is safe to read
+        static uint8_t *getBufferBySequence(uint32_t sequence, size_t *length);
+            // NULL if it isn't full yet or has been overwritten
+        static uint8_t *getFillingBuffer(uint32_t *sequence, size_t *length);
+            // the head buffer as far as it has been filled, for readers
+            // that can't wait for all of it (the RTP uplink)
 };
 
 #endif
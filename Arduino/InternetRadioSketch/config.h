@@ -17,7 +17,10 @@
 // Delay times are in milliseconds
 #define RTOS_DELAY_SERVER_TASK      5
 #define RTOS_DELAY_LISTENER_TASK    10
+#define RTOS_DELAY_RELAY_TASK       10
 #define RTOS_DELAY_ENCODER_TASK     30  // smaller=fewer chirps
+#define RTOS_DELAY_STREAM_TASK      5
+#define RTOS_DELAY_SPILL_TASK       100 // a ring buffer is ~250ms of audio
 
 // Set to 1 to run the VLSI streaming tasks at higher
 // priority than the Web/WiFi tasks
@@ -26,6 +29,37 @@
 // still run even when the WiFi server is blocking
 #define RTOS_HIPRIORITY_VLSI 1
 
+// The audio egress (icecast PUT + local mp3 listeners) runs in its own
+// task, away from the HTTP/WS server task, so that a long blocking
+// request (i.e. a POST upload) can't stall the outgoing stream.
+#define RTOS_CORE_STREAM_TASK       1
+#define RTOS_PRIORITY_STREAM_TASK   (1+RTOS_HIPRIORITY_VLSI)
+
+// If the board has PSRAM, keep this many seconds of encoded audio
+// (at 128kbps) so the icecast uplink can catch up after an outage.
+// Without PSRAM, or set to 0, the ring is 3 seconds in internal RAM.
+#define PSRAM_BUFFER_SECONDS        60
+
+// Outages longer than that can spill to flash, see uplink_spill.h
+// (turned on with remote_icecast_spill = 1 in the settings). The spill
+// task runs at the lowest priority, on the same core as the server.
+
+// Set to 1 to build in the Opus encoder (codec = opus in the settings).
+// It needs a fixed point libopus as an Arduino library (one that has
+// <opus.h>), see src/ToolkitVLSI/opus_stream.h. With 0, codec = opus
+// falls back to mp3. A -DUSE_OPUS_ENCODER=1 build flag turns it on too
+// (test/ogg_reference.cpp is built that way).
+#ifndef USE_OPUS_ENCODER
+#define USE_OPUS_ENCODER 0
+#endif
+
+// With codec = opus the encoder task reads PCM, which fills the
+// VS1063a's buffer in ~40ms at 48kHz stereo, so it has to come round
+// faster. The Opus task runs on the other core.
+#define RTOS_DELAY_PCM_TASK         10
+#define RTOS_DELAY_OPUS_TASK        5
+#define RTOS_CORE_OPUS_TASK         0
+
 // Turn on/off use of GPIO input pin controls (volume + switch)
 #define USE_PIN_CONTROLS 1
 
@@ -94,6 +94,88 @@ function startAudio()
     }
 }
 
+//----------------------------------------------------
+// Low latency monitoring .. the mp3 frames come over
+// a websocket as they are encoded, straight into a
+// MediaSource, so there's no stream buffering.
+// (falls back to startAudio() if the browser can't)
+//
+
+let monitorSocket = null;
+
+function startMonitor()
+{
+    let elem = document.getElementById("audio_stream");
+    if (!elem) {
+        return;
+    }
+    if (!window.MediaSource || !MediaSource.isTypeSupported("audio/mpeg")) {
+        startAudio();
+        return;
+    }
+    stopMonitor();
+    let source = new MediaSource();
+    let buffer = null;
+    let frames = [];
+
+    function feed() {
+        if (!buffer || buffer.updating || (0 == frames.length)) {
+            return;
+        }
+        let b = elem.buffered;
+        if (b.length) {
+            let end = b.end(b.length - 1);
+            if (end - elem.currentTime > 0.5) {
+                elem.currentTime = end - 0.1;   // back to the live edge
+            }
+            if (elem.currentTime - b.start(0) > 10) {
+                buffer.remove(b.start(0), elem.currentTime - 5);
+                return;     // feed() again when that's done
+            }
+        }
+        let length = 0;
+        for (let f of frames) {
+            length += f.length;
+        }
+        let data = new Uint8Array(length);
+        length = 0;
+        for (let f of frames) {
+            data.set(f, length);
+            length += f.length;
+        }
+        frames = [];
+        buffer.appendBuffer(data);
+    }
+
+    source.addEventListener("sourceopen", (event) => {
+        buffer = source.addSourceBuffer("audio/mpeg");
+        buffer.mode = "sequence";   // dropped frames just close up
+        buffer.addEventListener("updateend", feed);
+    });
+    elem.src = URL.createObjectURL(source);
+
+    monitorSocket = new WebSocket("ws://" + window.location.host, "toolkit-audio");
+    monitorSocket.binaryType = "arraybuffer";
+    monitorSocket.addEventListener("message", (event) => {
+        // skip the frame number and timestamp
+        frames.push(new Uint8Array(event.data, 8));
+        feed();
+    });
+    monitorSocket.addEventListener("close", (event) => {
+        console.log("Monitor has closed");
+    });
+    elem.play();
+    console.log("Start Monitor");
+}
+
+function stopMonitor()
+{
+    if (monitorSocket) {
+        monitorSocket.close();
+        monitorSocket = null;
+    }
+}
+
 //----------------------------------------------------
 // Functions to deal with the Web-Socket stuff
 //
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+#
+# make_data.py
+#
+# Run this after changing one of the web pages in data/, before
+# building the sketch. It writes src/ToolkitWiFi/default_files/assets.h,
+# the pages built into the sketch (see default_files.h) ..
+#
+#  - each page minified, and that gzipped, as constexpr byte arrays
+#  - their lengths, MIME types and ETags (the same as
+#    asset_cache_makeETag() works out), and the ETag of the page in
+#    data/ as it is, so default_files_begin() can tell if the flash has
+#    the same one
+#  - a perfect hash table of the paths, checked with static_assert, so
+#    finding a path is one hash and one strcmp
+#
+# and data/<page>.gz, the same gzipped bytes, for the flash image. The
+# server sends path.gz from the flash to browsers that take gzip when
+# the flash's page isn't the one built in (see http_file.cpp).
+#
+# The minifying is only what can't break anything, every line is
+# trimmed and blank lines and whole line comments go. Line ends are
+# kept, so JavaScript without semicolons still works.
+#
+# This replaces the hand made data/*.hex, which were
+#
+#   hexdump -ve '1/1 " 0x%02x,"' index.html > index.hex
+#
+# with the spaces (0x20), LFs (0x0a) and CRs (0x0d) taken out and a
+# 0x00 added on the end.
+#
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+PAGES = [
+    # path, file in data/, route, MIME type
+    ("/index.html",  "index.html",  "FILE_IS_INDEX",  "text/html"),
+    ("/toolkit.js",  "toolkit.js",  "FILE_IS_ANY",    "text/javascript"),
+    ("/toolkit.css", "toolkit.css", "FILE_IS_ANY",    "text/css"),
+    ("/upload.html", "upload.html", "FILE_IS_UPLOAD", "text/html"),
+    ("/kiosk.html",  "kiosk.html",  "FILE_IS_ANY",    "text/html"),
+]
+
+# paths that only pick a route, there's no file
+ROUTES = [
+    ("/",            "FILE_IS_ROOT"),
+    ("/upload",      "FILE_IS_UPLOAD"),
+    ("/favicon.ico", "FILE_IS_FAVICON"),
+]
+
+OUTPUT = "src/ToolkitWiFi/default_files/assets.h"
+
+FNV_BASIS = 0x811c9dc5
+FNV_PRIME = 16777619
+
+
+def etag(data):
+    # the first 8 bytes of the SHA-1, in hex, quoted .. as a C string
+    return '"\\"' + hashlib.sha1(data).hexdigest()[:16] + '\\""'
+
+
+def fnv1a(path, seed):
+    # the same as default_files_hash()
+    h = seed
+    for c in path.encode():
+        h = ((h ^ c) * FNV_PRIME) & 0xffffffff
+    return h
+
+
+def minify(name, text):
+    lines = []
+    in_comment = False
+    for line in text.splitlines():
+        line = line.strip()
+        if name.endswith(".css"):
+            line = re.sub(r"/\*.*?\*/", "", line).strip()
+        if in_comment:
+            in_comment = "*/" not in line
+            continue
+        if line.startswith("/*") and not name.endswith(".html"):
+            in_comment = "*/" not in line
+            continue
+        if name.endswith(".js") and line.startswith("//"):
+            continue
+        if line:
+            lines.append(line)
+    return ("\n".join(lines) + "\n").encode()
+
+
+def c_bytes(data):
+    out = []
+    for i in range(0, len(data), 16):
+        out.append(" " + "".join(" 0x%02x," % b for b in data[i:i + 16]))
+    return "\n".join(out)
+
+
+def c_name(path):
+    return "asset_" + re.sub(r"[^a-z0-9]", "_", path[1:].lower())
+
+
+def find_seed(paths, slots):
+    seed = FNV_BASIS
+    while True:
+        used = set(fnv1a(p, seed) & (slots - 1) for p in paths)
+        if len(used) == len(paths):
+            return seed
+        seed = (seed + 1) & 0xffffffff
+
+
+def main():
+    os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+    paths = [p[0] for p in PAGES] + [r[0] for r in ROUTES]
+    slots = 1
+    while slots < (2 * len(paths)):
+        slots *= 2
+    seed = find_seed(paths, slots)
+
+    out = []
+    out.append("//")
+    out.append("// assets.h")
+    out.append("//")
+    out.append("// Made by make_data.py from data/, don't edit it, run that.")
+    out.append("//")
+    out.append("")
+    out.append("enum {")
+    out.append("    DEFAULT_FILES_COUNT     = %d," % len(paths))
+    out.append("    DEFAULT_FILES_SLOTS     = %d" % slots)
+    out.append("};")
+    out.append("")
+    out.append("static constexpr uint32_t default_files_seed = 0x%08xu;" % seed)
+    out.append("")
+
+    entries = []
+    for path, filename, route, mime in PAGES:
+        with open(os.path.join("data", filename), "rb") as f:
+            source = f.read()
+        data = minify(filename, source.decode())
+        # mtime=0 leaves out the time, so the same page gives the same bytes
+        gz = gzip.compress(data, 9, mtime=0)
+        with open(os.path.join("data", filename + ".gz"), "wb") as f:
+            f.write(gz)
+        name = c_name(path)
+
+        out.append("// %s, %d bytes minified from %d, gzip %d"
+            % (path, len(data), len(source), len(gz)))
+        out.append("static constexpr uint8_t %s[] = {" % name)
+        out.append(c_bytes(data))
+        out.append("};")
+        out.append("static constexpr uint8_t %s_gz[] = {" % name)
+        out.append(c_bytes(gz))
+        out.append("};")
+        out.append("")
+        entries.append('    { "%s", %s, "%s",\n'
+            '        %s, %d, %s,\n'
+            '        %s_gz, %d, %s,\n'
+            '        %s },'
+            % (path, route, mime, name, len(data), etag(data),
+                name, len(gz), etag(gz), etag(source)))
+        print("%s %d bytes, minified %d, gzip %d"
+            % (path, len(source), len(data), len(gz)))
+    for path, route in ROUTES:
+        entries.append('    { "%s", %s, NULL, NULL, 0, NULL, NULL, 0, NULL, NULL },'
+            % (path, route))
+
+    out.append("static constexpr default_asset default_assets[DEFAULT_FILES_COUNT] = {")
+    out.extend(entries)
+    out.append("};")
+    out.append("")
+
+    # which asset is in each slot, -1 for none
+    table = [-1] * slots
+    for i, path in enumerate(paths):
+        table[fnv1a(path, seed) & (slots - 1)] = i
+    out.append("static constexpr int8_t default_slots[DEFAULT_FILES_SLOTS] = {")
+    out.append("    " + ", ".join(str(t) for t in table))
+    out.append("};")
+    out.append("")
+    for i, path in enumerate(paths):
+        slot = fnv1a(path, seed) & (slots - 1)
+        out.append('static_assert((default_files_hash("%s", default_files_seed) '
+            '& (DEFAULT_FILES_SLOTS - 1)) == %d, "rerun make_data.py");'
+            % (path, slot))
+    out.append("")
+    out.append("//")
+    out.append("// END OF assets.h")
+
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("%s, %d paths in %d slots" % (OUTPUT, len(paths), slots))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -126,6 +126,18 @@ File ToolkitFiles::fileOpen(const char *path, const char *mode)
     return TOOLFS.open(path, mode);
 }
 
+boolean ToolkitFiles::fileRemove(const char *path)
+{
+    return TOOLFS.remove(path);
+}
+
+size_t ToolkitFiles::freeBytes()
+{
+    size_t total = TOOLFS.totalBytes();
+    size_t used = TOOLFS.usedBytes();
+    return (used < total) ? (total - used) : 0;
+}
+
 //
 // Settings
 const char *SETTINGS_PATHNAME = "/settings.txt";
@@ -40,6 +40,10 @@ class ToolkitFiles
             size_t size, boolean append=false);
 
         static File fileOpen(const char *path, const char *mode);
+        static boolean fileRemove(const char *path);
+
+        // space left on the flash partition
+        static size_t freeBytes();
 
         // These functions read the entire file into big_buffer[]
         // Larger files need to be streamed in chunks.
@@ -48,7 +52,13 @@ class ToolkitFiles
 
         // loading and saving settings uses a static buffer
         enum {
-            MAX_SETTINGS_SIZE = 1024*2
+            MAX_SETTINGS_SIZE = 1024*3
+        };
+
+        // the LittleFS block size (CONFIG_LITTLEFS_BLOCK_SIZE in
+        // esp_littlefs.c), writes of whole blocks don't get split
+        enum {
+            FLASH_BLOCK_SIZE = 4096
         };
 };
 
@@ -65,7 +65,7 @@ class SettingItem
 
         enum {
             ITEM_MAX_NAME_STRING = 32,
-            ITEM_MAX_VALUE_STRING = 32
+            ITEM_MAX_VALUE_STRING = 128     // URLs, and WHIP bearer tokens
         };
 
         static SettingItem *first, *last;
@@ -218,7 +218,7 @@ void ToolkitVLSI::sciWrite(uint8_t addr, uint16_t data)
 ToolkitVS1063::ToolkitVS1063(int8_t cs, int8_t dcs, int8_t dreq)
     : ToolkitVLSI(cs, dcs, dreq)
 {
-    // nothing to do here .. yet!
+    _format = FORMAT_MP3;
 }
 
 #include "VS1063a_patches.h"
@@ -320,6 +320,43 @@ uint16_t ToolkitVS1063::readVUMeter()
     return vuMeter;
 }
 
+//------------------------------------------------------------------------
+//
+// Playback position and rate
+//
+// 32 bit parametric values are low word first. The counter keeps
+// going while we read it, so read the high word either side of the
+// low one and try again if it moved.
+//
+
+uint32_t ToolkitVS1063::getSampleCounter()
+{   // WRAMADDR 0x1e0a-0x1e0b samples played since cleared
+    uint16_t high, low, again;
+    do {
+        sciWrite(VS10xx_SCI_WRAMADDR, 0x1e0b);
+        high = sciRead(VS10xx_SCI_WRAM);
+        sciWrite(VS10xx_SCI_WRAMADDR, 0x1e0a);
+        low = sciRead(VS10xx_SCI_WRAM);
+        sciWrite(VS10xx_SCI_WRAMADDR, 0x1e0b);
+        again = sciRead(VS10xx_SCI_WRAM);
+    } while (high != again);
+    return ((uint32_t) high << 16) | low;
+}
+
+void ToolkitVS1063::clearSampleCounter()
+{
+    sciWrite(VS10xx_SCI_WRAMADDR, 0x1e0a);
+    sciWrite(VS10xx_SCI_WRAM, 0);   // the address steps on by itself
+    sciWrite(VS10xx_SCI_WRAM, 0);
+}
+
+void ToolkitVS1063::setRateTune(int32_t ppm)
+{   // WRAMADDR 0x1e07-0x1e08 playback rate in 1ppm steps
+    sciWrite(VS10xx_SCI_WRAMADDR, 0x1e07);
+    sciWrite(VS10xx_SCI_WRAM, (uint32_t) ppm & 0xffff);
+    sciWrite(VS10xx_SCI_WRAM, (uint32_t) ppm >> 16);
+}
+
 //------------------------------------------------------------------------
 //
 // Encoder basics
@@ -342,8 +379,8 @@ void ToolkitVS1063::encoder_start()
     Serial.println(gu16);
     sciWrite(VS10xx_SCI_AICTRL2, gu16);     // AGC max gain
 
-    // 0x60 is mp3, _channel is stereo or mono modes
-    sciWrite(VS10xx_SCI_AICTRL3, 0x60 | _channel);
+    // 0x60 is mp3 (0x10 pcm), _channel is stereo or mono modes
+    sciWrite(VS10xx_SCI_AICTRL3, _format | _channel);
 
     // 0xE000 is CBR bit rate x1000
     sciWrite(VS10xx_SCI_WRAMADDR, 0xE000 | _kbps);
@@ -422,6 +459,22 @@ uint16_t ToolkitVS1063::encoder_getData(uint8_t *where, uint16_t where_size)
     return bytes_read;
 }
 
+// PCM is one 16 bit sample per word. The VS1063a writes it as a WAV
+// file, big endian words like the mp3 (see encoder_getData) holding
+// little endian samples, so each one is swapped back.
+uint16_t ToolkitVS1063::encoder_getSamples(int16_t *where, uint16_t where_samples)
+{
+    uint16_t words = sciRead(VS10xx_SCI_HDAT1);
+    if (words > where_samples) {
+        words = where_samples;
+    }
+    for (uint16_t i = 0; i < words; i++) {
+        uint16_t w = sciRead(VS10xx_SCI_HDAT0);
+        where[i] = (int16_t) ((w << 8) | (w >> 8));
+    }
+    return words;
+}
+
 void ToolkitVS1063::encoder_updateVolume()
 {
     // gain and AGC
@@ -478,5 +531,10 @@ void ToolkitVS1063::encoder_setSamplerate(uint16_t rate_enum)
     _sample_rate = rate_enum;
 }
 
+void ToolkitVS1063::encoder_setFormat(uint16_t format_enum)
+{   // use FORMAT_ enums
+    _format = format_enum;
+}
+
 //
 // END OF ToolkitVLSI.cpp
@@ -60,10 +60,16 @@ class ToolkitVS1063 : public ToolkitVLSI
     uint16_t enableVUMeter(bool on_not_off); // WRAMADDR 0x1e09 bit 2 meter enable
     uint16_t readVUMeter(); //WRAMADDR 0x1w0c 8 bits left 8 bits right, 0-32 in 3dB steps
 
+  // PLAYBACK: position and fine rate, for synchronised playback
+    uint32_t getSampleCounter();    // WRAMADDR 0x1e0a-b samples played
+    void clearSampleCounter();
+    void setRateTune(int32_t ppm);  // WRAMADDR 0x1e07-8 +faster, -slower
+
     void encoder_start(); // configure the VS10xx /w CBR and start encoding
     void encoder_stop();
     uint16_t encoder_available();   // number of byte available
     uint16_t encoder_getData(uint8_t *where, uint16_t where_size); // even aligned
+    uint16_t encoder_getSamples(int16_t *where, uint16_t where_samples); // FORMAT_PCM
     void encoder_updateVolume(); // send volume changes to the VS1063a
 
   // ENCODER: set parameters
@@ -89,16 +95,22 @@ class ToolkitVS1063 : public ToolkitVLSI
         SAMPLE_48K      = 48000
     };
 
+    enum {  // AICTRL3 bits 7:4
+        FORMAT_PCM      = 0x10, // 16 bit samples, interleaved if stereo
+        FORMAT_MP3      = 0x60
+    };
+
     void encoder_setAGC(float maximum_gain);     // hardware max is 64.0
     void encoder_setBitrate(uint16_t kbps_enum); // use the BITRATE_xxK enums
     void encoder_setChannels(uint16_t channel_enum);  // JOINT_STEREO .. etc
     void encoder_setManualGain(float gain);      // 0.001 to 64.0
     void encoder_setMicNotLine(boolean mic_not_line); // mic is mono
     void encoder_setSamplerate(uint16_t rate_enum);   // use SAMPLE_ enums
+    void encoder_setFormat(uint16_t format_enum);     // use FORMAT_ enums
 
   private:
       float _agc_max_gain, _gain;
-      uint16_t _channel, _kbps, _sample_rate;
+      uint16_t _channel, _kbps, _sample_rate, _format;
       boolean _mic_not_line;
 };
 
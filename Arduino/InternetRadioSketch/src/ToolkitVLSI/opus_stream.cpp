@@ -0,0 +1,213 @@
+//
+// opus_stream.cpp
+
+#include "opus_stream.h"
+#include "../../config.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+#include "../ToolkitWiFi/ogg_opus.h"
+#include "../ToolkitWiFi/whip_output.h"
+
+#if USE_OPUS_ENCODER
+#include <opus.h>
+static OpusEncoder *encoder = NULL;
+#endif
+
+enum {
+    WAV_HEADER_SAMPLES  = 22    // the 44 byte RIFF header, if there is one
+};
+
+static boolean on = false;
+static uint32_t channel_count = 0;
+static void (*write_func)(const uint8_t*, size_t) = NULL;
+
+// the PCM ring .. the encoder task fills frames, the Opus task empties
+// them, each only moves its own count on
+static int16_t *pcm = NULL;
+static size_t frame_size = 0;           // samples, all channels
+static size_t frame_used = 0;           // of the one being filled
+static volatile uint32_t filled = 0;
+static volatile uint32_t encoded = 0;
+static size_t discarded = 0;            // samples thrown away, see capture
+static boolean header_checked = false;
+static uint32_t header_skip = 0;
+
+static uint8_t packet[OPUS_STREAM_MAX_PACKET];
+
+// stats
+static uint32_t stats_frames = 0;
+static uint32_t stats_bytes = 0;
+static uint32_t stats_errors = 0;
+static uint32_t stats_dropped = 0;      // frames of PCM we had no room for
+static uint32_t stats_over = 0;         // frames that took more than 20ms
+static uint64_t stats_total_us = 0;
+static uint32_t stats_worst_us = 0;
+static uint32_t stats_window_us = 0;    // over the last second
+static uint32_t stats_window_frames = 0;
+static uint32_t stats_last_load = 0;    // percent, the last full second
+
+boolean opus_stream_begin(uint32_t channels,
+    void (*write)(const uint8_t*, size_t))
+{
+#if USE_OPUS_ENCODER
+    int error;
+    encoder = opus_encoder_create(OPUS_STREAM_RATE, channels,
+        OPUS_APPLICATION_AUDIO, &error);
+    if (OPUS_OK != error) {
+        Serial.printf("Opus encoder failed (%d), staying with mp3.\n", error);
+        return false;
+    }
+    uint32_t kbps = SettingItem::findUInt("opus_bitrate", OPUS_STREAM_BITRATE);
+    uint32_t complexity = SettingItem::findUInt("opus_complexity",
+        OPUS_STREAM_COMPLEXITY);
+    opus_encoder_ctl(encoder, OPUS_SET_BITRATE(kbps * 1000));
+    opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(complexity));
+    opus_int32 lookahead = 0;
+    opus_encoder_ctl(encoder, OPUS_GET_LOOKAHEAD(&lookahead));
+
+    frame_size = OPUS_STREAM_FRAME_SAMPLES * channels;
+    size_t size = OPUS_STREAM_FRAMES * frame_size * sizeof(int16_t);
+    pcm = (int16_t *) (psramFound() ? ps_malloc(size) : malloc(size));
+    if ((NULL==pcm) || !ogg_opus_begin(channels, lookahead)) {
+        Serial.println("Opus has no memory, staying with mp3.");
+        opus_encoder_destroy(encoder);
+        encoder = NULL;
+        return false;
+    }
+    write_func = write;
+    channel_count = channels;
+    on = true;
+    Serial.printf("Opus %u kbps, %u channels, complexity %u\n",
+        kbps, channels, complexity);
+    return true;
+#else
+    Serial.println("Opus isn't built in (USE_OPUS_ENCODER), staying with mp3.");
+    return false;
+#endif
+}
+
+//------------------------------------------------------------------
+//
+// Capture .. the encoder task
+//
+
+void opus_stream_capture(ToolkitVS1063 *vs)
+{
+    if (!on) {
+        return;
+    }
+    while (true) {
+        if ((filled - encoded) >= OPUS_STREAM_FRAMES) {
+            // the Opus task is behind, empty the VS1063a anyway
+            int16_t discard[256];
+            uint32_t got = vs->encoder_getSamples(discard, 256);
+            if (0==got) {
+                return;
+            }
+            discarded += got;
+            if (discarded >= frame_size) {
+                discarded -= frame_size;
+                stats_dropped++;
+            }
+            continue;
+        }
+        int16_t *frame = &pcm[(filled % OPUS_STREAM_FRAMES) * frame_size];
+        uint32_t got = vs->encoder_getSamples(&frame[frame_used],
+            frame_size - frame_used);
+        if (0==got) {
+            return;
+        }
+        if (!header_checked) {
+            // PCM starts as a WAV file, the header isn't audio
+            header_checked = true;
+            if ((got >= 2) && (0x4952==(uint16_t) frame[0]) &&
+                    (0x4646==(uint16_t) frame[1])) {    // "RIFF"
+                header_skip = WAV_HEADER_SAMPLES;
+            }
+        }
+        if (header_skip) {
+            uint32_t skip = (got < header_skip) ? got : header_skip;
+            memmove(&frame[frame_used], &frame[frame_used + skip],
+                (got - skip) * sizeof(int16_t));
+            got -= skip;
+            header_skip -= skip;
+        }
+        frame_used += got;
+        if (frame_used == frame_size) {
+            frame_used = 0;
+            __sync_synchronize();   // the samples before the count
+            filled++;
+        }
+    }
+}
+
+//------------------------------------------------------------------
+//
+// Encoding .. the Opus task
+//
+
+static void count_time(uint32_t us)
+{
+    stats_total_us += us;
+    if (us > stats_worst_us) {
+        stats_worst_us = us;
+    }
+    if (us > OPUS_STREAM_FRAME_US) {
+        stats_over++;
+    }
+    stats_window_us += us;
+    if (++stats_window_frames >= OPUS_STREAM_LOAD_FRAMES) {
+        stats_last_load = (stats_window_us * 100) /
+            (OPUS_STREAM_LOAD_FRAMES * OPUS_STREAM_FRAME_US);
+        stats_window_us = 0;
+        stats_window_frames = 0;
+    }
+}
+
+void opus_stream_run()
+{
+#if USE_OPUS_ENCODER
+    if (!on) {
+        return;
+    }
+    while (encoded != filled) {
+        int16_t *frame = &pcm[(encoded % OPUS_STREAM_FRAMES) * frame_size];
+        int64_t start = esp_timer_get_time();
+        int32_t length = opus_encode(encoder, frame,
+            OPUS_STREAM_FRAME_SAMPLES, packet, sizeof(packet));
+        count_time(esp_timer_get_time() - start);
+        __sync_synchronize();       // done with the samples
+        encoded++;
+        stats_frames++;
+        if (length < 0) {
+            stats_errors++;
+            continue;
+        }
+        stats_bytes += length;
+        ogg_opus_addPacket(packet, length, OPUS_STREAM_FRAME_SAMPLES, write_func);
+        whip_sendOpus(packet, length, OPUS_STREAM_FRAME_SAMPLES);
+    }
+#endif
+}
+
+uint32_t opus_stream_channels()
+{
+    return on ? channel_count : 0;
+}
+
+void opus_stream_printStats()
+{
+    if (!on) {
+        return;
+    }
+    uint32_t average = stats_frames ? (stats_total_us / stats_frames) : 0;
+    Serial.printf("Opus %u frames, %u bytes, %u errors, %u dropped\n",
+        stats_frames, stats_bytes, stats_errors, stats_dropped);
+    Serial.printf("Opus encode %u us average (%u%% load), %u%% last second, "
+        "worst %u us, %u over 20ms\n", average,
+        (average * 100) / OPUS_STREAM_FRAME_US, stats_last_load,
+        stats_worst_us, stats_over);
+    ogg_opus_printStats();
+}
+
+//
+// END OF opus_stream.cpp
@@ -0,0 +1,66 @@
+//
+// opus_stream.h
+
+//
+// Opus from the VS1063a's PCM, for codec = opus.
+//
+// The VS1063a only encodes mp3 and Ogg Vorbis itself, so for Opus it
+// hands us 48kHz 16 bit PCM instead (AICTRL3 format 1). That's ~24%
+// of the 10MHz SPI bus in stereo (see TOEXPLORE.txt). The encoder
+// task reads it into a ring of 20ms frames, the Opus task on the other
+// core encodes them, and the packets go into Ogg pages (ogg_opus.h) in
+// the stream ring, so the uplinks and local listeners send audio/ogg.
+// The packets also go to the WHIP publisher, see whip_output.h.
+//
+// The encoder is a fixed point libopus, built in with USE_OPUS_ENCODER
+// in config.h (any Arduino libopus that has <opus.h>). Without it
+// codec = opus falls back to mp3.
+//
+// Every frame is timed. The stats give the encoder's share of each
+// 20ms, on average, over the last second and at worst, and how many
+// frames took longer than that, so you can see how much room
+// opus_complexity leaves. If the Opus task falls more than
+// OPUS_STREAM_FRAMES behind, the newest PCM is dropped and counted.
+//
+//  codec               = opus (or mp3, the default)
+//  opus_bitrate        = 64 kbps
+//  opus_complexity     = 3 (0 to 10, higher is better and slower)
+//
+
+#ifndef _OPUS_STREAM_H_
+#define _OPUS_STREAM_H_
+
+#include <Arduino.h>
+#include "ToolkitVLSI.h"
+
+enum {
+    OPUS_STREAM_RATE            = 48000,
+    OPUS_STREAM_FRAME_SAMPLES   = 960,      // 20ms, per channel
+    OPUS_STREAM_FRAME_US        = 20000,
+    OPUS_STREAM_FRAMES          = 8,        // 160ms of PCM waiting
+    OPUS_STREAM_MAX_PACKET      = 1275,
+    OPUS_STREAM_BITRATE         = 64,
+    OPUS_STREAM_COMPLEXITY      = 3,
+    OPUS_STREAM_LOAD_FRAMES     = 50        // a second
+};
+
+// make the encoder and the Ogg headers .. false if Opus isn't built in
+// or there's no memory, the stream stays mp3
+boolean opus_stream_begin(uint32_t channels,
+    void (*write)(const uint8_t*, size_t));
+
+// from the encoder task .. read the PCM the VS1063a has for us
+void opus_stream_capture(ToolkitVS1063 *vs);
+
+// from the Opus task .. encode the frames that are full
+void opus_stream_run();
+
+// 1 or 2, 0 if the stream isn't Opus
+uint32_t opus_stream_channels();
+
+void opus_stream_printStats();
+
+#endif
+
+//
+// END OF opus_stream.h
@@ -1,12 +1,17 @@
 //
 // ToolkitWiFi_Client.cpp
 
+#include <new>
 #include "ToolkitWiFi_Client.h"
 //
 // static variables
 
 uint32_t ToolkitWiFi_Client::_num_clients = 0;
+uint32_t ToolkitWiFi_Client::_max_clients = 0;
 ToolkitWiFi_Client ToolkitWiFi_Client::_client_list[MAX_CLIENTS];
+ToolkitWiFi_Client *ToolkitWiFi_Client::_free_list = NULL;
+boolean ToolkitWiFi_Client::_pool_ready = false;
+portMUX_TYPE ToolkitWiFi_Client::_client_lock = portMUX_INITIALIZER_UNLOCKED;
 
 //
 // object methods
@@ -16,7 +21,22 @@ ToolkitWiFi_Client::ToolkitWiFi_Client()
     client = NULL;
     type = 0;
     millis_last_used = 0;
+    streaming = false;
     closed = NULL;
+    next_free = NULL;
+    buffer = NULL;
+    buffer_size = 0;
+    buffer_used = 0;
+    buffer_type = CONNECTION_BUFFER_NONE;
+    mount = 0;
+    remote_ip = 0;
+    connected_at = 0;
+    bytes_sent = 0;
+    lag_ms = 0;
+    cursor = 0;
+    cursor_sent = 0;
+    last_progress = 0;
+    http_request_init(&request, NULL, 0);
 }
 
 ToolkitWiFi_Client::~ToolkitWiFi_Client()
@@ -24,21 +44,35 @@ ToolkitWiFi_Client::~ToolkitWiFi_Client()
     closeClient();
 }
 
+WiFiClient *ToolkitWiFi_Client::openClient()
+{
+    client = new (socket_storage) WiFiClient();
+    return client;
+}
+
+WiFiClient *ToolkitWiFi_Client::openClient(const WiFiClient &from)
+{
+    client = new (socket_storage) WiFiClient(from);
+    // the request buffer is picked up when the first bytes arrive
+    http_request_init(&request, NULL, 0);
+    return client;
+}
+
 void ToolkitWiFi_Client::closeClient()
 {
     if (client) {
         client->stop();
-        delete(client);
+        client->~WiFiClient();  // it lives in socket_storage
         client = NULL;
     }
-    type = ToolkitWiFi_Client::TYPE_UNUSED;
     millis_last_used = 0;
+    streaming = false;
+    releaseBuffer();
     if (closed) {
         closed();
     }
     closed = NULL;
-    _num_clients--;
-    //Serial.printf("Num clients (closing) = %u\n", _num_clients);
+    releaseClient(this);
 }
 
 boolean ToolkitWiFi_Client::didClientTimeout()
@@ -58,30 +92,105 @@ void ToolkitWiFi_Client::setClientTimedClose()
     type = ToolkitWiFi_Client::TYPE_UNKNOWN;
 }
 
+boolean ToolkitWiFi_Client::changeBuffer(uint32_t new_type,
+    const char *carry, size_t carry_length)
+{
+    char *new_buffer = NULL;
+    size_t new_size = 0;
+    if (CONNECTION_BUFFER_NONE != new_type) {
+        new_buffer = connection_buffer_acquire(new_type, &new_size);
+        if (NULL==new_buffer) {
+            return false;
+        }
+        if (carry_length > new_size) {
+            carry_length = new_size;
+        }
+        if (carry_length > 0) {
+            memcpy(new_buffer, carry, carry_length);
+        }
+    } else {
+        carry_length = 0;
+    }
+    releaseBuffer();
+    buffer = new_buffer;
+    buffer_size = new_size;
+    buffer_used = carry_length;
+    buffer_type = new_type;
+    return true;
+}
+
+void ToolkitWiFi_Client::releaseBuffer()
+{
+    if (buffer) {
+        connection_buffer_release(buffer_type, buffer);
+    }
+    buffer = NULL;
+    buffer_size = 0;
+    buffer_used = 0;
+    buffer_type = CONNECTION_BUFFER_NONE;
+    http_request_init(&request, NULL, 0);
+}
+
 //
 // static methods
 
+// call with _client_lock held
+void ToolkitWiFi_Client::initPool()
+{
+    _free_list = NULL;
+    for (int32_t i = MAX_CLIENTS-1; i >= 0; i--) {
+        _client_list[i].next_free = _free_list;
+        _free_list = &_client_list[i];
+    }
+    _pool_ready = true;
+}
+
+void ToolkitWiFi_Client::releaseClient(ToolkitWiFi_Client *twfc)
+{
+    portENTER_CRITICAL(&_client_lock);
+    // closeClient() can be called more than once on the same slot
+    // (i.e. from the destructor) so only free it if it is in use
+    if (ToolkitWiFi_Client::TYPE_UNUSED != twfc->type) {
+        twfc->type = ToolkitWiFi_Client::TYPE_UNUSED;
+        twfc->next_free = _free_list;
+        _free_list = twfc;
+        _num_clients--;
+    }
+    portEXIT_CRITICAL(&_client_lock);
+}
+
 ToolkitWiFi_Client *ToolkitWiFi_Client::getAnEmptyClient()
 {
-    if (_num_clients < MAX_CLIENTS) {
-        for (uint32_t i = 0; i < MAX_CLIENTS; i++) {
-            if (ToolkitWiFi_Client::TYPE_UNUSED == _client_list[i].type) {
-                _num_clients++;
-                //Serial.printf("Num clients = %u\n", _num_clients);
-                _client_list[i].type = ToolkitWiFi_Client::TYPE_UNKNOWN;
-                return &_client_list[i];
-            }
+    ToolkitWiFi_Client *result = NULL;
+    boolean new_high = false;
+    portENTER_CRITICAL(&_client_lock);
+    if (!_pool_ready) {
+        initPool();
+    }
+    result = _free_list;
+    if (result) {
+        _free_list = result->next_free;
+        result->next_free = NULL;
+        result->type = ToolkitWiFi_Client::TYPE_UNKNOWN;
+        _num_clients++;
+        if (_num_clients > _max_clients) {
+            _max_clients = _num_clients;
+            new_high = true;
         }
     }
-    return NULL;
+    portEXIT_CRITICAL(&_client_lock);
+    if (new_high) {
+        printPoolStats();
+    }
+    return result;
 }
 
 void ToolkitWiFi_Client::acceptNewClient(WiFiClient client)
 { // we do it this way because accept() is passing references not pointers
     if (client) {
         ToolkitWiFi_Client *twfc = getAnEmptyClient();
-        if (twfc) { // copied twfc->client has global scope
-            twfc->client = new WiFiClient(client);  // clone it
+        if (twfc) { // the copy lives in the slot, not on the heap
+            twfc->openClient(client);
         } else {
             Serial.println("Accept .. server is full.");
         }
@@ -92,6 +201,9 @@ void ToolkitWiFi_Client::checkClientList(void(*func)(ToolkitWiFi_Client*))
 {
     for (uint32_t i = 0; i < MAX_CLIENTS; i++) {
         ToolkitWiFi_Client *twfc = &_client_list[i];
+        if (twfc->streaming) {
+            continue;   // the stream task looks after these
+        }
         if (NULL != twfc->client) {
             if (!twfc->client->connected()) {
                 twfc->closeClient();
@@ -106,5 +218,21 @@ void ToolkitWiFi_Client::checkClientList(void(*func)(ToolkitWiFi_Client*))
     } // end of for()
 }
 
+uint32_t ToolkitWiFi_Client::getClientCount()
+{
+    return _num_clients;
+}
+
+uint32_t ToolkitWiFi_Client::getClientHighWater()
+{
+    return _max_clients;
+}
+
+void ToolkitWiFi_Client::printPoolStats()
+{
+    Serial.printf("Clients in use %u of %u, high water %u\n",
+        _num_clients, MAX_CLIENTS, _max_clients);
+}
+
 //
 // END OF ToolkitWiFi_Client.cpp
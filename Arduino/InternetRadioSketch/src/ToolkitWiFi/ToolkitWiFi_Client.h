@@ -7,8 +7,20 @@
 #include <Arduino.h>
 #include <WiFi.h>
 
+#include "http_request.h"
+#include "connection_buffers.h"
+
 //
 // Server client
+//
+// The clients are a fixed pool. Each slot has room for its own
+// WiFiClient, which is constructed in place when the slot is opened
+// and destroyed in place when it is closed, so accepting a connection
+// doesn't touch the heap. Unused slots sit on a free list.
+//
+// A slot only holds a data buffer while its connection type needs one
+// (see connection_buffers.h), so the memory follows the traffic rather
+// than the number of open sockets.
 
 class ToolkitWiFi_Client
 {
@@ -19,7 +31,8 @@ class ToolkitWiFi_Client
             TYPE_GET        = 2,
             TYPE_WEBSOCKET  = 3,
             TYPE_MP3STREAM  = 4,    // a local network listener
-            TYPE_MP3ICECAST = 5     // broadcast to a remote icecast server
+            TYPE_MP3ICECAST = 5,    // (now ToolkitWiFi_Uplink, not a client)
+            TYPE_WSAUDIO    = 6     // a websocket monitor, see ws_audio.h
         };
 
         enum {
@@ -30,24 +43,70 @@ class ToolkitWiFi_Client
             MAX_CLIENTS     = 30
         };
 
-        WiFiClient *client;
+        WiFiClient *client; // points at socket_storage while open
         uint32_t type;
         uint32_t millis_last_used;
+        boolean streaming;  // true once handed off to the stream task
         void (*closed)();   // call this when the client closes
+        http_request request;   // HTTP parser state for this connection
+
+        // borrowed from the pool for this connection's type
+        char *buffer;
+        size_t buffer_size;
+        size_t buffer_used;     // websocket bytes waiting for a full frame
+        uint32_t buffer_type;   // CONNECTION_BUFFER_xxx
+
+        // local listener stats (TYPE_MP3STREAM), see local_icecast.h
+        uint32_t mount;
+        uint32_t remote_ip;
+        uint32_t connected_at;          // millis()
+        volatile uint32_t bytes_sent;
+        volatile uint32_t lag_ms;       // behind the encoder
+        uint32_t cursor;                // next ring buffer to send
+        size_t cursor_sent;             //  .. and how much of it has gone
+        uint32_t last_progress;         // millis() when a byte last went
 
         ToolkitWiFi_Client();
         ~ToolkitWiFi_Client();
 
+        WiFiClient *openClient();   // a new unconnected WiFiClient
+        WiFiClient *openClient(const WiFiClient &from); // copy of an accept()
         void closeClient();
         boolean didClientTimeout();
         void setClientTimedClose();
 
+        // swap to a buffer of another type, keeping the first
+        // carry_length bytes of carry .. false if none are left
+        boolean changeBuffer(uint32_t new_type,
+            const char *carry = NULL, size_t carry_length = 0);
+        void releaseBuffer();
+
         static ToolkitWiFi_Client *getAnEmptyClient();
         static void acceptNewClient(WiFiClient client);
         static void checkClientList(void(*func)(ToolkitWiFi_Client*));
 
-        static uint32_t _num_clients;
+        // pool occupancy
+        static uint32_t getClientCount();
+        static uint32_t getClientHighWater();
+        static void printPoolStats();
+
         static ToolkitWiFi_Client _client_list[MAX_CLIENTS];
+
+    private:
+        static void initPool();
+        static void releaseClient(ToolkitWiFi_Client *twfc);
+
+        alignas(WiFiClient) uint8_t socket_storage[sizeof(WiFiClient)];
+        ToolkitWiFi_Client *next_free;
+
+        static uint32_t _num_clients;
+        static uint32_t _max_clients;   // high water mark
+        static ToolkitWiFi_Client *_free_list;
+        static boolean _pool_ready;
+
+        // the server task and the stream task both open and close
+        // clients, so the free list is guarded by a spinlock
+        static portMUX_TYPE _client_lock;
 };
 
 
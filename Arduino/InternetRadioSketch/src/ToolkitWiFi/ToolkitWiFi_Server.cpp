@@ -4,10 +4,26 @@
 #include "ToolkitWiFi_Server.h"
 #include "websocket.h"
 #include "http_file.h"
-#include "icy_stream.h"
+#include "http_request.h"
+#include "connection_buffers.h"
+#include "ToolkitWiFi_Uplink.h"
+#include "uplink_spill.h"
+#include "local_icecast.h"
+#include "hls_segmenter.h"
+#include "rtp_output.h"
+#include "rtp_receiver.h"
+#include "rtp_uplink.h"
+#include "whip_output.h"
+#include "ws_audio.h"
+#include "asset_cache.h"
+#include "default_files.h"
+#include "ogg_opus.h"
+#include "../ToolkitVLSI/opus_stream.h"
 #include "../ToolkitFiles/ToolkitFiles.h"
 #include "../parsingTools.h"
 
+#include "lwip/sockets.h"
+
 //
 // Everything is static except the constructor
 // It's sort of like a singleton
@@ -25,17 +41,33 @@ static size_t _default_index_size = 0;
 static boolean _dns_server_running = false;
 static DNSServer *_dnsServer = NULL;
 
-        // this is a network connected() state
-        // true if we are connected to the icecast server
-        // false if we disconnect
-static boolean _icecast_is_sending = false;
-static boolean _mp3data_is_ready = false;
-static uint8_t *(*_mp3_data_func)(size_t*) = NULL;
-static uint8_t *_mp3_data = NULL;
-static size_t _mp3_data_length = 0;
+        // the connections to the remote icecast servers,
+        // only the stream task runs them
+static ToolkitWiFi_Uplink _uplinks[ToolkitWiFi_Server::MAX_UPLINKS];
+static uint32_t (*_seq_head_func)() = NULL;
+static uint32_t (*_seq_oldest_func)() = NULL;
+static uint8_t *(*_seq_get_func)(uint32_t, size_t*) = NULL;
+static uint8_t *(*_seq_filling_func)(uint32_t*, size_t*) = NULL;
+static boolean _spilling = false;
 
 static void (*_ws_live_changes_func)(const char*,const char*) = NULL;
 
+        // local mp3 listeners are handed from the server task to the
+        // stream task through this queue. After the handoff only the
+        // stream task reads, writes or closes them.
+static QueueHandle_t _stream_queue = NULL;
+static ToolkitWiFi_Client *_stream_list[ToolkitWiFi_Client::MAX_CLIENTS];
+static uint32_t _num_streams = 0;
+static uint32_t _listener_skips = 0;    // fell behind the ring
+static uint32_t _listener_skipped = 0;  //  .. by this many buffers
+static uint32_t _listener_stalls = 0;   // took nothing, dropped
+
+        // egress pacing, updated by the stream task from what the
+        // uplinks and listeners actually sent
+static uint32_t _egress_last_ms = 0;   // 0 while nobody is sending
+static volatile uint32_t _egress_max_gap = 0;
+static volatile uint32_t _egress_bytes_sent = 0;
+
 ToolkitWiFi_Server::ToolkitWiFi_Server()
 {
     // nothing to do
@@ -54,6 +86,13 @@ ToolkitWiFi_Server::~ToolkitWiFi_Server()
 uint16_t ToolkitWiFi_Server::begin(uint16_t timeout_in_seconds)
 {
     uint16_t result = WIFI_ALL_OKAY;
+    if (NULL==_stream_queue) {
+        _stream_queue = xQueueCreate(MAX_CLIENTS, sizeof(ToolkitWiFi_Client *));
+    }
+    local_icecast_begin();
+    asset_cache_begin();
+    http_file_begin();
+    default_files_begin();
     WiFi.mode(WIFI_STA); // all examples use this mode, even for AP only
     delay(200);
 
@@ -128,8 +167,10 @@ uint16_t ToolkitWiFi_Server::begin(uint16_t timeout_in_seconds)
     return result;
 }
 
-// forward prototype
+// forward prototypes
 static void handleRequest(ToolkitWiFi_Client *twfc);
+static void startOutgoingMP3Stream(ToolkitWiFi_Client *twfc);
+static boolean handleOutgoingMP3Stream(ToolkitWiFi_Client *twfc);
 
 void ToolkitWiFi_Server::run()
 {
@@ -149,18 +190,131 @@ void ToolkitWiFi_Server::run()
     }
 
     //
-    // Check the client list for active requests/streams
+    // Check the client list for active requests
+    // (streams are skipped, they belong to the stream task)
     ToolkitWiFi_Client::checkClientList(handleRequest);
-    if (_mp3_data_func) { // data has been sent to all stream clients
-        _mp3_data = _mp3_data_func(&_mp3_data_length);
-        _mp3data_is_ready = (NULL!=_mp3_data);
-    }
-    // Even if we don't have any mp3 clients, we still want to pull
-    // the data through so we don't get behind the encoder.
-    // If we do have mp3 clients, then if we get behind, we should
-    // eventually catchup (if the WiFi connection is fast enough)
-    // or we may get over-written/mangled (in which case we will
-    // hear a chirp on the mp3 stream, or it will drop out)
+}
+
+// Hand a streaming client over to the stream task
+static void handoffToStreaming(ToolkitWiFi_Client *twfc)
+{
+    twfc->streaming = true;
+    if (pdTRUE != xQueueSend(_stream_queue, &twfc, 0)) {
+        Serial.println("Stream queue is full!");
+        if (ToolkitWiFi_Client::TYPE_MP3STREAM == twfc->type) {
+            local_icecast_closeListener(twfc);
+        }
+        twfc->closeClient();
+    }
+}
+
+void ToolkitWiFi_Server::runStreaming()
+{
+    if (NULL==_stream_queue) { return; }
+
+    //
+    // Pick up any new streams from the server task
+    ToolkitWiFi_Client *twfc;
+    while (pdTRUE == xQueueReceive(_stream_queue, &twfc, 0)) {
+        if (ToolkitWiFi_Client::TYPE_WSAUDIO == twfc->type) {
+            if (!ws_audio_addClient(twfc)) {
+                twfc->closeClient();
+            }
+        } else {
+            startOutgoingMP3Stream(twfc);
+            _stream_list[_num_streams++] = twfc;
+        }
+    }
+
+    //
+    // Send it to the icecast server and all the local listeners
+    uint32_t sent = 0;
+    boolean sending = (_num_streams > 0);
+    for (uint32_t u = 0; u < MAX_UPLINKS; u++) {
+        uint32_t before = _uplinks[u].getBytesSent();
+        _uplinks[u].run();  // each keeps its own place in the ring
+        sent += _uplinks[u].getBytesSent() - before;
+        sending = sending || _uplinks[u].isStreaming();
+    }
+    hls_run();          // so does the HLS segmenter
+    rtp_run();          // and the RTP output
+    rtp_uplink_run();   // and the RTP contribution uplink
+    whip_run();         // and WHIP's signalling and ICE (the Opus task sends)
+    ws_audio_run();     // and the websocket monitors
+    uint32_t i = 0;
+    while (i < _num_streams) {
+        twfc = _stream_list[i];
+        uint32_t before = twfc->bytes_sent;
+        boolean open = (NULL!=twfc->client) && twfc->client->connected() &&
+            handleOutgoingMP3Stream(twfc);
+        sent += twfc->bytes_sent - before;
+        if (!open) {
+            local_icecast_closeListener(twfc);
+            twfc->closeClient();
+            _stream_list[i] = _stream_list[--_num_streams];
+        } else {
+            i++;
+        }
+    }
+
+    //
+    // The gaps between passes that got something out
+    if (!sending) {
+        _egress_last_ms = 0;    // an idle spell isn't a gap
+    } else if (sent) {
+        uint32_t now = millis();
+        if (0!=_egress_last_ms) {
+            uint32_t gap = now - _egress_last_ms;
+            if (gap > _egress_max_gap) {
+                _egress_max_gap = gap;
+            }
+        }
+        _egress_last_ms = now;
+        _egress_bytes_sent += sent;
+    }
+}
+
+void ToolkitWiFi_Server::printStats()
+{
+    ToolkitWiFi_Client::printPoolStats();
+    connection_buffer_printStats();
+    http_request_printStats();
+    asset_cache_printStats();
+    local_icecast_printStats();
+    hls_printStats();
+    rtp_printStats();
+    rtp_receiver_printStats();
+    rtp_uplink_printStats();
+    whip_printStats();
+    ws_audio_printStats();
+    opus_stream_printStats();
+    for (uint32_t u = 0; u < MAX_UPLINKS; u++) {
+        if (ToolkitWiFi_Uplink::STATE_IDLE != _uplinks[u].getState()) {
+            _uplinks[u].printStats();
+        }
+    }
+    spill_printStats();
+    Serial.printf("Listeners fell behind %u times (%u buffers skipped), "
+        "%u dropped for taking nothing\n",
+        _listener_skips, _listener_skipped, _listener_stalls);
+    Serial.printf("Egress sent %u bytes, max gap %u ms\n",
+        _egress_bytes_sent, _egress_max_gap);
+}
+
+void ToolkitWiFi_Server::resetEgressStats()
+{
+    _egress_max_gap = 0;
+    _egress_bytes_sent = 0;
+}
+
+uint32_t ToolkitWiFi_Server::getEgressMaxGap()
+{
+    return _egress_max_gap;
+}
+
+uint32_t ToolkitWiFi_Server::getEgressBytesSent()
+{
+    return _egress_bytes_sent;
 }
 
 void ToolkitWiFi_Server::setDefaultIndexPage(const char *buffer, size_t size)
@@ -174,60 +328,82 @@ void ToolkitWiFi_Server::setDefaultIndexPage(const char *buffer, size_t size)
 // MP3 data stream
 //
 
-void ToolkitWiFi_Server::setMP3DataStreamFunction(uint8_t*(*func)(size_t*))
+void ToolkitWiFi_Server::setMP3SequenceFunctions(uint32_t(*head)(),
+    uint32_t(*oldest)(), uint8_t*(*get)(uint32_t,size_t*))
 {
-    _mp3_data_func = func;
+    _seq_head_func = head;
+    _seq_oldest_func = oldest;
+    _seq_get_func = get;
+    for (uint32_t u = 0; u < MAX_UPLINKS; u++) {
+        _uplinks[u].setNumber(u);
+        _uplinks[u].setSource(head, oldest, get);
+    }
+    if (!ogg_opus_isOn()) {
+        // these cut the ring into mp3 frames
+        hls_begin(head, oldest, get);
+        rtp_begin(head, oldest, get);
+        ws_audio_begin(head, oldest, get);
+    }
 }
 
-// MUST STAY IN THIS CODE FILE!
-static void icyCloseFunction()
+void ToolkitWiFi_Server::setMP3FillingFunction(uint8_t*(*filling)(uint32_t*,size_t*))
 {
-    _icecast_is_sending = false;
+    _seq_filling_func = filling;
 }
 
+// The uplinks connect in the background (see ToolkitWiFi_Uplink.h)
+// and keep reconnecting by themselves if the server goes away.
+// Only the ones with a remote_icecast_url(_n) are started.
 boolean ToolkitWiFi_Server::startIcecastBroadcast() {
-    ToolkitWiFi_Client *twfc = ToolkitWiFi_Client::getAnEmptyClient();
-    if (!twfc) {
-        Serial.println("ToolkitWiFi client list is full!!");
-        return false;
+    if (!_spilling && (1==SettingItem::findUInt("remote_icecast_spill", 0))) {
+        _spilling = spill_begin(_seq_head_func, _seq_oldest_func, _seq_get_func);
     }
-
-    // connect to the remote icecast server
-    WiFiClient *client = new WiFiClient();
-    if (!client) {
-        Serial.println("Cannot create new WiFiClient!");
-        twfc->closeClient();
-        return false;
+    boolean started = false;
+    if (_seq_filling_func && !ogg_opus_isOn()) {
+        // it cuts the ring into mp3 frames too
+        started = rtp_uplink_begin(_seq_head_func, _seq_oldest_func,
+            _seq_get_func, _seq_filling_func);
     }
-    const char *url = SettingItem::findString("remote_icecast_url");
-    uint16_t port = SettingItem::findUInt("remote_icecast_port",8000);
-    Serial.printf("ICY connecting .. %s:%u\n", url, port);
-    if (!client->connect(url, port))
-    {
-        Serial.println("Failed to connect to remote icecast server!");
-        delete(client);
-        twfc->closeClient();
-        return false;
+    if (SettingItem::findUInt("remote_whip", 0)) {
+        started = whip_begin(opus_stream_channels()) || started;
     }
-    // send headers and wait for OK reply
-    _icecast_is_sending = icy_start_stream(client);
-    if (!_icecast_is_sending) {
-        client->stop();
-        delete(client);
-        twfc->closeClient();
-    } else {
-        twfc->client = client;
-        twfc->type = ToolkitWiFi_Client::TYPE_MP3ICECAST;
-        twfc->closed = icyCloseFunction;
+    for (uint32_t u = 0; u < MAX_UPLINKS; u++) {
+        if (_uplinks[u].isConfigured()) {
+            _uplinks[u].start();
+        }
+        if (ToolkitWiFi_Uplink::STATE_IDLE != _uplinks[u].getState()) {
+            started = true;
+        }
     }
-    return _icecast_is_sending;
+    return started;
+}
+
+// Only the spill task writes to the flash log, so a slow block write
+// never holds up the stream task.
+void ToolkitWiFi_Server::runSpill()
+{
+    if (!_spilling) {
+        return;
+    }
+    // keep what the furthest behind uplink still needs
+    uint32_t needed = 0xffffffff;
+    for (uint32_t u = 0; u < MAX_UPLINKS; u++) {
+        uint32_t n = _uplinks[u].getNeeded();
+        if (n < needed) {
+            needed = n;
+        }
+    }
+    spill_run(needed);
 }
 
-// WE CAN ALSO keep a direct link to this client
-// so that we can check to see if it disconnects
 boolean ToolkitWiFi_Server::isIcecastBroadcastStillConnected()
 {
-    return _icecast_is_sending;
+    for (uint32_t u = 0; u < MAX_UPLINKS; u++) {
+        if (_uplinks[u].isStreaming()) {
+            return true;
+        }
+    }
+    return false;
 }
 
 //------------------------------------------------------------------
@@ -236,43 +412,26 @@ boolean ToolkitWiFi_Server::isIcecastBroadcastStillConnected()
 //      UNKNOWN (froma new connection)
 //      WEBSOCKET   .. websocket to a local portal page
 //      MP3STREAM   .. stream to a local portal page
-//      MP3ICECAST  .. stream to an icecast server
 //
 
 //
-// Buffer for incoming request packets
-
-#define MAX_PACKET_SIZE 1024   // incoming packets
-static char http_buffer[MAX_PACKET_SIZE];
-
-//------------------------------------------------------------------
-//
-// Send infinite headers for a new outgoing MP3 stream
-//
-
-// Used by handleUnknownRequest
-static void http_send_infinite(ToolkitWiFi_Client *twfc, bool okay, const char *type) {
-//  const char nocache[] =
-//      "Cache-Control: no-cache, no-store, must-revalidate\nPragma: no-cache\nExpires: 0\n";
-    const char nocache[] =
-        "Cache-Control: no-cache, no-store\nPragma: no-cache\nExpires: 0\n";
-    int response = 200;
-    if (!okay) response = 404;
-	twfc->client->printf(
-        "HTTP/1.1 %d OK\nContent-Type: %s\n%s\n",
-        response, type, nocache);
-}
+// Each connection reads into its own buffer (see connection_buffers.h)
+//  HTTP      .. [ request header | file streaming ]
+//  WEBSOCKET .. incoming frames, the settings going out
 
 //------------------------------------------------------------------
 //
 // HANDLE GET REQUEST
 //
 
-static void handleGetRequest(ToolkitWiFi_Client *twfc, const char *path)
+// The file is sent from the part of the connection's buffer after
+// the request header, so pipelined requests are left alone.
+static void handleGetRequest(ToolkitWiFi_Client *twfc, http_request *r,
+    const char *path)
 {
-    http_handleGetRequest(twfc, path,
+    http_handleGetRequest(twfc, r, path,
         _default_index, _default_index_size,
-        http_buffer, MAX_PACKET_SIZE);
+        twfc->buffer + HTTP_HEADER_SIZE, HTTP_IO_SIZE);
 }
 
 //------------------------------------------------------------------
@@ -280,18 +439,27 @@ static void handleGetRequest(ToolkitWiFi_Client *twfc, const char *path)
 // HANDLE POST REQUEST
 //
 
-// We want to parse the incoming buffer .. which will contain the headers
-// and the first part of the data.
+// The request parser has the headers and the first part of the data.
 // Then we want to load in more chunks of data until we reach the
 // end boundary.
 
-// The header and start boundary should fit inside 1024 bytes
-// then we can push the rest through as a stream of 1024 bytes at a time
+// The header and start boundary should fit inside the request part
+// of the buffer, then we can push the rest through as a stream,
+// reusing the whole buffer since we are finished with the header.
 
-static void handlePostRequest(ToolkitWiFi_Client *twfc,
-    const char *buffer, size_t size)
+static void handlePostRequest(ToolkitWiFi_Client *twfc, http_request *r)
 {
-    http_handlePostRequest(twfc, http_buffer, size, MAX_PACKET_SIZE);
+    // the upload blocks the server task until it is finished,
+    // check that the stream task kept the uplinks and listeners going
+    uint32_t start_t = millis();
+    ToolkitWiFi_Server::resetEgressStats();
+    http_handlePostRequest(twfc, r->path, r->body, r->body_length,
+        twfc->buffer, twfc->buffer_size);
+    http_request_reset(r);  // the upload has used the whole buffer
+    Serial.printf("POST took %u ms .. egress sent %u bytes, max gap %u ms\n",
+        millis() - start_t,
+        ToolkitWiFi_Server::getEgressBytesSent(),
+        ToolkitWiFi_Server::getEgressMaxGap());
 }
 
 //------------------------------------------------------------------
@@ -320,50 +488,102 @@ static void handleWebSocketMessage(ToolkitWiFi_Client *twfc)
     // messages should be of the form <setting_name> = <value>
     size_t avail = twfc->client->available();
     if (avail <= 0) { return; }
-    if (avail > (MAX_PACKET_SIZE-1)) {
-        avail = MAX_PACKET_SIZE - 1;
-        Serial.println("WS - INCOMING PACKET IS TOO BIG!");
+    size_t space = twfc->buffer_size - twfc->buffer_used;
+    if (0==space) {
+        Serial.println("WS - INCOMING FRAME IS TOO BIG!");
+        twfc->closeClient();
+        return;
+    }
+    if (avail > space) {
+        avail = space;
     }
-    twfc->client->readBytes(http_buffer, avail);
+    twfc->buffer_used += twfc->client->readBytes(
+        twfc->buffer + twfc->buffer_used, avail);
 
-    if (!websocket_handleIncoming(twfc, http_buffer, avail)) {
+    size_t used;
+    if (!websocket_handleIncoming(twfc, twfc->buffer, twfc->buffer_used, &used)) {
         twfc->closeClient();
+        return;
+    }
+    // keep a partial frame until the rest arrives
+    if (used > 0) {
+        twfc->buffer_used -= used;
+        memmove(twfc->buffer, twfc->buffer + used, twfc->buffer_used);
     }
 }
 
 //------------------------------------------------------------------
 //
-// HANDLE Outgoing MP3 Stream .. send to icecast and local listeners
+// HANDLE Outgoing MP3 Stream .. send to local listeners
 //
 
-// USES http_buffer which is defined in this file
-static void handleOutgoingMP3Stream(ToolkitWiFi_Client *twfc)
+// Each listener keeps its own place in the ring (see Streamer.h) and
+// gets what its socket will take without waiting, so a slow one only
+// holds itself up. One that falls behind the ring skips to the newest
+// buffer .. a glitch, which is better than a stream that never catches up.
+
+static void startOutgoingMP3Stream(ToolkitWiFi_Client *twfc)
 {
-    // if we have MP3 data in the buffer then send it out
-    if (_mp3data_is_ready) {
-        // write() will try to send the data up to 10 times
-        // then it will fail if there's something wrong with the
-        // TCP connection.
-        size_t actual = twfc->client->write(_mp3_data, _mp3_data_length);
-        if (actual != _mp3_data_length) {
-            Serial.printf("Error sending mp3 stream .. %u bytes sent out of %u\n",
-                actual, _mp3_data_length);
-        }
+    int fd = twfc->client->fd();
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    uint32_t head = _seq_head_func ? _seq_head_func() : 0;
+    twfc->cursor = head ? (head - 1) : 0;   // start on the newest one
+    twfc->cursor_sent = 0;
+    twfc->last_progress = millis();
+}
+
+// false if the listener has to go
+static boolean handleOutgoingMP3Stream(ToolkitWiFi_Client *twfc)
+{
+    if (NULL==_seq_get_func) {
+        return true;
     }
-    if (ToolkitWiFi_Client::TYPE_MP3ICECAST==twfc->type) {
-        // check for messages from the server and clear
-        // the input buffer.
-        // static char http_buffer[MAX_PACKET_SIZE];
-        size_t avail = twfc->client->available();
-        if (avail > 0) {
-            if (avail > (MAX_PACKET_SIZE-1)) {
-                avail = MAX_PACKET_SIZE-1;
+    int fd = twfc->client->fd();
+    uint32_t now = millis();
+    uint32_t kbps = ogg_opus_bitrate();
+    while (true) {
+        uint32_t head = _seq_head_func();
+        if (twfc->cursor >= head) {
+            twfc->lag_ms = 0;
+            twfc->last_progress = now;  // it has everything, nothing to time out
+            break;          // at the live edge, wait for the encoder
+        }
+        if (twfc->cursor < _seq_oldest_func()) {
+            _listener_skips++;
+            _listener_skipped += (head - 1) - twfc->cursor;
+            twfc->cursor = head - 1;
+            twfc->cursor_sent = 0;
+        }
+        size_t length;
+        uint8_t *data = _seq_get_func(twfc->cursor, &length);
+        if (NULL==data) {
+            continue;       // overwritten since we looked, go round again
+        }
+        twfc->lag_ms = kbps ? (uint32_t) (((uint64_t) (head - twfc->cursor) *
+            length * 8) / kbps) : 0;
+
+        int sent = ::send(fd, data + twfc->cursor_sent,
+            length - twfc->cursor_sent, MSG_DONTWAIT);
+        if (sent <= 0) {
+            if ((sent < 0) && (EAGAIN!=errno) && (EWOULDBLOCK!=errno)) {
+                return false;
             }
-            twfc->client->readBytes(http_buffer, avail);
-            http_buffer[avail] = 0;
-            Serial.printf("ICY SERVER SAYS: %s\n", http_buffer);
+            break;          // the socket is full, try again next time
         }
+        twfc->bytes_sent += sent;
+        twfc->last_progress = now;
+        twfc->cursor_sent += sent;
+        if (twfc->cursor_sent >= length) {
+            twfc->cursor++;
+            twfc->cursor_sent = 0;
+        }
+    }
+    // only one with data waiting and a full socket gets this far
+    if ((now - twfc->last_progress) > ToolkitWiFi_Server::LISTENER_STALL_MS) {
+        _listener_stalls++;
+        return false;
     }
+    return true;
 }
 
 //------------------------------------------------------------------
@@ -375,62 +595,59 @@ static void handleOutgoingMP3Stream(ToolkitWiFi_Client *twfc)
 // GET /generate_204 HTTP/1.1   -> reply with index.html
 // ignore POST requests         -> reply with 200 OK ??
 // GET /toolkit.mp3 HTTP/1.1    -> reply with infinite header
+// GET /status-json.xsl         -> icecast style listener stats
 // WS request has a Sec-WebSocket-Key header -> reply with WS handshake
+//  .. and asks for the toolkit-audio protocol -> a monitor, see ws_audio.h
 
 enum {
     RESPONSE_IGNORE,
     RESPONSE_WEBSOCKET,
+    RESPONSE_WS_AUDIO,
     RESPONSE_INDEX,
     RESPONSE_MP3,
+    RESPONSE_STATUS,
     RESPONSE_FILE,
     RESPONSE_POST
 };
 
-// parse the header to figure out what type we are
+// the header has been parsed (see http_request.cpp)
+// figure out what type we are
 // Look for GET <filename> or POST
 // if web-socket handshake -> WS stuff
 // if /favicon.ico -> ignore OR just let it go through as a file
 // if / or /generate_204 -> send index.html
-// if /*.mp3 -> send infinite header and setup as MP3 stream
+// if a mountpoint or /*.mp3 -> send infinite header and setup as MP3 stream
+// if /status-json.xsl -> listener stats, like icecast
 // else load and send file or 404
 
-static int whatisit(char *buffer, size_t size, char **path)
+static int whatisit(http_request *r)
 {
-    buffer[size] = 0;
-
-    // Serial.println("=====================");
-    // Serial.println(buffer);
-    // Serial.println("=====================");
-
-    char *get = strtok(buffer, " ");
-    if (NULL==get) {
-        return RESPONSE_IGNORE;
-    } else if (0 == strcmp("POST", get)) {
-        buffer[4] = ' ';    // replace the strtok \0 with a space character
+    if (HTTP_METHOD_POST == r->method) {
         return RESPONSE_POST;
-    } else if (0 != strcmp("GET", get)) {
+    } else if (HTTP_METHOD_GET != r->method) {
         return RESPONSE_IGNORE;
     }
 
-    size_t getsize = strlen(get) + 1;
-    buffer = get + getsize;
-    size = size - getsize;
-
-    const char *ws_key = websocket_isWSHeader(buffer, size);
-    if (ws_key) { // web socket open request
+    if (r->ws_key) { // web socket open request
+        if (ws_audio_protocol(r->ws_protocol)) {
+            return RESPONSE_WS_AUDIO;
+        }
         return RESPONSE_WEBSOCKET;
     }
 
-    *path = strtok(NULL, " ");
-    if (NULL==path) {
-        return RESPONSE_IGNORE;
+    if (hls_isPath(r->path)) {
+        return RESPONSE_FILE;   // short objects, see hls_segmenter.h
     }
-
-    char *dot = strrchr(*path, '.');
-    if (dot && dot[1]) {
-        if (0 == strcmp("mp3", &dot[1])) {
-            return RESPONSE_MP3;
-        }
+    if (local_icecast_isMount(r->path)) {
+        return RESPONSE_MP3;    // even if the flash has a file of that name
+    }
+    if (local_icecast_findMount(r->path) >= 0) {
+        // a recording on the flash (see uplink_spill.h) is a file,
+        // any other .mp3 is the live stream
+        return ToolkitFiles::fileExists(r->path) ? RESPONSE_FILE : RESPONSE_MP3;
+    }
+    if (local_icecast_isStatus(r->path)) {
+        return RESPONSE_STATUS;
     }
 
     // all missing files will default to index.html
@@ -438,61 +655,156 @@ static int whatisit(char *buffer, size_t size, char **path)
     return RESPONSE_FILE;
 }
 
-//------------------------------------------------------------------
-//
-// HANDLE Unknown Request Type
-//
-
-// USES http_buffer which is defined in this file!
-static void handleUnknownRequest(ToolkitWiFi_Client *twfc)
+// A POST waits until the start of the multipart body is in the
+// buffer (or the buffer is full), so that the boundary and the
+// filename can be found.
+static boolean waitingForBody(http_request *r)
 {
-    // if bytes are available, read the data into a largish internal buffer
-    // add a NULL character to the end of the buffer so we can use c-string
-
-    size_t avail = twfc->client->available();
-    if (avail <= 0) { return; }
-    if (avail > (MAX_PACKET_SIZE-1)) {
-        avail = MAX_PACKET_SIZE - 1;
-        //Serial.println("INCOMING PACKET IS TOO BIG!");
-        //Packets are streamed for POST requests
-        //All other packets should fit in 1024 bytes
+    if (HTTP_METHOD_POST != r->method) {
+        return false;
     }
+    size_t want = r->content_length;
+    size_t room = r->size - 1 - r->header_length;   // HTTP_HEADER_SIZE
+    if (want > room) {
+        want = room;
+    }
+    return (r->body_length < want);
+}
 
-    twfc->millis_last_used = 0; // reset the timer when a new request comes in
-
+// Answer one complete request.
+// Returns true if the connection is still HTTP and we should go on
+// to the next pipelined request. Returns false if it was closed or
+// has become a websocket or an mp3 stream.
+static boolean respond(ToolkitWiFi_Client *twfc, http_request *r)
+{
     const char indexfile[] = "/index.html";
-    char *path = NULL;
-    twfc->client->readBytes(http_buffer, avail);
-    switch (whatisit(http_buffer, avail, &path)) {
+    const char *path = r->path;
+    switch (whatisit(r)) {
         case RESPONSE_WEBSOCKET :
         {   // Serial.println("Request for Web Socket");
-            twfc->type = ToolkitWiFi_Client::TYPE_WEBSOCKET;
-            const char *ws_key = websocket_getClientKey();
+            // the key points into the HTTP buffer, so make the reply
+            // before we swap it for a websocket buffer (any frames
+            // that came in behind the request are carried over)
             uint32_t reply_length;
-            char *reply = websocket_handshake(ws_key, &reply_length);
+            char *reply = websocket_handshake(r->ws_key, NULL, &reply_length);
+            if (!twfc->changeBuffer(CONNECTION_BUFFER_WEBSOCKET,
+                    r->body, r->body_length)) {
+                Serial.println("No websocket buffers left!");
+                free(reply);
+                twfc->closeClient();
+                return false;
+            }
+            twfc->type = ToolkitWiFi_Client::TYPE_WEBSOCKET;
             twfc->client->write(reply,reply_length);
             free(reply);
             websocket_sendSettings(twfc);
-        }   break;
+        }   return false;
+        case RESPONSE_WS_AUDIO :
+        {   // monitors only get audio, they don't need a buffer
+            uint32_t reply_length;
+            char *reply = websocket_handshake(r->ws_key,
+                ws_audio_protocol(r->ws_protocol), &reply_length);
+            twfc->type = ToolkitWiFi_Client::TYPE_WSAUDIO;
+            twfc->client->write(reply,reply_length);
+            free(reply);
+            twfc->releaseBuffer();
+            handoffToStreaming(twfc);
+        }   return false;
         case RESPONSE_MP3 :
             // Serial.println("Request for MP3 Stream");
             twfc->type = ToolkitWiFi_Client::TYPE_MP3STREAM;
-            http_send_infinite(twfc, true, "audio/mpeg");
-            break;
+            local_icecast_startListener(twfc, local_icecast_findMount(path));
+            twfc->releaseBuffer();  // listeners don't read anything
+            handoffToStreaming(twfc);
+            return false;
+        case RESPONSE_STATUS :
+            // no length up front, so the end of the reply is the close
+            local_icecast_sendStatus(twfc,
+                twfc->buffer + HTTP_HEADER_SIZE, HTTP_IO_SIZE);
+            twfc->closeClient();
+            return false;
         case RESPONSE_INDEX :
             // Serial.println("Request for HTML Index");
-            path = (char *) indexfile;
+            path = indexfile;
         case RESPONSE_FILE :
             Serial.printf("Request for file %s\n", path);
-            handleGetRequest(twfc, (char *) path);
+            handleGetRequest(twfc, r, path);
             break;
         case RESPONSE_POST :
-            handlePostRequest(twfc, http_buffer, avail);
+            handlePostRequest(twfc, r);
             break;
         case RESPONSE_IGNORE :
             // Serial.println("Request for Ignore");
             twfc->closeClient();
-            break;
+            return false;
+    }
+
+    // keep-alive connections stay open for CLOSE_TIMEOUT after
+    // the last request (see setClientTimedClose())
+    if (!r->keep_alive) {
+        twfc->closeClient();
+        return false;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// HANDLE Unknown Request Type
+//
+
+// Any connection that isn't a websocket or a stream yet.
+// Read whatever has arrived into the connection's request buffer
+// and answer every complete request in it.
+// The buffer is only held while there is a request to work on, so
+// idle keep-alive connections don't tie one up. If they are all in
+// use the bytes wait in the socket until one is free.
+static void handleUnknownRequest(ToolkitWiFi_Client *twfc)
+{
+    http_request *r = &twfc->request;
+
+    size_t avail = twfc->client->available();
+    if (NULL==twfc->buffer) {
+        if ((0==avail) || !twfc->changeBuffer(CONNECTION_BUFFER_HTTP)) {
+            return;
+        }
+        http_request_init(r, twfc->buffer, HTTP_HEADER_SIZE);
+    }
+    if (avail > 0) {
+        char *where;
+        size_t space = http_request_space(r, &where);
+        if (avail > space) {
+            avail = space;
+        }
+        if (avail > 0) {
+            http_request_add(r, twfc->client->readBytes(where, avail));
+            // a request that stops half way gets the usual timeout
+            twfc->millis_last_used = millis();
+        }
+    }
+
+    while (true) {
+        switch (http_request_parse(r)) {
+            case HTTP_REQUEST_INCOMPLETE :
+                if (0==r->used) {
+                    twfc->releaseBuffer();
+                }
+                return;     // wait for more bytes
+            case HTTP_REQUEST_TOO_BIG :
+            case HTTP_REQUEST_BAD :
+                twfc->closeClient();
+                return;
+        }
+        if (waitingForBody(r)) {
+            return;
+        }
+        twfc->millis_last_used = 0; // reset the timer while we answer
+        if (!respond(twfc, r)) {
+            return;
+        }
+        // start the keep-alive timer
+        twfc->millis_last_used = millis();
+        http_request_next(r, 0);
     }
 }
 
@@ -510,10 +822,8 @@ static void handleRequest(ToolkitWiFi_Client *twfc)
         case ToolkitWiFi_Client::TYPE_WEBSOCKET :
             handleWebSocketMessage(twfc);
             break;
-        case ToolkitWiFi_Client::TYPE_MP3STREAM :
-        case ToolkitWiFi_Client::TYPE_MP3ICECAST :
-            handleOutgoingMP3Stream(twfc);
-            break;
+        // TYPE_MP3STREAM is handled by the stream task,
+        // see runStreaming()
     } // end of switch()
 }
 
@@ -16,6 +16,7 @@
 #include <DNSServer.h>
 
 #include "ToolkitWiFi_Client.h"
+#include "mp3_chunk.h"
 
 //
 // The server object
@@ -38,6 +39,17 @@ class ToolkitWiFi_Server
             HTTP_PORT       = 80
         };
 
+        // icecast servers we can stream to at once, each with its own
+        // remote_icecast_xxx settings (xxx_2, xxx_3 for the others)
+        enum {
+            MAX_UPLINKS     = 3
+        };
+
+        // a local listener that takes nothing for this long is dropped
+        enum {
+            LISTENER_STALL_MS   = 10000
+        };
+
         enum {
             MAX_CONNECTIONS = 30,
             MAX_CLIENTS     = 30,
@@ -47,20 +59,50 @@ class ToolkitWiFi_Server
         // timeout for connecting to the local WiFi router
         static uint16_t begin(uint16_t timeout_in_seconds=60);
 
-        // main server run function
+        // main server run function .. DNS, accepts, HTTP and WS
         static void run();
 
+        // audio egress run function .. icecast PUT and local mp3
+        // listeners. Run this from its own task so that blocking
+        // HTTP requests don't stall the outgoing stream.
+        static void runStreaming();
+
         // in case there is no index.html on the flash drive
         // you can set a default block of text
         static void setDefaultIndexPage(const char *buffer, size_t size);
 
-        // function that the server uses to get the next available
-        // mp3 data buffer
-        static void setMP3DataStreamFunction(uint8_t*(*func)(size_t*));
+        // functions the icecast uplink uses to read the mp3 buffers
+        // by sequence number, so it can resume after a reconnect
+        // (see Streamer::getBufferBySequence)
+        static void setMP3SequenceFunctions(uint32_t(*head)(),
+            uint32_t(*oldest)(), uint8_t*(*get)(uint32_t,size_t*));
+
+        // and the one the RTP uplink uses to read the buffer that's
+        // still being filled (see Streamer::getFillingBuffer)
+        static void setMP3FillingFunction(uint8_t*(*filling)(uint32_t*,size_t*));
 
         // connect to icy and start streaming
+        // this only starts the uplink, it connects (and reconnects)
+        // in the background from the stream task
         static boolean startIcecastBroadcast();
-        static boolean isIcecastBroadcastStillConnected();
+        static boolean isIcecastBroadcastStillConnected();  // any of them
+
+        // uplink store and forward .. copies the buffers the uplink
+        // hasn't sent to flash before the encoder overwrites them
+        // (remote_icecast_spill = 1). Run this from its own low
+        // priority task, flash writes can take a while.
+        static void runSpill();
+
+        // egress pacing .. the largest gap (in milliseconds) between
+        // bytes going out to the uplinks or the local listeners, while
+        // any are connected, since the last reset
+        static void resetEgressStats();
+        static uint32_t getEgressMaxGap();
+        static uint32_t getEgressBytesSent();
+
+        // print the server statistics to Serial
+        // (also sent from a WS client as $STATS)
+        static void printStats();
 
         // function to forward incoming WS volume control messages
         // to the VLSI chip
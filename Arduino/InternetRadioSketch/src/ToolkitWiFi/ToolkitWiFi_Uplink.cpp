@@ -0,0 +1,713 @@
+//
+// ToolkitWiFi_Uplink.cpp
+
+#include "ToolkitWiFi_Uplink.h"
+#include "ToolkitWiFi_Server.h"
+#include "connection_buffers.h"
+#include "icy_stream.h"
+#include "ogg_opus.h"
+#include "uplink_spill.h"
+#include "../ToolkitFiles/ToolkitFiles.h"
+
+#include "lwip/sockets.h"
+#include "lwip/tcpip.h"
+
+static const char *state_names[ToolkitWiFi_Uplink::STATES] = {
+    "IDLE", "DNS", "CONNECTING", "SEND_HEADERS",
+    "AWAIT_STATUS", "STREAMING", "BACKOFF"
+};
+
+// upper limits of the histogram buckets, in milliseconds
+static const uint32_t bucket_limits[ToolkitWiFi_Uplink::HISTOGRAM_BUCKETS] = {
+    50, 100, 200, 500, 1000, 2000, 5000, 0xffffffff
+};
+
+// dns_done and dns_ip are written by lwip's task
+static portMUX_TYPE dns_lock = portMUX_INITIALIZER_UNLOCKED;
+
+ToolkitWiFi_Uplink::ToolkitWiFi_Uplink()
+{
+    number = 0;
+    suffix[0] = 0;
+    tag[0] = 0;
+    state = STATE_IDLE;
+    state_started = 0;
+    attempt_started = 0;
+    handshake_started = 0;
+    backoff = BACKOFF_MIN;
+    method = ICY_METHOD_PUT_CHUNKED;
+    fd = -1;
+    dns_asked = false;
+    dns_done = false;
+    dns_ip = 0;
+    ip = 0;
+    port = 0;
+    request_length = 0;
+    request_sent = 0;
+    reply = NULL;
+    reply_size = 0;
+    reply_used = 0;
+    ring_head = NULL;
+    ring_oldest = NULL;
+    ring_get = NULL;
+    have_bookmark = false;
+    cursor = 0;
+    buffer_length = 0;
+    pending = NULL;
+    pending_length = 0;
+    pending_sent = 0;
+    spill_buffer = NULL;
+    catchup = CATCHUP_DEFAULT;
+    next_burst = 0;
+    stall_ms = STALL_DEFAULT;
+    byte_rate = 128000/8;
+    allowance_ms = 0;
+    last_progress = 0;
+    lost_at_start = 0;
+    attempts = 0;
+    streams = 0;
+    failures = 0;
+    lost = 0;
+    resumed = 0;
+    caught_up = 0;
+    from_flash = 0;
+    bytes_sent = 0;
+    memset(&connect_ms, 0, sizeof(connect_ms));
+    memset(&handshake_ms, 0, sizeof(handshake_ms));
+    stalls = 0;
+    stall_worst_ms = 0;
+    memset(&last_stall, 0, sizeof(last_stall));
+}
+
+// Uplink 0 uses the remote_icecast_xxx settings, the others add
+// _2, _3 .. to the names (remote_icecast_url_2 and so on)
+void ToolkitWiFi_Uplink::setNumber(uint32_t n)
+{
+    number = n;
+    if (0==n) {
+        suffix[0] = 0;
+        tag[0] = 0;
+    } else {
+        sprintf(suffix, "_%u", n+1);
+        sprintf(tag, " %u", n+1);
+    }
+}
+
+// Anything but the url falls back to the plain setting, so i.e. a
+// backup server can share the password of the main one.
+const char *ToolkitWiFi_Uplink::findSetting(const char *name, boolean fallback)
+{
+    char key[ToolkitWiFi_Uplink::SETTING_NAME_SIZE];
+    snprintf(key, sizeof(key), "%s%s", name, suffix);
+    const char *value = SettingItem::findString(key);
+    if ((NULL==value) && fallback) {
+        value = SettingItem::findString(name);
+    }
+    return value;
+}
+
+uint16_t ToolkitWiFi_Uplink::findSettingUInt(const char *name,
+    uint16_t default_value)
+{
+    const char *value = findSetting(name);
+    return value ? (uint16_t) atoi(value) : default_value;
+}
+
+boolean ToolkitWiFi_Uplink::isConfigured()
+{
+    const char *url = findSetting("remote_icecast_url", false);
+    return (url && url[0]);
+}
+
+void ToolkitWiFi_Uplink::setSource(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*))
+{
+    ring_head = head;
+    ring_oldest = oldest;
+    ring_get = get;
+}
+
+void ToolkitWiFi_Uplink::start()
+{
+    if ((STATE_IDLE != state) || (NULL==ring_get)) {
+        return;
+    }
+    if (NULL==reply) {  // kept for as long as we live
+        reply = connection_buffer_acquire(CONNECTION_BUFFER_ICECAST, &reply_size);
+        if (NULL==reply) {
+            Serial.printf("ICY uplink%s .. no icecast buffer left!\n", tag);
+            return;
+        }
+    }
+    backoff = BACKOFF_MIN;
+    enter(STATE_DNS);
+}
+
+void ToolkitWiFi_Uplink::stop()
+{
+    closeSocket();
+    have_bookmark = false;  // start from live next time
+    enter(STATE_IDLE);
+}
+
+void ToolkitWiFi_Uplink::enter(uint32_t new_state)
+{
+    state = new_state;
+    state_started = millis();
+    dns_asked = false;
+}
+
+void ToolkitWiFi_Uplink::closeSocket()
+{
+    if (fd >= 0) {
+        close(fd);
+        fd = -1;
+    }
+    pending = NULL;
+    pending_length = 0;
+    pending_sent = 0;
+}
+
+void ToolkitWiFi_Uplink::fail(const char *why)
+{
+    closeSocket();
+    failures++;
+    Serial.printf("ICY uplink%s %s .. retry in %u ms\n", tag, why, backoff);
+    enter(STATE_BACKOFF);
+}
+
+//------------------------------------------------------------------
+//
+// One step at a time
+//
+
+void ToolkitWiFi_Uplink::run()
+{
+    switch (state) {
+        case STATE_DNS :
+            stepDNS();
+            break;
+        case STATE_CONNECTING :
+            stepConnecting();
+            break;
+        case STATE_SEND_HEADERS :
+            stepSendHeaders();
+            break;
+        case STATE_AWAIT_STATUS :
+            stepAwaitStatus();
+            break;
+        case STATE_STREAMING :
+            pump();
+            if (STATE_STREAMING==state) {
+                drainReplies();
+            }
+            if (STATE_STREAMING==state) {
+                checkForStall();
+            }
+            if ((STATE_STREAMING==state) && (BACKOFF_MIN!=backoff) &&
+                ((millis() - state_started) > BACKOFF_RESET)) {
+                backoff = BACKOFF_MIN;
+            }
+            break;
+        case STATE_BACKOFF :
+            if ((millis() - state_started) >= backoff) {
+                backoff = backoff * 2;
+                if (backoff > BACKOFF_MAX) {
+                    backoff = BACKOFF_MAX;
+                }
+                enter(STATE_DNS);
+            }
+            break;
+    }
+}
+
+// called by lwip from its own task
+void ToolkitWiFi_Uplink::dnsFound(const char *name, const ip_addr_t *ipaddr,
+    void *arg)
+{
+    ToolkitWiFi_Uplink *uplink = (ToolkitWiFi_Uplink *) arg;
+    portENTER_CRITICAL(&dns_lock);
+    uplink->dns_ip = ipaddr ? ip_2_ip4(ipaddr)->addr : 0;
+    uplink->dns_done = true;
+    portEXIT_CRITICAL(&dns_lock);
+}
+
+void ToolkitWiFi_Uplink::stepDNS()
+{
+    if (!dns_asked) {
+        dns_asked = true;
+        attempt_started = state_started;
+        attempts++;
+        const char *url = findSetting("remote_icecast_url", false);
+        port = findSettingUInt("remote_icecast_port", 8000);
+        if ((NULL==url) || (0==url[0])) {
+            fail("has no url");
+            return;
+        }
+        ip_addr_t addr;
+        portENTER_CRITICAL(&dns_lock);
+        dns_done = false;
+        portEXIT_CRITICAL(&dns_lock);
+        // lwip's DNS isn't thread safe, it belongs to the tcpip task
+        LOCK_TCPIP_CORE();
+        err_t err = dns_gethostbyname(url, &addr, dnsFound, this);
+        UNLOCK_TCPIP_CORE();
+        if (ERR_OK==err) {          // cached, or a number
+            portENTER_CRITICAL(&dns_lock);
+            dns_ip = ip_2_ip4(&addr)->addr;
+            dns_done = true;
+            portEXIT_CRITICAL(&dns_lock);
+        } else if (ERR_INPROGRESS!=err) {
+            fail("DNS error");
+            return;
+        }
+    }
+
+    portENTER_CRITICAL(&dns_lock);
+    boolean done = dns_done;
+    uint32_t found = dns_ip;
+    portEXIT_CRITICAL(&dns_lock);
+    if (done) {
+        if (0==found) {
+            fail("DNS lookup failed");
+        } else {
+            ip = found;
+            enter(STATE_CONNECTING);
+        }
+    } else if ((millis() - state_started) > DNS_TIMEOUT) {
+        fail("DNS timeout");
+    }
+}
+
+void ToolkitWiFi_Uplink::stepConnecting()
+{
+    if (fd < 0) {
+        fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (fd < 0) {
+            fail("has no socket");
+            return;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        struct sockaddr_in server;
+        memset(&server, 0, sizeof(server));
+        server.sin_family = AF_INET;
+        server.sin_port = htons(port);
+        server.sin_addr.s_addr = ip;
+        if ((connect(fd, (struct sockaddr *) &server, sizeof(server)) < 0) &&
+            (EINPROGRESS != errno)) {
+            fail("connect error");
+            return;
+        }
+    }
+
+    // writable once the connect has finished, one way or the other
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(fd, &fds);
+    struct timeval no_wait = { 0, 0 };
+    if (select(fd+1, NULL, &fds, NULL, &no_wait) > 0) {
+        int error = 0;
+        socklen_t error_length = sizeof(error);
+        getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &error_length);
+        if (error) {
+            fail("connect refused");
+            return;
+        }
+        histogramAdd(&connect_ms, millis() - attempt_started);
+        request_length = icy_make_request(request, method,
+            findSetting("remote_icecast_url", false), port,
+            findSetting("remote_icecast_user"),
+            findSetting("remote_icecast_password"),
+            findSetting("remote_icecast_mountpoint"));
+        request_sent = 0;
+        handshake_started = millis();
+        Serial.println(request);
+        enter(STATE_SEND_HEADERS);
+    } else if ((millis() - state_started) > CONNECT_TIMEOUT) {
+        fail("connect timeout");
+    }
+}
+
+void ToolkitWiFi_Uplink::stepSendHeaders()
+{
+    int sent = ::send(fd, &request[request_sent],
+        request_length - request_sent, MSG_DONTWAIT);
+    if (sent > 0) {
+        request_sent += sent;
+    } else if ((EAGAIN!=errno) && (EWOULDBLOCK!=errno)) {
+        fail("send error");
+        return;
+    }
+    if (request_sent >= request_length) {
+        reply_used = 0;
+        enter(STATE_AWAIT_STATUS);
+    } else if ((millis() - state_started) > STATUS_TIMEOUT) {
+        fail("send timeout");
+    }
+}
+
+void ToolkitWiFi_Uplink::stepAwaitStatus()
+{
+    // read up to the blank line at the end of the reply header
+    boolean complete = false;
+    while (!complete && (reply_used < (reply_size-1))) {
+        int got = recv(fd, &reply[reply_used], 1, MSG_DONTWAIT);
+        if (0==got) {
+            fail("closed by server");
+            return;
+        } else if (got < 0) {
+            if ((EAGAIN!=errno) && (EWOULDBLOCK!=errno)) {
+                fail("receive error");
+                return;
+            }
+            break;
+        }
+        reply_used++;
+        reply[reply_used] = 0;
+        complete = (strstr(reply, "\r\n\r\n") || strstr(reply, "\n\n"));
+    }
+    if (reply_used >= (reply_size-1)) {
+        complete = true;    // a long reply, the status line is in there
+    }
+
+    if (!complete) {
+        if ((millis() - state_started) > STATUS_TIMEOUT) {
+            fail("has no reply");
+        }
+        return;
+    }
+
+    Serial.printf("\nREPLY\n%s\n", reply);
+    uint32_t status = icy_parse_status(reply);
+    if (icy_accepted(status)) {
+        histogramAdd(&handshake_ms, millis() - handshake_started);
+        streams++;
+        Serial.printf("ICY server%s accepted %s\n", tag,
+            icy_method_name(method));
+        startStreaming();
+    } else if (icy_try_another_method(status)) {
+        Serial.printf("ICY server%s turned down %s (%u)\n", tag,
+            icy_method_name(method), status);
+        method = (method + 1) % ICY_METHODS;
+        closeSocket();  // the server hangs up after turning us down
+        enter(STATE_CONNECTING);
+        attempt_started = state_started;
+    } else {
+        fail("was refused");
+    }
+}
+
+//------------------------------------------------------------------
+//
+// Streaming
+//
+
+void ToolkitWiFi_Uplink::startStreaming()
+{
+    stall_ms = findSettingUInt("remote_icecast_stall_ms", STALL_DEFAULT);
+    byte_rate = ogg_opus_bitrate() * 1000 / 8;
+    catchup = findSettingUInt("remote_icecast_catchup", CATCHUP_DEFAULT);
+    if (catchup < 1) {
+        catchup = 1;
+    }
+
+    uint32_t head = ring_head();
+    uint32_t oldest = ring_oldest();
+    if (!have_bookmark) {
+        // the first time, start with the newest full buffer
+        cursor = (head > 0) ? (head - 1) : 0;
+        have_bookmark = true;
+    } else {
+        uint32_t gap = skipLost(oldest);
+        if (gap) {
+            Serial.printf("ICY uplink%s .. %u buffers were lost while we were away\n",
+                tag, gap);
+        } else {
+            resumed++;
+        }
+        if (cursor < oldest) {
+            Serial.printf("ICY uplink%s .. %u buffers to send from flash\n",
+                tag, oldest - cursor);
+        }
+        if ((head - cursor) > 1) {
+            Serial.printf("ICY uplink%s .. catching up %u buffers\n",
+                tag, head - cursor);
+        }
+    }
+
+    pending = NULL;
+    pending_headers = false;
+    sendOggHeaders();
+    last_progress = millis();
+    next_burst = last_progress;
+    lost_at_start = lost;
+    enter(STATE_STREAMING);
+    allowance_ms = behindMs();
+}
+
+// An Ogg stream (codec = opus) can't be read without its header
+// pages, so the server gets them first on every connection. They go
+// out of the request buffer, which is finished with by now.
+void ToolkitWiFi_Uplink::sendOggHeaders()
+{
+    uint8_t *data = (uint8_t *) request + MP3_CHUNK_HEADROOM;
+    size_t length = ogg_opus_headers(data, REQUEST_SIZE -
+        MP3_CHUNK_HEADROOM - MP3_CHUNK_TAILROOM);
+    if (0==length) {
+        return;     // it's mp3
+    }
+    if (ICY_METHOD_PUT_CHUNKED==method) {
+        data = icy_frame_chunk(data, &length);
+    }
+    pending = data;
+    pending_length = length;
+    pending_sent = 0;
+    pending_headers = true;
+}
+
+// Send what we can from the ring, without blocking.
+void ToolkitWiFi_Uplink::pump()
+{
+    while (STATE_STREAMING==state) {
+        if (pending) {
+            if (!flush()) {
+                return;     // still going (or failed)
+            }
+            if (pending_headers) {
+                pending_headers = false;
+            } else {
+                cursor++;   // that one is delivered
+            }
+            pending = NULL;
+        }
+
+        uint32_t head = ring_head();
+        if (cursor >= head) {
+            return;         // at the live edge, wait for the encoder
+        }
+        uint32_t oldest = ring_oldest();
+        skipLost(oldest);
+
+        uint32_t now = millis();
+        if ((head - cursor) > 1) {
+            // a backlog .. pace it at catchup times real time
+            if ((int32_t) (now - next_burst) < 0) {
+                return;
+            }
+            if ((int32_t) (now - next_burst) > 0) {
+                next_burst = now;   // don't save up credit
+            }
+            if (byte_rate && buffer_length) {
+                next_burst += (buffer_length * 1000) / (byte_rate * catchup);
+            }
+            caught_up++;
+        }
+
+        size_t length;
+        uint8_t *data;
+        if (cursor < oldest) {
+            data = readSpilled(&length);
+            if (NULL==data) {
+                lost++;     // gone from flash too
+                cursor++;
+                continue;
+            }
+        } else {
+            data = ring_get(cursor, &length);
+            if (NULL==data) {
+                continue;   // overwritten since we looked, go round again
+            }
+        }
+        buffer_length = length;
+        if (ICY_METHOD_PUT_CHUNKED==method) {
+            // chunk header, payload and trailer all go out together
+            data = icy_frame_chunk(data, &length);
+            if (NULL==data) {
+                return;     // too big for the headroom, can't happen
+            }
+        }
+        pending = data;
+        pending_length = length;
+        pending_sent = 0;
+    }
+}
+
+// We fell so far behind that the encoder came round again. Anything
+// it overwrote that isn't in the spill log is lost, move the cursor
+// past it. Returns how many buffers that was.
+uint32_t ToolkitWiFi_Uplink::skipLost(uint32_t oldest)
+{
+    if (cursor >= oldest) {
+        return 0;
+    }
+    uint32_t next = spill_find(cursor);
+    if (next > oldest) {
+        next = oldest;
+    }
+    uint32_t gap = next - cursor;
+    lost += gap;
+    cursor = next;
+    return gap;
+}
+
+// read buffer number cursor back from the spill log, into a buffer of
+// our own with the same chunk headroom and tailroom as the ring
+uint8_t *ToolkitWiFi_Uplink::readSpilled(size_t *length)
+{
+    if (NULL==spill_buffer) {
+        spill_buffer = (uint8_t *) malloc(MP3_CHUNK_HEADROOM +
+            ToolkitFiles::FLASH_BLOCK_SIZE + MP3_CHUNK_TAILROOM);
+        if (NULL==spill_buffer) {
+            return NULL;
+        }
+    }
+    uint8_t *data = spill_buffer + MP3_CHUNK_HEADROOM;
+    *length = spill_read(cursor, data, ToolkitFiles::FLASH_BLOCK_SIZE);
+    if (0==*length) {
+        return NULL;
+    }
+    from_flash++;
+    return data;
+}
+
+// returns true once the whole pending chunk has gone out
+boolean ToolkitWiFi_Uplink::flush()
+{
+    while (pending_sent < pending_length) {
+        int sent = ::send(fd, &pending[pending_sent],
+            pending_length - pending_sent, MSG_DONTWAIT);
+        if (sent > 0) {
+            pending_sent += sent;
+            bytes_sent += sent;
+            last_progress = millis();
+        } else if ((EAGAIN==errno) || (EWOULDBLOCK==errno)) {
+            return false;   // the send buffer is full, try again next time
+        } else {
+            fail("send error");
+            return false;
+        }
+    }
+    return true;
+}
+
+// check for messages from the server and clear the input buffer
+void ToolkitWiFi_Uplink::drainReplies()
+{
+    int got = recv(fd, reply, reply_size-1, MSG_DONTWAIT);
+    if (got > 0) {
+        reply[got] = 0;
+        Serial.printf("ICY SERVER%s SAYS: %s\n", tag, reply);
+    } else if (0==got) {
+        fail("closed by server");
+    } else if ((EAGAIN!=errno) && (EWOULDBLOCK!=errno)) {
+        fail("receive error");
+    }
+}
+
+// how far behind the encoder we are, in milliseconds of audio
+// (full buffers in the ring that haven't all gone out yet)
+uint32_t ToolkitWiFi_Uplink::behindMs()
+{
+    uint32_t head = ring_head ? ring_head() : 0;
+    if ((0==byte_rate) || (cursor >= head)) {
+        return 0;
+    }
+    uint64_t behind_bytes = (uint64_t) (head - cursor) * buffer_length;
+    return (uint32_t) ((behind_bytes * 1000) / byte_rate);
+}
+
+// The lwip socket API doesn't tell us how much is still waiting to be
+// acked, but a send that keeps coming back EAGAIN is the same thing
+// seen from up here: the TCP send buffer is full and isn't emptying.
+void ToolkitWiFi_Uplink::checkForStall()
+{
+    uint32_t behind = behindMs();
+    if (behind < allowance_ms) {
+        allowance_ms = behind;  // catching up
+    }
+    if (NULL==pending) {
+        return;     // all caught up
+    }
+    uint32_t now = millis();
+    uint32_t quiet = now - last_progress;
+    if ((behind <= (allowance_ms + stall_ms)) && (quiet <= stall_ms)) {
+        return;
+    }
+
+    stalls++;
+    last_stall.at = now;
+    last_stall.behind_bytes = (behind * (uint64_t) byte_rate) / 1000;
+    last_stall.behind_ms = behind;
+    last_stall.quiet_ms = quiet;
+    last_stall.streamed_ms = now - state_started;
+    last_stall.lost = lost - lost_at_start;
+    if (behind > stall_worst_ms) {
+        stall_worst_ms = behind;
+    }
+    Serial.printf("ICY uplink%s stall %u .. %u bytes (%u ms) behind, "
+        "nothing sent for %u ms, after %u s streaming, %u buffers lost\n",
+        tag, stalls, last_stall.behind_bytes, last_stall.behind_ms,
+        last_stall.quiet_ms, last_stall.streamed_ms / 1000,
+        last_stall.lost);
+
+    // reconnect straight away, it's the link not the server
+    backoff = BACKOFF_MIN;
+    fail("stalled");
+}
+
+//------------------------------------------------------------------
+//
+// Stats
+//
+
+void ToolkitWiFi_Uplink::histogramAdd(histogram *h, uint32_t ms)
+{
+    uint32_t i = 0;
+    while (ms > bucket_limits[i]) {
+        i++;
+    }
+    h->counts[i]++;
+    h->samples++;
+    if (ms > h->max_ms) {
+        h->max_ms = ms;
+    }
+}
+
+void ToolkitWiFi_Uplink::histogramPrint(const char *name, histogram *h)
+{
+    Serial.printf("Uplink%s %s ms:", tag, name);
+    for (uint32_t i = 0; i < (HISTOGRAM_BUCKETS-1); i++) {
+        Serial.printf(" <=%u:%u", bucket_limits[i], h->counts[i]);
+    }
+    Serial.printf(" more:%u, max %u\n", h->counts[HISTOGRAM_BUCKETS-1], h->max_ms);
+}
+
+void ToolkitWiFi_Uplink::printStats()
+{
+    Serial.printf("Uplink%s %s (%s), attempts %u, streams %u, failures %u, "
+        "sent %u bytes\n",
+        tag, state_names[state], icy_method_name(method),
+        attempts, streams, failures, bytes_sent);
+    Serial.printf("Uplink%s resumed %u times, caught up %u buffers "
+        "(%u from flash), lost %u buffers\n",
+        tag, resumed, caught_up, from_flash, lost);
+    histogramPrint("connect", &connect_ms);
+    histogramPrint("handshake", &handshake_ms);
+    if (isStreaming()) {
+        Serial.printf("Uplink%s is %u ms behind, limit %u ms\n",
+            tag, behindMs(), stall_ms);
+    }
+    Serial.printf("Uplink%s stalls %u, worst %u ms behind\n",
+        tag, stalls, stall_worst_ms);
+    if (stalls) {
+        Serial.printf("Uplink%s last stall %u s ago .. %u bytes (%u ms) behind, "
+            "nothing sent for %u ms, after %u s streaming, %u lost\n",
+            tag, (millis() - last_stall.at) / 1000,
+            last_stall.behind_bytes, last_stall.behind_ms,
+            last_stall.quiet_ms, last_stall.streamed_ms / 1000,
+            last_stall.lost);
+    }
+}
+
+//
+// END OF ToolkitWiFi_Uplink.cpp
@@ -0,0 +1,228 @@
+//
+// ToolkitWiFi_Uplink.h
+
+//
+// The connection up to a remote icecast server.
+//
+// Nothing in here blocks. run() is called from the stream task every
+// few milliseconds and takes one small step through the connection:
+//
+//  IDLE -> DNS -> CONNECTING -> SEND_HEADERS -> AWAIT_STATUS -> STREAMING
+//                     ^                              |             |
+//                     +------ next icy method -------+             |
+//  BACKOFF <------------------ any failure ------------------------+
+//
+// A failure waits in BACKOFF (1 second, doubling up to a minute) then
+// starts again from DNS. The socket is a plain non-blocking lwip
+// socket, a send that doesn't fit is picked up where it stopped.
+//
+// The uplink keeps its own place in the encoder ring (a sequence
+// number, see Streamer::getBufferBySequence()). A buffer only counts
+// as delivered once all of it has gone out, so after a reconnect we
+// pick up from the first buffer the server didn't get. Anything still
+// in the ring is sent faster than real time (remote_icecast_catchup
+// times) until we are back at the live edge, so short outages leave
+// no gap in the stream.
+//
+// Longer outages: with remote_icecast_spill on, the buffers the
+// encoder is about to overwrite are copied to flash first (see
+// uplink_spill.h) and read back from there, at the same catch up
+// rate, before we carry on from the ring.
+//
+// There can be more than one (see ToolkitWiFi_Server), each with its
+// own settings, state, stats and place in the ring. They all read the
+// same encoder buffers, nothing is copied per uplink. Two chunked
+// uplinks can both write the chunk header into the same buffer's
+// headroom, but for the same length it's the same bytes.
+//
+// Stalls: a half dead link can keep the socket "connected" for a long
+// time while nothing gets through. While streaming we keep count of
+// how far behind the encoder we are (buffers written but not sent yet,
+// in milliseconds of audio at the encoder bitrate) and when the last
+// byte went out. If nothing goes out for remote_icecast_stall_ms, or
+// we fall that much further behind than we were (a catch up starts
+// out behind on purpose), we call it a stall and reconnect rather
+// than wait for TCP to give up.
+//
+
+#ifndef ToolkitWiFi_Uplink_H
+#define ToolkitWiFi_Uplink_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "lwip/dns.h"
+
+class ToolkitWiFi_Uplink
+{
+    public:
+        enum {
+            STATE_IDLE = 0,
+            STATE_DNS,
+            STATE_CONNECTING,
+            STATE_SEND_HEADERS,
+            STATE_AWAIT_STATUS,
+            STATE_STREAMING,
+            STATE_BACKOFF,
+            STATES
+        };
+
+        enum {  // milliseconds
+            DNS_TIMEOUT     = 10000,
+            CONNECT_TIMEOUT = 10000,
+            STATUS_TIMEOUT  = 5000,
+            BACKOFF_MIN     = 1000,
+            BACKOFF_MAX     = 60000,
+            BACKOFF_RESET   = 30000     // streaming this long resets it
+        };
+
+        enum {
+            STALL_DEFAULT       = 3000, // milliseconds behind the encoder
+            CATCHUP_DEFAULT     = 4     // times real time
+        };
+
+        enum {
+            REQUEST_SIZE        = 512,
+            HISTOGRAM_BUCKETS   = 8,
+            SETTING_NAME_SIZE   = 32,   // ITEM_MAX_NAME_STRING
+            SUFFIX_SIZE         = 4
+        };
+
+        typedef struct {
+            uint32_t counts[HISTOGRAM_BUCKETS];
+            uint32_t samples;
+            uint32_t max_ms;
+        } histogram;
+
+        typedef struct {
+            uint32_t at;            // millis()
+            uint32_t behind_bytes;
+            uint32_t behind_ms;     // of audio
+            uint32_t quiet_ms;      // since the last byte went out
+            uint32_t streamed_ms;   // how long the stream had been up
+            uint32_t lost;          // buffers overwritten during the stream
+        } stall_incident;
+
+        ToolkitWiFi_Uplink();
+
+        // which settings to use, 0 for remote_icecast_xxx,
+        // n for remote_icecast_xxx_<n+1>
+        void setNumber(uint32_t n);
+        boolean isConfigured();     // has a url
+
+        // where to read the encoder buffers from
+        // (with the chunk headroom and tailroom around them)
+        void setSource(uint32_t (*head)(), uint32_t (*oldest)(),
+            uint8_t *(*get)(uint32_t, size_t*));
+
+        void start();       // start connecting, from IDLE
+        void stop();        // close and go back to IDLE
+        void run();         // one step, from the stream task
+
+        boolean isStreaming() { return (STATE_STREAMING==state); }
+        uint32_t getState() { return state; }
+        uint32_t getBytesSent() { return bytes_sent; }
+
+        // the first buffer the server hasn't had yet
+        // (0xffffffff if we aren't keeping a place in the ring)
+        uint32_t getNeeded() { return have_bookmark ? cursor : 0xffffffff; }
+
+        void printStats();
+
+    private:
+        void enter(uint32_t new_state);
+        void fail(const char *why);
+        void closeSocket();
+        void startStreaming();
+        void sendOggHeaders();
+        void pump();
+        uint32_t skipLost(uint32_t oldest);
+        uint8_t *readSpilled(size_t *length);
+        boolean flush();
+        void drainReplies();
+        void checkForStall();
+        uint32_t behindMs();
+
+        void stepDNS();
+        void stepConnecting();
+        void stepSendHeaders();
+        void stepAwaitStatus();
+
+        static void dnsFound(const char *name, const ip_addr_t *ipaddr,
+            void *arg);
+        static void histogramAdd(histogram *h, uint32_t ms);
+        void histogramPrint(const char *name, histogram *h);
+
+        const char *findSetting(const char *name, boolean fallback=true);
+        uint16_t findSettingUInt(const char *name, uint16_t default_value);
+
+        uint32_t number;
+        char suffix[SUFFIX_SIZE];   // on the end of the setting names
+        char tag[SUFFIX_SIZE];      // on the end of "Uplink" in messages
+
+        volatile uint32_t state;
+        uint32_t state_started;     // millis() when we entered the state
+        uint32_t attempt_started;   // millis() at the start of DNS
+        uint32_t handshake_started; // millis() when the request went out
+        uint32_t backoff;           // milliseconds
+        uint32_t method;            // ICY_METHOD_xxx, kept across reconnects
+        int fd;                     // lwip socket, -1 if closed
+
+        boolean dns_asked;
+        volatile boolean dns_done;  // set by the lwip callback, under dns_lock
+        volatile uint32_t dns_ip;   // 0 if the lookup failed
+        uint32_t ip;
+        uint16_t port;
+
+        char request[REQUEST_SIZE];
+        size_t request_length;
+        size_t request_sent;
+        char *reply;                // from the icecast buffer pool
+        size_t reply_size;
+        size_t reply_used;
+
+        // the encoder ring
+        uint32_t (*ring_head)();
+        uint32_t (*ring_oldest)();
+        uint8_t *(*ring_get)(uint32_t, size_t*);
+        volatile boolean have_bookmark;
+        volatile uint32_t cursor;   // the next buffer the server needs
+        size_t buffer_length;       // bytes per ring buffer
+
+        // the chunk going out right now (buffer number cursor)
+        uint8_t *pending;
+        size_t pending_length;
+        size_t pending_sent;
+        uint8_t *spill_buffer;      // a buffer read back from flash
+        boolean pending_headers;    // it's the Ogg headers, not a buffer
+
+        // catching up, sending the backlog faster than real time
+        uint32_t catchup;           // remote_icecast_catchup
+        uint32_t next_burst;        // millis() the next backlog buffer can go
+
+        // stall detection, reset when we start streaming
+        uint32_t stall_ms;          // remote_icecast_stall_ms
+        uint32_t byte_rate;         // encoder bytes per second
+        uint32_t allowance_ms;      // least we've been behind this stream
+        uint32_t last_progress;     // millis() of the last bytes sent
+        uint32_t lost_at_start;
+
+        // stats
+        uint32_t attempts;
+        uint32_t streams;
+        uint32_t failures;
+        uint32_t lost;              // buffers overwritten before we sent them
+        uint32_t resumed;           // reconnects that picked up with no gap
+        uint32_t caught_up;         // backlog buffers sent
+        uint32_t from_flash;        //  .. of those read back from flash
+        uint32_t bytes_sent;
+        histogram connect_ms;       // DNS + TCP connect
+        histogram handshake_ms;     // request sent to accepted
+        uint32_t stalls;
+        uint32_t stall_worst_ms;
+        stall_incident last_stall;
+};
+
+#endif
+
+//
+// END OF ToolkitWiFi_Uplink.h
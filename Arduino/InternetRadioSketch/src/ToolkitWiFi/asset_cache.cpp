@@ -0,0 +1,230 @@
+//
+// asset_cache.cpp
+
+#include "asset_cache.h"
+#include "../ToolkitFiles/ToolkitFiles.h"
+#include "sha1.h"
+
+typedef struct {
+    char path[ASSET_CACHE_PATH_SIZE];
+    uint8_t *data;
+    size_t size;
+    char etag[ASSET_ETAG_SIZE];
+    boolean in_use;
+    boolean missing;        // not on the flash, data is NULL
+    uint32_t last_used;
+} asset_entry;
+
+static boolean enabled = false;
+static boolean in_psram = false;
+static size_t budget = 0;
+static size_t used = 0;
+static uint32_t use_count = 0;
+static asset_entry entries[ASSET_CACHE_ENTRIES];
+
+static uint32_t stats_hits = 0;
+static uint32_t stats_misses = 0;
+static uint32_t stats_evictions = 0;
+static uint32_t stats_invalidated = 0;
+static uint32_t stats_too_big = 0;
+static uint32_t stats_no_memory = 0;
+
+static void free_entry(asset_entry *e);
+
+boolean asset_cache_begin()
+{
+    for (uint32_t i = 0; i < ASSET_CACHE_ENTRIES; i++) {
+        if (entries[i].in_use) {
+            free_entry(&entries[i]);
+        }
+    }
+    uint32_t kb = SettingItem::findUInt("local_asset_cache_kb", ASSET_CACHE_KB);
+    in_psram = psramFound();
+    if (!in_psram && (kb > ASSET_CACHE_RAM_KB)) {
+        kb = ASSET_CACHE_RAM_KB;
+    }
+    budget = kb * 1024;
+    enabled = (0 != budget);
+    return enabled;
+}
+
+static asset_entry *find_entry(const char *path)
+{
+    for (uint32_t i = 0; i < ASSET_CACHE_ENTRIES; i++) {
+        if (entries[i].in_use && (0==strcmp(path, entries[i].path))) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void free_entry(asset_entry *e)
+{
+    free(e->data);
+    e->data = NULL;
+    used -= e->size;
+    e->size = 0;
+    e->in_use = false;
+    e->missing = false;
+}
+
+// the least recently used entry, a free one if there is one ..
+// or with holding_data, the least recently used file (NULL if none)
+static asset_entry *oldest_entry(boolean holding_data)
+{
+    asset_entry *oldest = NULL;
+    for (uint32_t i = 0; i < ASSET_CACHE_ENTRIES; i++) {
+        asset_entry *e = &entries[i];
+        if (!e->in_use && !holding_data) {
+            return e;
+        }
+        if (holding_data && (NULL==e->data)) {
+            continue;       // free, or missing
+        }
+        if ((NULL==oldest) || ((int32_t) (e->last_used - oldest->last_used) < 0)) {
+            oldest = e;
+        }
+    }
+    return oldest;
+}
+
+// take the least recently used entry for path
+static asset_entry *new_entry(const char *path)
+{
+    asset_entry *e = oldest_entry(false);
+    if (e->in_use) {
+        free_entry(e);
+        stats_evictions++;
+    }
+    strcpy(e->path, path);
+    e->in_use = true;
+    e->last_used = ++use_count;
+    return e;
+}
+
+boolean asset_cache_isMissing(const char *path)
+{
+    if (!enabled) {
+        return false;
+    }
+    asset_entry *e = find_entry(path);
+    if (e && e->missing) {
+        e->last_used = ++use_count;
+        return true;
+    }
+    return false;
+}
+
+void asset_cache_makeETag(const uint8_t *digest, char *etag)
+{
+    etag[0] = '"';
+    for (uint32_t i = 0; i < 8; i++) {
+        sprintf(&etag[1 + (i * 2)], "%02x", digest[i]);
+    }
+    etag[17] = '"';
+    etag[18] = 0;
+}
+
+const uint8_t *asset_cache_fetch(const char *path, size_t *size,
+    const char **etag, File *file)
+{
+    if (!enabled || (strlen(path) >= ASSET_CACHE_PATH_SIZE)) {
+        return NULL;
+    }
+    asset_entry *e = find_entry(path);
+    if (e) {
+        stats_hits++;
+        e->last_used = ++use_count;
+        *size = e->size;
+        *etag = e->etag;
+        return e->data;     // NULL if it's missing
+    }
+
+    stats_misses++;
+    File f = ToolkitFiles::fileOpen(path, FILE_READ);
+    if (!f) {
+        // remember that, a browser asks for /favicon.ico every time
+        new_entry(path)->missing = true;
+        return NULL;
+    }
+    size_t length = f.size();
+    if ((0==length) || (length > (budget / 2))) {
+        if (length) {
+            stats_too_big++;
+        }
+        *file = f;
+        return NULL;
+    }
+
+    // make room, then a free entry
+    while ((used + length) > budget) {
+        asset_entry *oldest = oldest_entry(true);
+        if (NULL==oldest) {
+            break;
+        }
+        free_entry(oldest);
+        stats_evictions++;
+    }
+    uint8_t *data = (uint8_t *) (in_psram ? ps_malloc(length) : malloc(length));
+    if (NULL==data) {
+        stats_no_memory++;
+        *file = f;
+        return NULL;
+    }
+    if (length != f.read(data, length)) {
+        free(data);
+        f.close();
+        return NULL;
+    }
+    f.close();
+
+    e = new_entry(path);
+    e->data = data;
+    e->size = length;
+    used += length;
+
+    // the hash of what's sent, so it's right however the file got there
+    SHA1Context sha;
+    uint8_t digest[SHA1HashSize];
+    SHA1Reset(&sha);
+    SHA1Input(&sha, data, length);
+    SHA1Result(&sha, digest);
+    asset_cache_makeETag(digest, e->etag);
+
+    *size = length;
+    *etag = e->etag;
+    return data;
+}
+
+void asset_cache_invalidate(const char *path)
+{
+    asset_entry *e = find_entry(path);
+    if (e) {
+        free_entry(e);
+        stats_invalidated++;
+    }
+}
+
+void asset_cache_printStats()
+{
+    if (!enabled) {
+        return;
+    }
+    uint32_t files = 0;
+    uint32_t missing = 0;
+    for (uint32_t i = 0; i < ASSET_CACHE_ENTRIES; i++) {
+        if (entries[i].data) {
+            files++;
+        } else if (entries[i].missing) {
+            missing++;
+        }
+    }
+    Serial.printf("Asset cache %u files (%u missing), %u of %u bytes in %s\n",
+        files, missing, used, budget, in_psram ? "PSRAM" : "RAM");
+    Serial.printf("Asset cache %u hits, %u misses, %u evicted, %u invalidated, "
+        "%u too big, %u out of memory\n", stats_hits, stats_misses,
+        stats_evictions, stats_invalidated, stats_too_big, stats_no_memory);
+}
+
+//
+// END OF asset_cache.cpp
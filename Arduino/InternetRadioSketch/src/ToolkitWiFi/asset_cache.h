@@ -0,0 +1,71 @@
+//
+// asset_cache.h
+
+//
+// Whole web pages, scripts and style sheets kept in RAM for
+// http_handleGetRequest().
+//
+// Every page load asks for index.html, toolkit.js and toolkit.css, and
+// each one was a LittleFS open (two, with the file_exists() check) and
+// a string of 1k reads. With a room full of phones joining the AP at
+// once those reads hold up the server task. The first request for a
+// file reads all of it into here, the ones after it are one write()
+// from RAM.
+//
+// The cache is limited by bytes, not files. When a new file doesn't
+// fit, the least recently sent ones are thrown out until it does. Files
+// bigger than half of it are never kept, they're still streamed
+// from the flash. The memory comes from PSRAM if there is any. A file
+// that isn't on the flash is remembered too (at no cost in bytes), so
+// /favicon.ico doesn't mean a failed open every time.
+//
+//  local_asset_cache_kb    = 128, 0 turns it off (at most 24 without PSRAM)
+//
+// Each file has an ETag, the first 8 bytes of the SHA-1 of what's
+// sent, worked out when it's read in. A browser asking If-None-Match
+// for it gets a 304 without the flash being read at all.
+//
+// An upload over a file drops it from the cache. Everything here runs
+// in the server task.
+//
+
+#ifndef _ASSET_CACHE_H_
+#define _ASSET_CACHE_H_
+
+#include <Arduino.h>
+#include <FS.h>
+
+enum {
+    ASSET_CACHE_KB          = 128,
+    ASSET_CACHE_RAM_KB      = 24,       // without PSRAM
+    ASSET_CACHE_ENTRIES     = 16,
+    ASSET_CACHE_PATH_SIZE   = 36,
+    ASSET_ETAG_SIZE         = 19        // "0123456789abcdef" and a NULL
+};
+
+// reads the settings, false if it's off
+boolean asset_cache_begin();
+
+// the whole file and its ETag, from the cache or read into it from
+// the flash .. NULL if it isn't on the flash, or won't be kept. Then
+// stream it, from file if that's been left open (it was opened to see
+// how big it is, no need to open it again).
+const uint8_t *asset_cache_fetch(const char *path, size_t *size,
+    const char **etag, File *file);
+
+// true if we know path isn't on the flash, no need to look
+boolean asset_cache_isMissing(const char *path);
+
+// after path has been written to
+void asset_cache_invalidate(const char *path);
+
+void asset_cache_printStats();
+
+// the quoted ETag for a SHA-1 digest (SHA1HashSize bytes), the same as
+// make_data.py makes .. etag is ASSET_ETAG_SIZE
+void asset_cache_makeETag(const uint8_t *digest, char *etag);
+
+#endif
+
+//
+// END OF asset_cache.h
@@ -0,0 +1,92 @@
+//
+// connection_buffers.cpp
+
+#include "connection_buffers.h"
+
+static char http_buffers[HTTP_BUFFER_COUNT][HTTP_BUFFER_SIZE];
+static char ws_buffers[WS_BUFFER_COUNT][WS_FRAME_SIZE];
+static char icy_buffers[ICY_BUFFER_COUNT][ICY_REPLY_SIZE];
+
+typedef struct {
+    const char *name;
+    char *storage;
+    size_t size;            // bytes per buffer
+    uint32_t count;         // up to 32
+    uint32_t in_use;        // one bit per buffer
+    uint32_t high_water;
+    uint32_t failed;        // acquire() found the pool empty
+} buffer_pool;
+
+static buffer_pool pools[CONNECTION_BUFFER_TYPES] = {
+    { "none",       NULL,                   0,              0,                  0, 0, 0 },
+    { "http",       &http_buffers[0][0],    HTTP_BUFFER_SIZE, HTTP_BUFFER_COUNT, 0, 0, 0 },
+    { "websocket",  &ws_buffers[0][0],      WS_FRAME_SIZE,  WS_BUFFER_COUNT,    0, 0, 0 },
+    { "icecast",    &icy_buffers[0][0],     ICY_REPLY_SIZE, ICY_BUFFER_COUNT,   0, 0, 0 }
+};
+
+// the server task and the stream task both close connections
+static portMUX_TYPE pool_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t count_bits(uint32_t bits)
+{
+    return __builtin_popcount(bits);
+}
+
+char *connection_buffer_acquire(uint32_t type, size_t *size)
+{
+    *size = 0;
+    if ((CONNECTION_BUFFER_NONE==type) || (type >= CONNECTION_BUFFER_TYPES)) {
+        return NULL;
+    }
+    buffer_pool *pool = &pools[type];
+    char *result = NULL;
+    portENTER_CRITICAL(&pool_lock);
+    uint32_t full = (pool->count < 32) ? ((1u << pool->count) - 1) : 0xffffffff;
+    uint32_t free_bits = (~pool->in_use) & full;
+    if (free_bits) {
+        uint32_t i = __builtin_ctz(free_bits);
+        pool->in_use |= (1u << i);
+        uint32_t used = count_bits(pool->in_use);
+        if (used > pool->high_water) {
+            pool->high_water = used;
+        }
+        result = pool->storage + (i * pool->size);
+        *size = pool->size;
+    } else {
+        pool->failed++;
+    }
+    portEXIT_CRITICAL(&pool_lock);
+    return result;
+}
+
+void connection_buffer_release(uint32_t type, char *buffer)
+{
+    if ((NULL==buffer) || (type >= CONNECTION_BUFFER_TYPES)) {
+        return;
+    }
+    buffer_pool *pool = &pools[type];
+    uint32_t i = (buffer - pool->storage) / pool->size;
+    if (i < pool->count) {
+        portENTER_CRITICAL(&pool_lock);
+        pool->in_use &= ~(1u << i);
+        portEXIT_CRITICAL(&pool_lock);
+    }
+}
+
+void connection_buffer_printStats()
+{
+    size_t total = 0;
+    for (uint32_t t = CONNECTION_BUFFER_HTTP; t < CONNECTION_BUFFER_TYPES; t++) {
+        buffer_pool *pool = &pools[t];
+        size_t bytes = pool->size * pool->count;
+        total += bytes;
+        Serial.printf("Buffers %s: %u of %u in use, %u bytes each, "
+            "%u bytes total, high water %u, none left %u times\n",
+            pool->name, count_bits(pool->in_use), pool->count,
+            pool->size, bytes, pool->high_water, pool->failed);
+    }
+    Serial.printf("Buffers total: %u bytes\n", total);
+}
+
+//
+// END OF connection_buffers.cpp
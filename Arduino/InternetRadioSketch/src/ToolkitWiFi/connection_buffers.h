@@ -0,0 +1,58 @@
+//
+// connection_buffers.h
+
+//
+// Per-connection buffers.
+//
+// Every connection that needs a buffer borrows one from a small pool
+// that is sized for its type, instead of sharing one static buffer.
+// A connection can then stop half way through a request or a frame
+// and pick up where it left off without anyone else touching its
+// bytes.
+//
+//  HTTP        request header + a block for file streaming/uploads
+//              (only held while there are request bytes to work on)
+//  WEBSOCKET   incoming frames, outgoing settings
+//  ICECAST     replies from the icecast server
+//
+// MP3 listeners don't need one, they stream straight from the encoder
+// buffers, and nor do the websocket monitors (see ws_audio.h).
+//
+
+#ifndef _CONNECTION_BUFFERS_H_
+#define _CONNECTION_BUFFERS_H_
+
+#include <Arduino.h>
+
+enum {
+    CONNECTION_BUFFER_NONE = 0,
+    CONNECTION_BUFFER_HTTP,
+    CONNECTION_BUFFER_WEBSOCKET,
+    CONNECTION_BUFFER_ICECAST,
+    CONNECTION_BUFFER_TYPES
+};
+
+enum {
+    HTTP_HEADER_SIZE        = 1024, // largest request header
+    HTTP_IO_SIZE            = 1024, // file streaming block
+    HTTP_BUFFER_SIZE        = HTTP_HEADER_SIZE + HTTP_IO_SIZE,
+    HTTP_BUFFER_COUNT       = 8,
+
+    WS_FRAME_SIZE           = 2048, // all the settings fit in one frame
+    WS_BUFFER_COUNT         = 6,
+
+    ICY_REPLY_SIZE          = 256,
+    ICY_BUFFER_COUNT        = 4
+};
+
+// returns NULL if all the buffers of that type are in use
+char *connection_buffer_acquire(uint32_t type, size_t *size);
+void connection_buffer_release(uint32_t type, char *buffer);
+
+// pool sizes and use, per type
+void connection_buffer_printStats();
+
+#endif
+
+//
+// END OF connection_buffers.h
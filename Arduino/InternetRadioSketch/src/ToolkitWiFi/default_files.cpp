@@ -1,105 +1,71 @@
 //
 // default_files.cpp
 
-#include <Arduino.h>
+#include "default_files.h"
+#include "asset_cache.h"
+#include "../ToolkitFiles/ToolkitFiles.h"
+#include "sha1.h"
 
-typedef struct {
-    const char name[32];
-    const char *data;      // data is NULL terminated
-} default_file_data;
+// made by make_data.py
+#include "default_files/assets.h"
 
-//---------------------------------------------------------------
-//
-// FILE DATA GOES IN HERE
-//
-
-//
-// index.html
-
-// static const char data_index_html[] = {
-//     0x00
-// };
-
-#include "default_files/index_html.h"
-
-static default_file_data default_index_html = {
-    "/index.html", data_index_html
-};
-
-//
-// toolkit.js
-
-#include "default_files/toolkit_js.h"
-
-static default_file_data default_toolkit_js = {
-    "/toolkit.js", data_toolkit_js
-};
-
-//
-// toolkit.css
-
-#include "default_files/toolkit_css.h"
-
-static default_file_data default_toolkit_css = {
-    "/toolkit.css", data_toolkit_css
-};
-
-//
-// upload.html
-
-#include "default_files/upload_html.h"
-
-static default_file_data default_upload_html = {
-    "/upload.html", data_upload_html
-};
+static boolean on_flash[DEFAULT_FILES_COUNT];
 
-//
-// kiosk.html
-
-#include "default_files/kiosk_html.h"
-
-static default_file_data default_kiosk_html = {
-    "/kiosk.html", data_kiosk_html
-};
-
-//---------------------------------------------------------------
-//
-// Table of file data
-//
-
-static default_file_data *files[] = {
-    &default_index_html,
-    &default_toolkit_js,
-    &default_toolkit_css,
-    &default_upload_html,
-    &default_kiosk_html,
-    0
-};
+// the ETag of path on the flash, false if it isn't there
+static boolean flash_etag(const char *path, char *etag)
+{
+    File f = ToolkitFiles::fileOpen(path, FILE_READ);
+    if (!f) {
+        return false;
+    }
+    SHA1Context sha;
+    uint8_t digest[SHA1HashSize];
+    uint8_t buffer[256];
+    size_t actual;
+    SHA1Reset(&sha);
+    while ((actual = f.read(buffer, sizeof(buffer))) > 0) {
+        SHA1Input(&sha, buffer, actual);
+    }
+    f.close();
+    SHA1Result(&sha, digest);
+    asset_cache_makeETag(digest, etag);
+    return true;
+}
 
-boolean default_file_exists(const char *path)
+void default_files_begin()
 {
-    default_file_data **list = files;
-    while (*list) {
-        if (0 == strcmp((*list)->name, path)) {
-            return true;
+    char etag[ASSET_ETAG_SIZE];
+    for (uint32_t i = 0; i < DEFAULT_FILES_COUNT; i++) {
+        const default_asset *a = &default_assets[i];
+        on_flash[i] = a->data && flash_etag(a->path, etag) &&
+            (0 != strcmp(etag, a->source_etag));
+        if (on_flash[i]) {
+            Serial.printf("%s from the flash, not the sketch\n", a->path);
         }
-        list++;
     }
-    return false;
 }
 
-const char *default_files_find(const char *path, size_t *length)
+const default_asset *default_files_lookup(const char *path)
 {
-    default_file_data **list = files;
-    while (*list) {
-        if (0 == strcmp((*list)->name, path)) {
-            *length = strlen((*list)->data);
-            return (*list)->data;
-        }
-        list++;
+    int8_t i = default_slots[default_files_hash(path, default_files_seed)
+        & (DEFAULT_FILES_SLOTS - 1)];
+    if ((i < 0) || (0 != strcmp(path, default_assets[i].path))) {
+        return NULL;
+    }
+    return &default_assets[i];
+}
+
+boolean default_files_onFlash(const default_asset *asset)
+{
+    return on_flash[asset - default_assets];
+}
+
+void default_files_uploaded(const char *path)
+{
+    const default_asset *a = default_files_lookup(path);
+    if (a && a->data) {
+        on_flash[a - default_assets] = true;
     }
-    *length = 0;
-    return 0;
 }
 
 //
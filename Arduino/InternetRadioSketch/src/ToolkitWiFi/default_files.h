@@ -1,13 +1,67 @@
 //
 // default_files.h
 
+//
+// The web pages built into the sketch, and the paths with a route of
+// their own (/, /upload, /favicon.ico).
+//
+// make_data.py turns data/ into default_files/assets.h, one constexpr
+// table with each page minified and gzipped, its length, MIME type and
+// ETags. The paths are in a perfect hash table, so finding one is
+// a hash and one strcmp, whatever the path.
+//
+// The built in pages are sent without touching the flash, unless the
+// flash has a different copy. default_files_begin() checks that once,
+// at boot, against the hash of the page in data/, and an upload
+// over a page marks it too. A page on the flash wins, so a changed
+// page can still be tried without building the sketch.
+//
+
 #ifndef _DEFAULT_FILES_H_
 #define _DEFAULT_FILES_H_
 
 #include <Arduino.h>
 
-boolean default_file_exists(const char *path);
-const char *default_files_find(const char *path, size_t *length);
+enum {
+    FILE_IS_ANY     = 0,
+    FILE_IS_ROOT,
+    FILE_IS_INDEX,
+    FILE_IS_FAVICON,
+    FILE_IS_UPLOAD
+};
+
+typedef struct {
+    const char *path;
+    uint32_t route;         // FILE_IS_*
+    const char *mime;       // the rest are NULL for a route only
+    const uint8_t *data;    // minified
+    size_t length;
+    const char *etag;
+    const uint8_t *gz;      // data gzipped
+    size_t gz_length;
+    const char *gz_etag;
+    const char *source_etag;    // of the page in data/
+} default_asset;
+
+// FNV-1a, the same as make_data.py .. constexpr so assets.h can check
+// its table when it's compiled
+constexpr uint32_t default_files_hash(const char *s, uint32_t h)
+{
+    return *s ? default_files_hash(s + 1,
+        (h ^ (uint8_t) *s) * 16777619u) : h;
+}
+
+// looks for different copies on the flash
+void default_files_begin();
+
+// NULL if path isn't built in
+const default_asset *default_files_lookup(const char *path);
+
+// true if the flash has its own copy of the page
+boolean default_files_onFlash(const default_asset *asset);
+
+// after path has been uploaded
+void default_files_uploaded(const char *path);
 
 #endif
 
@@ -0,0 +1,1296 @@
+//
+// assets.h
+//
+// Made by make_data.py from data/, don't edit it, run that.
+//
+
+enum {
+    DEFAULT_FILES_COUNT     = 8,
+    DEFAULT_FILES_SLOTS     = 16
+};
+
+static constexpr uint32_t default_files_seed = 0x811c9dc6u;
+
+// /index.html, 6133 bytes minified from 6542, gzip 1782
+static constexpr uint8_t asset_index_html[] = {
+  0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+  0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x6c,
+  0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68,
+  0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x74, 0x6f, 0x6f, 0x6c, 0x6b,
+  0x69, 0x74, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63,
+  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d,
+  0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x22, 0x3e, 0x0a, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65,
+  0x3e, 0x57, 0x61, 0x76, 0x65, 0x20, 0x46, 0x61, 0x72, 0x6d, 0x20, 0x2d, 0x20, 0x54, 0x6f, 0x6f,
+  0x6c, 0x6b, 0x69, 0x74, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x3c, 0x2f, 0x68,
+  0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x53, 0x54, 0x41, 0x52, 0x54, 0x20,
+  0x4f, 0x46, 0x20, 0x42, 0x4f, 0x44, 0x59, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64,
+  0x79, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x61, 0x73, 0x74, 0x65,
+  0x72, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x64, 0x69, 0x76, 0x5f, 0x6d, 0x61,
+  0x73, 0x74, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x31, 0x3e, 0x57, 0x61, 0x76, 0x65, 0x20,
+  0x46, 0x61, 0x72, 0x6d, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x3c, 0x2f, 0x68, 0x31,
+  0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x3e, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x57, 0x69, 0x46, 0x69,
+  0x20, 0x52, 0x6f, 0x75, 0x74, 0x65, 0x72, 0x3a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x6c,
+  0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x72,
+  0x6f, 0x75, 0x74, 0x65, 0x72, 0x5f, 0x53, 0x53, 0x49, 0x44, 0x22, 0x3e, 0x52, 0x6f, 0x75, 0x74,
+  0x65, 0x72, 0x20, 0x53, 0x53, 0x49, 0x44, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74,
+  0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x72, 0x6f,
+  0x75, 0x74, 0x65, 0x72, 0x5f, 0x53, 0x53, 0x49, 0x44, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x77, 0x69,
+  0x66, 0x69, 0x5f, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x72, 0x5f, 0x53, 0x53, 0x49, 0x44, 0x27, 0x29,
+  0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62,
+  0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x72, 0x6f, 0x75,
+  0x74, 0x65, 0x72, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x3e, 0x52, 0x6f,
+  0x75, 0x74, 0x65, 0x72, 0x20, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x3a, 0x20, 0x3c,
+  0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x20, 0x69,
+  0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x72, 0x5f, 0x70,
+  0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x0a, 0x6f, 0x6e, 0x66, 0x6f, 0x63, 0x75, 0x73,
+  0x3d, 0x22, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x54, 0x65, 0x78, 0x74, 0x28, 0x27, 0x77, 0x69, 0x66,
+  0x69, 0x5f, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x72, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72,
+  0x64, 0x27, 0x29, 0x22, 0x0a, 0x6f, 0x6e, 0x62, 0x6c, 0x75, 0x72, 0x3d, 0x22, 0x62, 0x6c, 0x75,
+  0x72, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x28, 0x27, 0x77, 0x69, 0x66, 0x69, 0x5f,
+  0x72, 0x6f, 0x75, 0x74, 0x65, 0x72, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x27,
+  0x29, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74,
+  0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x72, 0x6f, 0x75, 0x74, 0x65,
+  0x72, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x27, 0x29, 0x22, 0x20, 0x2f, 0x3e,
+  0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66,
+  0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74,
+  0x5f, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3e, 0x54, 0x6f, 0x6f, 0x6c, 0x6b,
+  0x69, 0x74, 0x20, 0x48, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x3a, 0x20, 0x3c, 0x2f, 0x6c,
+  0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70,
+  0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 0x66,
+  0x69, 0x5f, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5f, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61,
+  0x6d, 0x65, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65,
+  0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x74, 0x6f, 0x6f, 0x6c,
+  0x6b, 0x69, 0x74, 0x5f, 0x68, 0x6f, 0x73, 0x74, 0x6e, 0x61, 0x6d, 0x65, 0x27, 0x29, 0x22, 0x20,
+  0x2f, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x72, 0x6f, 0x75, 0x74, 0x65,
+  0x72, 0x5f, 0x69, 0x70, 0x22, 0x3e, 0x52, 0x6f, 0x75, 0x74, 0x65, 0x72, 0x20, 0x49, 0x50, 0x3a,
+  0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d,
+  0x22, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x72, 0x5f, 0x69, 0x70, 0x22,
+  0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69,
+  0x6e, 0x67, 0x28, 0x27, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x72, 0x6f, 0x75, 0x74, 0x65, 0x72, 0x5f,
+  0x69, 0x70, 0x27, 0x29, 0x22, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2f, 0x3e,
+  0x0a, 0x3c, 0x68, 0x32, 0x3e, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x20, 0x41, 0x63, 0x63,
+  0x65, 0x73, 0x73, 0x20, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x3a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a,
+  0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69,
+  0x5f, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5f, 0x41, 0x50, 0x5f, 0x53, 0x53, 0x49, 0x44,
+  0x22, 0x3e, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x20, 0x53, 0x53, 0x49, 0x44, 0x3a, 0x20,
+  0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+  0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+  0x77, 0x69, 0x66, 0x69, 0x5f, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5f, 0x41, 0x50, 0x5f,
+  0x53, 0x53, 0x49, 0x44, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22,
+  0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x74, 0x6f,
+  0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5f, 0x41, 0x50, 0x5f, 0x53, 0x53, 0x49, 0x44, 0x27, 0x29, 0x22,
+  0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x74, 0x6f, 0x6f, 0x6c,
+  0x6b, 0x69, 0x74, 0x5f, 0x41, 0x50, 0x5f, 0x49, 0x50, 0x22, 0x3e, 0x41, 0x63, 0x63, 0x65, 0x73,
+  0x73, 0x20, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x49, 0x50, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65,
+  0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x77, 0x69, 0x66, 0x69,
+  0x5f, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5f, 0x41, 0x50, 0x5f, 0x49, 0x50, 0x22, 0x0a,
+  0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e,
+  0x67, 0x28, 0x27, 0x77, 0x69, 0x66, 0x69, 0x5f, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5f,
+  0x41, 0x50, 0x5f, 0x49, 0x50, 0x27, 0x29, 0x22, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65,
+  0x64, 0x2f, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x3e, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x69, 0x6e,
+  0x67, 0x20, 0x2f, 0x20, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x69, 0x6e, 0x67, 0x3a, 0x3c, 0x2f,
+  0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22,
+  0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x75,
+  0x72, 0x6c, 0x22, 0x3e, 0x49, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x20, 0x55, 0x52, 0x4c, 0x3a,
+  0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74,
+  0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d,
+  0x22, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f,
+  0x75, 0x72, 0x6c, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x5f, 0x69,
+  0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x75, 0x72, 0x6c, 0x27, 0x29, 0x22, 0x20, 0x2f, 0x3e,
+  0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66,
+  0x6f, 0x72, 0x3d, 0x22, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61,
+  0x73, 0x74, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x3e, 0x49, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74,
+  0x20, 0x50, 0x6f, 0x72, 0x74, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a,
+  0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x22, 0x20, 0x6d, 0x69, 0x6e, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x6d, 0x61, 0x78,
+  0x3d, 0x22, 0x36, 0x35, 0x30, 0x30, 0x30, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22,
+  0x38, 0x30, 0x30, 0x30, 0x22, 0x0a, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+  0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x0a, 0x6f,
+  0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67,
+  0x28, 0x27, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74,
+  0x5f, 0x70, 0x6f, 0x72, 0x74, 0x27, 0x2c, 0x30, 0x29, 0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x62,
+  0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d,
+  0x22, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f,
+  0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x22, 0x3e, 0x49, 0x63, 0x65, 0x63,
+  0x61, 0x73, 0x74, 0x20, 0x4d, 0x6f, 0x75, 0x6e, 0x74, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x3a, 0x20,
+  0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20,
+  0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+  0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x6d,
+  0x6f, 0x75, 0x6e, 0x74, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61,
+  0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x6c, 0x69,
+  0x73, 0x74, 0x65, 0x6e, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x6d, 0x6f, 0x75,
+  0x6e, 0x74, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x27, 0x29, 0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x62,
+  0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d,
+  0x22, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x5f, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x22, 0x3e,
+  0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65,
+  0x20, 0x28, 0x30, 0x2e, 0x30, 0x20, 0x74, 0x6f, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3a, 0x20, 0x3c,
+  0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x3d, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6d, 0x69, 0x6e,
+  0x3d, 0x22, 0x30, 0x22, 0x2c, 0x20, 0x6d, 0x61, 0x78, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x73, 0x74,
+  0x65, 0x70, 0x3d, 0x22, 0x30, 0x2e, 0x30, 0x31, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+  0x22, 0x31, 0x2e, 0x30, 0x30, 0x22, 0x0a, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x69, 0x73, 0x74, 0x65,
+  0x6e, 0x5f, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e,
+  0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x6c, 0x69, 0x73,
+  0x74, 0x65, 0x6e, 0x5f, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x27, 0x2c, 0x32, 0x29, 0x22, 0x20,
+  0x2f, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x3e, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x69, 0x6e, 0x67,
+  0x20, 0x2f, 0x20, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x3a,
+  0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72,
+  0x3d, 0x22, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74,
+  0x5f, 0x75, 0x72, 0x6c, 0x22, 0x3e, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x3a, 0x20, 0x3c,
+  0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72,
+  0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x75, 0x72,
+  0x6c, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74,
+  0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65,
+  0x63, 0x61, 0x73, 0x74, 0x5f, 0x75, 0x72, 0x6c, 0x27, 0x29, 0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x3c,
+  0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72,
+  0x3d, 0x22, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74,
+  0x5f, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x3e, 0x50, 0x6f, 0x72, 0x74, 0x3a, 0x20, 0x3c, 0x2f, 0x6c,
+  0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70,
+  0x65, 0x3d, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20, 0x6d, 0x69, 0x6e, 0x3d, 0x22,
+  0x30, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x3d, 0x22, 0x36, 0x35, 0x30, 0x30, 0x30, 0x22, 0x20, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x38, 0x30, 0x30, 0x30, 0x22, 0x0a, 0x69, 0x64, 0x3d, 0x22,
+  0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x70,
+  0x6f, 0x72, 0x74, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69,
+  0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x70, 0x6f, 0x72, 0x74, 0x27, 0x2c, 0x30, 0x29, 0x22,
+  0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63,
+  0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x75, 0x73, 0x65, 0x72, 0x22, 0x3e, 0x49, 0x63, 0x65, 0x63,
+  0x61, 0x73, 0x74, 0x20, 0x55, 0x73, 0x65, 0x72, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22,
+  0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65,
+  0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x75, 0x73, 0x65, 0x72, 0x22, 0x0a, 0x6f,
+  0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67,
+  0x28, 0x27, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74,
+  0x5f, 0x75, 0x73, 0x65, 0x72, 0x27, 0x29, 0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20,
+  0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x72,
+  0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x70, 0x61,
+  0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x3e, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64,
+  0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64,
+  0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65,
+  0x63, 0x61, 0x73, 0x74, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x22, 0x0a, 0x6f,
+  0x6e, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x3d, 0x22, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x54, 0x65, 0x78,
+  0x74, 0x28, 0x27, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73,
+  0x74, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x27, 0x29, 0x22, 0x0a, 0x6f, 0x6e,
+  0x62, 0x6c, 0x75, 0x72, 0x3d, 0x22, 0x62, 0x6c, 0x75, 0x72, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f,
+  0x72, 0x64, 0x28, 0x27, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61,
+  0x73, 0x74, 0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x27, 0x29, 0x22, 0x0a, 0x6f,
+  0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67,
+  0x28, 0x27, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74,
+  0x5f, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x27, 0x29, 0x22, 0x20, 0x2f, 0x3e, 0x0a,
+  0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f,
+  0x72, 0x3d, 0x22, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73,
+  0x74, 0x5f, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x22, 0x3e, 0x49, 0x63,
+  0x65, 0x63, 0x61, 0x73, 0x74, 0x20, 0x4d, 0x6f, 0x75, 0x6e, 0x74, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+  0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64,
+  0x3d, 0x22, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74,
+  0x5f, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x22, 0x0a, 0x6f, 0x6e, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27,
+  0x72, 0x65, 0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x6d,
+  0x6f, 0x75, 0x6e, 0x74, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x27, 0x29, 0x22, 0x20, 0x2f, 0x3e, 0x0a,
+  0x3c, 0x68, 0x32, 0x3e, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x65, 0x72, 0x3a, 0x3c, 0x2f, 0x68, 0x32,
+  0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x6d, 0x69,
+  0x63, 0x5f, 0x6e, 0x6f, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x22, 0x3e, 0x4d, 0x69, 0x63, 0x72,
+  0x6f, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x20, 0x28, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x65,
+  0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x29, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x69, 0x63,
+  0x5f, 0x6e, 0x6f, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x3d, 0x22, 0x30, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73,
+  0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x6d, 0x69, 0x63, 0x5f, 0x6e, 0x6f, 0x74, 0x5f,
+  0x6c, 0x69, 0x6e, 0x65, 0x27, 0x29, 0x22, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a,
+  0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x63, 0x68, 0x61, 0x6e,
+  0x6e, 0x65, 0x6c, 0x73, 0x22, 0x3e, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x73, 0x3a, 0x20,
+  0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x73, 0x22, 0x20, 0x6f,
+  0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67,
+  0x28, 0x27, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x73, 0x27, 0x29, 0x22, 0x3e, 0x0a, 0x3c,
+  0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22,
+  0x3e, 0x4a, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x65, 0x72, 0x65, 0x6f, 0x20, 0x28, 0x63,
+  0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x20, 0x41, 0x47, 0x43, 0x29, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x44, 0x75, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x65, 0x72, 0x65,
+  0x6f, 0x20, 0x28, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x41, 0x47, 0x43, 0x29, 0x3c, 0x2f, 0x6f,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x4c, 0x65, 0x66, 0x74, 0x20, 0x6d, 0x6f,
+  0x6e, 0x6f, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x33, 0x22, 0x3e, 0x52, 0x69,
+  0x67, 0x68, 0x74, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x3c, 0x2f, 0x6f, 0x70, 0x69, 0x6f, 0x6e, 0x3e,
+  0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22,
+  0x34, 0x22, 0x3e, 0x4d, 0x69, 0x78, 0x65, 0x64, 0x20, 0x6d, 0x6f, 0x6e, 0x6f, 0x3c, 0x2f, 0x6f,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e,
+  0x0a, 0x3c, 0x2f, 0x62, 0x72, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f,
+  0x72, 0x3d, 0x22, 0x62, 0x69, 0x74, 0x72, 0x61, 0x74, 0x65, 0x22, 0x3e, 0x42, 0x69, 0x74, 0x72,
+  0x61, 0x74, 0x65, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x73,
+  0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x62, 0x69, 0x74, 0x72, 0x61, 0x74,
+  0x65, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74,
+  0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x62, 0x69, 0x74, 0x72, 0x61, 0x74, 0x65, 0x27, 0x29, 0x22,
+  0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+  0x22, 0x33, 0x32, 0x22, 0x3e, 0x33, 0x32, 0x20, 0x6b, 0x62, 0x70, 0x73, 0x3c, 0x2f, 0x6f, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x3d, 0x22, 0x36, 0x34, 0x22, 0x3e, 0x36, 0x34, 0x20, 0x6b, 0x62, 0x70, 0x73,
+  0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x39, 0x36, 0x22, 0x3e, 0x39, 0x36, 0x20,
+  0x6b, 0x62, 0x70, 0x73, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x32, 0x38,
+  0x22, 0x3e, 0x31, 0x32, 0x38, 0x20, 0x6b, 0x62, 0x70, 0x73, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x3d, 0x22, 0x31, 0x39, 0x32, 0x22, 0x3e, 0x31, 0x39, 0x32, 0x20, 0x6b, 0x62, 0x70, 0x73,
+  0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x72, 0x61,
+  0x74, 0x65, 0x22, 0x3e, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x72, 0x61, 0x74, 0x65, 0x3a,
+  0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63,
+  0x74, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x72, 0x61, 0x74,
+  0x65, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74,
+  0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x72, 0x61, 0x74,
+  0x65, 0x27, 0x29, 0x22, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61,
+  0x6c, 0x75, 0x65, 0x3d, 0x22, 0x33, 0x32, 0x30, 0x30, 0x30, 0x22, 0x3e, 0x33, 0x32, 0x30, 0x30,
+  0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x34, 0x34, 0x31, 0x30, 0x30, 0x22,
+  0x3e, 0x34, 0x34, 0x31, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a,
+  0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x34,
+  0x38, 0x30, 0x30, 0x30, 0x22, 0x3e, 0x34, 0x38, 0x30, 0x30, 0x30, 0x3c, 0x2f, 0x6f, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x0a, 0x3c,
+  0x2f, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f,
+  0x72, 0x3d, 0x22, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x5f, 0x67, 0x61, 0x69, 0x6e, 0x5f, 0x6c,
+  0x65, 0x76, 0x65, 0x6c, 0x22, 0x3e, 0x4d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x20, 0x67, 0x61, 0x69,
+  0x6e, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x20, 0x28, 0x30, 0x2e, 0x31, 0x20, 0x74, 0x6f, 0x20,
+  0x36, 0x34, 0x2e, 0x30, 0x29, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a,
+  0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x22, 0x20, 0x6d, 0x69, 0x6e, 0x3d, 0x22, 0x30, 0x2e, 0x31, 0x22, 0x2c, 0x20,
+  0x6d, 0x61, 0x78, 0x3d, 0x22, 0x36, 0x34, 0x2e, 0x30, 0x22, 0x20, 0x73, 0x74, 0x65, 0x70, 0x3d,
+  0x22, 0x30, 0x2e, 0x31, 0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x2e, 0x30,
+  0x22, 0x0a, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x5f, 0x67, 0x61, 0x69,
+  0x6e, 0x5f, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x6d, 0x61, 0x6e, 0x75,
+  0x61, 0x6c, 0x5f, 0x67, 0x61, 0x69, 0x6e, 0x5f, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x27, 0x2c, 0x31,
+  0x29, 0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x61, 0x67, 0x63, 0x5f, 0x6e, 0x6f, 0x74,
+  0x5f, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x22, 0x3e, 0x41, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74,
+  0x69, 0x63, 0x20, 0x47, 0x61, 0x69, 0x6e, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c,
+  0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x67, 0x63,
+  0x5f, 0x6e, 0x6f, 0x74, 0x5f, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x22, 0x20, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d,
+  0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x61, 0x67, 0x63, 0x5f, 0x6e, 0x6f,
+  0x74, 0x5f, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x27, 0x29, 0x22, 0x3e, 0x0a, 0x3c, 0x62, 0x72,
+  0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22,
+  0x61, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x5f, 0x67, 0x61, 0x69, 0x6e,
+  0x22, 0x3e, 0x4d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x41, 0x47, 0x43, 0x20, 0x67, 0x61,
+  0x69, 0x6e, 0x20, 0x28, 0x31, 0x2e, 0x30, 0x20, 0x74, 0x6f, 0x20, 0x36, 0x34, 0x2e, 0x30, 0x29,
+  0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x20,
+  0x6d, 0x69, 0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x2c, 0x20, 0x6d, 0x61, 0x78, 0x3d, 0x22,
+  0x36, 0x34, 0x2e, 0x30, 0x22, 0x20, 0x73, 0x74, 0x65, 0x70, 0x3d, 0x22, 0x30, 0x2e, 0x31, 0x22,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x34, 0x2e, 0x30, 0x22, 0x0a, 0x69, 0x64, 0x3d,
+  0x22, 0x61, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x5f, 0x67, 0x61, 0x69,
+  0x6e, 0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74,
+  0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x61, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75,
+  0x6d, 0x5f, 0x67, 0x61, 0x69, 0x6e, 0x27, 0x2c, 0x31, 0x29, 0x22, 0x20, 0x2f, 0x3e, 0x0a, 0x3c,
+  0x68, 0x32, 0x3e, 0x53, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70, 0x20, 0x4d, 0x6f, 0x64, 0x65, 0x3a,
+  0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72,
+  0x3d, 0x22, 0x73, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70, 0x5f, 0x61, 0x75, 0x74, 0x6f, 0x5f, 0x6d,
+  0x6f, 0x64, 0x65, 0x22, 0x3e, 0x41, 0x75, 0x74, 0x6f, 0x3a, 0x20, 0x3c, 0x2f, 0x6c, 0x61, 0x62,
+  0x65, 0x6c, 0x3e, 0x0a, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x22,
+  0x73, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70, 0x5f, 0x61, 0x75, 0x74, 0x6f, 0x5f, 0x6d, 0x6f, 0x64,
+  0x65, 0x22, 0x20, 0x6f, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3d, 0x22, 0x73, 0x65, 0x74,
+  0x74, 0x69, 0x6e, 0x67, 0x28, 0x27, 0x73, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70, 0x5f, 0x61, 0x75,
+  0x74, 0x6f, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x27, 0x29, 0x22, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x6c, 0x69, 0x73, 0x74, 0x65,
+  0x6e, 0x65, 0x72, 0x22, 0x3e, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x3c, 0x2f, 0x6f,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x74, 0x74, 0x65,
+  0x72, 0x22, 0x3e, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x72, 0x3c, 0x2f,
+  0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x72, 0x65, 0x6c, 0x61, 0x79, 0x22, 0x3e, 0x52, 0x65,
+  0x6c, 0x61, 0x79, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x6f, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x77, 0x61, 0x69, 0x74,
+  0x69, 0x6e, 0x67, 0x22, 0x3e, 0x57, 0x61, 0x69, 0x74, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x6f, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x0a,
+  0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x0a, 0x3c, 0x62, 0x72,
+  0x20, 0x2f, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f,
+  0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20,
+  0x69, 0x64, 0x3d, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x5f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e,
+  0x22, 0x0a, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x64, 0x54,
+  0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x28, 0x27, 0x24,
+  0x52, 0x45, 0x53, 0x45, 0x54, 0x27, 0x29, 0x22, 0x3e, 0x52, 0x65, 0x73, 0x65, 0x74, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74,
+  0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b,
+  0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x0a, 0x3c, 0x61,
+  0x75, 0x64, 0x69, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x20, 0x69, 0x64,
+  0x3d, 0x22, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x22, 0x20,
+  0x70, 0x72, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x3d, 0x22, 0x6e, 0x6f, 0x6e, 0x65, 0x22, 0x3e, 0x0a,
+  0x3c, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x73, 0x72, 0x63, 0x3d, 0x22, 0x73, 0x74, 0x72,
+  0x65, 0x61, 0x6d, 0x2e, 0x6d, 0x70, 0x33, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x61,
+  0x75, 0x64, 0x69, 0x6f, 0x2f, 0x6d, 0x70, 0x65, 0x67, 0x22, 0x3e, 0x0a, 0x5b, 0x41, 0x75, 0x64,
+  0x69, 0x6f, 0x20, 0x54, 0x61, 0x67, 0x5d, 0x0a, 0x3c, 0x2f, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x3e,
+  0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3b, 0x0a, 0x3c, 0x68,
+  0x33, 0x3e, 0x28, 0x4e, 0x6f, 0x76, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x32, 0x30, 0x32, 0x34,
+  0x29, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x62,
+  0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x45, 0x4e, 0x44, 0x20, 0x4f, 0x46,
+  0x20, 0x42, 0x4f, 0x44, 0x59, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x53,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72, 0x65, 0x66, 0x65,
+  0x72, 0x20, 0x74, 0x6f, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x20, 0x69, 0x6e, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x2d, 0x2d,
+  0x3e, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3d, 0x22, 0x74,
+  0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x2f, 0x2f,
+  0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x54, 0x69,
+  0x6d, 0x65, 0x6f, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f,
+  0x75, 0x74, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x41, 0x66, 0x74, 0x65, 0x72, 0x44, 0x65, 0x6c, 0x61,
+  0x79, 0x2c, 0x20, 0x32, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x41, 0x66, 0x74, 0x65, 0x72, 0x44, 0x65, 0x6c, 0x61,
+  0x79, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x54, 0x69, 0x6d, 0x65, 0x6f,
+  0x75, 0x74, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x29, 0x3b,
+  0x0a, 0x2f, 0x2f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x73,
+  0x68, 0x65, 0x65, 0x74, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x20, 0x3d,
+  0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x28, 0x27, 0x6c, 0x69, 0x6e, 0x6b, 0x27, 0x29, 0x3b,
+  0x0a, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x69, 0x64, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x27, 0x74, 0x6f,
+  0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x63, 0x73, 0x73, 0x27, 0x3b, 0x0a, 0x6c, 0x69, 0x6e, 0x6b, 0x2e,
+  0x72, 0x65, 0x6c, 0x20, 0x20, 0x3d, 0x20, 0x27, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65,
+  0x65, 0x74, 0x27, 0x3b, 0x0a, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3d,
+  0x20, 0x27, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x63, 0x73, 0x73, 0x27, 0x3b, 0x0a, 0x6c, 0x69, 0x6e,
+  0x6b, 0x2e, 0x68, 0x72, 0x65, 0x66, 0x20, 0x3d, 0x20, 0x27, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69,
+  0x74, 0x2e, 0x63, 0x73, 0x73, 0x27, 0x3b, 0x0a, 0x6c, 0x69, 0x6e, 0x6b, 0x2e, 0x6d, 0x65, 0x64,
+  0x69, 0x61, 0x20, 0x3d, 0x20, 0x27, 0x61, 0x6c, 0x6c, 0x27, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x68, 0x65, 0x61, 0x64, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64,
+  0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x6c, 0x69, 0x6e, 0x6b, 0x29, 0x3b, 0x0a, 0x2f, 0x2f, 0x20,
+  0x6c, 0x6f, 0x61, 0x64, 0x20, 0x6a, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x0a,
+  0x76, 0x61, 0x72, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63,
+  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x28, 0x27, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x27, 0x29, 0x3b, 0x0a, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x2e, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x22, 0x74, 0x6f, 0x6f, 0x6c,
+  0x6b, 0x69, 0x74, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3b, 0x0a, 0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2f, 0x6a, 0x61,
+  0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x0a, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x2e, 0x73, 0x72, 0x63, 0x20, 0x3d, 0x20, 0x22, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x2e,
+  0x6a, 0x73, 0x22, 0x0a, 0x2f, 0x2f, 0x20, 0x4f, 0x52, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x2e, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x27, 0x73,
+  0x72, 0x63, 0x27, 0x2c, 0x27, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x2e, 0x6a, 0x73, 0x27,
+  0x29, 0x3b, 0x0a, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79,
+  0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x73, 0x63, 0x72,
+  0x69, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x61,
+  0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+  0x22, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x0a, 0x7b, 0x0a, 0x2f, 0x2f, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x20, 0x73, 0x75, 0x72, 0x65,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x53, 0x20, 0x69, 0x73, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69,
+  0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x68, 0x61, 0x73, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x0a, 0x69, 0x66, 0x20, 0x28,
+  0x21, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x69,
+  0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29, 0x20, 0x7b, 0x0a,
+  0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6f, 0x70,
+  0x65, 0x6e, 0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x2c, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65,
+  0x29, 0x3b, 0x0a, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x68,
+  0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+};
+static constexpr uint8_t asset_index_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0x6d, 0x6f, 0xdb, 0x36,
+  0x10, 0xfe, 0xee, 0x5f, 0xc1, 0x0a, 0xc3, 0xec, 0x00, 0x89, 0xdf, 0x92, 0x05, 0x7d, 0x89, 0x05,
+  0xb8, 0x49, 0xda, 0x65, 0x48, 0x1b, 0x23, 0xf6, 0x16, 0x14, 0xc3, 0x60, 0xd0, 0x12, 0x1d, 0xb3,
+  0x96, 0x48, 0x41, 0xa4, 0x9c, 0x04, 0x45, 0xff, 0xfb, 0xee, 0x48, 0xc9, 0x96, 0x65, 0xc9, 0x56,
+  0xb0, 0xe5, 0x43, 0x24, 0x92, 0xcf, 0x91, 0xcf, 0x3d, 0x3c, 0x9e, 0xce, 0xbc, 0x78, 0x73, 0x75,
+  0x77, 0x39, 0xf9, 0x36, 0xba, 0x26, 0x0b, 0x1d, 0x06, 0x6e, 0xe3, 0x22, 0x7b, 0x30, 0xea, 0xc3,
+  0x23, 0xe0, 0x62, 0x49, 0x62, 0x16, 0x0c, 0x1c, 0xa5, 0x5f, 0x02, 0xa6, 0x16, 0x8c, 0x69, 0x87,
+  0x2c, 0x62, 0x36, 0x1f, 0x38, 0x5a, 0xca, 0x60, 0xc9, 0x75, 0xdb, 0x53, 0xca, 0x01, 0x68, 0xc8,
+  0x34, 0x25, 0x82, 0x86, 0x6c, 0xe0, 0xac, 0x38, 0x7b, 0x8a, 0x64, 0x0c, 0x48, 0x4f, 0x0a, 0xcd,
+  0x84, 0x1e, 0x38, 0x5c, 0x70, 0xcd, 0x69, 0x70, 0xa2, 0x3c, 0x1a, 0xb0, 0x41, 0x0f, 0x0d, 0x34,
+  0xd7, 0x01, 0x73, 0x1f, 0xe8, 0x8a, 0x91, 0x4f, 0x34, 0x0e, 0xc9, 0x09, 0x99, 0xd8, 0x19, 0x2f,
+  0x3a, 0x76, 0xa8, 0x71, 0xd1, 0x49, 0x69, 0xbc, 0x39, 0x39, 0x21, 0xe3, 0xc9, 0xf0, 0x7e, 0x42,
+  0xee, 0x3e, 0x91, 0x8f, 0x77, 0x57, 0xdf, 0xc8, 0xc9, 0x09, 0x74, 0xcf, 0xa4, 0xff, 0xe2, 0x5e,
+  0xf8, 0x7c, 0x45, 0xb8, 0x3f, 0x70, 0x42, 0xaa, 0x34, 0x8b, 0x61, 0xcd, 0x80, 0x2a, 0x35, 0x70,
+  0xa0, 0x7b, 0x9a, 0x76, 0xa1, 0x3f, 0xbd, 0xdc, 0x4a, 0xeb, 0x75, 0xa0, 0x17, 0x86, 0xfa, 0xee,
+  0xad, 0x04, 0x5a, 0xe4, 0x81, 0x7f, 0xe2, 0xe4, 0x5e, 0x26, 0x60, 0xf2, 0x1e, 0xc6, 0xfa, 0xe8,
+  0x3f, 0x9d, 0xb1, 0x80, 0xcc, 0x65, 0x3c, 0x70, 0x9e, 0xf8, 0x9c, 0x4f, 0x63, 0x33, 0x3a, 0x1d,
+  0x8f, 0x6f, 0xae, 0x1c, 0xd7, 0x42, 0x09, 0x36, 0xde, 0x93, 0x8b, 0x8e, 0xc1, 0x82, 0x0d, 0x17,
+  0x51, 0xa2, 0x89, 0x7e, 0x89, 0x40, 0x09, 0xcd, 0x9e, 0x41, 0x05, 0x64, 0xb7, 0x63, 0xde, 0x90,
+  0xc2, 0x5b, 0x50, 0xf1, 0x08, 0x28, 0xc5, 0xb4, 0xe6, 0xe2, 0xb1, 0xd5, 0x2c, 0x82, 0x9a, 0x47,
+  0x0e, 0xe9, 0xa0, 0xa3, 0xb1, 0x79, 0x54, 0xb0, 0x89, 0xc0, 0xdf, 0x27, 0x19, 0xfb, 0x6b, 0x46,
+  0xa3, 0xb4, 0xa3, 0x8a, 0xd5, 0xda, 0x60, 0x87, 0xd9, 0x7a, 0x04, 0xd8, 0xcd, 0xa5, 0x97, 0x80,
+  0x8e, 0xe6, 0x31, 0x01, 0x3f, 0xb6, 0xe9, 0x65, 0x48, 0xa0, 0x08, 0xd8, 0x59, 0x90, 0x00, 0x29,
+  0xfc, 0x9f, 0xad, 0xbd, 0x0f, 0xbd, 0xd7, 0xef, 0x1c, 0x74, 0x9f, 0xef, 0x69, 0xf4, 0x4d, 0x17,
+  0x52, 0x69, 0x8c, 0x3a, 0xc7, 0x4d, 0x77, 0x95, 0xfc, 0x9e, 0xf6, 0xd4, 0xdc, 0x93, 0x9d, 0x89,
+  0x2a, 0x09, 0x16, 0x91, 0xf5, 0x76, 0x87, 0x47, 0xeb, 0x7d, 0xb9, 0x19, 0xbd, 0x2e, 0x4e, 0xc0,
+  0xf4, 0x90, 0x5a, 0x3c, 0x42, 0x16, 0x3e, 0x57, 0x74, 0x16, 0x30, 0xbf, 0x63, 0xc3, 0x39, 0x53,
+  0x62, 0xe8, 0x79, 0x4c, 0x29, 0x32, 0x92, 0x5c, 0xe8, 0xaa, 0x88, 0xce, 0x9c, 0x1a, 0x8e, 0xd2,
+  0xa8, 0xce, 0x8c, 0x5f, 0x11, 0xd6, 0xc5, 0x39, 0x0e, 0x2a, 0x98, 0x02, 0x6b, 0x6e, 0x31, 0xa0,
+  0x6f, 0x46, 0x8e, 0x9b, 0xf7, 0xa6, 0xbe, 0x94, 0xdb, 0x93, 0xd4, 0x61, 0x76, 0x33, 0x2a, 0x91,
+  0xf4, 0x96, 0x43, 0x26, 0x11, 0x80, 0x27, 0x1d, 0x72, 0xcf, 0x3c, 0xc6, 0x57, 0xf0, 0x5e, 0xa2,
+  0x69, 0x60, 0x70, 0x53, 0xee, 0x31, 0x0f, 0x72, 0xcf, 0x34, 0x89, 0x03, 0xc7, 0xbd, 0xb1, 0x0d,
+  0xf2, 0xe7, 0xfd, 0xed, 0x61, 0xd2, 0x25, 0x13, 0x94, 0x91, 0xde, 0x85, 0x55, 0x8b, 0x59, 0xc0,
+  0x9a, 0xcc, 0xbc, 0x26, 0x35, 0x82, 0x56, 0x15, 0x2b, 0x91, 0x84, 0x33, 0xcc, 0xa8, 0x21, 0x17,
+  0x03, 0xa7, 0x0b, 0x4f, 0xfa, 0x3c, 0x70, 0xce, 0x7f, 0xeb, 0x76, 0xe1, 0x7d, 0x45, 0x83, 0x04,
+  0x20, 0x6f, 0xb1, 0xd1, 0x28, 0x21, 0x6e, 0x56, 0xa9, 0xc1, 0x1c, 0x71, 0xcd, 0xe3, 0x6e, 0x5d,
+  0xf2, 0xa1, 0x4c, 0x84, 0x8e, 0x30, 0x04, 0x36, 0x2e, 0x7c, 0x59, 0xf7, 0xbd, 0x5a, 0xde, 0xdc,
+  0x74, 0x35, 0xb8, 0x6e, 0xd0, 0x07, 0xc5, 0x5e, 0xc9, 0x20, 0xc1, 0xa4, 0xb4, 0x89, 0x9b, 0xbf,
+  0x4c, 0x0f, 0x69, 0x75, 0xdb, 0x5d, 0xa2, 0x25, 0xe9, 0xb5, 0xbb, 0x47, 0x35, 0x75, 0x3f, 0xb6,
+  0xc2, 0xf7, 0x1c, 0x02, 0x73, 0x45, 0xd0, 0xd3, 0xee, 0xf6, 0xd6, 0x1b, 0x00, 0xf3, 0x6c, 0x6f,
+  0x40, 0xba, 0xf2, 0x1e, 0x77, 0x2c, 0xa2, 0x79, 0xdc, 0x4f, 0x9d, 0x80, 0x18, 0x1e, 0xeb, 0x98,
+  0xd1, 0xd0, 0x86, 0xf7, 0x24, 0xa6, 0x42, 0x85, 0xdc, 0xd8, 0x94, 0x44, 0x78, 0xcc, 0x42, 0xa9,
+  0xd9, 0x76, 0x84, 0x0f, 0x7d, 0x3f, 0x86, 0xb3, 0x79, 0x58, 0xfe, 0x12, 0xe3, 0x32, 0xa2, 0xbb,
+  0xb0, 0x6a, 0xc1, 0x0b, 0x58, 0x1b, 0xdd, 0xff, 0x5b, 0x54, 0x97, 0xcd, 0x5e, 0x83, 0xf1, 0xa1,
+  0xa8, 0x2e, 0x3a, 0xa8, 0xb0, 0x4a, 0x59, 0xe7, 0x09, 0x68, 0xbd, 0x5e, 0x4a, 0x9c, 0xa2, 0x8e,
+  0x96, 0x80, 0xab, 0x2f, 0xe6, 0xba, 0xb2, 0x78, 0x5d, 0x49, 0x51, 0x35, 0x4d, 0x69, 0x55, 0x51,
+  0x01, 0xae, 0x2e, 0x2c, 0xf6, 0x1a, 0x1c, 0xdc, 0x99, 0x83, 0xe5, 0x45, 0xc1, 0xe0, 0xbf, 0x66,
+  0x9c, 0xea, 0xe9, 0x6a, 0xb0, 0xdd, 0xcd, 0x38, 0x70, 0x1c, 0xaf, 0x85, 0x27, 0xfd, 0xd2, 0x1a,
+  0x35, 0xe4, 0xde, 0x54, 0x48, 0x3d, 0x85, 0xb2, 0x1d, 0x72, 0xcf, 0x17, 0xee, 0xc5, 0x32, 0x5a,
+  0x48, 0x01, 0x59, 0x07, 0x7a, 0x09, 0xf6, 0x12, 0x43, 0xb2, 0x32, 0xf3, 0x78, 0x0b, 0xe6, 0x2d,
+  0x67, 0xf2, 0xd9, 0x52, 0xdf, 0x9a, 0x2e, 0x3b, 0x1b, 0xdd, 0x52, 0xde, 0x79, 0x28, 0x50, 0x2d,
+  0x15, 0x16, 0x8d, 0x04, 0x0b, 0xe0, 0xd7, 0xc2, 0x65, 0xfa, 0x96, 0xa7, 0xa1, 0x58, 0xc0, 0x3c,
+  0x6d, 0xd6, 0x5d, 0x03, 0x49, 0xc9, 0x4a, 0xd9, 0xa0, 0x5d, 0x45, 0x46, 0x9a, 0x4b, 0xb1, 0xe1,
+  0xe6, 0xfe, 0x61, 0xca, 0x03, 0x2c, 0xfb, 0x99, 0x24, 0x2d, 0x4f, 0x86, 0x21, 0x0c, 0x0f, 0x3f,
+  0x5f, 0x1e, 0x5d, 0x74, 0x2c, 0x76, 0xc7, 0x08, 0x7e, 0x8c, 0x5c, 0x25, 0x50, 0xfe, 0x67, 0x36,
+  0x2a, 0x0a, 0xb0, 0x76, 0xda, 0x67, 0xd2, 0x87, 0xc4, 0xce, 0xe6, 0x9a, 0xc0, 0xdc, 0xb2, 0x12,
+  0x74, 0x0a, 0x75, 0x1f, 0x7f, 0x5c, 0x6c, 0x50, 0x65, 0xa0, 0x33, 0xdc, 0xa6, 0x67, 0xe6, 0x17,
+  0xa7, 0xea, 0x58, 0x39, 0xf0, 0x6d, 0x16, 0x6f, 0xcb, 0x38, 0xe3, 0x3a, 0xa6, 0x1a, 0xf6, 0xf7,
+  0xa3, 0x7d, 0xa9, 0x10, 0x31, 0x83, 0x95, 0x69, 0x98, 0x8e, 0x95, 0x49, 0x78, 0x0a, 0xbe, 0x9d,
+  0xf6, 0xc9, 0x72, 0x16, 0xa9, 0x4a, 0xcf, 0xce, 0x81, 0xf5, 0xf9, 0xd9, 0x7e, 0xcc, 0xbb, 0x73,
+  0xc7, 0x7d, 0x77, 0xbe, 0x1f, 0xd3, 0xeb, 0xbf, 0x75, 0x5c, 0xf8, 0x77, 0x00, 0xf5, 0x0e, 0x28,
+  0xc1, 0xbf, 0x22, 0x6a, 0x23, 0xd1, 0x6e, 0xa8, 0x29, 0x1a, 0x46, 0x01, 0x9b, 0x5a, 0x9d, 0xc6,
+  0xa6, 0x41, 0xf6, 0x68, 0x95, 0x87, 0x97, 0xe9, 0x95, 0x1b, 0x2f, 0xd7, 0x0c, 0xbf, 0x17, 0xae,
+  0x79, 0x54, 0xba, 0x71, 0x76, 0xd6, 0x43, 0x90, 0x79, 0x54, 0x83, 0xcc, 0x97, 0xc7, 0x35, 0x8f,
+  0xaa, 0x68, 0x28, 0xfa, 0x1a, 0x52, 0x01, 0xe1, 0x3b, 0x7d, 0xa4, 0x5c, 0x4c, 0x03, 0xb6, 0x62,
+  0xf0, 0x3d, 0xfe, 0x62, 0xba, 0x08, 0x76, 0x11, 0xd3, 0x85, 0x65, 0x47, 0x0f, 0xcb, 0x8e, 0xf3,
+  0xb3, 0xda, 0x75, 0x47, 0xbb, 0x97, 0x55, 0x1e, 0x68, 0xb4, 0x29, 0x3e, 0xb6, 0x6a, 0x0f, 0xfb,
+  0x95, 0xdc, 0xa5, 0x50, 0x9a, 0x23, 0x8a, 0xa8, 0xe6, 0x71, 0xaf, 0x32, 0x0b, 0xd3, 0x47, 0x9b,
+  0x50, 0xac, 0x11, 0x94, 0x18, 0x89, 0x96, 0x21, 0xd5, 0xdc, 0x23, 0x9f, 0xc1, 0xbe, 0x5e, 0xfe,
+  0x2a, 0xcc, 0xb1, 0x3f, 0x83, 0x6d, 0x83, 0xab, 0x72, 0x18, 0xa2, 0x40, 0x13, 0x1e, 0x26, 0xa1,
+  0x71, 0x04, 0xb5, 0x36, 0x2d, 0x4c, 0x18, 0x56, 0xf0, 0x56, 0xcf, 0x56, 0x78, 0xf5, 0xa5, 0x46,
+  0x1d, 0x0f, 0x48, 0x7d, 0x96, 0x49, 0xbd, 0x43, 0xa0, 0xca, 0x97, 0x3c, 0x68, 0x23, 0xb4, 0xa9,
+  0xf5, 0x68, 0xac, 0x93, 0x08, 0x3e, 0x62, 0x3e, 0x2b, 0xf9, 0x86, 0x28, 0x3b, 0x3c, 0xa5, 0x20,
+  0x38, 0x7c, 0x7f, 0x7c, 0x66, 0xb5, 0xaf, 0x3a, 0x39, 0x3b, 0xe8, 0xd2, 0xf3, 0x53, 0x44, 0x95,
+  0x9d, 0x22, 0x5b, 0x9d, 0x62, 0x21, 0x74, 0x9b, 0xbe, 0x55, 0x1e, 0x13, 0x9d, 0x95, 0xa8, 0x88,
+  0x9e, 0x6c, 0x1a, 0x95, 0x06, 0x31, 0x0b, 0xe8, 0x0b, 0xe4, 0x63, 0x7c, 0x54, 0x82, 0x9e, 0x28,
+  0x47, 0xba, 0x8e, 0xfb, 0x60, 0x5f, 0xaa, 0x73, 0xcd, 0xaf, 0x62, 0xa6, 0xa2, 0x0f, 0xc5, 0x46,
+  0xa2, 0x35, 0x4c, 0x66, 0xf7, 0xd7, 0x36, 0xb2, 0x0a, 0x00, 0x84, 0x98, 0xa6, 0x3d, 0xb8, 0x5d,
+  0x01, 0xf7, 0x96, 0xa8, 0x8e, 0xf0, 0xd3, 0x1f, 0xdb, 0x97, 0xf0, 0x99, 0xa2, 0x02, 0x4a, 0x9b,
+  0x5f, 0xee, 0xaf, 0xc7, 0xd7, 0x13, 0x54, 0xe7, 0x1e, 0x8d, 0x88, 0x5e, 0xb0, 0xcd, 0x6d, 0x95,
+  0x9d, 0x61, 0x2f, 0x07, 0x9a, 0xf8, 0x5c, 0x9a, 0x5b, 0xb7, 0x58, 0x06, 0xca, 0x1e, 0x02, 0xec,
+  0x9a, 0x2a, 0x53, 0xe0, 0x3b, 0x24, 0x02, 0x25, 0x24, 0x85, 0x6e, 0x21, 0xb1, 0x44, 0x80, 0xbd,
+  0x94, 0x49, 0xec, 0x31, 0xa2, 0x62, 0x0f, 0x37, 0x13, 0x41, 0xed, 0x30, 0x3a, 0x75, 0x52, 0x37,
+  0x8c, 0x71, 0x27, 0x8c, 0x18, 0xa8, 0xd2, 0xf8, 0x7b, 0x68, 0x66, 0x9f, 0xd0, 0xc7, 0x7f, 0x40,
+  0x11, 0x33, 0x54, 0x24, 0xb3, 0x38, 0x75, 0x5b, 0x5f, 0xe5, 0x8a, 0x61, 0x70, 0x93, 0x7e, 0xb7,
+  0x7f, 0x06, 0xdf, 0x50, 0xe8, 0x03, 0xb8, 0xcf, 0x57, 0x2e, 0xb8, 0x80, 0x37, 0x76, 0xf6, 0x3e,
+  0xef, 0xfa, 0xeb, 0xd5, 0xf6, 0x6d, 0x9e, 0xb9, 0xe4, 0xf3, 0x62, 0x1e, 0x69, 0x05, 0x7e, 0x53,
+  0x4d, 0x62, 0x36, 0x87, 0x59, 0xe0, 0x24, 0xc9, 0xd9, 0x77, 0x10, 0x1f, 0xdc, 0x11, 0x46, 0x10,
+  0xbc, 0xa2, 0x24, 0x58, 0x02, 0x59, 0x3b, 0x65, 0x6c, 0xac, 0x07, 0xd9, 0x9d, 0xe4, 0x77, 0x28,
+  0x32, 0x60, 0xd3, 0xcc, 0xc8, 0x1a, 0xe2, 0x36, 0x3a, 0x1d, 0x02, 0x7f, 0x20, 0x0f, 0xd4, 0x70,
+  0x28, 0xc3, 0x84, 0x87, 0x4c, 0xc2, 0x99, 0x1c, 0x10, 0x10, 0x3b, 0x6d, 0xb4, 0x70, 0x60, 0x38,
+  0x87, 0x68, 0xba, 0xc2, 0x68, 0x39, 0x26, 0x98, 0xd5, 0x8f, 0x3e, 0x34, 0xe6, 0x89, 0xf0, 0x4c,
+  0xb4, 0x6c, 0x8f, 0xb7, 0x8e, 0xc8, 0x8f, 0x86, 0x17, 0x30, 0x1a, 0xe7, 0xed, 0xd3, 0x77, 0x30,
+  0x83, 0x25, 0xb1, 0x83, 0x98, 0xfb, 0x53, 0x62, 0x2e, 0x50, 0x1b, 0x2b, 0x1a, 0x13, 0x73, 0xb3,
+  0x0a, 0x0b, 0xfb, 0x50, 0x08, 0x87, 0x4c, 0xe8, 0xb6, 0x07, 0xda, 0x6b, 0x76, 0x1d, 0x30, 0x6c,
+  0xe1, 0x6f, 0x35, 0xb1, 0x6c, 0x82, 0x3d, 0x3e, 0xdb, 0xdc, 0x27, 0x88, 0x6d, 0xa6, 0xee, 0x79,
+  0x4a, 0x35, 0xd3, 0x11, 0xd8, 0x4e, 0x33, 0xb2, 0xb9, 0x9e, 0xcd, 0x46, 0x70, 0x03, 0x8d, 0x0d,
+  0x54, 0xa2, 0x9d, 0x9c, 0x05, 0x5e, 0xde, 0xe6, 0xe6, 0x6a, 0xe7, 0x86, 0x42, 0xe6, 0x73, 0x8a,
+  0x63, 0x34, 0x08, 0xa0, 0x6f, 0x4d, 0x0d, 0x6f, 0x61, 0xdb, 0x34, 0x8a, 0x20, 0x60, 0x2f, 0x17,
+  0x3c, 0xf0, 0x5b, 0x88, 0xce, 0xf9, 0xf6, 0x9d, 0xae, 0xa8, 0x95, 0xd8, 0xb8, 0x96, 0x6e, 0x48,
+  0xb5, 0x6f, 0x16, 0x80, 0xde, 0xd9, 0x37, 0xf4, 0x6f, 0x40, 0xb2, 0xcd, 0xb3, 0x7d, 0xce, 0x7a,
+  0x70, 0x53, 0x50, 0x77, 0x36, 0x0b, 0x39, 0xd9, 0x28, 0x6c, 0x7b, 0xce, 0x16, 0x37, 0x1e, 0x69,
+  0xdd, 0xdd, 0x93, 0x6c, 0x9c, 0xe9, 0xa1, 0xd6, 0x31, 0x87, 0xc3, 0xc3, 0x60, 0xe5, 0xd8, 0x6b,
+  0x1e, 0x37, 0x37, 0x60, 0xe4, 0xb0, 0x66, 0x89, 0xc1, 0xb9, 0xe5, 0xa6, 0x9d, 0x02, 0x20, 0x3f,
+  0x1b, 0x4f, 0x5c, 0xf8, 0xf2, 0xa9, 0x4d, 0x7d, 0xff, 0x7a, 0x05, 0xd8, 0x2c, 0x43, 0xb5, 0xec,
+  0x0f, 0x19, 0xc8, 0xde, 0x59, 0x78, 0xb4, 0x18, 0x8e, 0x1f, 0x35, 0x7e, 0x20, 0x0d, 0xf3, 0x39,
+  0xc2, 0x08, 0x0e, 0xe9, 0x12, 0x36, 0x3f, 0x89, 0x99, 0x09, 0xe0, 0x87, 0x31, 0xe1, 0x8a, 0xc4,
+  0x89, 0x30, 0x17, 0x03, 0x70, 0xf0, 0xc9, 0x82, 0x2a, 0x92, 0x44, 0x3e, 0x88, 0xe4, 0x93, 0x34,
+  0x6b, 0xaa, 0x06, 0x9f, 0x93, 0xd6, 0x9b, 0x94, 0xeb, 0x58, 0x7a, 0x4b, 0x06, 0x42, 0xa9, 0x4b,
+  0x09, 0xd5, 0xaf, 0x07, 0xb8, 0xd6, 0x11, 0x46, 0xde, 0xf6, 0xb0, 0x04, 0xee, 0x2d, 0xc3, 0xf7,
+  0x27, 0x30, 0xa2, 0x81, 0x62, 0xd0, 0xc8, 0x9d, 0x83, 0x8e, 0xbd, 0xdd, 0xff, 0x17, 0x3c, 0x59,
+  0xb4, 0x7b, 0xf5, 0x17, 0x00, 0x00,
+};
+
+// /toolkit.js, 5673 bytes minified from 8971, gzip 1811
+static constexpr uint8_t asset_toolkit_js[] = {
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x61, 0x6c, 0x57, 0x69, 0x74,
+  0x68, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2c, 0x20, 0x70, 0x72,
+  0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0x0a, 0x7b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x6e,
+  0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x65, 0x6c,
+  0x65, 0x6d, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x3b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x6d,
+  0x69, 0x6e, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28,
+  0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x6d, 0x69, 0x6e, 0x29, 0x3b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x6d,
+  0x61, 0x78, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28,
+  0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x6d, 0x61, 0x78, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x6e,
+  0x20, 0x3c, 0x20, 0x6d, 0x69, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x6e, 0x20, 0x3d, 0x20, 0x6d, 0x69,
+  0x6e, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x20,
+  0x3e, 0x20, 0x6d, 0x61, 0x78, 0x29, 0x20, 0x7b, 0x0a, 0x6e, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x78,
+  0x3b, 0x0a, 0x7d, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d,
+  0x20, 0x6e, 0x2e, 0x74, 0x6f, 0x46, 0x69, 0x78, 0x65, 0x64, 0x28, 0x70, 0x72, 0x65, 0x63, 0x69,
+  0x73, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x64, 0x65, 0x61, 0x6c, 0x57, 0x69, 0x74, 0x68, 0x50, 0x6f, 0x70, 0x75, 0x70, 0x28,
+  0x65, 0x6c, 0x65, 0x6d, 0x29, 0x0a, 0x7b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x64, 0x65, 0x61, 0x6c, 0x57, 0x69, 0x74, 0x68, 0x43, 0x68, 0x65, 0x63, 0x6b,
+  0x62, 0x6f, 0x78, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x29, 0x0a, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28,
+  0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x29, 0x20, 0x7b, 0x0a,
+  0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x31, 0x22,
+  0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x30, 0x22, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d,
+  0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e,
+  0x67, 0x28, 0x69, 0x64, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x29,
+  0x0a, 0x7b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x64, 0x6f,
+  0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+  0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x22,
+  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x3d, 0x3d, 0x74, 0x79, 0x70, 0x65, 0x6f, 0x66, 0x28,
+  0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x64, 0x65,
+  0x61, 0x6c, 0x57, 0x69, 0x74, 0x68, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x65, 0x6c, 0x65,
+  0x6d, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0x0a, 0x7d,
+  0x20, 0x2f, 0x2a, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x22, 0x53, 0x45, 0x4c,
+  0x45, 0x43, 0x54, 0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x6e, 0x6f, 0x64, 0x65,
+  0x4e, 0x61, 0x6d, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x64, 0x65, 0x61, 0x6c, 0x57, 0x69, 0x74, 0x68,
+  0x50, 0x6f, 0x70, 0x75, 0x70, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x2a,
+  0x2f, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x22, 0x49, 0x4e, 0x50, 0x55,
+  0x54, 0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x6e, 0x6f, 0x64, 0x65, 0x4e, 0x61,
+  0x6d, 0x65, 0x29, 0x26, 0x26, 0x28, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22,
+  0x3d, 0x3d, 0x3d, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x29, 0x29, 0x20, 0x7b,
+  0x0a, 0x64, 0x65, 0x61, 0x6c, 0x57, 0x69, 0x74, 0x68, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f,
+  0x78, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74,
+  0x72, 0x69, 0x70, 0x73, 0x20, 0x6c, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x73,
+  0x0a, 0x73, 0x65, 0x6e, 0x64, 0x54, 0x6f, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x28, 0x69,
+  0x64, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x63, 0x75, 0x73,
+  0x54, 0x65, 0x78, 0x74, 0x28, 0x69, 0x64, 0x29, 0x0a, 0x7b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x65,
+  0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67,
+  0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64,
+  0x29, 0x3b, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x22,
+  0x74, 0x65, 0x78, 0x74, 0x22, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x62, 0x6c, 0x75, 0x72, 0x50, 0x61, 0x73, 0x73, 0x77, 0x6f, 0x72, 0x64, 0x28, 0x69,
+  0x64, 0x29, 0x0a, 0x7b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d,
+  0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x65, 0x6c, 0x65,
+  0x6d, 0x2e, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6f,
+  0x72, 0x64, 0x22, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x55, 0x49, 0x28, 0x69, 0x64, 0x2c, 0x20, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x2c, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0x0a, 0x7b,
+  0x0a, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75,
+  0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42,
+  0x79, 0x49, 0x64, 0x28, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x65, 0x6c, 0x65,
+  0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x22, 0x6e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x22, 0x3d, 0x3d, 0x74, 0x79, 0x70, 0x65, 0x6f, 0x66, 0x28, 0x70, 0x72,
+  0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x64, 0x65, 0x61, 0x6c,
+  0x57, 0x69, 0x74, 0x68, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2c,
+  0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x69,
+  0x66, 0x20, 0x28, 0x28, 0x22, 0x49, 0x4e, 0x50, 0x55, 0x54, 0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x6c,
+  0x65, 0x6d, 0x2e, 0x6e, 0x6f, 0x64, 0x65, 0x4e, 0x61, 0x6d, 0x65, 0x29, 0x26, 0x26, 0x28, 0x22,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f, 0x78, 0x22, 0x3d, 0x3d, 0x3d, 0x65, 0x6c, 0x65, 0x6d,
+  0x2e, 0x74, 0x79, 0x70, 0x65, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x28, 0x22, 0x31, 0x22, 0x3d, 0x3d, 0x65,
+  0x6c, 0x65, 0x6d, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a,
+  0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+  0x41, 0x75, 0x64, 0x69, 0x6f, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x6c,
+  0x65, 0x6d, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65,
+  0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x61, 0x75,
+  0x64, 0x69, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x22, 0x29, 0x3b, 0x0a, 0x69, 0x66,
+  0x20, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x74,
+  0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x2f, 0x6d, 0x70, 0x65,
+  0x67, 0x22, 0x3b, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x73, 0x72, 0x63, 0x20, 0x3d, 0x20, 0x22,
+  0x61, 0x75, 0x64, 0x69, 0x6f, 0x2e, 0x6d, 0x70, 0x33, 0x22, 0x3b, 0x0a, 0x65, 0x6c, 0x65, 0x6d,
+  0x2e, 0x70, 0x6c, 0x61, 0x79, 0x28, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65,
+  0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x41, 0x75, 0x64, 0x69,
+  0x6f, 0x22, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x6e,
+  0x69, 0x74, 0x6f, 0x72, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c,
+  0x6c, 0x3b, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74, 0x61, 0x72,
+  0x74, 0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0x6c, 0x65, 0x74,
+  0x20, 0x65, 0x6c, 0x65, 0x6d, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74,
+  0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+  0x22, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x22, 0x29, 0x3b,
+  0x0a, 0x69, 0x66, 0x20, 0x28, 0x21, 0x65, 0x6c, 0x65, 0x6d, 0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x21, 0x77, 0x69, 0x6e,
+  0x64, 0x6f, 0x77, 0x2e, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20,
+  0x7c, 0x7c, 0x20, 0x21, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e,
+  0x69, 0x73, 0x54, 0x79, 0x70, 0x65, 0x53, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x28,
+  0x22, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x2f, 0x6d, 0x70, 0x65, 0x67, 0x22, 0x29, 0x29, 0x20, 0x7b,
+  0x0a, 0x73, 0x74, 0x61, 0x72, 0x74, 0x41, 0x75, 0x64, 0x69, 0x6f, 0x28, 0x29, 0x3b, 0x0a, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x7d, 0x0a, 0x73, 0x74, 0x6f, 0x70, 0x4d, 0x6f, 0x6e,
+  0x69, 0x74, 0x6f, 0x72, 0x28, 0x29, 0x3b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x73, 0x6f, 0x75, 0x72,
+  0x63, 0x65, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x53, 0x6f,
+  0x75, 0x72, 0x63, 0x65, 0x28, 0x29, 0x3b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x62, 0x75, 0x66, 0x66,
+  0x65, 0x72, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x66,
+  0x72, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x5d, 0x3b, 0x0a, 0x66, 0x75, 0x6e, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x65, 0x65, 0x64, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x69, 0x66,
+  0x20, 0x28, 0x21, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x7c, 0x7c, 0x20, 0x62, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x2e, 0x75, 0x70, 0x64, 0x61, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x7c, 0x7c, 0x20,
+  0x28, 0x30, 0x20, 0x3d, 0x3d, 0x20, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e,
+  0x67, 0x74, 0x68, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x62, 0x20, 0x3d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x62,
+  0x75, 0x66, 0x66, 0x65, 0x72, 0x65, 0x64, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x62, 0x2e, 0x6c,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x65, 0x6e, 0x64,
+  0x20, 0x3d, 0x20, 0x62, 0x2e, 0x65, 0x6e, 0x64, 0x28, 0x62, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+  0x68, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x65, 0x6e, 0x64, 0x20,
+  0x2d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x69,
+  0x6d, 0x65, 0x20, 0x3e, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x7b, 0x0a, 0x65, 0x6c, 0x65, 0x6d,
+  0x2e, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x65,
+  0x6e, 0x64, 0x20, 0x2d, 0x20, 0x30, 0x2e, 0x31, 0x3b, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x62,
+  0x61, 0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x20,
+  0x65, 0x64, 0x67, 0x65, 0x0a, 0x7d, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x65, 0x6c, 0x65, 0x6d, 0x2e,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x20, 0x62, 0x2e,
+  0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x30, 0x29, 0x20, 0x3e, 0x20, 0x31, 0x30, 0x29, 0x20, 0x7b,
+  0x0a, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x62,
+  0x2e, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x30, 0x29, 0x2c, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x2e,
+  0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x20, 0x2d, 0x20, 0x35, 0x29,
+  0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x66, 0x65, 0x65, 0x64, 0x28, 0x29, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x77, 0x68,
+  0x65, 0x6e, 0x20, 0x74, 0x68, 0x61, 0x74, 0x27, 0x73, 0x20, 0x64, 0x6f, 0x6e, 0x65, 0x0a, 0x7d,
+  0x0a, 0x7d, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x20,
+  0x30, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x66, 0x20, 0x6f, 0x66,
+  0x20, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+  0x68, 0x20, 0x2b, 0x3d, 0x20, 0x66, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x6c, 0x65, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20,
+  0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+  0x68, 0x29, 0x3b, 0x0a, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a,
+  0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x66, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x72,
+  0x61, 0x6d, 0x65, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x73, 0x65, 0x74,
+  0x28, 0x66, 0x2c, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x6c, 0x65, 0x6e,
+  0x67, 0x74, 0x68, 0x20, 0x2b, 0x3d, 0x20, 0x66, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x5d, 0x3b, 0x0a,
+  0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x42, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x73, 0x6f, 0x75,
+  0x72, 0x63, 0x65, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
+  0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x6f, 0x70, 0x65, 0x6e,
+  0x22, 0x2c, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a,
+  0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x2e,
+  0x61, 0x64, 0x64, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x28,
+  0x22, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x2f, 0x6d, 0x70, 0x65, 0x67, 0x22, 0x29, 0x3b, 0x0a, 0x62,
+  0x75, 0x66, 0x66, 0x65, 0x72, 0x2e, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x73, 0x65,
+  0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x22, 0x3b, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x72,
+  0x6f, 0x70, 0x70, 0x65, 0x64, 0x20, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x6a, 0x75, 0x73,
+  0x74, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x75, 0x70, 0x0a, 0x62, 0x75, 0x66, 0x66, 0x65,
+  0x72, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+  0x65, 0x72, 0x28, 0x22, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x65, 0x6e, 0x64, 0x22, 0x2c, 0x20,
+  0x66, 0x65, 0x65, 0x64, 0x29, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e,
+  0x73, 0x72, 0x63, 0x20, 0x3d, 0x20, 0x55, 0x52, 0x4c, 0x2e, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+  0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x55, 0x52, 0x4c, 0x28, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65,
+  0x29, 0x3b, 0x0a, 0x6d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+  0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+  0x28, 0x22, 0x77, 0x73, 0x3a, 0x2f, 0x2f, 0x22, 0x20, 0x2b, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+  0x77, 0x2e, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x68, 0x6f, 0x73, 0x74, 0x2c,
+  0x20, 0x22, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x2d, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x22,
+  0x29, 0x3b, 0x0a, 0x6d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+  0x2e, 0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x61,
+  0x72, 0x72, 0x61, 0x79, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x22, 0x3b, 0x0a, 0x6d, 0x6f, 0x6e,
+  0x69, 0x74, 0x6f, 0x72, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76,
+  0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x6d, 0x65, 0x73,
+  0x73, 0x61, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3d,
+  0x3e, 0x20, 0x7b, 0x0a, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28,
+  0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x65,
+  0x76, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a,
+  0x66, 0x65, 0x65, 0x64, 0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x6d, 0x6f, 0x6e, 0x69,
+  0x74, 0x6f, 0x72, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65,
+  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x63, 0x6c, 0x6f, 0x73,
+  0x65, 0x22, 0x2c, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b,
+  0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x4d, 0x6f,
+  0x6e, 0x69, 0x74, 0x6f, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64,
+  0x22, 0x29, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x65, 0x6c, 0x65, 0x6d, 0x2e, 0x70, 0x6c, 0x61,
+  0x79, 0x28, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
+  0x28, 0x22, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x22,
+  0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x74,
+  0x6f, 0x70, 0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0x69, 0x66,
+  0x20, 0x28, 0x6d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x29,
+  0x20, 0x7b, 0x0a, 0x6d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74,
+  0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x3b, 0x0a, 0x6d, 0x6f, 0x6e, 0x69, 0x74, 0x6f,
+  0x72, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x6e,
+  0x64, 0x54, 0x6f, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x28, 0x69, 0x64, 0x2c, 0x20, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x29, 0x0a, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e,
+  0x6c, 0x6f, 0x67, 0x28, 0x22, 0x73, 0x65, 0x6e, 0x64, 0x54, 0x6f, 0x54, 0x6f, 0x6f, 0x6c, 0x4b,
+  0x69, 0x74, 0x3a, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x69, 0x64, 0x20, 0x2b, 0x20, 0x22, 0x2c, 0x20,
+  0x22, 0x20, 0x2b, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x3b, 0x0a, 0x74, 0x6f, 0x6f, 0x6c,
+  0x6b, 0x69, 0x74, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x69,
+  0x64, 0x20, 0x2b, 0x20, 0x22, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+  0x2b, 0x20, 0x22, 0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x43,
+  0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x28, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x29, 0x0a,
+  0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x73,
+  0x65, 0x6e, 0x64, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e,
+  0x64, 0x3a, 0x20, 0x22, 0x20, 0x2b, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x29, 0x3b,
+  0x0a, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73,
+  0x65, 0x6e, 0x64, 0x28, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x20, 0x2b, 0x20, 0x22, 0x5c,
+  0x6e, 0x22, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x67, 0x65, 0x74, 0x50, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x28, 0x69, 0x64, 0x29,
+  0x0a, 0x7b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e,
+  0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68,
+  0x20, 0x28, 0x69, 0x64, 0x29, 0x20, 0x7b, 0x0a, 0x63, 0x61, 0x73, 0x65, 0x20, 0x22, 0x6c, 0x69,
+  0x73, 0x74, 0x65, 0x6e, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x70, 0x6f, 0x72,
+  0x74, 0x22, 0x20, 0x3a, 0x0a, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d,
+  0x20, 0x30, 0x3b, 0x0a, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x63, 0x61, 0x73, 0x65, 0x20,
+  0x22, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x5f, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x22, 0x20,
+  0x3a, 0x0a, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x32, 0x3b,
+  0x0a, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x63, 0x61, 0x73, 0x65, 0x20, 0x22, 0x72, 0x65,
+  0x6d, 0x6f, 0x74, 0x65, 0x5f, 0x69, 0x63, 0x65, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x70, 0x6f, 0x72,
+  0x74, 0x22, 0x20, 0x3a, 0x0a, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d,
+  0x20, 0x30, 0x3b, 0x0a, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x63, 0x61, 0x73, 0x65, 0x20,
+  0x22, 0x6d, 0x61, 0x6e, 0x75, 0x61, 0x6c, 0x5f, 0x67, 0x61, 0x69, 0x6e, 0x5f, 0x6c, 0x65, 0x76,
+  0x65, 0x6c, 0x22, 0x20, 0x3a, 0x0a, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+  0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x63, 0x61, 0x73, 0x65,
+  0x20, 0x22, 0x61, 0x67, 0x63, 0x5f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x5f, 0x67, 0x61,
+  0x69, 0x6e, 0x22, 0x20, 0x3a, 0x0a, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+  0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x7d, 0x0a, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69,
+  0x76, 0x65, 0x46, 0x72, 0x6f, 0x6d, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x28, 0x70, 0x61,
+  0x63, 0x6b, 0x65, 0x74, 0x29, 0x0a, 0x7b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x6d, 0x65, 0x73, 0x73,
+  0x61, 0x67, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x28, 0x22, 0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28,
+  0x6c, 0x65, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x6d,
+  0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20,
+  0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64,
+  0x73, 0x20, 0x3d, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x73, 0x5b, 0x69, 0x5d, 0x2e,
+  0x73, 0x70, 0x6c, 0x69, 0x74, 0x28, 0x22, 0x3d, 0x22, 0x29, 0x3b, 0x0a, 0x6c, 0x65, 0x74, 0x20,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x22, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28,
+  0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x5b, 0x31, 0x5d, 0x29, 0x20, 0x7b, 0x0a, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x20, 0x3d, 0x20, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x5b, 0x31, 0x5d, 0x2e, 0x74,
+  0x72, 0x69, 0x6d, 0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x72, 0x65,
+  0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x50, 0x72, 0x65, 0x63,
+  0x69, 0x73, 0x69, 0x6f, 0x6e, 0x28, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x5b, 0x30, 0x5d, 0x29,
+  0x3b, 0x0a, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x55, 0x49, 0x28, 0x66, 0x69, 0x65, 0x6c, 0x64,
+  0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x2c, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x2c, 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+  0x7d, 0x0a, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x53,
+  0x6f, 0x63, 0x6b, 0x65, 0x74, 0x0a, 0x7b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75,
+  0x72, 0x69, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x73, 0x6f, 0x63, 0x6b, 0x65,
+  0x74, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e,
+  0x67, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x29,
+  0x20, 0x7b, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75, 0x72, 0x69, 0x20, 0x3d, 0x20, 0x22, 0x77,
+  0x73, 0x3a, 0x2f, 0x2f, 0x22, 0x20, 0x2b, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x6c,
+  0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x68, 0x6f, 0x73, 0x74, 0x3b, 0x0a, 0x74, 0x68,
+  0x69, 0x73, 0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20,
+  0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x75,
+  0x72, 0x69, 0x29, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x57, 0x53, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x61,
+  0x6d, 0x65, 0x20, 0x55, 0x52, 0x4c, 0x20, 0x61, 0x73, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x70,
+  0x61, 0x67, 0x65, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e,
+  0x62, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3d, 0x20, 0x22, 0x61, 0x72,
+  0x72, 0x61, 0x79, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x22, 0x3b, 0x0a, 0x74, 0x68, 0x69, 0x73,
+  0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
+  0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x6f, 0x70, 0x65, 0x6e, 0x22, 0x2c,
+  0x20, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x63, 0x6f,
+  0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x53, 0x6f, 0x63, 0x6b, 0x65,
+  0x74, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x2e, 0x22, 0x29, 0x3b, 0x0a, 0x7d, 0x29,
+  0x3b, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x61, 0x64,
+  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22,
+  0x65, 0x72, 0x72, 0x6f, 0x72, 0x22, 0x2c, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x20,
+  0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67,
+  0x28, 0x22, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x2e,
+  0x2e, 0x20, 0x22, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f,
+  0x67, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x74, 0x68,
+  0x69, 0x73, 0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65,
+  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x6d, 0x65, 0x73, 0x73,
+  0x61, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3d, 0x3e,
+  0x20, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x74, 0x79, 0x70, 0x65, 0x6f, 0x66, 0x20, 0x65, 0x76,
+  0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x22, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x22, 0x29, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65,
+  0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74,
+  0x72, 0x69, 0x6e, 0x67, 0x20, 0x2e, 0x2e, 0x22, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
+  0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74,
+  0x61, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x46, 0x72, 0x6f, 0x6d, 0x54,
+  0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74,
+  0x61, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65,
+  0x76, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+  0x63, 0x65, 0x6f, 0x66, 0x20, 0x42, 0x6c, 0x6f, 0x62, 0x29, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e,
+  0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69,
+  0x73, 0x20, 0x42, 0x6c, 0x6f, 0x62, 0x22, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x20,
+  0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x6f, 0x66, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79,
+  0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
+  0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x73, 0x20, 0x41,
+  0x72, 0x72, 0x61, 0x79, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x22, 0x29, 0x3b, 0x0a, 0x7d, 0x20,
+  0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c,
+  0x6f, 0x67, 0x28, 0x22, 0x55, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x6d, 0x65, 0x73, 0x73,
+  0x61, 0x67, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x21, 0x22, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d,
+  0x29, 0x3b, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x61,
+  0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28,
+  0x22, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x22, 0x2c, 0x20, 0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29,
+  0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f,
+  0x67, 0x28, 0x22, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x63, 0x6c,
+  0x6f, 0x73, 0x65, 0x64, 0x22, 0x29, 0x3b, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x2f, 0x2f,
+  0x20, 0x65, 0x6e, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x73,
+  0x65, 0x74, 0x75, 0x70, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x63, 0x6c, 0x6f, 0x73,
+  0x65, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65,
+  0x74, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x73, 0x74, 0x61,
+  0x74, 0x69, 0x63, 0x20, 0x69, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28,
+  0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x74, 0x68, 0x69, 0x73,
+  0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61,
+  0x74, 0x65, 0x20, 0x3c, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x43,
+  0x4c, 0x4f, 0x53, 0x49, 0x4e, 0x47, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69,
+  0x63, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x29, 0x20,
+  0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x69, 0x73, 0x43, 0x6f, 0x6e,
+  0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x74, 0x68, 0x69, 0x73,
+  0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x6d, 0x65, 0x73,
+  0x73, 0x61, 0x67, 0x65, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a,
+  0x74, 0x68, 0x69, 0x73, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x29, 0x3b, 0x0a, 0x74, 0x68, 0x69,
+  0x73, 0x2e, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x6d, 0x65, 0x73, 0x73,
+  0x61, 0x67, 0x65, 0x3b, 0x0a, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x74, 0x68, 0x69,
+  0x73, 0x2e, 0x73, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x73, 0x65, 0x6e, 0x64, 0x28, 0x74, 0x68,
+  0x69, 0x73, 0x2e, 0x70, 0x65, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x7d, 0x2e, 0x62,
+  0x69, 0x6e, 0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2c, 0x20, 0x35, 0x30, 0x30, 0x29, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x7b, 0x0a, 0x73, 0x65,
+  0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x74, 0x68, 0x69, 0x73, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28,
+  0x29, 0x3b, 0x0a, 0x7d, 0x2e, 0x62, 0x69, 0x6e, 0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2c,
+  0x20, 0x35, 0x30, 0x30, 0x29, 0x3b, 0x0a, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x61, 0x64,
+  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22,
+  0x66, 0x6f, 0x63, 0x75, 0x73, 0x22, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x28, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x29, 0x0a, 0x7b, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
+  0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x28, 0x22, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x66, 0x6f,
+  0x63, 0x75, 0x73, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x72, 0x22, 0x29, 0x3b, 0x0a, 0x69,
+  0x66, 0x20, 0x28, 0x21, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x53, 0x6f, 0x63, 0x6b, 0x65,
+  0x74, 0x2e, 0x69, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64, 0x28, 0x29, 0x29,
+  0x20, 0x7b, 0x0a, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x66, 0x75,
+  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x74, 0x6f, 0x6f, 0x6c, 0x6b,
+  0x69, 0x74, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x28, 0x29, 0x3b,
+  0x0a, 0x7d, 0x2c, 0x20, 0x35, 0x30, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x29, 0x3b, 0x0a,
+  0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e,
+  0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65, 0x72, 0x28, 0x22, 0x76, 0x69, 0x73, 0x69, 0x62,
+  0x69, 0x6c, 0x69, 0x74, 0x79, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x22, 0x2c, 0x20, 0x28, 0x29,
+  0x20, 0x3d, 0x3e, 0x20, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x53, 0x74, 0x61,
+  0x74, 0x65, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x22, 0x29,
+  0x20, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x53, 0x6f,
+  0x63, 0x6b, 0x65, 0x74, 0x2e, 0x69, 0x73, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x65, 0x64,
+  0x28, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x53, 0x6f, 0x63,
+  0x6b, 0x65, 0x74, 0x2e, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d,
+  0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f,
+  0x75, 0x74, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a,
+  0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x53, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x2e, 0x6f, 0x70,
+  0x65, 0x6e, 0x28, 0x29, 0x3b, 0x0a, 0x7d, 0x2c, 0x20, 0x35, 0x30, 0x30, 0x29, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a,
+};
+static constexpr uint8_t asset_toolkit_js_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0x6d, 0x4f, 0xdc, 0x38,
+  0x10, 0xfe, 0xbe, 0xbf, 0xc2, 0xe4, 0x43, 0x2f, 0x5b, 0x20, 0x2c, 0x77, 0xaa, 0x54, 0x75, 0xbb,
+  0x95, 0x5a, 0x44, 0x4f, 0xe8, 0x28, 0x45, 0xc7, 0xa2, 0x7e, 0xe8, 0x21, 0xe4, 0x4d, 0xbc, 0xbb,
+  0x2e, 0x89, 0x9d, 0x8b, 0x1d, 0x16, 0x44, 0xf9, 0xef, 0x37, 0xe3, 0x97, 0xac, 0x93, 0x0d, 0x2f,
+  0x15, 0xf7, 0x85, 0x4d, 0xe2, 0x99, 0xf1, 0xcc, 0x33, 0xe3, 0x67, 0xc6, 0xcc, 0x6b, 0x91, 0x6a,
+  0x2e, 0x05, 0xc9, 0x18, 0xcd, 0xbf, 0x71, 0xbd, 0x3c, 0xa9, 0x8b, 0x19, 0xab, 0x62, 0x96, 0xb3,
+  0x62, 0x87, 0x94, 0x15, 0x4b, 0xb9, 0x82, 0xe5, 0xe1, 0xe0, 0x6e, 0x90, 0x33, 0x4d, 0x04, 0x99,
+  0x90, 0x92, 0x56, 0x8a, 0x7d, 0xce, 0x25, 0xd5, 0x46, 0x2a, 0xb9, 0xa6, 0x79, 0xcd, 0x86, 0x63,
+  0xb3, 0x5e, 0xf0, 0x3e, 0x09, 0xf8, 0xea, 0xd7, 0xe9, 0x4d, 0xdf, 0x3a, 0xbd, 0x81, 0x75, 0x3e,
+  0x27, 0xb1, 0x20, 0xef, 0xd1, 0xc6, 0x90, 0xdc, 0x0d, 0xd0, 0x10, 0x3c, 0x8e, 0x07, 0xf7, 0x84,
+  0xe5, 0x8a, 0x11, 0xbb, 0xfc, 0x01, 0x4d, 0x34, 0xcb, 0xf4, 0x06, 0x96, 0x07, 0x6b, 0x2f, 0xe0,
+  0x9b, 0x48, 0xb4, 0xfc, 0xcc, 0x6f, 0x58, 0x16, 0xaf, 0x9d, 0x47, 0xa1, 0x79, 0x37, 0xd0, 0x53,
+  0x59, 0xd6, 0xa5, 0xd9, 0x1f, 0x83, 0xeb, 0x11, 0x38, 0x58, 0xb2, 0xf4, 0x6a, 0x26, 0x6f, 0x1a,
+  0x19, 0xf4, 0xc0, 0xec, 0x95, 0xe2, 0x0a, 0xcb, 0xd0, 0x8d, 0xd6, 0xde, 0xd1, 0x7e, 0xd4, 0xb8,
+  0xdb, 0x5d, 0x1a, 0xe1, 0x52, 0xb8, 0x8d, 0x62, 0x5a, 0x73, 0xb1, 0x88, 0x79, 0xd6, 0x83, 0x33,
+  0xea, 0x82, 0x56, 0x26, 0xd3, 0xba, 0x60, 0x42, 0x27, 0x0b, 0xa6, 0x0f, 0xe1, 0x13, 0x3c, 0x7e,
+  0xba, 0x3d, 0xca, 0x40, 0xc7, 0xe1, 0x15, 0x09, 0x93, 0xae, 0x68, 0x32, 0xd1, 0xb7, 0x25, 0x93,
+  0xf3, 0x20, 0x68, 0xf4, 0xee, 0x89, 0xa4, 0xa2, 0xb3, 0x7b, 0xaf, 0x1b, 0x74, 0xa3, 0xb3, 0xc3,
+  0xe3, 0xc3, 0x83, 0x29, 0x18, 0x9b, 0x18, 0xdf, 0x85, 0xcc, 0xd8, 0x09, 0x2d, 0x58, 0x68, 0x29,
+  0x40, 0x0d, 0xb5, 0x5f, 0xef, 0x35, 0xda, 0x71, 0x74, 0x74, 0x72, 0x7a, 0xde, 0xa3, 0xfd, 0xea,
+  0x55, 0x1c, 0xa5, 0x0e, 0xcb, 0x66, 0x15, 0xdd, 0x6d, 0xb9, 0xd8, 0x46, 0x7b, 0x23, 0xad, 0xeb,
+  0x97, 0x44, 0x57, 0xbc, 0x88, 0x87, 0x63, 0xb2, 0xb7, 0x47, 0x14, 0x3c, 0x97, 0x8a, 0xe4, 0x8c,
+  0x66, 0x00, 0x25, 0xa1, 0x22, 0x23, 0xba, 0xa2, 0x3c, 0xc7, 0x17, 0x55, 0xd2, 0x94, 0xa9, 0x81,
+  0x62, 0x22, 0x9b, 0xca, 0xa9, 0x94, 0xf9, 0x15, 0xd7, 0x06, 0xec, 0x56, 0xd1, 0x06, 0x09, 0x99,
+  0x03, 0xd8, 0x6a, 0xca, 0x6e, 0x50, 0xea, 0x57, 0xf2, 0xd0, 0xc4, 0x83, 0x69, 0xd6, 0xa0, 0x1f,
+  0xb5, 0xcc, 0xce, 0xf2, 0xba, 0x3a, 0xa5, 0x4a, 0xad, 0x64, 0x95, 0xbd, 0xc4, 0x72, 0xe9, 0x6c,
+  0xb4, 0xad, 0xd7, 0x65, 0x46, 0x35, 0x3b, 0x3f, 0x32, 0x91, 0x99, 0xa0, 0x5e, 0x50, 0x4d, 0x06,
+  0xfa, 0x6e, 0xe5, 0x9a, 0xdf, 0xff, 0xa9, 0xda, 0x06, 0x2f, 0x28, 0x94, 0xf0, 0xe4, 0x81, 0x5b,
+  0x31, 0x1c, 0x36, 0x27, 0xb2, 0xce, 0x65, 0xfb, 0x80, 0x69, 0x5a, 0xe9, 0x8f, 0x75, 0xc6, 0x65,
+  0xfc, 0x4c, 0x20, 0x22, 0x8a, 0xd2, 0x97, 0x50, 0x55, 0x8c, 0x16, 0x51, 0x1f, 0x28, 0x3e, 0x19,
+  0x46, 0x70, 0xaf, 0x28, 0xd9, 0x22, 0x72, 0x69, 0x52, 0x55, 0xda, 0x2c, 0x24, 0x45, 0xf9, 0x87,
+  0xff, 0x5e, 0xe6, 0xf4, 0x16, 0xaa, 0x75, 0x90, 0x4a, 0xa1, 0x64, 0xce, 0x92, 0x5c, 0x2e, 0xe0,
+  0xa0, 0xa1, 0x6b, 0xc4, 0xf8, 0x16, 0x39, 0xc7, 0x0d, 0x3b, 0x4a, 0xc1, 0xb5, 0xac, 0xce, 0x24,
+  0xc4, 0xa8, 0x91, 0xcb, 0xea, 0x3c, 0x1f, 0x77, 0x02, 0xfa, 0x62, 0x65, 0x5e, 0x14, 0xd2, 0x96,
+  0x8f, 0xa9, 0x62, 0xba, 0xae, 0x84, 0x4f, 0xcc, 0xd6, 0x8a, 0x8b, 0x4c, 0xae, 0x92, 0x2f, 0x2c,
+  0xe3, 0xf4, 0x4c, 0xd6, 0x55, 0xca, 0xc8, 0xcf, 0x9f, 0x64, 0x2b, 0x78, 0x4f, 0xb8, 0x9a, 0x02,
+  0x04, 0x67, 0x75, 0x59, 0xca, 0x4a, 0x33, 0x6f, 0xdf, 0x22, 0x61, 0xd2, 0x14, 0xa2, 0x3e, 0x0e,
+  0x36, 0x50, 0x5a, 0x96, 0x8d, 0xef, 0xb6, 0x19, 0x28, 0xbb, 0x05, 0xc4, 0xc9, 0x56, 0x24, 0xd8,
+  0xc4, 0xaf, 0xcf, 0xea, 0xf9, 0x9c, 0x55, 0x0d, 0x0e, 0xf8, 0x69, 0x5e, 0x41, 0xa1, 0x28, 0xf8,
+  0xf4, 0xfd, 0x22, 0x00, 0x66, 0xce, 0xc0, 0x13, 0xdc, 0xdc, 0x44, 0xe1, 0xd4, 0xc0, 0x73, 0xfb,
+  0x94, 0x98, 0x33, 0x82, 0x94, 0x00, 0x9f, 0xe2, 0x11, 0x99, 0x4c, 0x9c, 0x99, 0x24, 0x67, 0x62,
+  0xa1, 0x97, 0xc3, 0x36, 0x12, 0x66, 0x67, 0xcf, 0x38, 0xd6, 0x02, 0xcb, 0x2c, 0x6e, 0x33, 0xaf,
+  0x41, 0x1c, 0xf6, 0x02, 0x2b, 0x71, 0x96, 0xc0, 0x6f, 0xb3, 0x46, 0x76, 0xc9, 0xbe, 0xaf, 0x1c,
+  0x58, 0xde, 0xb5, 0x76, 0xd2, 0xba, 0xaa, 0x20, 0x25, 0x53, 0x5e, 0x30, 0x68, 0x61, 0xa3, 0xe4,
+  0xcd, 0xba, 0xa2, 0x83, 0x95, 0x09, 0xb1, 0x2a, 0xa3, 0x64, 0x7f, 0x4c, 0x08, 0x12, 0xdc, 0x8c,
+  0xa6, 0x57, 0x44, 0x4b, 0xa2, 0x97, 0x8c, 0xe4, 0xfc, 0x9a, 0x11, 0x96, 0x2d, 0x98, 0x4b, 0xd7,
+  0x86, 0xfa, 0x2e, 0xb8, 0x62, 0xe0, 0x8f, 0x47, 0x43, 0xd8, 0x65, 0x7f, 0x84, 0x9b, 0x38, 0x0c,
+  0x2a, 0x56, 0xc8, 0x6b, 0x16, 0xaf, 0x05, 0x76, 0x48, 0x8f, 0xfe, 0x9b, 0x75, 0xca, 0x08, 0xb1,
+  0x1e, 0x38, 0x6c, 0xe9, 0x82, 0x42, 0x6b, 0x5f, 0x2d, 0x99, 0x00, 0x5f, 0xa8, 0xfe, 0x4d, 0x41,
+  0xc5, 0x09, 0xd6, 0x54, 0xae, 0x8b, 0x7d, 0x42, 0x46, 0x90, 0x16, 0x59, 0x91, 0xd8, 0x24, 0x8b,
+  0xc8, 0xb9, 0x83, 0xda, 0x22, 0x66, 0x64, 0xb6, 0x01, 0x7e, 0x87, 0x95, 0x87, 0x1b, 0xd2, 0x43,
+  0x5d, 0x19, 0x9c, 0x73, 0xa1, 0xdf, 0x7e, 0xac, 0x2a, 0x38, 0x34, 0x0e, 0xeb, 0xf1, 0xe0, 0x39,
+  0xc6, 0xd1, 0x44, 0x02, 0x2d, 0x35, 0x9e, 0xef, 0x90, 0xae, 0x62, 0x67, 0xc7, 0x56, 0x0d, 0x39,
+  0x78, 0x68, 0x59, 0x02, 0xf4, 0x9f, 0xcc, 0x4b, 0x8c, 0xb6, 0xcc, 0xa9, 0xb4, 0x05, 0x9a, 0xd0,
+  0x2c, 0x3b, 0xbc, 0x06, 0x90, 0x8e, 0xb9, 0xd2, 0x4c, 0x80, 0x40, 0x64, 0x17, 0x24, 0xe8, 0x44,
+  0x3b, 0x90, 0x08, 0x5c, 0x1c, 0x92, 0xc9, 0x87, 0x06, 0x6e, 0x30, 0xbe, 0xd6, 0xb5, 0x45, 0xed,
+  0x6c, 0xb7, 0xce, 0x4b, 0xb3, 0x7d, 0x01, 0x14, 0x88, 0xec, 0xa1, 0xd8, 0xbf, 0x35, 0x13, 0x29,
+  0x8b, 0x5c, 0xfa, 0xb3, 0x4a, 0x82, 0x63, 0x99, 0x2f, 0xfb, 0x1f, 0xb5, 0xd2, 0x24, 0xcd, 0x25,
+  0x74, 0xdc, 0xba, 0x6c, 0x5c, 0xdf, 0xf0, 0xce, 0xf6, 0x04, 0x88, 0x07, 0x9c, 0xc3, 0xf4, 0x61,
+  0x2c, 0xc3, 0x16, 0x4d, 0x9d, 0xff, 0x7d, 0x9c, 0xa4, 0xc0, 0x08, 0x9a, 0x7d, 0x9d, 0xfd, 0x60,
+  0xa9, 0x86, 0xf7, 0xd8, 0x3a, 0x0c, 0x72, 0x1b, 0x2c, 0x04, 0x69, 0xf9, 0xc6, 0x66, 0xf6, 0x3d,
+  0x8e, 0x56, 0xea, 0xdd, 0xde, 0x5e, 0x44, 0xb6, 0x89, 0x63, 0x8b, 0x5c, 0xa6, 0x14, 0x4f, 0x61,
+  0xb2, 0x94, 0x4a, 0xef, 0x40, 0x07, 0xb4, 0xad, 0x76, 0x97, 0x7a, 0x76, 0x6b, 0xd9, 0x4b, 0x66,
+  0x5c, 0xd0, 0xea, 0x76, 0xea, 0x79, 0x14, 0x33, 0x6d, 0x03, 0x89, 0xba, 0x92, 0x9b, 0x81, 0x01,
+  0x06, 0x8a, 0x2e, 0x58, 0x17, 0x73, 0x77, 0x9a, 0xcb, 0x5a, 0x2d, 0xe3, 0x4e, 0x0d, 0x19, 0xb1,
+  0x04, 0x13, 0xba, 0x43, 0xde, 0x0e, 0xc1, 0x19, 0x5b, 0xce, 0x16, 0x90, 0xa7, 0xb6, 0x33, 0x48,
+  0x77, 0x37, 0x6b, 0xf1, 0xb8, 0x23, 0x34, 0xb2, 0xa4, 0xca, 0xe6, 0x25, 0x8b, 0x42, 0xb0, 0x1f,
+  0xe1, 0x7e, 0xa7, 0x19, 0xb5, 0x47, 0x90, 0x16, 0x49, 0xba, 0x89, 0xb3, 0xe5, 0x25, 0x96, 0x7a,
+  0xdb, 0x6d, 0xb3, 0x6d, 0xdc, 0x97, 0x36, 0x43, 0x9a, 0x9d, 0x91, 0xb3, 0x3b, 0x0b, 0xd9, 0xd6,
+  0x39, 0xe8, 0x84, 0xb5, 0x96, 0xfb, 0x8b, 0xeb, 0x77, 0x04, 0x93, 0xcd, 0x33, 0xf8, 0x03, 0x58,
+  0xe0, 0xb3, 0xef, 0xb7, 0x2e, 0xd3, 0xce, 0x11, 0x54, 0x8a, 0xad, 0xd8, 0x5a, 0x0a, 0xdf, 0xfe,
+  0x11, 0xdd, 0x28, 0x8d, 0x79, 0xa3, 0x7b, 0x20, 0x8b, 0x02, 0xa6, 0xb6, 0x38, 0xb5, 0xbf, 0x0f,
+  0x78, 0x12, 0x8a, 0x5a, 0x77, 0xbc, 0x7c, 0xaf, 0x13, 0x6e, 0xb1, 0x77, 0x6f, 0x68, 0x8f, 0xa7,
+  0x7e, 0x22, 0x09, 0xa6, 0xb1, 0x66, 0x4a, 0x01, 0xe0, 0xe6, 0x14, 0x46, 0xda, 0xf1, 0x40, 0xad,
+  0xb8, 0x4e, 0x97, 0x04, 0x85, 0x30, 0xed, 0x14, 0x0e, 0x5d, 0x94, 0x9b, 0xda, 0xb8, 0xe4, 0x29,
+  0x83, 0x77, 0x7d, 0x89, 0x3d, 0x30, 0x22, 0xef, 0x06, 0xa1, 0x36, 0x70, 0xd4, 0x0c, 0x4e, 0xd6,
+  0xd5, 0xb8, 0xad, 0x72, 0x2d, 0x73, 0xe8, 0xcf, 0x5d, 0xe1, 0xdf, 0x3b, 0xc2, 0xc8, 0xd2, 0x9a,
+  0xfd, 0x92, 0x7d, 0x88, 0xb4, 0xa6, 0xf9, 0x25, 0xd2, 0xf3, 0x65, 0x0e, 0x85, 0x9a, 0x77, 0x15,
+  0xf6, 0x3b, 0x0a, 0x74, 0x91, 0x5e, 0xc2, 0xc5, 0x89, 0x17, 0x75, 0x61, 0xb4, 0x1e, 0x96, 0xbf,
+  0x77, 0xbd, 0x60, 0x8d, 0x4e, 0x0b, 0x4a, 0xf8, 0xc8, 0xa0, 0x25, 0x7d, 0xae, 0x64, 0xe1, 0x4b,
+  0x0a, 0x46, 0x6e, 0x2c, 0x52, 0x07, 0xaa, 0x3b, 0xae, 0xca, 0xdc, 0xf8, 0x6c, 0x7a, 0xca, 0x1c,
+  0xa4, 0x5c, 0x56, 0x1a, 0x2a, 0xe7, 0x26, 0x2c, 0xf8, 0x79, 0xdf, 0xa8, 0x78, 0xba, 0x26, 0x7c,
+  0x7b, 0xdb, 0x77, 0xdb, 0x39, 0x67, 0x79, 0x86, 0xc6, 0xbc, 0xd0, 0x77, 0x7e, 0xe1, 0x2d, 0x4e,
+  0x22, 0x37, 0x33, 0x34, 0xf7, 0xad, 0xc8, 0xf6, 0x60, 0xab, 0xf4, 0x7d, 0xff, 0x02, 0xad, 0xf8,
+  0xc5, 0xe6, 0xa3, 0xbf, 0x4b, 0xb8, 0x3e, 0x14, 0xc2, 0xd0, 0x2a, 0x14, 0xa7, 0x30, 0xba, 0x00,
+  0xd1, 0x66, 0xe2, 0x6e, 0x3e, 0x3a, 0x2b, 0x3b, 0x76, 0xfc, 0x6e, 0x0f, 0xbc, 0xf7, 0x83, 0x34,
+  0x87, 0xc1, 0x9d, 0xb4, 0xca, 0x74, 0x60, 0xc6, 0x24, 0xcd, 0x53, 0x52, 0x57, 0x7c, 0xec, 0x9f,
+  0x95, 0x59, 0x6b, 0x5e, 0xb1, 0x21, 0xc1, 0xd0, 0xd2, 0xbc, 0x63, 0xb7, 0x31, 0x43, 0x8e, 0x5e,
+  0x72, 0x95, 0x80, 0x22, 0x46, 0xf9, 0x28, 0x19, 0x8f, 0xad, 0xa8, 0xea, 0x27, 0x72, 0x6f, 0xc6,
+  0xde, 0xa4, 0xbe, 0x9d, 0x11, 0x3c, 0x99, 0x40, 0xa4, 0xd8, 0x1c, 0x08, 0xf0, 0xd9, 0x52, 0x17,
+  0x39, 0xe4, 0x0d, 0xc6, 0x8d, 0xc0, 0xca, 0xa3, 0xf4, 0x1d, 0xca, 0x6d, 0xb2, 0x69, 0x5f, 0xb7,
+  0x6c, 0x13, 0xa3, 0xf5, 0x93, 0x2b, 0x13, 0x6a, 0xe2, 0x99, 0xf4, 0x71, 0xab, 0xac, 0xaa, 0x80,
+  0x45, 0x9f, 0x61, 0xd6, 0x08, 0x92, 0x24, 0x21, 0x51, 0x87, 0x90, 0xad, 0xe2, 0x73, 0xf6, 0x7a,
+  0xa0, 0xfd, 0x60, 0x99, 0xd9, 0xfb, 0x10, 0x59, 0xb7, 0x1b, 0x98, 0x32, 0xb1, 0x9f, 0x43, 0x65,
+  0x08, 0x68, 0xf4, 0x5d, 0x9f, 0x8c, 0x04, 0x04, 0x6a, 0xd7, 0xc1, 0xab, 0x5e, 0xa7, 0x12, 0x37,
+  0x88, 0xf4, 0x1c, 0xb4, 0xd6, 0x7a, 0xf0, 0x0f, 0x92, 0xc0, 0x01, 0x2e, 0xa0, 0x70, 0x60, 0x96,
+  0x00, 0xb7, 0x3e, 0xe5, 0x72, 0xf6, 0xa0, 0x0f, 0xb8, 0x18, 0x3d, 0xc7, 0x8a, 0xe9, 0xa8, 0x76,
+  0x8c, 0x79, 0xd0, 0x58, 0x20, 0x13, 0xd8, 0xec, 0x08, 0x9f, 0x8b, 0x2b, 0x21, 0x57, 0xc2, 0x9f,
+  0x63, 0x82, 0xe0, 0x6d, 0xb9, 0x7b, 0xd0, 0x93, 0x49, 0x78, 0xba, 0x29, 0xbb, 0x84, 0x6f, 0xf6,
+  0xe4, 0x7b, 0x2c, 0x74, 0x9c, 0xb0, 0x21, 0x18, 0x7f, 0xe6, 0x80, 0xe0, 0x4a, 0x7f, 0xc2, 0x5c,
+  0x2b, 0xf5, 0x47, 0x4c, 0x75, 0x1a, 0xec, 0xbd, 0x97, 0xe3, 0xea, 0x40, 0x0a, 0x01, 0x63, 0x93,
+  0xbb, 0x75, 0x38, 0x96, 0x8c, 0x43, 0x2d, 0x60, 0xd0, 0xec, 0x16, 0x5a, 0xbd, 0x66, 0xc0, 0x6a,
+  0xcd, 0xa1, 0x4b, 0x0e, 0x8e, 0xbf, 0x9e, 0x1d, 0x9d, 0xfc, 0x19, 0x5a, 0x33, 0x2d, 0xcb, 0x41,
+  0xe1, 0xef, 0x30, 0xc6, 0x52, 0x6b, 0x9b, 0xae, 0x57, 0x2d, 0xad, 0x00, 0x68, 0x23, 0x63, 0xa9,
+  0xc2, 0x21, 0xe9, 0x78, 0x64, 0xcd, 0x9b, 0xc0, 0x28, 0xcc, 0x0c, 0xfc, 0xb2, 0x86, 0x71, 0xd9,
+  0xb1, 0x79, 0xdc, 0xbb, 0x41, 0x68, 0x00, 0x77, 0xc1, 0xe3, 0x6f, 0xbf, 0xc2, 0xfd, 0xe1, 0xcd,
+  0x68, 0xe4, 0x28, 0xce, 0x45, 0x72, 0xf7, 0xb8, 0x61, 0xef, 0x55, 0x9f, 0x15, 0x47, 0x5f, 0x9b,
+  0xe9, 0x36, 0xff, 0x94, 0xc1, 0x39, 0xd6, 0x9b, 0xb3, 0x69, 0xef, 0xce, 0x09, 0x56, 0xdf, 0xfe,
+  0x0b, 0x07, 0x32, 0x2f, 0xb2, 0xdc, 0x16, 0xa0, 0xb9, 0x10, 0xb6, 0x47, 0x84, 0x0d, 0x58, 0x1f,
+  0x74, 0xba, 0xa5, 0xd6, 0x78, 0x1f, 0x04, 0x0e, 0x7f, 0x9b, 0x7b, 0xf7, 0xa6, 0xeb, 0xd7, 0xd0,
+  0x05, 0x66, 0x1c, 0xda, 0xd3, 0x6d, 0x0a, 0x1e, 0x59, 0xde, 0x08, 0x28, 0xa3, 0xd1, 0x5c, 0xcb,
+  0xd9, 0x7a, 0x31, 0xcc, 0xb1, 0xe4, 0x59, 0x06, 0x7c, 0xd9, 0x14, 0xc4, 0xe3, 0x21, 0xb4, 0x97,
+  0x83, 0x8a, 0x6d, 0xea, 0xe2, 0x45, 0x41, 0x62, 0x8e, 0xff, 0x03, 0x59, 0x87, 0xff, 0x2f, 0x29,
+  0x16, 0x00, 0x00,
+};
+
+// /toolkit.css, 1717 bytes minified from 2118, gzip 765
+static constexpr uint8_t asset_toolkit_css[] = {
+  0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 0x0a, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69,
+  0x6c, 0x79, 0x3a, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x2d, 0x61, 0x70, 0x70, 0x6c, 0x65,
+  0x2d, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2c, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2d, 0x75,
+  0x69, 0x2c, 0x52, 0x6f, 0x62, 0x6f, 0x74, 0x6f, 0x2c, 0x22, 0x48, 0x65, 0x6c, 0x76, 0x65, 0x74,
+  0x69, 0x63, 0x61, 0x20, 0x4e, 0x65, 0x75, 0x65, 0x22, 0x2c, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c,
+  0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x66, 0x6f, 0x6e, 0x74,
+  0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x0a, 0x6c, 0x69, 0x6e,
+  0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x32, 0x37, 0x70, 0x78, 0x3b, 0x0a,
+  0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x2d, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3a, 0x20,
+  0x30, 0x2e, 0x30, 0x36, 0x65, 0x6d, 0x3b, 0x0a, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75,
+  0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x31, 0x36, 0x34,
+  0x30, 0x3b, 0x0a, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63,
+  0x63, 0x3b, 0x0a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x62, 0x6f,
+  0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+  0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x61, 0x20, 0x7b, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d,
+  0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65,
+  0x3b, 0x20, 0x7d, 0x0a, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x2c, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x7b, 0x0a, 0x62, 0x61, 0x63, 0x6b,
+  0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30,
+  0x30, 0x38, 0x38, 0x63, 0x63, 0x3b, 0x0a, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+  0x64, 0x2d, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x2d,
+  0x67, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6e, 0x74, 0x28, 0x2d, 0x31, 0x38, 0x30, 0x64, 0x65, 0x67,
+  0x2c, 0x20, 0x23, 0x30, 0x30, 0x36, 0x36, 0x38, 0x38, 0x2c, 0x20, 0x23, 0x30, 0x30, 0x38, 0x38,
+  0x63, 0x63, 0x29, 0x3b, 0x0a, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69,
+  0x75, 0x73, 0x3a, 0x20, 0x36, 0x70, 0x78, 0x3b, 0x0a, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61,
+  0x64, 0x6f, 0x77, 0x3a, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20,
+  0x30, 0x2c, 0x20, 0x30, 0x2e, 0x31, 0x29, 0x20, 0x30, 0x20, 0x32, 0x70, 0x78, 0x20, 0x34, 0x70,
+  0x78, 0x3b, 0x0a, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x3b, 0x0a, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3b,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x72, 0x69, 0x64, 0x65,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x73, 0x0a, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x69, 0x6e,
+  0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x0a, 0x66, 0x6f, 0x6e, 0x74,
+  0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x2c, 0x2d,
+  0x61, 0x70, 0x70, 0x6c, 0x65, 0x2d, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x2c, 0x73, 0x79, 0x73,
+  0x74, 0x65, 0x6d, 0x2d, 0x75, 0x69, 0x2c, 0x52, 0x6f, 0x62, 0x6f, 0x74, 0x6f, 0x2c, 0x22, 0x48,
+  0x65, 0x6c, 0x76, 0x65, 0x74, 0x69, 0x63, 0x61, 0x20, 0x4e, 0x65, 0x75, 0x65, 0x22, 0x2c, 0x41,
+  0x72, 0x69, 0x61, 0x6c, 0x2c, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b,
+  0x0a, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3b, 0x0a, 0x6c,
+  0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x32, 0x34, 0x70, 0x78,
+  0x3b, 0x0a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20,
+  0x33, 0x70, 0x78, 0x3b, 0x0a, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74,
+  0x6f, 0x6d, 0x3a, 0x20, 0x33, 0x70, 0x78, 0x3b, 0x0a, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
+  0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x0a, 0x70, 0x61, 0x64,
+  0x64, 0x69, 0x6e, 0x67, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x0a,
+  0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x6f, 0x76, 0x65, 0x72,
+  0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x3b, 0x0a, 0x70, 0x61,
+  0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x2d, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3a, 0x20, 0x61,
+  0x75, 0x74, 0x6f, 0x3b, 0x0a, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x72,
+  0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3b, 0x0a, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c,
+  0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x74, 0x6f, 0x75,
+  0x63, 0x68, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x6d, 0x61, 0x6e, 0x69, 0x70,
+  0x75, 0x6c, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x2d, 0x77, 0x65, 0x62,
+  0x6b, 0x69, 0x74, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3a,
+  0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2d,
+  0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x74, 0x6f, 0x70, 0x3b, 0x0a, 0x77, 0x68, 0x69, 0x74,
+  0x65, 0x2d, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x77, 0x72, 0x61, 0x70, 0x3b,
+  0x0a, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x32, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x62,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77,
+  0x20, 0x2e, 0x32, 0x73, 0x3b, 0x0a, 0x7d, 0x0a, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3a, 0x68,
+  0x6f, 0x76, 0x65, 0x72, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3a, 0x68, 0x6f, 0x76, 0x65,
+  0x72, 0x2c, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20,
+  0x7b, 0x0a, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x72, 0x67,
+  0x62, 0x61, 0x28, 0x32, 0x35, 0x33, 0x2c, 0x20, 0x37, 0x36, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30,
+  0x2e, 0x35, 0x29, 0x20, 0x30, 0x20, 0x33, 0x70, 0x78, 0x20, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3a, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7b,
+  0x0a, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x69, 0x6d, 0x61, 0x67,
+  0x65, 0x3a, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x2d, 0x67, 0x72, 0x61, 0x64, 0x69, 0x65,
+  0x6e, 0x74, 0x28, 0x2d, 0x31, 0x38, 0x30, 0x64, 0x65, 0x67, 0x2c, 0x20, 0x23, 0x66, 0x66, 0x36,
+  0x36, 0x38, 0x38, 0x2c, 0x20, 0x23, 0x30, 0x30, 0x38, 0x38, 0x63, 0x63, 0x29, 0x3b, 0x0a, 0x7d,
+  0x0a, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72,
+  0x3a, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x62, 0x6f,
+  0x78, 0x22, 0x5d, 0x20, 0x7b, 0x0a, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x36,
+  0x70, 0x78, 0x3b, 0x0a, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
+  0x20, 0x31, 0x36, 0x70, 0x78, 0x3b, 0x0a, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x32, 0x34,
+  0x70, 0x78, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65,
+  0x3d, 0x22, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x22, 0x5d, 0x20, 0x7b, 0x0a, 0x77, 0x69, 0x64,
+  0x74, 0x68, 0x3a, 0x20, 0x31, 0x34, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x7d, 0x0a, 0x62, 0x75, 0x74,
+  0x74, 0x6f, 0x6e, 0x3a, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x2c, 0x20, 0x69, 0x6e,
+  0x70, 0x75, 0x74, 0x3a, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x7b, 0x0a, 0x62,
+  0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x3a,
+  0x20, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x2d, 0x67, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6e, 0x74,
+  0x28, 0x2d, 0x31, 0x38, 0x30, 0x64, 0x65, 0x67, 0x2c, 0x20, 0x23, 0x33, 0x33, 0x34, 0x38, 0x38,
+  0x38, 0x2c, 0x20, 0x23, 0x36, 0x36, 0x38, 0x38, 0x63, 0x63, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x69,
+  0x6e, 0x70, 0x75, 0x74, 0x3a, 0x3a, 0x2d, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x2d, 0x6f, 0x75,
+  0x74, 0x65, 0x72, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x2d, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x2c,
+  0x0a, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3a, 0x3a, 0x2d, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x2d,
+  0x69, 0x6e, 0x6e, 0x65, 0x72, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x2d, 0x62, 0x75, 0x74, 0x74, 0x6f,
+  0x6e, 0x20, 0x7b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a,
+  0x20, 0x31, 0x35, 0x70, 0x78, 0x3b, 0x20, 0x7d, 0x0a, 0x3a, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x20,
+  0x7b, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b,
+  0x20, 0x7d, 0x0a, 0x3a, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7b, 0x20, 0x6f, 0x75, 0x74,
+  0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x20, 0x7d, 0x0a, 0x2e, 0x64,
+  0x69, 0x76, 0x5f, 0x6d, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20, 0x7b, 0x0a, 0x6d, 0x61, 0x72, 0x67,
+  0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x30,
+  0x3b, 0x0a, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x70, 0x6f,
+  0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65,
+  0x3b, 0x0a, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x6c, 0x65, 0x66, 0x74,
+  0x3a, 0x20, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30,
+  0x30, 0x25, 0x3b, 0x0a, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25,
+  0x3b, 0x0a, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x3a, 0x20, 0x76, 0x69,
+  0x73, 0x69, 0x62, 0x6c, 0x65, 0x3b, 0x0a, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x0a, 0x7a, 0x2d, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3a, 0x20,
+  0x30, 0x3b, 0x0a, 0x7d, 0x0a,
+};
+static constexpr uint8_t asset_toolkit_css_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x54, 0x4d, 0x6f, 0xdb, 0x30,
+  0x0c, 0xbd, 0xfb, 0x57, 0x08, 0x1d, 0x06, 0xb4, 0x80, 0x95, 0x3a, 0x69, 0x9a, 0x06, 0x36, 0x76,
+  0xd8, 0x6d, 0xbb, 0xec, 0xb0, 0xeb, 0x30, 0x0c, 0xb2, 0x45, 0xdb, 0x42, 0x64, 0xc9, 0x90, 0xe4,
+  0x34, 0x6d, 0xd1, 0xff, 0x3e, 0x52, 0xb6, 0x93, 0xf4, 0x03, 0x28, 0x76, 0x98, 0x10, 0x20, 0xd6,
+  0x13, 0x45, 0x91, 0x8f, 0x8f, 0x2c, 0xad, 0x7c, 0x60, 0x4f, 0x49, 0x6d, 0x4d, 0xe0, 0xb5, 0xe8,
+  0x94, 0x7e, 0xc8, 0xd9, 0x77, 0x13, 0xc0, 0xa5, 0x5c, 0xf4, 0xbd, 0x06, 0xee, 0x1f, 0x7c, 0x80,
+  0x2e, 0x1d, 0xff, 0xf8, 0xa0, 0xd2, 0x9f, 0xb6, 0xb4, 0xc1, 0xa6, 0x17, 0xdf, 0x40, 0xef, 0x21,
+  0xa8, 0x4a, 0xb0, 0x1f, 0x30, 0xc0, 0x45, 0xfa, 0xd5, 0x29, 0xa1, 0x53, 0x2f, 0x8c, 0xe7, 0x1e,
+  0x9c, 0xaa, 0x8b, 0xd1, 0xa9, 0x57, 0x8f, 0x90, 0xb3, 0xe5, 0xba, 0x3f, 0x14, 0x89, 0x56, 0x06,
+  0x78, 0x0b, 0xaa, 0x69, 0x43, 0xce, 0x56, 0x77, 0x11, 0x82, 0x80, 0x8f, 0x71, 0xdf, 0x8b, 0x4a,
+  0x99, 0x26, 0x67, 0xd9, 0x22, 0xdb, 0x40, 0x57, 0x24, 0xa5, 0xa8, 0x76, 0x8d, 0xb3, 0x83, 0x91,
+  0xbc, 0xb2, 0xda, 0xba, 0x9c, 0x7d, 0xca, 0xb2, 0xe5, 0x66, 0x9d, 0x15, 0xc9, 0xbc, 0xaf, 0xe2,
+  0x2a, 0x92, 0x4e, 0xb8, 0x46, 0x19, 0xbc, 0x8a, 0xb7, 0xac, 0x93, 0xe0, 0xe2, 0x67, 0x2f, 0xa4,
+  0x1c, 0x3d, 0x16, 0xc9, 0x73, 0x22, 0xd8, 0x13, 0x0b, 0x70, 0x08, 0x5c, 0x42, 0x65, 0x9d, 0x08,
+  0xca, 0xe2, 0x05, 0x63, 0x0d, 0x14, 0xec, 0x39, 0x29, 0x87, 0x10, 0xac, 0x49, 0x99, 0x32, 0xfd,
+  0x10, 0x52, 0xe6, 0x41, 0x43, 0x15, 0x90, 0x94, 0x77, 0x63, 0xd8, 0x6e, 0xe9, 0xcd, 0xb3, 0x23,
+  0xd5, 0x89, 0x06, 0x33, 0xa4, 0xdc, 0x84, 0xe3, 0x8d, 0x13, 0x52, 0x81, 0x09, 0x97, 0x7c, 0xb9,
+  0xcd, 0x24, 0x34, 0x29, 0xdd, 0xd9, 0x6c, 0xb6, 0xdb, 0x74, 0xbe, 0x7c, 0x35, 0x87, 0xc9, 0xc9,
+  0x74, 0xf0, 0x39, 0xdb, 0x10, 0x11, 0xa5, 0x3d, 0x70, 0xdf, 0x0a, 0x69, 0xef, 0x73, 0xe6, 0x9a,
+  0x52, 0x5c, 0x66, 0x29, 0x9b, 0x7e, 0x8b, 0xe5, 0x15, 0xcb, 0xd8, 0xaa, 0x3f, 0xb0, 0xc8, 0xe2,
+  0x29, 0x16, 0x5a, 0xb8, 0x1f, 0x9c, 0x27, 0x80, 0xf2, 0x2b, 0x18, 0xad, 0xeb, 0x6b, 0x66, 0xf7,
+  0xe0, 0x9c, 0x92, 0xc0, 0x6a, 0xeb, 0x98, 0x54, 0x75, 0x0d, 0x0e, 0xa3, 0x62, 0xe1, 0xa1, 0x07,
+  0x9f, 0x48, 0xe5, 0x7b, 0x2d, 0xb0, 0xd2, 0xca, 0xc4, 0x92, 0x94, 0xda, 0x56, 0xbb, 0xe2, 0xff,
+  0x88, 0xe0, 0x58, 0xee, 0x77, 0x14, 0x10, 0xa1, 0xb1, 0x7c, 0xdc, 0x8d, 0xd8, 0xcd, 0x19, 0x84,
+  0x4f, 0x04, 0xdb, 0x4d, 0xd8, 0x54, 0xcf, 0xd9, 0xee, 0xf6, 0x1c, 0xd3, 0x50, 0xcf, 0x90, 0x1d,
+  0x02, 0xbd, 0x11, 0xcb, 0x4e, 0x1c, 0xd4, 0x9a, 0x08, 0x6d, 0x95, 0x94, 0x60, 0xce, 0x45, 0xc1,
+  0x56, 0x59, 0xf4, 0x60, 0x15, 0xe5, 0xc9, 0x61, 0x8f, 0xec, 0x60, 0x29, 0xc4, 0x10, 0x2c, 0xa1,
+  0x5e, 0x8d, 0x12, 0x71, 0xa0, 0x51, 0x2c, 0x7b, 0x28, 0x92, 0xa8, 0x1e, 0xa1, 0x55, 0x83, 0x68,
+  0x05, 0x74, 0x09, 0x31, 0x3b, 0x54, 0x2d, 0x17, 0xd5, 0x68, 0xdb, 0x09, 0xa3, 0xfa, 0x41, 0x47,
+  0x71, 0x15, 0xc9, 0xe0, 0x49, 0xd6, 0x51, 0x4a, 0x93, 0xd2, 0x12, 0x7e, 0x0f, 0xe5, 0x4e, 0x05,
+  0xfe, 0xce, 0x11, 0x46, 0x4a, 0x2c, 0xea, 0xf9, 0x85, 0x60, 0xfb, 0x22, 0xb9, 0x6f, 0x55, 0x80,
+  0xd8, 0x1a, 0x40, 0x76, 0xf7, 0x4e, 0x10, 0xa8, 0x64, 0x68, 0x91, 0xbb, 0x2c, 0x1b, 0x55, 0x73,
+  0x14, 0x7c, 0x70, 0xc8, 0xfa, 0x14, 0xf6, 0x49, 0x4c, 0x6c, 0xb1, 0xf2, 0xd4, 0x00, 0xa3, 0xc6,
+  0xf3, 0x96, 0x38, 0x99, 0x94, 0x3e, 0x6f, 0xa6, 0x48, 0xe2, 0x8e, 0x54, 0xff, 0x5a, 0x88, 0xab,
+  0xdb, 0x9b, 0x94, 0xdd, 0x6d, 0x26, 0x2d, 0xde, 0x92, 0x16, 0xb1, 0x22, 0x6c, 0x4b, 0xef, 0x1f,
+  0x1d, 0x13, 0x09, 0x7b, 0x78, 0xd9, 0x34, 0x1f, 0x76, 0x46, 0x5d, 0xbf, 0xee, 0x8c, 0xd9, 0x1f,
+  0x3a, 0x9a, 0x65, 0x3d, 0x95, 0x88, 0xce, 0x62, 0xd8, 0xbf, 0x48, 0xc3, 0x5f, 0x2e, 0xaa, 0x16,
+  0xaa, 0x1d, 0xc6, 0x7a, 0xf1, 0x1b, 0x6d, 0x67, 0x45, 0x2d, 0x37, 0x6f, 0x44, 0x36, 0x42, 0x33,
+  0x6b, 0xeb, 0x31, 0xe8, 0x73, 0x47, 0x66, 0xe8, 0x4a, 0x70, 0xd1, 0xcd, 0x64, 0xb5, 0x5c, 0x67,
+  0x2f, 0x72, 0xc3, 0x76, 0x11, 0xa5, 0x06, 0x39, 0xf3, 0x36, 0xef, 0xff, 0x31, 0xdb, 0x9b, 0x9b,
+  0xf5, 0x36, 0x66, 0x4b, 0x49, 0x4f, 0xd9, 0x8e, 0x0e, 0xf3, 0x59, 0x19, 0xa8, 0xde, 0x38, 0x0c,
+  0x49, 0xfc, 0xe3, 0x50, 0x7a, 0x6d, 0xa1, 0x8c, 0x79, 0x69, 0x81, 0x83, 0x6d, 0x6a, 0x97, 0xb1,
+  0x0b, 0x96, 0xd4, 0x06, 0x38, 0xd4, 0xf2, 0xda, 0x56, 0x83, 0xc7, 0xd3, 0x63, 0x47, 0xcc, 0xe3,
+  0xee, 0x58, 0xab, 0xb7, 0x47, 0x0b, 0xa9, 0xf6, 0x7f, 0x3a, 0x81, 0x5d, 0x4e, 0x4a, 0xf8, 0x78,
+  0xb0, 0x9e, 0x1a, 0x45, 0x94, 0xde, 0x6a, 0x8c, 0x9e, 0x9a, 0xa2, 0xc7, 0xb3, 0x71, 0xb6, 0x53,
+  0x40, 0xd9, 0x19, 0xff, 0xcb, 0x2c, 0xfb, 0x7c, 0x1a, 0x09, 0xe3, 0x6e, 0xaf, 0xbc, 0x2a, 0x95,
+  0x56, 0x01, 0x87, 0x4e, 0xfc, 0xd6, 0xe8, 0xe4, 0x38, 0xa1, 0xa6, 0xd1, 0xf4, 0x88, 0x89, 0x4b,
+  0x38, 0x4c, 0xd3, 0xfc, 0x2f, 0x03, 0x37, 0x6a, 0xfc, 0xb5, 0x06, 0x00, 0x00,
+};
+
+// /upload.html, 349 bytes minified from 349, gzip 240
+static constexpr uint8_t asset_upload_html[] = {
+  0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+  0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x6d,
+  0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x27, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f,
+  0x72, 0x74, 0x27, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x27, 0x69, 0x6e, 0x69,
+  0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x27, 0x3e, 0x0a, 0x3c,
+  0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x57, 0x61, 0x76, 0x65, 0x20, 0x46, 0x61, 0x72, 0x6d, 0x20,
+  0x2d, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65,
+  0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e,
+  0x0a, 0x3c, 0x68, 0x31, 0x3e, 0x57, 0x61, 0x76, 0x65, 0x20, 0x46, 0x61, 0x72, 0x6d, 0x20, 0x54,
+  0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x20, 0x49,
+  0x6e, 0x64, 0x65, 0x78, 0x20, 0x50, 0x61, 0x67, 0x65, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x3c,
+  0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x27, 0x70, 0x6f, 0x73,
+  0x74, 0x27, 0x20, 0x65, 0x6e, 0x63, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x27, 0x6d, 0x75, 0x6c, 0x74,
+  0x69, 0x70, 0x61, 0x72, 0x74, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x2d, 0x64, 0x61, 0x74, 0x61, 0x27,
+  0x3e, 0x0a, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x27, 0x66, 0x69,
+  0x6c, 0x65, 0x27, 0x3e, 0x46, 0x69, 0x6c, 0x65, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e,
+  0x0a, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3d, 0x27, 0x66, 0x69, 0x6c, 0x65,
+  0x27, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x27, 0x66, 0x69, 0x6c, 0x65, 0x27, 0x20, 0x74, 0x79,
+  0x70, 0x65, 0x3d, 0x27, 0x66, 0x69, 0x6c, 0x65, 0x27, 0x20, 0x2f, 0x3e, 0x0a, 0x3c, 0x62, 0x75,
+  0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x55, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x3c, 0x2f, 0x62, 0x75, 0x74,
+  0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x3c, 0x2f, 0x62,
+  0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+};
+static constexpr uint8_t asset_upload_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x4d, 0x50, 0x3d, 0x4f, 0x03, 0x31,
+  0x0c, 0xdd, 0xfb, 0x2b, 0xcc, 0x94, 0xe9, 0x14, 0xdd, 0x9e, 0xdc, 0x42, 0xa9, 0xc4, 0x44, 0x87,
+  0x22, 0xc4, 0xe8, 0x5e, 0x7c, 0x34, 0x22, 0x5f, 0xba, 0xfa, 0x0a, 0xfd, 0xf7, 0x38, 0x24, 0x48,
+  0x2c, 0x79, 0xfe, 0x78, 0xcf, 0x7e, 0x8e, 0x79, 0xd8, 0xbf, 0x3c, 0x9e, 0xde, 0x8f, 0x4f, 0x70,
+  0xe1, 0x18, 0xa6, 0x9d, 0xf9, 0x03, 0x42, 0x27, 0x10, 0x89, 0x11, 0x12, 0x46, 0xb2, 0xea, 0xe6,
+  0xe9, 0xab, 0xe4, 0x95, 0x15, 0xcc, 0x39, 0x31, 0x25, 0xb6, 0xca, 0x27, 0xcf, 0x1e, 0xc3, 0x70,
+  0x9d, 0x31, 0x90, 0x1d, 0x95, 0x08, 0xd8, 0x73, 0xa0, 0xe9, 0x0d, 0x6f, 0x04, 0x07, 0x5c, 0x23,
+  0x0c, 0x70, 0xca, 0x39, 0x7c, 0x7a, 0x36, 0xba, 0xb5, 0x76, 0x46, 0xf7, 0xd9, 0xe7, 0xec, 0xee,
+  0x75, 0xd3, 0xf8, 0x8f, 0xde, 0xc9, 0xb0, 0xa7, 0x05, 0xb7, 0xc0, 0xf0, 0x9c, 0x1c, 0x7d, 0xc3,
+  0x11, 0x3f, 0x48, 0x64, 0xa3, 0xb0, 0x97, 0x2c, 0x2c, 0x71, 0x75, 0xc9, 0xce, 0xaa, 0x92, 0xaf,
+  0x62, 0x87, 0xd2, 0xcc, 0xf7, 0x22, 0x0e, 0xa3, 0x28, 0x7c, 0xc1, 0x95, 0x75, 0x65, 0x0d, 0x0e,
+  0x19, 0xab, 0xa5, 0x80, 0x67, 0x0a, 0x20, 0x25, 0xab, 0x16, 0x1f, 0x48, 0x4d, 0x07, 0x79, 0x8d,
+  0xfe, 0x2d, 0x4b, 0xdb, 0xa7, 0xb2, 0x31, 0x78, 0xd7, 0xbb, 0xfd, 0xda, 0x16, 0xb7, 0xb9, 0x2d,
+  0xd6, 0xd5, 0xf2, 0xc6, 0x9c, 0xd3, 0xf4, 0x5a, 0x42, 0x46, 0x67, 0x74, 0x4f, 0xe5, 0xa4, 0xba,
+  0xb0, 0x62, 0xbf, 0x49, 0xb7, 0x5f, 0xfc, 0x01, 0xe4, 0x0c, 0x47, 0x9a, 0x5d, 0x01, 0x00, 0x00,
+};
+
+// /kiosk.html, 504 bytes minified from 520, gzip 350
+static constexpr uint8_t asset_kiosk_html[] = {
+  0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+  0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x6c,
+  0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68,
+  0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x74, 0x6f, 0x6f, 0x6c, 0x6b,
+  0x69, 0x74, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63,
+  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d,
+  0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x22, 0x3e, 0x0a, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65,
+  0x3e, 0x57, 0x61, 0x76, 0x65, 0x20, 0x46, 0x61, 0x72, 0x6d, 0x20, 0x2d, 0x20, 0x54, 0x6f, 0x6f,
+  0x6c, 0x6b, 0x69, 0x74, 0x20, 0x2d, 0x20, 0x4b, 0x69, 0x6f, 0x73, 0x6b, 0x20, 0x4c, 0x69, 0x73,
+  0x74, 0x65, 0x6e, 0x65, 0x72, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x3c, 0x2f,
+  0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x53, 0x54, 0x41, 0x52, 0x54,
+  0x20, 0x4f, 0x46, 0x20, 0x42, 0x4f, 0x44, 0x59, 0x20, 0x2d, 0x2d, 0x3e, 0x0a, 0x3c, 0x62, 0x6f,
+  0x64, 0x79, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x61, 0x73, 0x74,
+  0x65, 0x72, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x64, 0x69, 0x76, 0x5f, 0x6d,
+  0x61, 0x73, 0x74, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x31, 0x3e, 0x57, 0x61, 0x76, 0x65,
+  0x20, 0x46, 0x61, 0x72, 0x6d, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x3c, 0x2f, 0x68,
+  0x31, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x3e, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x20, 0x74, 0x6f,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x42, 0x72, 0x6f, 0x61, 0x64, 0x63, 0x61, 0x73, 0x74, 0x3c, 0x2f,
+  0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72,
+  0x6f, 0x6c, 0x73, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x5f, 0x73, 0x74,
+  0x72, 0x65, 0x61, 0x6d, 0x22, 0x20, 0x70, 0x72, 0x65, 0x6c, 0x6f, 0x61, 0x64, 0x3d, 0x22, 0x6e,
+  0x6f, 0x6e, 0x65, 0x22, 0x3e, 0x0a, 0x3c, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x20, 0x73, 0x72,
+  0x63, 0x3d, 0x22, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x2e, 0x6d, 0x70, 0x33, 0x22, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x3d, 0x22, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x2f, 0x6d, 0x70, 0x65, 0x67, 0x22,
+  0x3e, 0x0a, 0x5b, 0x41, 0x75, 0x64, 0x69, 0x6f, 0x20, 0x54, 0x61, 0x67, 0x5d, 0x0a, 0x3c, 0x2f,
+  0x61, 0x75, 0x64, 0x69, 0x6f, 0x3e, 0x0a, 0x3c, 0x62, 0x72, 0x20, 0x2f, 0x3e, 0x26, 0x6e, 0x62,
+  0x73, 0x70, 0x3b, 0x0a, 0x3c, 0x68, 0x33, 0x3e, 0x28, 0x46, 0x65, 0x62, 0x72, 0x75, 0x61, 0x72,
+  0x79, 0x20, 0x32, 0x30, 0x32, 0x35, 0x29, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x0a, 0x3c, 0x2f, 0x64,
+  0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
+  0x45, 0x4e, 0x44, 0x20, 0x4f, 0x46, 0x20, 0x42, 0x4f, 0x44, 0x59, 0x20, 0x2d, 0x2d, 0x3e, 0x0a,
+  0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+};
+static constexpr uint8_t asset_kiosk_html_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x55, 0x51, 0xcb, 0x4e, 0xc3, 0x30,
+  0x10, 0xbc, 0xf7, 0x2b, 0xb6, 0x3e, 0x20, 0x38, 0xa4, 0xa1, 0xa9, 0x38, 0x11, 0x47, 0x6a, 0x69,
+  0x7b, 0x01, 0x51, 0x04, 0x91, 0x50, 0x85, 0x50, 0xe5, 0x26, 0x4b, 0x63, 0xd5, 0x8f, 0xc8, 0x76,
+  0x8b, 0xfa, 0xf7, 0xac, 0x93, 0x20, 0xc1, 0x69, 0xad, 0xdd, 0x99, 0x9d, 0x9d, 0x71, 0x3e, 0x5e,
+  0x6e, 0x1e, 0xca, 0xed, 0xcb, 0x0a, 0x9a, 0xa0, 0x55, 0x31, 0xca, 0x7f, 0x0b, 0x8a, 0x9a, 0x8a,
+  0x92, 0xe6, 0x08, 0x0e, 0x15, 0x67, 0x3e, 0x5c, 0x14, 0xfa, 0x06, 0x31, 0x30, 0x68, 0x1c, 0x7e,
+  0x71, 0x16, 0xac, 0x55, 0x47, 0x19, 0x26, 0x95, 0xf7, 0x8c, 0xa0, 0x1a, 0x83, 0x00, 0x23, 0x34,
+  0x72, 0x76, 0x96, 0xf8, 0xdd, 0x5a, 0x47, 0xc8, 0xca, 0x9a, 0x80, 0x26, 0x70, 0x26, 0x8d, 0x0c,
+  0x52, 0xa8, 0xc4, 0x57, 0x42, 0x21, 0x9f, 0x46, 0x42, 0x90, 0x41, 0x61, 0xf1, 0x2e, 0xce, 0x08,
+  0x6b, 0xe1, 0x34, 0x24, 0x50, 0xf6, 0x1b, 0xe9, 0xf5, 0x28, 0xad, 0x3f, 0xc2, 0x93, 0xf4, 0xc4,
+  0x46, 0x97, 0xa7, 0x3d, 0x76, 0x94, 0xa7, 0xc3, 0x5d, 0xe3, 0x24, 0x81, 0xb7, 0x72, 0xfe, 0x5a,
+  0xc2, 0x66, 0x0d, 0x8b, 0xcd, 0x72, 0x0b, 0x49, 0x42, 0xed, 0xbd, 0xad, 0x2f, 0x45, 0x5e, 0xcb,
+  0x33, 0xc8, 0x9a, 0x33, 0x2d, 0x88, 0xee, 0xe8, 0x08, 0x25, 0xbc, 0xe7, 0x8c, 0xda, 0xbb, 0xa1,
+  0x15, 0x0d, 0x4e, 0xff, 0x48, 0x0f, 0xc2, 0xb4, 0x7e, 0x1a, 0x47, 0x59, 0xd1, 0x2b, 0x43, 0xb0,
+  0x10, 0x1a, 0x84, 0x85, 0xb3, 0xa2, 0xae, 0x88, 0x4a, 0x80, 0x8c, 0x00, 0xe2, 0x54, 0x4b, 0xdb,
+  0x79, 0x73, 0x56, 0xf9, 0x4e, 0xab, 0x6b, 0xed, 0x7c, 0x70, 0x28, 0x34, 0x83, 0x96, 0x22, 0x23,
+  0x0a, 0x67, 0xc6, 0x1a, 0x8c, 0x6a, 0xde, 0x9e, 0x5c, 0x85, 0xe0, 0x5d, 0x15, 0x93, 0x8c, 0xa0,
+  0x89, 0x6e, 0x67, 0x0c, 0xc2, 0xa5, 0xc5, 0x81, 0x9c, 0xea, 0x16, 0x0f, 0x84, 0xfd, 0x98, 0x77,
+  0xdb, 0x4b, 0x71, 0xf8, 0x24, 0xbf, 0xdd, 0x28, 0x3a, 0x73, 0x90, 0x16, 0x57, 0x66, 0xef, 0xdb,
+  0x7b, 0x3a, 0x70, 0x56, 0x5c, 0xaf, 0x71, 0xef, 0x4e, 0xc2, 0x5d, 0x20, 0xbb, 0xcd, 0xee, 0x6e,
+  0xe8, 0xb0, 0x59, 0x8c, 0x87, 0x3c, 0x16, 0x79, 0xda, 0xc5, 0xd0, 0x87, 0xb4, 0x7a, 0x5e, 0xfe,
+  0x8f, 0x28, 0xed, 0x3f, 0xf8, 0x07, 0x7c, 0x10, 0xc0, 0x78, 0xf8, 0x01, 0x00, 0x00,
+};
+
+static constexpr default_asset default_assets[DEFAULT_FILES_COUNT] = {
+    { "/index.html", FILE_IS_INDEX, "text/html",
+        asset_index_html, 6133, "\"80155bd3c950e2b8\"",
+        asset_index_html_gz, 1782, "\"6e05e54fdf12cd98\"",
+        "\"3c2df14db3beeb06\"" },
+    { "/toolkit.js", FILE_IS_ANY, "text/javascript",
+        asset_toolkit_js, 5673, "\"6f81ad50beccf6ab\"",
+        asset_toolkit_js_gz, 1811, "\"7c32042bc38fdc71\"",
+        "\"bde5aea89410b4b3\"" },
+    { "/toolkit.css", FILE_IS_ANY, "text/css",
+        asset_toolkit_css, 1717, "\"a1ca10b0737d0228\"",
+        asset_toolkit_css_gz, 765, "\"b80f71388b36dfed\"",
+        "\"2c5cbd18ad48aa6c\"" },
+    { "/upload.html", FILE_IS_UPLOAD, "text/html",
+        asset_upload_html, 349, "\"1f4daf3bcda68db0\"",
+        asset_upload_html_gz, 240, "\"848e8e3b0f41aa0f\"",
+        "\"1f4daf3bcda68db0\"" },
+    { "/kiosk.html", FILE_IS_ANY, "text/html",
+        asset_kiosk_html, 504, "\"7dc50eb7e069b8bd\"",
+        asset_kiosk_html_gz, 350, "\"861fe51f5bb8bb02\"",
+        "\"5723e4f874a8b389\"" },
+    { "/", FILE_IS_ROOT, NULL, NULL, 0, NULL, NULL, 0, NULL, NULL },
+    { "/upload", FILE_IS_UPLOAD, NULL, NULL, 0, NULL, NULL, 0, NULL, NULL },
+    { "/favicon.ico", FILE_IS_FAVICON, NULL, NULL, 0, NULL, NULL, 0, NULL, NULL },
+};
+
+static constexpr int8_t default_slots[DEFAULT_FILES_SLOTS] = {
+    1, 4, 7, -1, -1, 3, 2, -1, 0, -1, -1, 5, -1, -1, 6, -1
+};
+
+static_assert((default_files_hash("/index.html", default_files_seed) & (DEFAULT_FILES_SLOTS - 1)) == 8, "rerun make_data.py");
+static_assert((default_files_hash("/toolkit.js", default_files_seed) & (DEFAULT_FILES_SLOTS - 1)) == 0, "rerun make_data.py");
+static_assert((default_files_hash("/toolkit.css", default_files_seed) & (DEFAULT_FILES_SLOTS - 1)) == 6, "rerun make_data.py");
+static_assert((default_files_hash("/upload.html", default_files_seed) & (DEFAULT_FILES_SLOTS - 1)) == 5, "rerun make_data.py");
+static_assert((default_files_hash("/kiosk.html", default_files_seed) & (DEFAULT_FILES_SLOTS - 1)) == 1, "rerun make_data.py");
+static_assert((default_files_hash("/", default_files_seed) & (DEFAULT_FILES_SLOTS - 1)) == 11, "rerun make_data.py");
+static_assert((default_files_hash("/upload", default_files_seed) & (DEFAULT_FILES_SLOTS - 1)) == 14, "rerun make_data.py");
+static_assert((default_files_hash("/favicon.ico", default_files_seed) & (DEFAULT_FILES_SLOTS - 1)) == 2, "rerun make_data.py");
+
+//
+// END OF assets.h
@@ -0,0 +1,357 @@
+//
+// hls_segmenter.cpp
+
+#include "hls_segmenter.h"
+#include "mp3_frame.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+
+typedef struct {
+    uint32_t number;            // media sequence number
+    uint32_t length;            // bytes, including the ID3 tag
+    uint32_t duration_ms;
+    boolean complete;           // in the playlist once it's complete
+    boolean discontinuity;      // audio was lost before this one
+} hls_segment;
+
+static uint8_t *store = NULL;   // HLS_SEGMENTS * HLS_SEGMENT_BYTES, PSRAM
+static hls_segment segments[HLS_SEGMENTS];
+static uint32_t current = 0;    // the segment being filled
+static uint32_t next_number = 0;
+
+// walking the frames of the current segment
+static uint32_t parsed = 0;     // offset of the next frame
+static uint32_t samples = 0;    // in the current segment
+static uint32_t sample_rate = 0;
+static uint64_t total_samples = 0;  // for the timestamps
+static boolean lost_audio = false;  // the next segment doesn't join up
+
+// our place in the encoder ring
+static uint32_t (*ring_head)() = NULL;
+static uint32_t (*ring_oldest)() = NULL;
+static uint8_t *(*ring_get)(uint32_t, size_t*) = NULL;
+static boolean have_cursor = false;
+static uint32_t cursor = 0;
+
+// the server task reads segments while we fill the next ones
+static portMUX_TYPE segment_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// stats
+static uint32_t stats_segments = 0;
+static uint32_t stats_lost = 0;         // ring buffers we were too late for
+static uint32_t stats_skipped = 0;      // bytes that weren't frames
+static uint32_t stats_playlists = 0;
+static uint32_t stats_fetches = 0;
+static uint32_t stats_too_late = 0;     // overwritten while being sent
+
+#define SEGMENT_DATA(I) (&store[(I) * HLS_SEGMENT_BYTES])
+
+static const char *playlist_path = "/hls/live.m3u8";
+
+boolean hls_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*))
+{
+    if (store || (0==SettingItem::findUInt("local_hls", 1))) {
+        return (NULL!=store);
+    }
+    if (!psramFound()) {
+        Serial.println("HLS needs PSRAM, it is off.");
+        return false;
+    }
+    store = (uint8_t *) ps_malloc(HLS_SEGMENTS * HLS_SEGMENT_BYTES);
+    if (NULL==store) {
+        Serial.println("No room in PSRAM for the HLS segments.");
+        return false;
+    }
+    memset(segments, 0, sizeof(segments));
+    ring_head = head;
+    ring_oldest = oldest;
+    ring_get = get;
+    Serial.printf("HLS segments in PSRAM: %u x %u bytes\n",
+        HLS_SEGMENTS, HLS_SEGMENT_BYTES);
+    return true;
+}
+
+boolean hls_isPath(const char *path)
+{
+    return (0==strncmp("/hls/", path, 5));
+}
+
+//------------------------------------------------------------------
+//
+// Cutting segments
+//
+
+// Packed audio segments start with an ID3 PRIV frame holding the
+// 33 bit, 90kHz timestamp of the first sample.
+static void write_timestamp(uint8_t *p)
+{
+    static const char owner[] = "com.apple.streaming.transportStreamTimestamp";
+    uint64_t pts = sample_rate ? ((total_samples * 90000) / sample_rate) : 0;
+    pts &= 0x1ffffffffULL;
+
+    memcpy(p, "ID3\x04\x00\x00", 6);
+    p[6] = 0; p[7] = 0; p[8] = 0; p[9] = HLS_ID3_SIZE - 10;    // syncsafe
+    memcpy(&p[10], "PRIV", 4);
+    p[14] = 0; p[15] = 0; p[16] = 0; p[17] = HLS_ID3_SIZE - 20;
+    p[18] = 0; p[19] = 0;                                       // flags
+    memcpy(&p[20], owner, sizeof(owner));                       // with the NULL
+    uint8_t *ts = &p[20 + sizeof(owner)];
+    for (int32_t i = 7; i >= 0; i--) {
+        ts[i] = pts & 0xff;
+        pts >>= 8;
+    }
+}
+
+// start filling the next slot, with carry_length bytes carried over
+// from the end of the last one (the start of the next frame)
+static void start_segment(const uint8_t *carry, size_t carry_length)
+{
+    uint32_t next = (current + 1) % HLS_SEGMENTS;
+    portENTER_CRITICAL(&segment_lock);
+    segments[next].complete = false;    // gone from the playlist
+    segments[next].number = next_number++;
+    portEXIT_CRITICAL(&segment_lock);
+
+    uint8_t *p = SEGMENT_DATA(next);
+    write_timestamp(p);
+    if (carry_length) {
+        memmove(&p[HLS_ID3_SIZE], carry, carry_length);
+    }
+    segments[next].length = HLS_ID3_SIZE + carry_length;
+    segments[next].duration_ms = 0;
+    segments[next].discontinuity = lost_audio;
+    lost_audio = false;
+    current = next;
+    parsed = HLS_ID3_SIZE;
+    samples = 0;
+}
+
+static void finish_segment()
+{
+    hls_segment *s = &segments[current];
+    portENTER_CRITICAL(&segment_lock);
+    s->length = parsed;
+    s->duration_ms = sample_rate ? ((uint64_t) samples * 1000 / sample_rate) : 0;
+    s->complete = true;
+    portEXIT_CRITICAL(&segment_lock);
+    total_samples += samples;
+    stats_segments++;
+}
+
+// drop length bytes at offset in the current segment
+static void drop_bytes(uint32_t offset, uint32_t length)
+{
+    hls_segment *s = &segments[current];
+    uint8_t *p = SEGMENT_DATA(current);
+    memmove(&p[offset], &p[offset + length], s->length - offset - length);
+    s->length -= length;
+    stats_skipped += length;
+}
+
+static void add_buffer(const uint8_t *data, size_t length)
+{
+    hls_segment *s = &segments[current];
+    if ((s->length + length) > HLS_SEGMENT_BYTES) {
+        // no frames in here at all, start again
+        stats_skipped += s->length - HLS_ID3_SIZE;
+        s->length = HLS_ID3_SIZE;
+        parsed = HLS_ID3_SIZE;
+        samples = 0;
+    }
+    memcpy(SEGMENT_DATA(current) + s->length, data, length);
+    s->length += length;
+
+    // walk the whole frames we have now
+    mp3_frame_info info;
+    while ((parsed + MP3_HEADER_SIZE) <= segments[current].length) {
+        uint8_t *p = SEGMENT_DATA(current);
+        s = &segments[current];
+        if (!mp3_frame_parse(&p[parsed], &info)) {
+            // lost sync, skip to the next frame header
+            uint32_t skip = mp3_frame_find(&p[parsed], s->length - parsed);
+            drop_bytes(parsed, skip ? skip : 1);
+            continue;
+        }
+        if ((parsed + info.length) > s->length) {
+            break;  // the rest of the frame is in the next ring buffer
+        }
+        boolean rate_change = sample_rate && (info.sample_rate != sample_rate);
+        if (samples && (rate_change ||
+            (((uint64_t) samples * 1000 / sample_rate) >= HLS_TARGET_MS))) {
+            // cut here, this frame starts the next segment
+            if (rate_change) {
+                lost_audio = true;  // players need to know it changed
+            }
+            uint32_t carry = s->length - parsed;
+            finish_segment();
+            start_segment(&p[parsed], carry);
+            continue;
+        }
+        sample_rate = info.sample_rate;
+        samples += info.samples;
+        parsed += info.length;
+    }
+}
+
+void hls_run()
+{
+    if ((NULL==store) || (NULL==ring_get)) {
+        return;
+    }
+    uint32_t head = ring_head();
+    if (!have_cursor) {
+        // start from the newest full buffer, in a fresh segment
+        cursor = (head > 0) ? (head - 1) : 0;
+        have_cursor = true;
+        current = HLS_SEGMENTS - 1;
+        start_segment(NULL, 0);
+    }
+    uint32_t oldest = ring_oldest();
+    if (cursor < oldest) {
+        stats_lost += oldest - cursor;
+        cursor = oldest;
+        // throw away the part segment, the audio doesn't join up
+        segments[current].length = HLS_ID3_SIZE;
+        segments[current].discontinuity = true;
+        parsed = HLS_ID3_SIZE;
+        samples = 0;
+    }
+    while (cursor < head) {
+        size_t length;
+        uint8_t *data = ring_get(cursor, &length);
+        if (NULL==data) {
+            break;  // overwritten since we looked, catch it next time
+        }
+        add_buffer(data, length);
+        cursor++;
+    }
+}
+
+//------------------------------------------------------------------
+//
+// Serving
+//
+
+static void send_playlist(ToolkitWiFi_Client *twfc, char *buffer, size_t max_size)
+{
+    // the newest complete segments, oldest first
+    uint32_t list[HLS_PLAYLIST_LENGTH];
+    hls_segment copy[HLS_PLAYLIST_LENGTH];
+    uint32_t count = 0;
+    portENTER_CRITICAL(&segment_lock);
+    for (uint32_t i = 1; (i < HLS_SEGMENTS) && (count < HLS_PLAYLIST_LENGTH); i++) {
+        uint32_t slot = (current + HLS_SEGMENTS - i) % HLS_SEGMENTS;
+        if (segments[slot].complete) {
+            list[count] = slot;
+            copy[count] = segments[slot];
+            count++;
+        }
+    }
+    portEXIT_CRITICAL(&segment_lock);
+
+    uint32_t target = (HLS_TARGET_MS + 999) / 1000;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t seconds = (copy[i].duration_ms + 999) / 1000;
+        if (seconds > target) {
+            target = seconds;
+        }
+    }
+
+    int length = snprintf(buffer, max_size,
+        "#EXTM3U\n#EXT-X-VERSION:3\n#EXT-X-TARGETDURATION:%u\n"
+        "#EXT-X-MEDIA-SEQUENCE:%u\n",
+        target, count ? copy[count-1].number : 0);
+    for (int32_t i = count - 1; (i >= 0) && (length < (int) max_size); i--) {
+        length += snprintf(&buffer[length], max_size - length,
+            "%s#EXTINF:%u.%03u,\nseg_%u.mp3\n",
+            copy[i].discontinuity ? "#EXT-X-DISCONTINUITY\n" : "",
+            copy[i].duration_ms / 1000, copy[i].duration_ms % 1000,
+            copy[i].number);
+    }
+    if (length >= (int) max_size) {
+        length = max_size - 1;
+    }
+
+    twfc->client->printf("HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/vnd.apple.mpegurl\r\n"
+        "Content-Length: %u\r\n"
+        "Cache-Control: no-cache\r\n\r\n", length);
+    twfc->client->write(buffer, length);
+    stats_playlists++;
+}
+
+// Sent straight out of PSRAM. The segment can only be overwritten
+// once the segmenter has gone all the way round the store, but a very
+// slow fetch could still see it happen, so check as we go.
+static boolean send_segment(ToolkitWiFi_Client *twfc, uint32_t number,
+    size_t max_size)
+{
+    uint32_t slot = number % HLS_SEGMENTS;
+    uint32_t length = 0;
+    portENTER_CRITICAL(&segment_lock);
+    boolean found = segments[slot].complete && (number==segments[slot].number);
+    if (found) {
+        length = segments[slot].length;
+    }
+    portEXIT_CRITICAL(&segment_lock);
+    if (!found) {
+        return false;
+    }
+
+    twfc->client->printf("HTTP/1.1 200 OK\r\n"
+        "Content-Type: audio/mpeg\r\n"
+        "Content-Length: %u\r\n"
+        "Cache-Control: max-age=%u\r\n\r\n",
+        length, (HLS_SEGMENTS * HLS_TARGET_MS) / 1000);
+    const uint8_t *p = SEGMENT_DATA(slot);
+    uint32_t sent = 0;
+    while (sent < length) {
+        size_t chunk = length - sent;
+        if (chunk > max_size) {
+            chunk = max_size;
+        }
+        size_t actual = twfc->client->write(&p[sent], chunk);
+        if ((0==actual) || (number != segments[slot].number)) {
+            // it's too late, the length we promised can't be kept
+            stats_too_late++;
+            twfc->client->stop();
+            return true;
+        }
+        sent += actual;
+    }
+    stats_fetches++;
+    return true;
+}
+
+boolean hls_handleGetRequest(ToolkitWiFi_Client *twfc, const char *path,
+    char *buffer, size_t max_size)
+{
+    if (NULL==store) {
+        return false;
+    }
+    if (0==strcmp(playlist_path, path)) {
+        send_playlist(twfc, buffer, max_size);
+        return true;
+    }
+    uint32_t number;
+    char end[8];
+    if ((2==sscanf(path, "/hls/seg_%u.%7s", &number, end)) &&
+        (0==strcmp("mp3", end))) {
+        return send_segment(twfc, number, max_size);
+    }
+    return false;
+}
+
+void hls_printStats()
+{
+    if (NULL==store) {
+        return;
+    }
+    Serial.printf("HLS segments %u, playlists %u, fetches %u, too late %u\n",
+        stats_segments, stats_playlists, stats_fetches, stats_too_late);
+    Serial.printf("HLS lost %u ring buffers, skipped %u bytes\n",
+        stats_lost, stats_skipped);
+}
+
+//
+// END OF hls_segmenter.cpp
@@ -0,0 +1,64 @@
+//
+// hls_segmenter.h
+
+//
+// HLS output for the local listeners.
+//
+// An endless audio/mpeg reply holds a socket (and a client slot) for
+// as long as someone listens, and some players (iOS, kiosk browsers)
+// don't like it much anyway. HLS players fetch a short playlist every
+// few seconds and then the segments it lists, so each listener only
+// holds a socket while it is fetching.
+//
+//  GET /hls/live.m3u8      .. the rolling playlist
+//  GET /hls/seg_<n>.mp3    .. segment n, packed MP3 audio
+//
+// The segmenter keeps its own place in the encoder ring, like the
+// uplinks, and copies the mp3 bytes into a store of HLS_SEGMENTS
+// segments in PSRAM. Segments are cut on frame boundaries once they
+// hold HLS_TARGET_MS of audio, and start with the ID3 timestamp tag
+// that packed audio needs. Only the newest HLS_PLAYLIST_LENGTH
+// complete segments are in the playlist, the older ones stay a while
+// for players that are still fetching them.
+//
+// hls_run() is called from the stream task, the requests are served
+// from the server task.
+//
+
+#ifndef _HLS_SEGMENTER_H_
+#define _HLS_SEGMENTER_H_
+
+#include <Arduino.h>
+#include "ToolkitWiFi_Client.h"
+
+enum {
+    HLS_SEGMENTS        = 8,
+    HLS_PLAYLIST_LENGTH = 4,
+    HLS_TARGET_MS       = 4000,
+    HLS_ID3_SIZE        = 73,       // the PRIV timestamp tag
+    // 5 seconds at 320kbps, room for the last frame to run over
+    HLS_SEGMENT_BYTES   = HLS_ID3_SIZE + (5 * 40000) + 4096
+};
+
+// needs PSRAM for the store, returns false if HLS is off
+// (local_hls = 0) or there isn't room
+boolean hls_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*));
+
+// from the stream task .. copy new ring buffers into the segments
+void hls_run();
+
+// /hls/...
+boolean hls_isPath(const char *path);
+
+// answer a GET for the playlist or a segment, false if there is no such
+// thing (the caller sends the 404). buffer is scratch for the playlist.
+boolean hls_handleGetRequest(ToolkitWiFi_Client *twfc, const char *path,
+    char *buffer, size_t max_size);
+
+void hls_printStats();
+
+#endif
+
+//
+// END OF hls_segmenter.h
@@ -6,6 +6,9 @@
 #include "ToolkitWiFi_Client.h"
 #include "../ToolkitFiles/ToolkitFiles.h"
 #include "default_files.h"
+#include "hls_segmenter.h"
+#include "asset_cache.h"
+#include "sha1.h"
 
 //------------------------------------------------------------------
 //
@@ -27,18 +30,59 @@ void http_turnOnKioskMode(int onNotOff)
 enum {
     RESPONSE_OKAY       = 200,
     RESPONSE_CREATED    = 201,
-    RESPONSE_NOT_FOUND  = 404
+    RESPONSE_PARTIAL    = 206,
+    RESPONSE_NOT_MODIFIED = 304,
+    RESPONSE_NOT_FOUND  = 404,
+    RESPONSE_BAD_RANGE  = 416
 };
 
+// text may be sent gzipped or not
+static const char *vary_header(const char *mime)
+{
+    return (0==strncmp("text/", mime, 5)) ? "Vary: Accept-Encoding\n" : "";
+}
+
+// encoding is "gzip" or NULL
+// with an etag the browser can keep the file, but has to check it
+// hasn't changed (If-None-Match) each time it's used
+// range is "bytes first-last/size" for RESPONSE_PARTIAL
 static void http_send_header(ToolkitWiFi_Client *twfc,
-    size_t content_length, uint32_t response, const char *mime)
+    size_t content_length, uint32_t response, const char *mime,
+    const char *encoding, const char *etag, const char *range)
 {
     const char nocache[] =
         "Cache-Control: no-cache, no-store, must-revalidate\n"
         "Pragma: no-cache\nExpires: 0\n";
+    char validate[ASSET_ETAG_SIZE + 40];
+    if (etag) {
+        snprintf(validate, sizeof(validate),
+            "ETag: %s\nCache-Control: no-cache\n", etag);
+    }
 	twfc->client->printf(
-        "HTTP/1.1 %u OK\nContent-Length: %u\nContent-Type: %s; charset=UTF-8\n%s\n",
-        response, content_length, mime, nocache);
+        "HTTP/1.1 %u %s\nContent-Length: %u\nContent-Type: %s%s\n"
+        "Accept-Ranges: bytes\n%s%s%s%s%s%s%s%s\n",
+        response, range ? "Partial Content" : "OK", content_length, mime,
+        (0==strncmp("text/", mime, 5)) ? "; charset=UTF-8" : "",
+        range ? "Content-Range: " : "", range ? range : "", range ? "\n" : "",
+        encoding ? "Content-Encoding: " : "", encoding ? encoding : "",
+        encoding ? "\n" : "", vary_header(mime), etag ? validate : nocache);
+}
+
+// the range starts after the end of the file
+static void http_send_416(ToolkitWiFi_Client *twfc, size_t size)
+{
+	twfc->client->printf(
+        "HTTP/1.1 %u Range Not Satisfiable\nContent-Length: 0\n"
+        "Content-Range: bytes */%u\n\n", RESPONSE_BAD_RANGE, size);
+}
+
+// the browser's copy is still good
+static void http_send_304(ToolkitWiFi_Client *twfc, const char *mime,
+    const char *etag)
+{
+	twfc->client->printf(
+        "HTTP/1.1 %u Not Modified\nETag: %s\nCache-Control: no-cache\n%s\n",
+        RESPONSE_NOT_MODIFIED, etag, vary_header(mime));
 }
 
 static void http_send_data_chunk(ToolkitWiFi_Client *twfc,
@@ -88,6 +132,7 @@ Content-Type: multipart/form-data; boundary=----WebKitFormBoundaryoKkPKmBNiJBy6K
 */
 
 #define MAX_FILENAME_LENGTH 32
+#define MAX_PATH_LENGTH (MAX_FILENAME_LENGTH+16)  // and .gz.etag
 #define MAX_BOUNDARY_LENGTH 72
 
 inline const char *copyBoundary(char *dst, const char *buffer)
@@ -111,12 +156,147 @@ inline const char *copyBoundary(char *dst, const char *buffer)
 }
 
 static char filename[MAX_FILENAME_LENGTH+2] = "/";
+
+//------------------------------------------------------------------
+//
+// ETags .. files in the cache have theirs worked out as they're read
+// in (see asset_cache.h), the rest have it kept in path.etag, which
+// is made when they're uploaded. Those are all read in at boot, and
+// kept here with each upload's, so a browser checking its copy never
+// costs a flash read.
+//
+
+enum {
+    ETAG_ENTRIES = 32
+};
+
+typedef struct {
+    char path[MAX_FILENAME_LENGTH+8];       // and .gz
+    char etag[ASSET_ETAG_SIZE];
+} etag_entry;
+
+static etag_entry etags[ETAG_ENTRIES];
+static uint32_t etag_next = 0;              // the one to go when full
+
+static etag_entry *find_etag(const char *path)
+{
+    for (uint32_t i = 0; i < ETAG_ENTRIES; i++) {
+        if (etags[i].path[0] && (0==strcmp(path, etags[i].path))) {
+            return &etags[i];
+        }
+    }
+    return NULL;
+}
+
+static void remember_etag(const char *path, const char *etag)
+{
+    if (strlen(path) >= sizeof(etags[0].path)) {
+        return;
+    }
+    etag_entry *e = find_etag(path);
+    for (uint32_t i = 0; !e && (i < ETAG_ENTRIES); i++) {
+        if (0==etags[i].path[0]) {
+            e = &etags[i];
+        }
+    }
+    if (!e) {
+        e = &etags[etag_next];
+        etag_next = (etag_next + 1) % ETAG_ENTRIES;
+    }
+    snprintf(e->path, sizeof(e->path), "%s", path);
+    snprintf(e->etag, sizeof(e->etag), "%s", etag);
+}
+
+static void forget_etag(const char *path)
+{
+    etag_entry *e = find_etag(path);
+    if (e) {
+        e->path[0] = 0;
+    }
+}
+
+static void write_etag(const char *path, char *buffer, size_t max_size)
+{
+    File f = ToolkitFiles::fileOpen(path, FILE_READ);
+    if (!f) {
+        forget_etag(path);
+        return;
+    }
+    SHA1Context sha;
+    SHA1Reset(&sha);
+    size_t actual;
+    while ((actual = f.readBytes(buffer, max_size)) > 0) {
+        SHA1Input(&sha, (const uint8_t *) buffer, actual);
+    }
+    f.close();
+    uint8_t digest[SHA1HashSize];
+    SHA1Result(&sha, digest);
+    char etag[ASSET_ETAG_SIZE];
+    asset_cache_makeETag(digest, etag);
+    remember_etag(path, etag);
+
+    char etag_path[MAX_PATH_LENGTH];
+    snprintf(etag_path, sizeof(etag_path), "%s.etag", path);
+    ToolkitFiles::fileWrite(etag_path, etag, strlen(etag));
+}
+
+// etag is ASSET_ETAG_SIZE
+static boolean read_etag(const char *path, char *etag)
+{
+    etag_entry *e = find_etag(path);
+    if (e) {
+        memcpy(etag, e->etag, ASSET_ETAG_SIZE);
+    }
+    return (NULL != e);
+}
+
+// every path.etag in the flash
+void http_file_begin()
+{
+    memset(etags, 0, sizeof(etags));
+    etag_next = 0;
+    File root = ToolkitFiles::fileOpen("/", FILE_READ);
+    if (!root || !root.isDirectory()) {
+        return;
+    }
+    uint32_t count = 0;
+    File f;
+    while ((f = root.openNextFile())) {
+        // the core has given names with and without the leading /
+        const char *name = f.name();
+        char path[MAX_PATH_LENGTH];
+        snprintf(path, sizeof(path), "%s%s", ('/'==name[0]) ? "" : "/", name);
+        size_t length = strlen(path);
+        char etag[ASSET_ETAG_SIZE];
+        if ((length > 5) && (0==strcmp(".etag", &path[length - 5])) &&
+                ((ASSET_ETAG_SIZE - 1)==f.size()) &&
+                ((ASSET_ETAG_SIZE - 1)==f.readBytes(etag, ASSET_ETAG_SIZE - 1))) {
+            etag[ASSET_ETAG_SIZE - 1] = 0;
+            path[length - 5] = 0;
+            remember_etag(path, etag);
+            count++;
+        }
+        f.close();
+    }
+    root.close();
+    Serial.printf("%u ETags from the flash\n", count);
+}
+
+// If-None-Match is "*" or a list of ETags
+static boolean etag_matches(const http_request *r, const char *etag)
+{
+    if ((NULL==etag) || (NULL==r->if_none_match)) {
+        return false;
+    }
+    return (0==strcmp("*", r->if_none_match)) ||
+        (NULL != strstr(r->if_none_match, etag));
+}
 static char boundary[MAX_BOUNDARY_LENGTH+2] = "";
 static char match[MAX_BOUNDARY_LENGTH+2] = "";
 static uint32_t matchpoint = 0;
 
-static const char *postfile_findContent(const char *buffer,
-    const char **content)
+static const char *postfile_findContent(const char *path,
+    const char *buffer, const char **content)
 {
 
     *content = NULL;
@@ -130,26 +310,15 @@ static const char *postfile_findContent(const char *buffer,
     // POST /
     // POST /upload
     // POST /upload.html
-    buffer = strstr(buffer, "/");
-    if (NULL == buffer) {
+    if ((0 != strcmp("/", path)) && (NULL == strstr(path, "upload"))) {
         return NULL;
     }
-    if (' ' != buffer[1]) {
-        buffer = strstr(buffer, "upload");
-        if (NULL == buffer) {
-            return NULL;
-        }
-    }
 
     // (1) We already know it is a POST request ..
-    // We also know that buffer is NULL terminated by the ToolkitWiFi code
-    // find two endlines in a row
-    buffer = findTwoEndlines(buffer);
-    if (NULL == buffer) {
-        return NULL;
-    }
+    // The HTTP request parser has already taken the headers off,
+    // buffer is the start of the body and it is NULL terminated
 
-    // (2) The boundary string is the next line
+    // (2) The boundary string is the first line
     buffer = copyBoundary(boundary, buffer);
     if (NULL == buffer) {
         return NULL;
@@ -297,14 +466,14 @@ BOUNDARY
 
 */
 
-void http_handlePostRequest(ToolkitWiFi_Client *twfc,
-    char *buffer, size_t actual, size_t max_size)
+void http_handlePostRequest(ToolkitWiFi_Client *twfc, const char *path,
+    const char *body, size_t body_length, char *buffer, size_t max_size)
 {
     const char *content = NULL;
     size_t remaining = 0;
     const char *filename = NULL;
 
-    filename = postfile_findContent(buffer, &content);
+    filename = postfile_findContent(path, body, &content);
 
     if ((NULL==filename) || (0==filename[1])) {
         twfc->closeClient();
@@ -319,7 +488,7 @@ void http_handlePostRequest(ToolkitWiFi_Client *twfc,
     }
 
     boolean keepgoing = true;
-    remaining = actual - (content - buffer);
+    remaining = body_length - (content - body);
 
     if (remaining) {
         keepgoing = postfile_addContent(&f, content, remaining);
@@ -353,6 +522,26 @@ void http_handlePostRequest(ToolkitWiFi_Client *twfc,
     }
 
     f.close();
+    asset_cache_invalidate(filename);
+    default_files_uploaded(filename);
+    write_etag(filename, buffer, max_size);
+
+    // a new page replaces its gzipped copy, or browsers would still be
+    // sent the old one
+    size_t length = strlen(filename);
+    if ((length < 3) || (0 != strcmp(".gz", &filename[length - 3]))) {
+        char gz_path[MAX_PATH_LENGTH];
+        snprintf(gz_path, sizeof(gz_path), "%s.gz", filename);
+        if (ToolkitFiles::fileExists(gz_path)) {
+            ToolkitFiles::fileRemove(gz_path);
+        }
+        asset_cache_invalidate(gz_path);
+        forget_etag(gz_path);
+        snprintf(gz_path, sizeof(gz_path), "%s.gz.etag", filename);
+        if (ToolkitFiles::fileExists(gz_path)) {
+            ToolkitFiles::fileRemove(gz_path);
+        }
+    }
 
     http_send_201(twfc);
     twfc->setClientTimedClose();
@@ -380,12 +569,19 @@ static mime_item mime_list[] = {
     { "png",  "image/png" },
     { "jpg",  "image/jpeg" },
     { "jpeg", "image/jpeg "},
+    { "mp3",  "audio/mpeg" },
+    { "ogg",  "audio/ogg" },
+    { "opus", "audio/ogg" },
+    { "wav",  "audio/wav" },
+    { "aac",  "audio/aac" },
+    { "m4a",  "audio/mp4" },
+    { "flac", "audio/flac" },
     { "", ""}
 };
 
 static char *mime_type(const char *name)
 {
-    char *dot = strrchr(name, '.');
+    const char *dot = strrchr(name, '.');
     if ((NULL != dot) && (0 != dot[1])) {
         dot++;  // point at first char after the dot
         mime_item *mi = mime_list;
@@ -400,30 +596,13 @@ static char *mime_type(const char *name)
 }
 
 //
-// (2) File types based on filename
-
-enum {
-    FILE_IS_ANY     = 0,
-    FILE_IS_ROOT,
-    FILE_IS_INDEX,
-    FILE_IS_FAVICON,
-    FILE_IS_UPLOAD
-};
+// (2) File types based on filename .. the FILE_IS_* routes are in the
+// table of built in pages (see default_files.h)
 
 static uint32_t match_filename(const char *path)
 {
-    if (0==strcmp("/favicon.ico", path)) {
-        return FILE_IS_FAVICON;
-    } else if (0==strcmp("/upload", path)) {
-        return FILE_IS_UPLOAD;
-    } else if (0==strcmp("/upload.html", path)) {
-        return FILE_IS_UPLOAD;
-    } else if (0==strcmp("/index.html", path)) {
-        return FILE_IS_INDEX;
-    } else if (0==strcmp("/", path)) {
-        return FILE_IS_ROOT;
-    }
-    return FILE_IS_ANY;
+    const default_asset *a = default_files_lookup(path);
+    return a ? a->route : FILE_IS_ANY;
 }
 
 static boolean is_file_html(const char *path)
@@ -439,16 +618,213 @@ static boolean is_file_html(const char *path)
     return true; // everything forwards to html except js and css
 }
 
-static boolean file_exists(const char *path)
+//
+// (3) Ranges .. one range is enough for players seeking and downloads
+// being resumed, a list of them gets the whole file
+
+enum {
+    RANGE_NONE = 0,     // send all of it
+    RANGE_OKAY,
+    RANGE_BAD           // starts after the end, 416
+};
+
+// "bytes=first-last", "bytes=first-" or "bytes=-length"
+static uint32_t parse_range(const http_request *r, const char *etag,
+    size_t size, size_t *first, size_t *last)
+{
+    const char *p = r->range;
+    if ((NULL==p) || (0 != strncasecmp("bytes=", p, 6)) || strchr(p, ',')) {
+        return RANGE_NONE;
+    }
+    // If-Range says which copy the part it has came from
+    if (r->if_range && ((NULL==etag) || (0 != strcmp(r->if_range, etag)))) {
+        return RANGE_NONE;
+    }
+    p += 6;
+    char *end;
+    if ('-'==*p) {
+        size_t length = strtoul(p + 1, &end, 10);
+        if (end==(p + 1)) {
+            return RANGE_NONE;
+        }
+        if ((0==length) || (0==size)) {
+            return RANGE_BAD;
+        }
+        *first = (length < size) ? (size - length) : 0;
+        *last = size - 1;
+        return RANGE_OKAY;
+    }
+    if ((*p < '0') || (*p > '9')) {
+        return RANGE_NONE;
+    }
+    *first = strtoul(p, &end, 10);
+    if ('-' != *end) {
+        return RANGE_NONE;
+    }
+    p = end + 1;
+    if (0==size) {
+        return RANGE_BAD;   // nothing to start on
+    }
+    *last = size - 1;
+    if ((*p >= '0') && (*p <= '9')) {
+        size_t last_asked = strtoul(p, &end, 10);
+        if (last_asked < *first) {
+            return RANGE_NONE;
+        }
+        if (last_asked < *last) {
+            *last = last_asked;
+        }
+    }
+    return (*first < size) ? RANGE_OKAY : RANGE_BAD;
+}
+
+// 304, 416, 206 or 200 for a file of size bytes .. false if that was
+// all, otherwise send the count bytes from first
+static boolean send_start(ToolkitWiFi_Client *twfc, const http_request *r,
+    size_t size, const char *mime, const char *encoding, const char *etag,
+    size_t *first, size_t *count)
+{
+    if (etag_matches(r, etag)) {
+        http_send_304(twfc, mime, etag);
+        return false;
+    }
+    size_t last;
+    char range[48];
+    switch (parse_range(r, etag, size, first, &last)) {
+        case RANGE_OKAY :
+            *count = last - *first + 1;
+            snprintf(range, sizeof(range), "bytes %u-%u/%u",
+                *first, last, size);
+            http_send_header(twfc, *count, RESPONSE_PARTIAL, mime,
+                encoding, etag, range);
+            return true;
+        case RANGE_BAD :
+            http_send_416(twfc, size);
+            return false;
+    }
+    *first = 0;
+    *count = size;
+    http_send_header(twfc, size, RESPONSE_OKAY, mime, encoding, etag, NULL);
+    return true;
+}
+
+// the whole file in one go from the cache, or in chunks from the flash
+// .. or a 304 if the browser already has it. Recordings (audio) can
+// change under us (see uplink_spill.h), so they're never cached.
+static boolean send_file(ToolkitWiFi_Client *twfc, const http_request *r,
+    const char *path, const char *mime, const char *encoding,
+    char *buffer, size_t max_size)
+{
+    size_t size;
+    size_t first;
+    size_t count;
+    const char *etag = NULL;
+    File f;
+    boolean cacheable = (0 != strncmp("audio/", mime, 6));
+
+    // the browser has this upload already, nothing to open
+    char stored[ASSET_ETAG_SIZE];
+    const char *uploaded = read_etag(path, stored) ? stored : NULL;
+    if (etag_matches(r, uploaded)) {
+        http_send_304(twfc, mime, uploaded);
+        return true;
+    }
+
+    const uint8_t *cached = cacheable ?
+        asset_cache_fetch(path, &size, &etag, &f) : NULL;
+    if (cached) {
+        if (send_start(twfc, r, size, mime, encoding, etag, &first, &count)) {
+            http_send_data_chunk(twfc, (const char *) cached + first, count);
+        }
+        return true;
+    }
+    if (cacheable && asset_cache_isMissing(path)) {
+        return false;
+    }
+
+    etag = uploaded;
+    // too big for the cache, it's open already
+    if (!f) {
+        f = ToolkitFiles::fileOpen(path, FILE_READ);
+    }
+    if (!f) {
+        return false;
+    }
+    if (send_start(twfc, r, f.size(), mime, encoding, etag, &first, &count)) {
+        // a range starts with a seek, not reading up to it
+        if (first) {
+            f.seek(first);
+        }
+        // now read the file in chunks until it all sent
+        size_t actual;
+        while (count) {
+            actual = f.readBytes(buffer, (count < max_size) ? count : max_size);
+            if (0==actual) {
+                break;
+            }
+            http_send_data_chunk(twfc, buffer, actual);
+            count -= actual;
+        }
+    }
+    f.close();
+    return true;
+}
+
+// a page built into the sketch, from flash memory but not the file system
+static void send_default(ToolkitWiFi_Client *twfc, const http_request *r,
+    const default_asset *a, boolean gzip)
 {
-    if (ToolkitFiles::fileExists(path)) {
+    size_t first;
+    size_t count;
+    if (gzip) {
+        if (send_start(twfc, r, a->gz_length, a->mime, "gzip", a->gz_etag,
+                &first, &count)) {
+            http_send_data_chunk(twfc, (const char *) a->gz + first, count);
+        }
+    } else if (send_start(twfc, r, a->length, a->mime, NULL, a->etag,
+            &first, &count)) {
+        http_send_data_chunk(twfc, (const char *) a->data + first, count);
+    }
+}
+
+// Text goes gzipped to browsers that take it. The pages built into the
+// sketch go first, unless the flash has its own, then path.gz from the
+// flash, then path. false if there's no such file anywhere.
+static boolean send_asset(ToolkitWiFi_Client *twfc, const http_request *r,
+    const char *path, char *buffer, size_t max_size)
+{
+    const default_asset *a = default_files_lookup(path);
+    if (a && (NULL==a->data)) {
+        a = NULL;       // a route, not a page
+    }
+    const char *mime = a ? a->mime : mime_type(path);
+    boolean gzip = r->accepts_gzip && (0==strncmp("text/", mime, 5));
+    if (a && !default_files_onFlash(a)) {
+        send_default(twfc, r, a, gzip);
+        return true;
+    }
+
+    if (gzip && (strlen(path) <= MAX_FILENAME_LENGTH+1)) {
+        char gz_path[MAX_PATH_LENGTH];
+        snprintf(gz_path, sizeof(gz_path), "%s.gz", path);
+        if (send_file(twfc, r, gz_path, mime, "gzip", buffer, max_size)) {
+            return true;
+        }
+    }
+    if (send_file(twfc, r, path, mime, NULL, buffer, max_size)) {
         return true;
     }
-    return default_file_exists(path);
+
+    // gone from the flash since
+    if (a) {
+        send_default(twfc, r, a, gzip);
+        return true;
+    }
+    return false;
 }
 
-void http_handleGetRequest(ToolkitWiFi_Client *twfc, const char *path,
-    const char *default_index, size_t default_index_size,
+void http_handleGetRequest(ToolkitWiFi_Client *twfc, const http_request *r,
+    const char *path, const char *default_index, size_t default_index_size,
     char *buffer, size_t max_size)
 {
     // fetch the file from *path, set the mime-type and content headers
@@ -458,6 +834,15 @@ void http_handleGetRequest(ToolkitWiFi_Client *twfc, const char *path,
 //    char *data = NULL;
     uint32_t type = match_filename(path);
 
+    // the HLS playlist and segments come from PSRAM, not the flash
+    if (hls_isPath(path)) {
+        if (!hls_handleGetRequest(twfc, path, buffer, max_size)) {
+            http_send_404(twfc);
+        }
+        twfc->setClientTimedClose();
+        return;
+    }
+
     if (isKioskOn) {
         // over ride html files when we are in kiosk mode
         if (is_file_html(path)) {
@@ -476,13 +861,6 @@ void http_handleGetRequest(ToolkitWiFi_Client *twfc, const char *path,
         type = FILE_IS_INDEX;
     }
 
-    if (FILE_IS_ANY==type) {
-        if (!file_exists(path)) {
-            path = "/index.html";
-            type = FILE_IS_INDEX;
-        }
-    }
-
     // if (FILE_IS_INDEX==type) {
     //     if(!ToolkitFiles::fileExists(path)) {
     //         type = FILE_IS_UPLOAD;
@@ -490,7 +868,7 @@ void http_handleGetRequest(ToolkitWiFi_Client *twfc, const char *path,
     // }
 
     // I think at this point it is one of
-    //  FILE_IS_ANY .. exists on the flash drive
+    //  FILE_IS_ANY .. the index if it doesn't exist
     //  FILE_IS_INDEX .. exists on the flash drive
     //  FILE_IS_FAVICON .. may or may not exist on the flash drive
     //  FILE_IS_UPLOAD .. use the _default if it exists
@@ -498,30 +876,11 @@ void http_handleGetRequest(ToolkitWiFi_Client *twfc, const char *path,
         path = "/upload.html";
     }
 
-    File f = ToolkitFiles::fileOpen(path, FILE_READ);
-    if (f) {
-        uint32_t content_length = f.size();
-        const char *mime = mime_type(path);
-        http_send_header(twfc, content_length, RESPONSE_OKAY, mime);
-        // now read the file in chunks until it all sent
-        int avail;
-        size_t actual;
-        while ((avail=f.available()) > 0) {
-            if (avail > max_size) {
-                avail = max_size;
-            }
-            actual = f.readBytes(buffer, avail);
-            http_send_data_chunk(twfc, buffer, actual);
-        }
-        f.close();
-    } else {
-        size_t size;
-        const char *data = default_files_find(path, &size);
-        if (data) {
-            const char *mime = mime_type(path);
-            http_send_header(twfc, size, RESPONSE_OKAY, mime);
-            http_send_data_chunk(twfc, data, size);
-        } else {
+    // most of the time it's one of the pages built into the sketch
+    // (see default_files.h), or else in RAM (see asset_cache.h)
+    if (!send_asset(twfc, r, path, buffer, max_size)) {
+        if ((FILE_IS_ANY != type) ||
+                !send_asset(twfc, r, "/index.html", buffer, max_size)) {
             http_send_404(twfc);
         }
     }
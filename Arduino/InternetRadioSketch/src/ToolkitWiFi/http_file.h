@@ -6,11 +6,17 @@
 
 #include "ToolkitWiFi_Client.h"
 
-void http_handlePostRequest(ToolkitWiFi_Client *twfc,
-    char *buffer, size_t actual, size_t max_size);
+// the ETags of the uploaded files, from the flash into memory
+void http_file_begin();
 
-void http_handleGetRequest(ToolkitWiFi_Client *twfc, const char *path,
-    const char *default_index, size_t default_index_size,
+// body is what has arrived after the request header so far
+// buffer is scratch space for reading the rest of the upload
+void http_handlePostRequest(ToolkitWiFi_Client *twfc, const char *path,
+    const char *body, size_t body_length, char *buffer, size_t max_size);
+
+// path is r->path, or the page to send instead
+void http_handleGetRequest(ToolkitWiFi_Client *twfc, const http_request *r,
+    const char *path, const char *default_index, size_t default_index_size,
     char *buffer, size_t max_size);
 
 void http_turnOnKioskMode(int onNotOff);
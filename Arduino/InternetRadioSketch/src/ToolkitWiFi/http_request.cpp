@@ -0,0 +1,296 @@
+//
+// http_request.cpp
+
+#include "http_request.h"
+
+//
+// Counters .. how many requests and how many bytes we copy for them
+// (one copy out of the socket plus any pipelined bytes we move down)
+
+static uint32_t stats_requests = 0;
+static uint32_t stats_bytes_read = 0;
+static uint32_t stats_bytes_moved = 0;
+
+static void clear_fields(http_request *r)
+{
+    r->scanned = 0;
+    r->endlines = 0;
+    r->started = false;
+    r->state = HTTP_REQUEST_INCOMPLETE;
+    r->header_length = 0;
+    r->method = HTTP_METHOD_OTHER;
+    r->path = NULL;
+    r->ws_key = NULL;
+    r->ws_protocol = NULL;
+    r->keep_alive = false;
+    r->accepts_gzip = false;
+    r->if_none_match = NULL;
+    r->range = NULL;
+    r->if_range = NULL;
+    r->content_length = 0;
+    r->body = NULL;
+    r->body_length = 0;
+}
+
+void http_request_init(http_request *r, char *buffer, size_t size)
+{
+    r->buffer = buffer;
+    r->size = size;
+    http_request_reset(r);
+}
+
+void http_request_reset(http_request *r)
+{
+    r->used = 0;
+    if (r->buffer) {
+        r->buffer[0] = 0;
+    }
+    clear_fields(r);
+}
+
+size_t http_request_space(http_request *r, char **where)
+{
+    if (NULL==r->buffer) {
+        *where = NULL;
+        return 0;
+    }
+    *where = &r->buffer[r->used];
+    return r->size - 1 - r->used;   // keep room for the NULL
+}
+
+void http_request_add(http_request *r, size_t actual)
+{
+    r->used += actual;
+    r->buffer[r->used] = 0;
+    stats_bytes_read += actual;
+    if (HTTP_REQUEST_COMPLETE==r->state) {
+        r->body_length = r->used - r->header_length;
+    }
+}
+
+//
+// Parse the header in place
+
+static char *trim(char *s)
+{
+    while ((' '==*s) || ('\t'==*s)) { s++; }
+    char *end = s + strlen(s);
+    while ((end > s) && ((' '==end[-1]) || ('\t'==end[-1]))) {
+        end--;
+    }
+    *end = 0;
+    return s;
+}
+
+// cut the next line out of the header, returns NULL at the end
+static char *next_line(char **text, char *end)
+{
+    char *line = *text;
+    if (line >= end) {
+        return NULL;
+    }
+    char *eol = (char *) memchr(line, '\n', end - line);
+    if (NULL==eol) {
+        eol = end;
+    }
+    *eol = 0;
+    if ((eol > line) && ('\r'==eol[-1])) {
+        eol[-1] = 0;
+    }
+    *text = eol + 1;
+    return line;
+}
+
+static boolean parse_request_line(http_request *r, char *line)
+{
+    char *method = line;
+    char *path = strchr(method, ' ');
+    if (NULL==path) {
+        return false;
+    }
+    *path++ = 0;
+    while (' '==*path) { path++; }
+    char *version = strchr(path, ' ');
+    if (version) {
+        *version++ = 0;
+        version = trim(version);
+    } else {
+        version = (char *) "HTTP/1.0";
+    }
+    if (0==path[0]) {
+        return false;
+    }
+
+    if (0==strcmp("GET", method)) {
+        r->method = HTTP_METHOD_GET;
+    } else if (0==strcmp("POST", method)) {
+        r->method = HTTP_METHOD_POST;
+    } else {
+        r->method = HTTP_METHOD_OTHER;
+    }
+    r->path = path;
+    // HTTP/1.1 is persistent unless the client says otherwise
+    r->keep_alive = (0==strcmp("HTTP/1.1", version));
+    return true;
+}
+
+// "gzip, deflate, br" or "gzip;q=1.0, identity; q=0.5, *;q=0"
+// .. the coding by name, or failing that *, and not with q=0
+static boolean accepts_coding(const char *value, const char *coding)
+{
+    size_t coding_length = strlen(coding);
+    int named = -1;         // -1 not listed, else 0 or 1
+    int star = -1;
+    const char *at = value;
+    while (*at) {
+        while ((' '==*at) || (','==*at)) { at++; }
+        const char *name = at;
+        while (*at && (',' != *at) && (';' != *at) && (' ' != *at)) { at++; }
+        size_t name_length = at - name;
+
+        // the parameters, only q matters
+        double q = 1.0;
+        while (*at && (',' != *at)) {
+            if (';'==*at) {
+                at++;
+                while (' '==*at) { at++; }
+                if (0==strncasecmp("q=", at, 2)) {
+                    q = strtod(at + 2, NULL);
+                }
+            } else {
+                at++;
+            }
+        }
+
+        int ok = (q > 0.0) ? 1 : 0;
+        if ((name_length==coding_length) &&
+                (0==strncasecmp(name, coding, coding_length))) {
+            named = ok;
+        } else if ((1==name_length) && ('*'==name[0])) {
+            star = ok;
+        }
+    }
+    return (named >= 0) ? (1==named) : (1==star);
+}
+
+static void parse_header_line(http_request *r, char *line)
+{
+    char *colon = strchr(line, ':');
+    if (NULL==colon) {
+        return;
+    }
+    *colon = 0;
+    char *name = trim(line);
+    char *value = trim(colon+1);
+
+    if (0==strcasecmp("Connection", name)) {
+        // may be a list, i.e. "keep-alive, Upgrade"
+        if (strcasestr(value, "close")) {
+            r->keep_alive = false;
+        } else if (strcasestr(value, "keep-alive")) {
+            r->keep_alive = true;
+        }
+    } else if (0==strcasecmp("Content-Length", name)) {
+        r->content_length = strtoul(value, NULL, 10);
+    } else if (0==strcasecmp("Sec-WebSocket-Key", name)) {
+        r->ws_key = value;
+    } else if (0==strcasecmp("Sec-WebSocket-Protocol", name)) {
+        r->ws_protocol = value;
+    } else if (0==strcasecmp("Accept-Encoding", name)) {
+        r->accepts_gzip = accepts_coding(value, "gzip");
+    } else if (0==strcasecmp("If-None-Match", name)) {
+        r->if_none_match = value;
+    } else if (0==strcasecmp("Range", name)) {
+        r->range = value;
+    } else if (0==strcasecmp("If-Range", name)) {
+        r->if_range = value;
+    }
+}
+
+static uint32_t parse_header(http_request *r)
+{
+    char *text = r->buffer;
+    char *end = r->buffer + r->header_length;
+
+    // skip any stray newlines in front of the request line
+    char *line;
+    do {
+        line = next_line(&text, end);
+    } while (line && (0==line[0]));
+
+    if ((NULL==line) || !parse_request_line(r, line)) {
+        return HTTP_REQUEST_BAD;
+    }
+    while (NULL != (line = next_line(&text, end))) {
+        if (line[0]) {
+            parse_header_line(r, line);
+        }
+    }
+
+    r->body = end;
+    r->body_length = r->used - r->header_length;
+    stats_requests++;
+    return HTTP_REQUEST_COMPLETE;
+}
+
+uint32_t http_request_parse(http_request *r)
+{
+    if (HTTP_REQUEST_INCOMPLETE != r->state) {
+        return r->state;
+    }
+
+    // only look at the bytes we haven't seen yet, a line at a time
+    while (r->scanned < r->used) {
+        char *at = &r->buffer[r->scanned];
+        char *eol = (char *) memchr(at, '\n', r->used - r->scanned);
+        char *end = eol ? eol : &r->buffer[r->used];
+        // anything but '\r' before the '\n' and it wasn't a blank line
+        while ((at < end) && ('\r'==*at)) { at++; }
+        if (at < end) {
+            r->endlines = 0;
+            r->started = true;
+        }
+        if (NULL==eol) {
+            r->scanned = r->used;
+            break;
+        }
+        r->scanned = (eol - r->buffer) + 1;
+        // blank lines before the request line don't count
+        if ((2 == ++(r->endlines)) && r->started) {
+            r->header_length = r->scanned;
+            r->state = parse_header(r);
+            return r->state;
+        }
+    }
+
+    if (r->used >= (r->size-1)) {
+        r->state = HTTP_REQUEST_TOO_BIG;
+    }
+    return r->state;
+}
+
+void http_request_next(http_request *r, size_t body_used)
+{
+    size_t consumed = r->header_length + body_used;
+    if ((HTTP_REQUEST_COMPLETE != r->state) || (consumed >= r->used)) {
+        http_request_reset(r);
+        return;
+    }
+    size_t remaining = r->used - consumed;
+    memmove(r->buffer, &r->buffer[consumed], remaining);
+    stats_bytes_moved += remaining;
+    r->used = remaining;
+    r->buffer[r->used] = 0;
+    clear_fields(r);
+}
+
+void http_request_printStats()
+{
+    uint32_t copied = stats_bytes_read + stats_bytes_moved;
+    Serial.printf("HTTP requests %u, bytes copied %u (%u per request)\n",
+        stats_requests, copied,
+        stats_requests ? (copied / stats_requests) : 0);
+}
+
+//
+// END OF http_request.cpp
@@ -0,0 +1,86 @@
+//
+// http_request.h
+
+//
+// Incremental HTTP request parser.
+//
+// Each HTTP connection keeps one of these. Bytes are read from the
+// socket straight into the request buffer, and only the new bytes are
+// scanned for the blank line at the end of the header, so a request
+// can arrive split across any number of TCP segments. Once the header
+// is complete it is parsed in place (no copies). Anything after the
+// header stays in the buffer, so pipelined requests are handled one
+// after another on the same connection.
+//
+
+#ifndef _HTTP_REQUEST_H_
+#define _HTTP_REQUEST_H_
+
+#include <Arduino.h>
+
+enum {
+    HTTP_REQUEST_INCOMPLETE = 0,    // still waiting for the end of the header
+    HTTP_REQUEST_COMPLETE,          // header parsed, fields are valid
+    HTTP_REQUEST_TOO_BIG,           // the header doesn't fit in the buffer
+    HTTP_REQUEST_BAD                // can't make sense of the request line
+};
+
+enum {
+    HTTP_METHOD_OTHER = 0,
+    HTTP_METHOD_GET,
+    HTTP_METHOD_POST
+};
+
+typedef struct {
+    char *buffer;           // raw request bytes, always NULL terminated
+    size_t size;            // size of buffer
+    size_t used;            // bytes in the buffer
+    size_t scanned;         // bytes already checked for the end of header
+    uint32_t endlines;      // '\n' in a row (ignoring '\r') while scanning
+    boolean started;        // seen something other than a newline
+    uint32_t state;         // HTTP_REQUEST_xxx
+
+    // valid when state is HTTP_REQUEST_COMPLETE
+    // the strings all point into buffer
+    size_t header_length;   // including the blank line
+    uint32_t method;        // HTTP_METHOD_xxx
+    char *path;
+    const char *ws_key;     // Sec-WebSocket-Key or NULL
+    const char *ws_protocol;    // Sec-WebSocket-Protocol or NULL
+    boolean keep_alive;     // from the HTTP version and Connection:
+    boolean accepts_gzip;   // Accept-Encoding: gzip (and not q=0)
+    const char *if_none_match;  // the ETags the browser has, or NULL
+    const char *range;      // Range: bytes=.. or NULL
+    const char *if_range;   // the ETag the range is from, or NULL
+    size_t content_length;
+    char *body;             // bytes after the header
+    size_t body_length;     //  .. that are already in the buffer
+} http_request;
+
+void http_request_init(http_request *r, char *buffer, size_t size);
+
+// discard everything, including pipelined bytes
+void http_request_reset(http_request *r);
+
+// where to read new bytes into, returns the space available
+size_t http_request_space(http_request *r, char **where);
+
+// tell the parser that bytes were read into the space
+void http_request_add(http_request *r, size_t actual);
+
+// scan the new bytes, parse the header once it is complete
+// returns the HTTP_REQUEST_xxx state
+uint32_t http_request_parse(http_request *r);
+
+// finished with the current request .. drop its header and
+// body_used bytes of its body, and move any pipelined bytes
+// to the front of the buffer
+void http_request_next(http_request *r, size_t body_used);
+
+// parser counters
+void http_request_printStats();
+
+#endif
+
+//
+// END OF http_request.h
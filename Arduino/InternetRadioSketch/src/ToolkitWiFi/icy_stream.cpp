@@ -4,6 +4,9 @@
 //
 
 #include <WiFi.h>
+#include "icy_stream.h"
+#include "mp3_chunk.h"
+#include "ogg_opus.h"
 #include "../ToolkitFiles/ToolkitFiles.h"
 
 //----------------------------------------------------------------------------------------------
@@ -79,82 +82,106 @@ static void encodeAsBase64(char *b64, const char *text)
 //     > Ice-Genre: Rock
 //     > Expect: 100-continue
 //     >
+//
+// The plain PUT leaves out Transfer-Encoding, SOURCE (for servers
+// from before icecast 2.4) also leaves out the Expect and is HTTP/1.0
 
 // should typically fit in a 512 byte buffer
 
-static void icy_make_request(char *buffer, const char *ip, uint32_t port,
-	char *username, char *password, char *mountpoint)
+size_t icy_make_request(char *buffer, uint32_t method,
+    const char *ip, uint32_t port,
+	const char *username, const char *password, const char *mountpoint)
 {
-	const char *requestA = "PUT /";
-	const char *requestB = " HTTP/1.1";
+	const char *requestA = (ICY_METHOD_SOURCE==method) ? "SOURCE /" : "PUT /";
+	const char *requestB = (ICY_METHOD_SOURCE==method) ? " HTTP/1.0" : " HTTP/1.1";
     const char *host = "HOST: ";	// ip:port
     const char *auth = "Authorization: Basic "; // base64 of username:password
     const char *accept = "Accept: */*";
-    const char *trans = "Transfer-Encoding: chunked";
-    const char *type = "Content-Type: audio/mpeg";
+    const char *trans = (ICY_METHOD_PUT_CHUNKED==method) ?
+        "Transfer-Encoding: chunked\n" : "";
+    const char *type = "Content-Type: ";    // audio/mpeg or audio/ogg
     const char *icy_public = "Ice-Public: 1";
     const char *icy_name = "Ice-Name: Toolkit Stream";
     const char *icy_descr = "Ice-Description: Toolkit stream description.";
     const char *icy_url = "Ice-URL: http://wavefarm.org";
     const char *icy_genre = "Ice-Genre: Toolkit Art";
-    const char *expect = "Expect: 100-continue";
+    const char *expect = (ICY_METHOD_SOURCE==method) ?
+        "" : "Expect: 100-continue\n";
 
-    char authbuffer[64];
-    strcpy(authbuffer, username);
-    strcat(authbuffer, ":");
-    strcat(authbuffer, password);
-    char b64[64];
+    char authbuffer[80];    // settings are up to 32 characters
+    snprintf(authbuffer, sizeof(authbuffer), "%s:%s", username, password);
+    char b64[112];
     encodeAsBase64(b64, authbuffer);
 
-	sprintf(buffer, "%s%s%s\n%s%s:%u\n%s%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n\n",
+	return sprintf(buffer, "%s%s%s\n%s%s:%u\n%s%s\n%s\n%s%s%s\n%s\n%s\n%s\n%s\n%s\n%s\n",
      	requestA, mountpoint, requestB,
         host, ip, port,
         auth, b64,
-        accept, trans, type,
+        accept, trans, type, ogg_opus_contentType(),
         icy_public, icy_name, icy_descr, icy_url, icy_genre,
         expect);
 }
 
 //----------------------------------------------------------------------------------------------
 //
-// icy_start_stream
+// Replies and methods
 //
 
-boolean icy_start_stream(WiFiClient *client)
+static const char *icy_method_names[ICY_METHODS] = {
+    "chunked PUT", "PUT", "SOURCE"
+};
+
+const char *icy_method_name(uint32_t method)
 {
-	static char request[512];  // reusable preallocated buffer
-    icy_make_request(request,
-        SettingItem::findString("remote_icecast_url"),        //prefs_getIcyURL(),
-        SettingItem::findUInt("remote_icecast_port",8000),    // prefs_getIcyPort(),
-        SettingItem::findString("remote_icecast_user"),       //prefs_getIcyUser(),
-        SettingItem::findString("remote_icecast_password"),   //prefs_getIcyPass(),
-        SettingItem::findString("remote_icecast_mountpoint")); //prefs_getIcyMount());
-    Serial.println(request);
-
-    int32_t request_length = strlen(request);
-    client->write(request, request_length);
-
-    // wait for icy reply
-    uint16_t timeout = 20;
-    size_t avail = 0;
-    while (timeout && (0==(avail=client->available()))) {
-        delay(100);
-        Serial.print("~");
-        timeout--;
+    return (method < ICY_METHODS) ? icy_method_names[method] : "?";
+}
+
+// "HTTP/1.1 100 Continue" is all we get from a PUT until we stop.
+// HTTP/1.x 200 OK .. or ICY 200 OK from old servers
+uint32_t icy_parse_status(const char *reply)
+{
+    const char *code = strchr(reply, ' ');
+    if (NULL==code) {
+        return 0;
     }
+    return strtoul(code, NULL, 10);
+}
 
-    if (avail) {
-        char reply[1024];
-        if (avail > 1023) { avail=1023; }
-        client->readBytes(reply,avail);
-        reply[avail] = 0;
-        Serial.printf("\nREPLY\n%s\n", reply);
-    } else {
-        Serial.println("Error reading reply from ICY server!");
-        return false;
+boolean icy_accepted(uint32_t status)
+{
+    return ((100==status) || (200==status));
+}
+
+// Did the server turn down the way we are sending, rather than us?
+boolean icy_try_another_method(uint32_t status)
+{
+    switch (status) {
+        case 400 :  // bad request
+        case 405 :  // method not allowed
+        case 411 :  // length required
+        case 417 :  // expectation failed
+        case 501 :  // not implemented
+        case 505 :  // HTTP version not supported
+            return true;
     }
+    // 401/403 bad password or mountpoint in use, 0 no reply, etc.
+    return false;
+}
 
-    return true;
+uint8_t *icy_frame_chunk(uint8_t *data, size_t *length)
+{
+    char head[MP3_CHUNK_HEADROOM + 1];
+    int head_length = snprintf(head, sizeof(head), "%X\r\n", *length);
+    if ((head_length <= 0) ||
+        (head_length > MP3_CHUNK_HEADROOM)) {
+        return NULL;
+    }
+    uint8_t *chunk = data - head_length;
+    memcpy(chunk, head, head_length);
+    data[*length] = '\r';
+    data[*length + 1] = '\n';
+    *length += head_length + 2;
+    return chunk;
 }
 
 //
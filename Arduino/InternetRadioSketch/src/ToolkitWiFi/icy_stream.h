@@ -9,8 +9,40 @@
 #ifndef _ICY_H_
 #define _ICY_H_
 
-// Create a request header from setting, open connection, etc.
-boolean icy_start_stream(WiFiClient *client);
+// How the mp3 data is sent up to the server
+enum {
+    ICY_METHOD_PUT_CHUNKED = 0,     // PUT, Transfer-Encoding: chunked
+    ICY_METHOD_PUT,                 // PUT, raw bytes until we close
+    ICY_METHOD_SOURCE,              // legacy SOURCE, raw bytes
+    ICY_METHODS
+};
+
+// The connection itself is driven by ToolkitWiFi_Uplink, these are
+// the icecast specific parts.
+
+// Build the request header, returns its length
+// (should typically fit in a 512 byte buffer)
+size_t icy_make_request(char *buffer, uint32_t method,
+    const char *ip, uint32_t port,
+    const char *username, const char *password, const char *mountpoint);
+
+const char *icy_method_name(uint32_t method);
+
+// status code from the reply's status line, 0 if there isn't one
+uint32_t icy_parse_status(const char *reply);
+
+// 100 Continue or 200 OK
+boolean icy_accepted(uint32_t status);
+
+// true if the server turned down the method, rather than us,
+// so falling back to the next method might work
+boolean icy_try_another_method(uint32_t status);
+
+// Frame length bytes of mp3 data as one HTTP chunk, in place.
+// Needs MP3_CHUNK_HEADROOM bytes (mp3_chunk.h) free in front of
+// data and MP3_CHUNK_TAILROOM after. Returns the start of the chunk
+// and sets length to the whole chunk, so it goes out in one write.
+uint8_t *icy_frame_chunk(uint8_t *data, size_t *length);
 
 #endif
 
@@ -0,0 +1,294 @@
+//
+// local_icecast.cpp
+
+#include "local_icecast.h"
+#include "ogg_opus.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+
+#define SERVER_ID "Icecast 2.4.0 compatible (Wave Farm Toolkit)"
+
+static const char *default_mount = "/stream.mp3";
+static const char *default_name = "Wave Farm Toolkit";
+static const char *mount_keys[LOCAL_MOUNTS] = {
+    "local_icecast_mount", "local_icecast_mount_2", "local_icecast_mount_3"
+};
+static const char *name_keys[LOCAL_MOUNTS] = {
+    "local_icecast_name", "local_icecast_name_2", "local_icecast_name_3"
+};
+
+typedef struct {
+    char path[LOCAL_MOUNT_PATH_SIZE];   // empty if not in use
+    uint32_t listeners;
+    uint32_t peak;
+    uint32_t connections;
+    uint32_t started;                   // millis() of the first listener
+} local_mount;
+
+static local_mount mounts[LOCAL_MOUNTS];
+
+// listeners start in the server task and finish in the stream task
+static portMUX_TYPE mount_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void local_icecast_begin()
+{
+    for (uint32_t i = 0; i < LOCAL_MOUNTS; i++) {
+        const char *path = SettingItem::findString(mount_keys[i]);
+        if ((0==i) && ((NULL==path) || (0==path[0]))) {
+            path = default_mount;
+        }
+        mounts[i].path[0] = 0;
+        if (path && path[0]) {
+            // always with the leading slash, that's how requests arrive
+            snprintf(mounts[i].path, LOCAL_MOUNT_PATH_SIZE, "%s%s",
+                ('/'==path[0]) ? "" : "/", path);
+        }
+    }
+}
+
+static const char *mount_name(uint32_t mount)
+{
+    const char *name = SettingItem::findString(name_keys[mount]);
+    if ((NULL==name) || (0==name[0])) {
+        name = SettingItem::findString(name_keys[0]);
+    }
+    return (name && name[0]) ? name : default_name;
+}
+
+static const char *mount_description()
+{
+    const char *description = SettingItem::findString("local_icecast_description");
+    return description ? description : "";
+}
+
+int32_t local_icecast_findMount(const char *path)
+{
+    for (uint32_t i = 0; i < LOCAL_MOUNTS; i++) {
+        if (mounts[i].path[0] && (0==strcmp(mounts[i].path, path))) {
+            return i;
+        }
+    }
+    const char *dot = strrchr(path, '.');
+    if (dot && (0==strcmp(".mp3", dot))) {
+        return 0;
+    }
+    return -1;
+}
+
+boolean local_icecast_isMount(const char *path)
+{
+    for (uint32_t i = 0; i < LOCAL_MOUNTS; i++) {
+        if (mounts[i].path[0] && (0==strcmp(mounts[i].path, path))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+boolean local_icecast_isStatus(const char *path)
+{
+    return (0==strcmp("/status-json.xsl", path));
+}
+
+//------------------------------------------------------------------
+//
+// Listeners
+//
+
+void local_icecast_startListener(ToolkitWiFi_Client *twfc, uint32_t mount)
+{
+    twfc->client->printf(
+        "HTTP/1.0 200 OK\r\n"
+        "Server: " SERVER_ID "\r\n"
+        "Content-Type: %s\r\n"
+        "icy-br: %u\r\n"
+        "icy-name: %s\r\n"
+        "icy-description: %s\r\n"
+        "icy-pub: 0\r\n"
+        "Cache-Control: no-cache, no-store\r\n"
+        "Pragma: no-cache\r\n"
+        "Expires: 0\r\n\r\n",
+        ogg_opus_contentType(), ogg_opus_bitrate(),
+        mount_name(mount), mount_description());
+
+    // an Ogg stream can't be played without its header pages
+    uint8_t headers[OGG_OPUS_HEADERS_SIZE];
+    size_t length = ogg_opus_headers(headers, sizeof(headers));
+    if (length) {
+        twfc->client->write(headers, length);
+    }
+
+    twfc->mount = mount;
+    twfc->remote_ip = twfc->client->remoteIP();
+    twfc->connected_at = millis();
+    twfc->bytes_sent = 0;
+    twfc->lag_ms = 0;
+
+    portENTER_CRITICAL(&mount_lock);
+    local_mount *m = &mounts[mount];
+    if (0==m->listeners) {
+        m->started = twfc->connected_at;
+    }
+    m->listeners++;
+    m->connections++;
+    if (m->listeners > m->peak) {
+        m->peak = m->listeners;
+    }
+    portEXIT_CRITICAL(&mount_lock);
+}
+
+void local_icecast_closeListener(ToolkitWiFi_Client *twfc)
+{
+    portENTER_CRITICAL(&mount_lock);
+    if (mounts[twfc->mount].listeners > 0) {
+        mounts[twfc->mount].listeners--;
+    }
+    portEXIT_CRITICAL(&mount_lock);
+}
+
+//------------------------------------------------------------------
+//
+// /status-json.xsl
+//
+
+// the reply goes out through the connection's buffer, a piece at a
+// time, so any number of listeners fit
+typedef struct {
+    ToolkitWiFi_Client *twfc;
+    char *buffer;
+    size_t size;
+    size_t used;
+} json_out;
+
+static void json_flush(json_out *j)
+{
+    if (j->used) {
+        j->twfc->client->write(j->buffer, j->used);
+        j->used = 0;
+    }
+}
+
+static void json_printf(json_out *j, const char *format, ...)
+{
+    for (uint32_t tries = 0; tries < 2; tries++) {
+        va_list args;
+        va_start(args, format);
+        size_t room = j->size - j->used;
+        int length = vsnprintf(&j->buffer[j->used], room, format, args);
+        va_end(args);
+        if ((length >= 0) && ((size_t) length < room)) {
+            j->used += length;
+            return;
+        }
+        json_flush(j);  // no room, send what we have and try again
+    }
+}
+
+// settings can hold anything, keep them from breaking the JSON
+static void json_string(json_out *j, const char *s)
+{
+    json_printf(j, "\"");
+    while (*s) {
+        char c = *s++;
+        if (('"'==c) || ('\\'==c)) {
+            json_printf(j, "\\%c", c);
+        } else if ((uint8_t) c < ' ') {
+            json_printf(j, "\\u%04x", c);
+        } else {
+            json_printf(j, "%c", c);
+        }
+    }
+    json_printf(j, "\"");
+}
+
+static void json_listeners(json_out *j, uint32_t mount)
+{
+    uint32_t now = millis();
+    boolean first = true;
+    json_printf(j, "\"listener\":[");
+    for (uint32_t i = 0; i < ToolkitWiFi_Client::MAX_CLIENTS; i++) {
+        // only plain fields, the stream task owns the sockets
+        ToolkitWiFi_Client *c = &ToolkitWiFi_Client::_client_list[i];
+        if ((ToolkitWiFi_Client::TYPE_MP3STREAM != c->type) ||
+            !c->streaming || (mount != c->mount)) {
+            continue;
+        }
+        uint32_t ip = c->remote_ip;
+        json_printf(j, "%s{\"id\":%u,\"ip\":\"%u.%u.%u.%u\","
+            "\"connected\":%u,\"bytes_sent\":%u,\"lag_ms\":%u}",
+            first ? "" : ",", i,
+            ip & 0xff, (ip >> 8) & 0xff, (ip >> 16) & 0xff, ip >> 24,
+            (now - c->connected_at) / 1000, c->bytes_sent, c->lag_ms);
+        first = false;
+    }
+    json_printf(j, "]");
+}
+
+void local_icecast_sendStatus(ToolkitWiFi_Client *twfc,
+    char *buffer, size_t size)
+{
+    String host = twfc->client->localIP().toString();
+    uint32_t bitrate = ogg_opus_bitrate();
+
+    twfc->client->print(
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: application/json; charset=utf-8\r\n"
+        "Access-Control-Allow-Origin: *\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Connection: close\r\n\r\n");
+
+    json_out j = { twfc, buffer, size, 0 };
+    json_printf(&j, "{\"icestats\":{\"admin\":\"\",\"host\":\"%s\","
+        "\"location\":\"\",\"server_id\":\"" SERVER_ID "\","
+        "\"server_start_uptime\":%u,\"source\":",
+        host.c_str(), millis() / 1000);
+
+    // like icecast, one source is an object and more are a list
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < LOCAL_MOUNTS; i++) {
+        if (mounts[i].path[0]) {
+            count++;
+        }
+    }
+    if (count > 1) {
+        json_printf(&j, "[");
+    }
+    boolean first = true;
+    for (uint32_t i = 0; i < LOCAL_MOUNTS; i++) {
+        local_mount *m = &mounts[i];
+        if (0==m->path[0]) {
+            continue;
+        }
+        json_printf(&j, "%s{\"listenurl\":\"http://%s%s\",\"server_name\":",
+            first ? "" : ",", host.c_str(), m->path);
+        json_string(&j, mount_name(i));
+        json_printf(&j, ",\"server_description\":");
+        json_string(&j, mount_description());
+        json_printf(&j, ",\"server_type\":\"%s\",\"bitrate\":%u,"
+            "\"audio_bitrate\":%u,\"listeners\":%u,\"listener_peak\":%u,"
+            "\"connections\":%u,\"stream_uptime\":%u,",
+            ogg_opus_contentType(), bitrate, bitrate * 1000, m->listeners, m->peak, m->connections,
+            m->listeners ? ((millis() - m->started) / 1000) : 0);
+        json_listeners(&j, i);
+        json_printf(&j, "}");
+        first = false;
+    }
+    if (count > 1) {
+        json_printf(&j, "]");
+    }
+    json_printf(&j, "}}\n");
+    json_flush(&j);
+}
+
+void local_icecast_printStats()
+{
+    for (uint32_t i = 0; i < LOCAL_MOUNTS; i++) {
+        local_mount *m = &mounts[i];
+        if (m->path[0]) {
+            Serial.printf("Mount %s listeners %u, peak %u, connections %u\n",
+                m->path, m->listeners, m->peak, m->connections);
+        }
+    }
+}
+
+//
+// END OF local_icecast.cpp
@@ -0,0 +1,57 @@
+//
+// local_icecast.h
+
+//
+// The local mp3 listeners, made to look like a small icecast server.
+//
+// Listeners get the icecast style reply (icy-br, icy-name ..) so
+// players show the station, and /status-json.xsl answers in the same
+// shape as icecast's, so dashboards that watch an icecast server can
+// watch the toolkit too. Each source also lists its listeners, with
+// how long they've been connected, bytes sent and their lag.
+//
+// Mountpoints come from the settings:
+//  local_icecast_mount     = /stream.mp3   (local_icecast_name ..)
+//  local_icecast_mount_2   = /backup.mp3   (local_icecast_name_2 ..)
+// They all carry the same encoder stream, each is counted on its own.
+// Any other *.mp3 is the first mount, so old links keep working.
+//
+
+#ifndef _LOCAL_ICECAST_H_
+#define _LOCAL_ICECAST_H_
+
+#include <Arduino.h>
+#include "ToolkitWiFi_Client.h"
+
+enum {
+    LOCAL_MOUNTS            = 3,
+    LOCAL_MOUNT_PATH_SIZE   = 32
+};
+
+// read the mountpoints from the settings
+void local_icecast_begin();
+
+// the mount for a request path, -1 if it isn't a stream
+int32_t local_icecast_findMount(const char *path);
+
+// true for the mountpoints in the settings only, not any other *.mp3
+boolean local_icecast_isMount(const char *path);
+
+boolean local_icecast_isStatus(const char *path);
+
+// reply to a new listener and start counting it
+void local_icecast_startListener(ToolkitWiFi_Client *twfc, uint32_t mount);
+
+// from the stream task, before the client is closed
+void local_icecast_closeListener(ToolkitWiFi_Client *twfc);
+
+// the /status-json.xsl reply, written through buffer
+void local_icecast_sendStatus(ToolkitWiFi_Client *twfc,
+    char *buffer, size_t size);
+
+void local_icecast_printStats();
+
+#endif
+
+//
+// END OF local_icecast.h
@@ -0,0 +1,23 @@
+//
+// mp3_chunk.h
+
+//
+// The room the mp3 ring leaves around each buffer, so the icecast
+// uplink can frame it as an HTTP chunk ("%X\r\n" in front, "\r\n"
+// after) and send it in one write (see icy_frame_chunk()). The ring in
+// Streamer and the uplink both need these, without the rest of the
+// server.
+//
+
+#ifndef _MP3_CHUNK_H_
+#define _MP3_CHUNK_H_
+
+enum {
+    MP3_CHUNK_HEADROOM  = 8,
+    MP3_CHUNK_TAILROOM  = 8     // only 2 are used, 8 keeps alignment
+};
+
+#endif
+
+//
+// END OF mp3_chunk.h
@@ -0,0 +1,80 @@
+//
+// mp3_frame.cpp
+
+#include "mp3_frame.h"
+
+// kbps by [lsf][layer-1][index], lsf is MPEG 2 and 2.5
+static const uint16_t bitrates[2][3][15] = {
+    {   // MPEG 1
+        { 0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448 },
+        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384 },
+        { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320 }
+    },
+    {   // MPEG 2 and 2.5
+        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256 },
+        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 },
+        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160 }
+    }
+};
+
+// by the version bits, 1 is reserved
+static const uint32_t sample_rates[4][3] = {
+    { 11025, 12000, 8000 },     // MPEG 2.5
+    { 0, 0, 0 },
+    { 22050, 24000, 16000 },    // MPEG 2
+    { 44100, 48000, 32000 }     // MPEG 1
+};
+
+boolean mp3_frame_parse(const uint8_t *header, mp3_frame_info *info)
+{
+    // 11 bits of sync
+    if ((0xff != header[0]) || (0xe0 != (header[1] & 0xe0))) {
+        return false;
+    }
+    uint32_t version = (header[1] >> 3) & 0x03;
+    uint32_t layer_bits = (header[1] >> 1) & 0x03;
+    uint32_t bitrate_index = (header[2] >> 4) & 0x0f;
+    uint32_t rate_index = (header[2] >> 2) & 0x03;
+    uint32_t padding = (header[2] >> 1) & 0x01;
+    if ((1==version) || (0==layer_bits) ||
+        (0==bitrate_index) || (15==bitrate_index) || (3==rate_index)) {
+        return false;
+    }
+
+    uint32_t layer = 4 - layer_bits;
+    uint32_t lsf = (3==version) ? 0 : 1;
+    info->layer = layer;
+    info->bitrate = bitrates[lsf][layer-1][bitrate_index];
+    info->sample_rate = sample_rates[version][rate_index];
+    info->channels = (3 == (header[3] >> 6)) ? 1 : 2;
+
+    if (1==layer) {
+        info->samples = 384;
+        info->length = ((12000 * info->bitrate / info->sample_rate) + padding) * 4;
+    } else {
+        info->samples = ((3==layer) && lsf) ? 576 : 1152;
+        info->length = ((info->samples / 8) * 1000 * info->bitrate /
+            info->sample_rate) + padding;
+    }
+    return (info->length > MP3_HEADER_SIZE);
+}
+
+size_t mp3_frame_find(const uint8_t *data, size_t length)
+{
+    mp3_frame_info info;
+    size_t i = 0;
+    while ((i + MP3_HEADER_SIZE) <= length) {
+        if ((0xff==data[i]) && mp3_frame_parse(&data[i], &info)) {
+            return i;
+        }
+        i++;
+    }
+    // keep a possible sync at the very end
+    while ((i < length) && (0xff != data[i])) {
+        i++;
+    }
+    return i;
+}
+
+//
+// END OF mp3_frame.cpp
@@ -0,0 +1,42 @@
+//
+// mp3_frame.h
+
+//
+// MPEG audio frame headers (MPEG 1, 2 and 2.5, layers I, II and III).
+//
+// The encoder ring is a plain byte stream, the frames run across the
+// ring buffers. Anything that needs whole frames (the HLS segments,
+// RTP packets) walks the headers with this to find where they are.
+//
+
+#ifndef _MP3_FRAME_H_
+#define _MP3_FRAME_H_
+
+#include <Arduino.h>
+
+enum {
+    MP3_HEADER_SIZE     = 4,
+    MP3_MAX_FRAME_SIZE  = 2881      // layer II/III at 160kbps, 8kHz, padded
+};
+
+typedef struct {
+    uint32_t length;        // bytes, including the header
+    uint32_t samples;       // per channel
+    uint32_t sample_rate;
+    uint32_t bitrate;       // kbps
+    uint32_t layer;         // 1, 2 or 3
+    uint32_t channels;
+} mp3_frame_info;
+
+// fills in info if header points at a valid frame header
+// (needs MP3_HEADER_SIZE bytes, free format frames aren't valid)
+boolean mp3_frame_parse(const uint8_t *header, mp3_frame_info *info);
+
+// the offset of the next frame sync in data, or length if there isn't
+// one (a sync that is cut off at the end is left for next time)
+size_t mp3_frame_find(const uint8_t *data, size_t length);
+
+#endif
+
+//
+// END OF mp3_frame.h
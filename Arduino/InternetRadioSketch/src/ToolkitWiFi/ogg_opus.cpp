@@ -0,0 +1,211 @@
+//
+// ogg_opus.cpp
+
+#include "ogg_opus.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+
+static boolean on = false;
+static uint32_t serial = 0;
+static uint32_t page_sequence = 0;
+static uint64_t granule = 0;        // 48kHz samples, from the start
+
+static uint32_t crc_table[256];
+
+static uint8_t headers[OGG_OPUS_HEADERS_SIZE];
+static size_t headers_length = 0;
+
+// the page being filled
+static uint8_t page[OGG_PAGE_HEADER_SIZE + OGG_MAX_SEGMENTS + OGG_OPUS_PAGE_SIZE];
+static uint8_t segments[OGG_MAX_SEGMENTS];
+static uint32_t segment_count = 0;
+static uint8_t data[OGG_OPUS_PAGE_SIZE];
+static size_t data_length = 0;
+static uint32_t page_packets = 0;
+
+// stats
+static uint32_t stats_packets = 0;
+static uint32_t stats_pages = 0;
+static uint32_t stats_bytes = 0;
+static uint32_t stats_too_big = 0;
+
+//------------------------------------------------------------------
+//
+// Pages
+//
+
+// the Ogg CRC .. polynomial 0x04c11db7, not reflected, starting at 0
+static void make_crc_table()
+{
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t r = i << 24;
+        for (uint32_t b = 0; b < 8; b++) {
+            r = (r & 0x80000000) ? ((r << 1) ^ 0x04c11db7) : (r << 1);
+        }
+        crc_table[i] = r;
+    }
+}
+
+static void put32(uint8_t *p, uint32_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+}
+
+// writes a whole page to where, returns its length
+static size_t make_page(uint8_t *where, uint8_t type, uint64_t position,
+    const uint8_t *lacing, uint32_t lacing_count,
+    const uint8_t *body, size_t body_length)
+{
+    uint8_t *p = where;
+    memcpy(p, "OggS", 4);
+    p[4] = 0;                           // version
+    p[5] = type;                        // 1 continued, 2 first, 4 last
+    put32(&p[6], (uint32_t) position);
+    put32(&p[10], (uint32_t) (position >> 32));
+    put32(&p[14], serial);
+    put32(&p[18], page_sequence++);
+    put32(&p[22], 0);                   // the CRC goes here
+    p[26] = lacing_count;
+    memcpy(&p[OGG_PAGE_HEADER_SIZE], lacing, lacing_count);
+    memcpy(&p[OGG_PAGE_HEADER_SIZE + lacing_count], body, body_length);
+    size_t length = OGG_PAGE_HEADER_SIZE + lacing_count + body_length;
+
+    uint32_t crc = 0;
+    for (size_t i = 0; i < length; i++) {
+        crc = (crc << 8) ^ crc_table[(crc >> 24) ^ p[i]];
+    }
+    put32(&p[22], crc);
+    return length;
+}
+
+// a header packet on a page of its own
+static size_t make_header_page(uint8_t *where, uint8_t type,
+    const uint8_t *packet, size_t length)
+{
+    uint8_t lacing[1] = { (uint8_t) length };   // always < 255 here
+    return make_page(where, type, 0, lacing, 1, packet, length);
+}
+
+boolean ogg_opus_begin(uint32_t channels, uint32_t pre_skip)
+{
+    if ((channels < 1) || (channels > 2)) {
+        return false;
+    }
+    make_crc_table();
+    serial = esp_random();
+    page_sequence = 0;
+    granule = 0;
+    segment_count = 0;
+    data_length = 0;
+    page_packets = 0;
+
+    // RFC 7845 5.1, mapping family 0 (mono or stereo)
+    uint8_t head[19];
+    memcpy(head, "OpusHead", 8);
+    head[8] = 1;                        // version
+    head[9] = channels;
+    head[10] = pre_skip;
+    head[11] = pre_skip >> 8;
+    put32(&head[12], 48000);            // what we encoded from
+    head[16] = 0;                       // output gain
+    head[17] = 0;
+    head[18] = 0;                       // mapping family
+    headers_length = make_header_page(headers, 0x02, head, sizeof(head));
+
+    // RFC 7845 5.2, a vendor string and no comments
+    const char vendor[] = "Wave Farm Toolkit";
+    uint8_t tags[8 + 4 + sizeof(vendor) - 1 + 4];
+    memcpy(tags, "OpusTags", 8);
+    put32(&tags[8], sizeof(vendor) - 1);
+    memcpy(&tags[12], vendor, sizeof(vendor) - 1);
+    put32(&tags[12 + sizeof(vendor) - 1], 0);
+    headers_length += make_header_page(&headers[headers_length], 0,
+        tags, sizeof(tags));
+    on = true;
+    return true;
+}
+
+boolean ogg_opus_isOn()
+{
+    return on;
+}
+
+const char *ogg_opus_contentType()
+{
+    return on ? "audio/ogg" : "audio/mpeg";
+}
+
+uint32_t ogg_opus_bitrate()
+{
+    return on ? SettingItem::findUInt("opus_bitrate", 64) :
+        SettingItem::findUInt("bitrate", 128);
+}
+
+size_t ogg_opus_headers(uint8_t *where, size_t size)
+{
+    if (!on || (headers_length > size)) {
+        return 0;
+    }
+    memcpy(where, headers, headers_length);
+    return headers_length;
+}
+
+static void flush_page(void (*write)(const uint8_t*, size_t))
+{
+    if (0==page_packets) {
+        return;
+    }
+    size_t length = make_page(page, 0, granule,
+        segments, segment_count, data, data_length);
+    write(page, length);
+    stats_pages++;
+    stats_bytes += length;
+    segment_count = 0;
+    data_length = 0;
+    page_packets = 0;
+}
+
+void ogg_opus_addPacket(const uint8_t *packet, size_t length,
+    uint32_t samples, void (*write)(const uint8_t*, size_t))
+{
+    if (!on) {
+        return;
+    }
+    // a packet ends with a lacing value under 255 (0 if it has to)
+    uint32_t lacing = (length / 255) + 1;
+    if ((lacing > OGG_MAX_SEGMENTS) || (length > OGG_OPUS_PAGE_SIZE)) {
+        stats_too_big++;    // Opus packets are 1275 bytes at most
+        return;
+    }
+    if (((segment_count + lacing) > OGG_MAX_SEGMENTS) ||
+            ((data_length + length) > OGG_OPUS_PAGE_SIZE)) {
+        flush_page(write);
+    }
+    for (uint32_t i = 1; i < lacing; i++) {
+        segments[segment_count++] = 255;
+    }
+    segments[segment_count++] = length % 255;
+    memcpy(&data[data_length], packet, length);
+    data_length += length;
+    granule += samples;
+    page_packets++;
+    stats_packets++;
+    if (page_packets >= OGG_OPUS_PAGE_PACKETS) {
+        flush_page(write);
+    }
+}
+
+void ogg_opus_printStats()
+{
+    if (!on) {
+        return;
+    }
+    Serial.printf("Ogg %u packets in %u pages, %u bytes, %u too big, "
+        "granule %llu\n", stats_packets, stats_pages, stats_bytes,
+        stats_too_big, granule);
+}
+
+//
+// END OF ogg_opus.cpp
@@ -0,0 +1,58 @@
+//
+// ogg_opus.h
+
+//
+// Opus packets in Ogg pages (RFC 7845), for the icecast PUT.
+//
+// Opus packets don't say how long they are, something around them has
+// to. Icecast takes Opus in Ogg as audio/ogg, so that's what goes in
+// the stream ring when codec = opus (see opus_stream.h).
+//
+// The stream starts with two header pages, OpusHead and OpusTags. The
+// icecast server and every local listener need those before anything
+// else, so they're kept here for whoever connects later. After that
+// each page carries OGG_OPUS_PAGE_PACKETS packets (100ms of audio) and
+// its granule position is the 48kHz sample count at the end of the
+// last one. A reader that joins part way through a page skips to the
+// next "OggS", as Ogg readers do.
+//
+
+#ifndef _OGG_OPUS_H_
+#define _OGG_OPUS_H_
+
+#include <Arduino.h>
+
+enum {
+    OGG_PAGE_HEADER_SIZE    = 27,       // before the segment table
+    OGG_MAX_SEGMENTS        = 255,
+    OGG_OPUS_PAGE_PACKETS   = 5,        // 100ms of 20ms packets
+    OGG_OPUS_PAGE_SIZE      = 4096,     // most data bytes on a page
+    OGG_OPUS_HEADERS_SIZE   = 160       // both header pages
+};
+
+// start a new logical stream, false if channels isn't 1 or 2
+boolean ogg_opus_begin(uint32_t channels, uint32_t pre_skip);
+
+// true once begin() has been called, the stream ring carries Ogg
+boolean ogg_opus_isOn();
+
+// what the stream ring carries .. "audio/ogg" when on, "audio/mpeg"
+// when it's mp3, and the kbps from opus_bitrate or bitrate
+const char *ogg_opus_contentType();
+uint32_t ogg_opus_bitrate();
+
+// copies the two header pages to where, returns their length (0 if
+// they don't fit or we aren't on)
+size_t ogg_opus_headers(uint8_t *where, size_t size);
+
+// one Opus packet of samples (at 48kHz) .. each page is passed to
+// write as soon as it is full
+void ogg_opus_addPacket(const uint8_t *packet, size_t length,
+    uint32_t samples, void (*write)(const uint8_t*, size_t));
+
+void ogg_opus_printStats();
+
+#endif
+
+//
+// END OF ogg_opus.h
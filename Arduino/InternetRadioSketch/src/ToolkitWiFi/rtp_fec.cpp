@@ -0,0 +1,31 @@
+//
+// rtp_fec.cpp
+
+#include "rtp_fec.h"
+
+void rtp_parity_reset(rtp_parity *p, uint16_t base)
+{
+    p->base = base;
+    p->count = 0;
+    p->length_xor = 0;
+    p->length = 0;
+    memset(p->data, 0, sizeof(p->data));
+}
+
+void rtp_parity_add(rtp_parity *p, const uint8_t *packet, size_t length)
+{
+    if (length > RTP_PACKET_SIZE) {
+        length = RTP_PACKET_SIZE;
+    }
+    for (size_t i = 0; i < length; i++) {
+        p->data[i] ^= packet[i];
+    }
+    p->length_xor ^= length;
+    if (length > p->length) {
+        p->length = length;
+    }
+    p->count++;
+}
+
+//
+// END OF rtp_fec.cpp
@@ -0,0 +1,55 @@
+//
+// rtp_fec.h
+
+//
+// XOR parity for the RTP stream, so a receiver can rebuild a lost packet.
+//
+// After every group of media packets the sender sends one parity
+// packet, the XOR of the whole group, on the RTP port + 2 (where
+// players that don't know about it won't look). If exactly one packet
+// of the group is lost, XOR the parity with the ones that did arrive
+// and it comes back, sequence number, timestamp and all.
+//
+// A parity packet is an RTP header (payload type 127, its own
+// sequence numbers), then
+//  base sequence number   16 bits    the first packet of the group
+//  count                   8 bits    packets in the group
+//  zero                    8 bits
+//  length XOR             16 bits    the packet lengths XORed together
+//  zero                   16 bits
+// and then the packets XORed together, as long as the longest one.
+//
+
+#ifndef _RTP_FEC_H_
+#define _RTP_FEC_H_
+
+#include <Arduino.h>
+#include "rtp_output.h"
+
+enum {
+    RTP_PAYLOAD_PARITY  = 127,
+    RTP_FEC_PORT_OFFSET = 2,
+    RTP_FEC_HEADER_SIZE = 8,
+    RTP_FEC_MAX_GROUP   = 16,
+    // the biggest media packet rtp_output sends
+    RTP_PACKET_SIZE     = RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE + RTP_MAX_PAYLOAD,
+    RTP_PARITY_SIZE     = RTP_HEADER_SIZE + RTP_FEC_HEADER_SIZE + RTP_PACKET_SIZE
+};
+
+typedef struct {
+    uint16_t base;
+    uint8_t count;
+    uint16_t length_xor;
+    uint16_t length;                // of the longest packet so far
+    uint8_t data[RTP_PACKET_SIZE];
+} rtp_parity;
+
+void rtp_parity_reset(rtp_parity *p, uint16_t base);
+
+// XOR in one media packet, sequence numbers must follow on from base
+void rtp_parity_add(rtp_parity *p, const uint8_t *packet, size_t length);
+
+#endif
+
+//
+// END OF rtp_fec.h
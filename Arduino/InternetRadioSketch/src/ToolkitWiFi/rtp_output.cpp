@@ -0,0 +1,381 @@
+//
+// rtp_output.cpp
+
+#include "rtp_output.h"
+#include "mp3_frame.h"
+#include "rtp_fec.h"
+#include "rtp_sync.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+
+static int fd = -1;
+static struct sockaddr_in group;
+static struct sockaddr_in parity_group;     // port + 2
+static struct sockaddr_in report_group;     // port + 1, RTCP
+
+// we're the time master for the listeners, see rtp_sync.h
+static int sync_fd = -1;
+static uint32_t last_report = 0;
+
+// ring buffers are copied in here and sent a frame at a time
+static const size_t STAGING_SIZE = 8192;
+static uint8_t staging[STAGING_SIZE];
+static size_t staged_start = 0;
+static size_t staged_end = 0;
+
+static uint8_t packet[RTP_PACKET_SIZE];
+
+// XOR parity, see rtp_fec.h
+static uint32_t fec_group = 0;          // 0 is off
+static rtp_parity parity;
+static uint8_t parity_packet[RTP_PARITY_SIZE];
+static uint16_t parity_sequence = 0;
+
+// RTP header fields
+static uint16_t sequence = 0;
+static uint32_t ssrc = 0;
+static boolean marker = true;
+
+// the clock .. a frame is due a frame's worth of samples after the
+// last one, counted from the anchor
+static boolean clock_running = false;
+static uint32_t anchor_us = 0;      // micros() when anchor_samples was 0
+static uint32_t anchor_ts = 0;      // the RTP timestamp then
+static uint64_t anchor_samples = 0;
+static uint32_t sample_rate = 0;
+
+// our place in the encoder ring
+static uint32_t (*ring_head)() = NULL;
+static uint32_t (*ring_oldest)() = NULL;
+static uint8_t *(*ring_get)(uint32_t, size_t*) = NULL;
+static boolean have_cursor = false;
+static uint32_t cursor = 0;
+
+// stats
+static uint32_t stats_frames = 0;
+static uint32_t stats_packets = 0;
+static uint32_t stats_parity = 0;
+static uint32_t stats_reports = 0;
+static uint32_t stats_bytes = 0;
+static uint32_t stats_send_errors = 0;
+static uint32_t stats_lost = 0;         // ring buffers we were too late for
+static uint32_t stats_skipped = 0;      // bytes that weren't frames
+static uint32_t stats_resyncs = 0;
+static uint32_t stats_max_late_us = 0;  // how late a frame went out
+
+boolean rtp_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*))
+{
+    if ((fd >= 0) || (0==SettingItem::findUInt("local_rtp", 0))) {
+        return (fd >= 0);
+    }
+    const char *address = SettingItem::findString("local_rtp_address");
+    if ((NULL==address) || (0==address[0])) {
+        address = "239.255.77.1";
+    }
+    memset(&group, 0, sizeof(group));
+    group.sin_family = AF_INET;
+    group.sin_port = htons(SettingItem::findUInt("local_rtp_port", 5004));
+    if (0==inet_aton(address, &group.sin_addr)) {
+        Serial.printf("RTP address %s isn't an IP address.\n", address);
+        return false;
+    }
+
+    fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0) {
+        Serial.println("RTP has no socket.");
+        return false;
+    }
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_BROADCAST, &on, sizeof(on));
+    uint8_t ttl = SettingItem::findUInt("local_rtp_ttl", 1);
+    setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+
+    parity_group = group;
+    parity_group.sin_port = htons(ntohs(group.sin_port) + RTP_FEC_PORT_OFFSET);
+    fec_group = SettingItem::findUInt("local_rtp_fec", 4);
+    if (fec_group > RTP_FEC_MAX_GROUP) {
+        fec_group = RTP_FEC_MAX_GROUP;
+    }
+    parity.count = 0;
+
+    report_group = group;
+    report_group.sin_port = htons(ntohs(group.sin_port) + RTP_RTCP_PORT_OFFSET);
+    sync_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sync_fd >= 0) {
+        struct sockaddr_in local;
+        memset(&local, 0, sizeof(local));
+        local.sin_family = AF_INET;
+        local.sin_port = htons(ntohs(group.sin_port) + RTP_SYNC_PORT_OFFSET);
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (bind(sync_fd, (struct sockaddr *) &local, sizeof(local)) < 0) {
+            close(sync_fd);
+            sync_fd = -1;
+        }
+    }
+
+    ring_head = head;
+    ring_oldest = oldest;
+    ring_get = get;
+    ssrc = esp_random();
+    sequence = esp_random();    // random start, RFC 3550 5.1
+    parity_sequence = esp_random();
+    Serial.printf("RTP to %s port %u, parity every %u packets\n",
+        address, ntohs(group.sin_port), fec_group);
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// Sending
+//
+
+static void send_packet(const uint8_t *data, size_t length,
+    struct sockaddr_in *to)
+{
+    int sent = sendto(fd, data, length, MSG_DONTWAIT,
+        (struct sockaddr *) to, sizeof(*to));
+    if (sent < 0) {
+        stats_send_errors++;    // no WiFi, or lwip is out of buffers
+    } else {
+        stats_packets++;
+        stats_bytes += sent;
+    }
+}
+
+static void write_header(uint8_t *p, uint8_t type, uint16_t number,
+    uint32_t timestamp)
+{
+    p[0] = 0x80;                                // version 2
+    p[1] = type;
+    p[2] = number >> 8;
+    p[3] = number;
+    p[4] = timestamp >> 24;
+    p[5] = timestamp >> 16;
+    p[6] = timestamp >> 8;
+    p[7] = timestamp;
+    p[8] = ssrc >> 24;
+    p[9] = ssrc >> 16;
+    p[10] = ssrc >> 8;
+    p[11] = ssrc;
+}
+
+// the media packet is sent, XOR it into the parity and send that once
+// the group is full
+static void send_parity(size_t length, uint32_t timestamp)
+{
+    if (0==parity.count) {
+        rtp_parity_reset(&parity, sequence);
+    }
+    rtp_parity_add(&parity, packet, length);
+    if (parity.count < fec_group) {
+        return;
+    }
+    uint8_t *p = parity_packet;
+    write_header(p, RTP_PAYLOAD_PARITY, parity_sequence++, timestamp);
+    p += RTP_HEADER_SIZE;
+    *p++ = parity.base >> 8;
+    *p++ = parity.base;
+    *p++ = parity.count;
+    *p++ = 0;
+    *p++ = parity.length_xor >> 8;
+    *p++ = parity.length_xor;
+    *p++ = 0;
+    *p++ = 0;
+    memcpy(p, parity.data, parity.length);
+    send_packet(parity_packet,
+        RTP_HEADER_SIZE + RTP_FEC_HEADER_SIZE + parity.length, &parity_group);
+    stats_parity++;
+    parity.count = 0;
+}
+
+// RTCP sender report .. timestamp went out at this time on our clock,
+// given as the NTP timestamp
+static void send_report(uint32_t timestamp, uint32_t due)
+{
+    int64_t clock = rtp_sync_clock() - (int32_t) (micros() - due);
+    uint32_t seconds = clock / 1000000;
+    uint32_t fraction = ((uint64_t) (clock % 1000000) << 32) / 1000000;
+    uint8_t report[RTP_SR_SIZE];
+    uint8_t *p = report;
+    *p++ = 0x80;                                // version 2, no blocks
+    *p++ = RTP_PAYLOAD_SR;
+    *p++ = 0;
+    *p++ = (RTP_SR_SIZE / 4) - 1;               // length in words - 1
+    uint32_t words[6] = {
+        ssrc, seconds, fraction, timestamp, stats_packets, stats_bytes
+    };
+    for (uint32_t i = 0; i < 6; i++) {
+        *p++ = words[i] >> 24;
+        *p++ = words[i] >> 16;
+        *p++ = words[i] >> 8;
+        *p++ = words[i];
+    }
+    sendto(fd, report, sizeof(report), MSG_DONTWAIT,
+        (struct sockaddr *) &report_group, sizeof(report_group));
+    last_report = millis();
+    stats_reports++;
+}
+
+// one frame, in as many packets as it takes
+static void send_frame(const uint8_t *frame, size_t length, uint32_t timestamp)
+{
+    uint32_t offset = 0;
+    while (offset < length) {
+        size_t chunk = length - offset;
+        if (chunk > RTP_MAX_PAYLOAD) {
+            chunk = RTP_MAX_PAYLOAD;
+        }
+        write_header(packet, (marker ? 0x80 : 0) | RTP_PAYLOAD_MPA,
+            sequence, timestamp);
+        uint8_t *p = &packet[RTP_HEADER_SIZE];
+        *p++ = 0;                               // MBZ
+        *p++ = 0;
+        *p++ = offset >> 8;                     // Frag_offset
+        *p++ = offset;
+        memcpy(p, &frame[offset], chunk);
+        size_t size = RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE + chunk;
+        send_packet(packet, size, &group);
+        if (fec_group) {
+            send_parity(size, timestamp);
+        }
+        sequence++;
+        marker = false;
+        offset += chunk;
+    }
+    stats_frames++;
+}
+
+// the clock starts again from now, the timestamps jump by the time
+// we were away so receivers see the gap
+static void restart_clock(uint32_t now, uint32_t late_us)
+{
+    anchor_ts += ((uint64_t) anchor_samples * RTP_CLOCK_RATE) / sample_rate;
+    anchor_ts += ((uint64_t) late_us * RTP_CLOCK_RATE) / 1000000;
+    anchor_us = now;
+    anchor_samples = 0;
+    marker = true;
+    stats_resyncs++;
+}
+
+// send the staged frames that are due, stop at the first one that isn't
+static void send_due_frames()
+{
+    mp3_frame_info info;
+    while ((staged_start + MP3_HEADER_SIZE) <= staged_end) {
+        uint8_t *p = &staging[staged_start];
+        size_t available = staged_end - staged_start;
+        if (!mp3_frame_parse(p, &info)) {
+            // lost sync, skip to the next frame header
+            size_t skip = mp3_frame_find(p, available);
+            skip = skip ? skip : 1;
+            staged_start += skip;
+            stats_skipped += skip;
+            continue;
+        }
+        if (info.length > available) {
+            break;  // the rest of the frame is in the next ring buffer
+        }
+
+        uint32_t now = micros();
+        if (!clock_running) {
+            anchor_us = now + (RTP_PREBUFFER_MS * 1000);
+            anchor_samples = 0;
+            sample_rate = info.sample_rate;
+            clock_running = true;
+        } else if (info.sample_rate != sample_rate) {
+            // carry on from where the old rate got to
+            anchor_us += ((uint64_t) anchor_samples * 1000000) / sample_rate;
+            anchor_ts += ((uint64_t) anchor_samples * RTP_CLOCK_RATE) / sample_rate;
+            anchor_samples = 0;
+            sample_rate = info.sample_rate;
+            marker = true;
+        }
+        uint32_t due = anchor_us +
+            (uint32_t) (((uint64_t) anchor_samples * 1000000) / sample_rate);
+        int32_t early = (int32_t) (due - now);
+        if (early > 0) {
+            break;
+        }
+        uint32_t late = -early;
+        if (late > (RTP_RESYNC_MS * 1000)) {
+            restart_clock(now, late);
+            late = 0;
+        }
+        if (late > stats_max_late_us) {
+            stats_max_late_us = late;
+        }
+
+        uint32_t timestamp = anchor_ts +
+            (uint32_t) (((uint64_t) anchor_samples * RTP_CLOCK_RATE) / sample_rate);
+        send_frame(p, info.length, timestamp);
+        if ((millis() - last_report) >= RTP_SR_INTERVAL_MS) {
+            send_report(timestamp, due);
+        }
+        anchor_samples += info.samples;
+        staged_start += info.length;
+    }
+}
+
+void rtp_run()
+{
+    if ((fd < 0) || (NULL==ring_get)) {
+        return;
+    }
+    if (sync_fd >= 0) {
+        rtp_sync_serve(sync_fd);
+    }
+    uint32_t head = ring_head();
+    if (!have_cursor) {
+        cursor = (head > 0) ? (head - 1) : 0;
+        have_cursor = true;
+    }
+    uint32_t oldest = ring_oldest();
+    if (cursor < oldest) {
+        stats_lost += oldest - cursor;
+        cursor = oldest;
+        // the staged part frame won't join up with what comes next
+        staged_start = staged_end = 0;
+        marker = true;
+    }
+
+    // top up the staging buffer, only as far as we need to .. the
+    // rest waits in the ring
+    while ((cursor < head) && ((staged_end - staged_start) < MP3_MAX_FRAME_SIZE)) {
+        size_t length;
+        uint8_t *data = ring_get(cursor, &length);
+        if (NULL==data) {
+            break;  // overwritten since we looked, catch it next time
+        }
+        if (staged_start) {
+            memmove(staging, &staging[staged_start], staged_end - staged_start);
+            staged_end -= staged_start;
+            staged_start = 0;
+        }
+        if ((staged_end + length) > STAGING_SIZE) {
+            break;
+        }
+        memcpy(&staging[staged_end], data, length);
+        staged_end += length;
+        cursor++;
+    }
+    send_due_frames();
+}
+
+void rtp_printStats()
+{
+    if (fd < 0) {
+        return;
+    }
+    Serial.printf("RTP frames %u, packets %u (parity %u), bytes %u, "
+        "send errors %u\n", stats_frames, stats_packets, stats_parity,
+        stats_bytes, stats_send_errors);
+    Serial.printf("RTP lost %u ring buffers, skipped %u bytes, "
+        "resyncs %u, max late %u us, reports %u\n",
+        stats_lost, stats_skipped, stats_resyncs, stats_max_late_us,
+        stats_reports);
+}
+
+//
+// END OF rtp_output.cpp
@@ -0,0 +1,61 @@
+//
+// rtp_output.h
+
+//
+// RTP output of the encoder stream, for the LAN.
+//
+// Every local listener costs a socket, a client slot and its own copy
+// of the audio on the air. RTP sends each mp3 frame once, to a
+// multicast (or broadcast) group, and any number of receivers on the
+// LAN can pick it up (VLC, ffplay, gstreamer ..).
+//
+// Packets are MPEG audio as in RFC 2250: payload type 14, the 90kHz
+// clock, one frame per packet with the 4 byte MPEG audio header in
+// front. Frames too big for one packet are split with Frag_offset.
+// The marker bit is set on the first packet, and after audio was lost.
+// XOR parity for every few packets goes to port + 2, see rtp_fec.h.
+// RTCP sender reports go to port + 1 and we answer the listeners'
+// time requests on port + 4, see rtp_sync.h.
+//
+// The frames are paced out at the rate they play, a frame's worth of
+// samples after the last one, so receivers don't need a big buffer.
+// If we fall more than RTP_RESYNC_MS behind (the encoder stopped, say)
+// the clock starts again from now and the timestamps jump to match.
+//
+//  local_rtp           = 1 to turn it on
+//  local_rtp_address   = 239.255.77.1 (multicast or broadcast)
+//  local_rtp_port      = 5004
+//  local_rtp_ttl       = 1 (multicast hops, 1 stays on the LAN)
+//  local_rtp_fec       = 4 (packets per parity packet, 0 for none)
+//
+// rtp_run() is called from the stream task.
+//
+
+#ifndef _RTP_OUTPUT_H_
+#define _RTP_OUTPUT_H_
+
+#include <Arduino.h>
+
+enum {
+    RTP_PAYLOAD_MPA     = 14,       // RFC 3551
+    RTP_CLOCK_RATE      = 90000,
+    RTP_HEADER_SIZE     = 12,
+    RTP_MPA_HEADER_SIZE = 4,        // RFC 2250 section 3.5
+    RTP_MAX_PAYLOAD     = 1400,     // mp3 bytes in a packet, fits the MTU
+    RTP_PREBUFFER_MS    = 100,      // the first frame goes out this late
+    RTP_RESYNC_MS       = 1000
+};
+
+// reads the settings and opens the socket, false if RTP is off
+boolean rtp_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*));
+
+// from the stream task .. send the frames that are due
+void rtp_run();
+
+void rtp_printStats();
+
+#endif
+
+//
+// END OF rtp_output.h
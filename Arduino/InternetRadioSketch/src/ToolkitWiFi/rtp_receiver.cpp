@@ -0,0 +1,436 @@
+//
+// rtp_receiver.cpp
+
+#include "rtp_receiver.h"
+#include "rtp_fec.h"
+#include "rtp_sync.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+
+typedef struct {
+    boolean valid;
+    uint16_t sequence;
+    uint16_t length;
+    uint32_t arrived;           // millis()
+    uint8_t data[RTP_PACKET_SIZE];
+} jitter_slot;
+
+static const size_t MEDIA_OFFSET = RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE;
+
+static int media_fd = -1;
+static int parity_fd = -1;
+static int report_fd = -1;              // RTCP, for rtp_sync
+static uint32_t jitter_ms = RTP_JITTER_MS;
+
+// packet n waits in slot n % RTP_JITTER_SLOTS, the parity packets are
+// kept until their group is complete or too late to matter
+static jitter_slot *slots = NULL;
+static rtp_parity *parities = NULL;     // count 0 is an empty slot
+static uint32_t next_parity = 0;
+static uint8_t incoming[RTP_PARITY_SIZE];
+
+static boolean have_ssrc = false;
+static uint32_t ssrc = 0;
+static boolean have_first = false;      // play_sequence means something
+static boolean started = false;         // played anything since the reset
+static boolean playing = false;         // false while the buffer fills
+static uint32_t filling_since = 0;
+static uint16_t play_sequence = 0;      // the next packet to play
+static size_t play_offset = 0;          // into its payload
+static uint16_t newest = 0;
+
+// stats
+static uint32_t stats_received = 0;
+static uint32_t stats_parity = 0;
+static uint32_t stats_recovered = 0;
+static uint32_t stats_lost = 0;         // skipped, nothing could bring it back
+static uint32_t stats_late = 0;         // arrived after it was skipped
+static uint32_t stats_duplicates = 0;
+static uint32_t stats_reordered = 0;
+static uint32_t stats_underruns = 0;
+static uint32_t stats_resets = 0;
+static uint32_t stats_bad = 0;          // not RTP, or not ours
+
+// how far a is after b, negative if it's before
+static int32_t distance(uint16_t a, uint16_t b)
+{
+    return (int16_t) (a - b);
+}
+
+static int open_socket(struct in_addr address, uint16_t port)
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0) {
+        return -1;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (struct sockaddr *) &local, sizeof(local)) < 0) {
+        close(fd);
+        return -1;
+    }
+    if (IN_MULTICAST(ntohl(address.s_addr))) {
+        struct ip_mreq join;
+        join.imr_multiaddr = address;
+        join.imr_interface.s_addr = htonl(INADDR_ANY);
+        setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &join, sizeof(join));
+    }
+    return fd;
+}
+
+boolean rtp_receiver_begin()
+{
+    if (media_fd >= 0) {
+        return true;
+    }
+    const char *address = SettingItem::findString("listen_rtp_address");
+    if ((NULL==address) || (0==address[0])) {
+        address = "239.255.77.1";
+    }
+    struct in_addr group;
+    if (0==inet_aton(address, &group)) {
+        Serial.printf("RTP address %s isn't an IP address.\n", address);
+        return false;
+    }
+    uint16_t port = SettingItem::findUInt("listen_rtp_port", 5004);
+    jitter_ms = SettingItem::findUInt("listen_rtp_jitter_ms", RTP_JITTER_MS);
+    if (jitter_ms > RTP_JITTER_MAX_MS) {
+        jitter_ms = RTP_JITTER_MAX_MS;
+    }
+
+    if (NULL==slots) {
+        size_t size = (RTP_JITTER_SLOTS * sizeof(jitter_slot)) +
+            (RTP_PARITY_SLOTS * sizeof(rtp_parity));
+        uint8_t *memory = (uint8_t *) (psramFound() ? ps_malloc(size) : malloc(size));
+        if (NULL==memory) {
+            Serial.println("No room for the RTP jitter buffer.");
+            return false;
+        }
+        memset(memory, 0, size);
+        slots = (jitter_slot *) memory;
+        parities = (rtp_parity *) &memory[RTP_JITTER_SLOTS * sizeof(jitter_slot)];
+    }
+
+    media_fd = open_socket(group, port);
+    parity_fd = open_socket(group, port + RTP_FEC_PORT_OFFSET);
+    if (rtp_sync_begin(port)) {
+        report_fd = open_socket(group, port + RTP_RTCP_PORT_OFFSET);
+    }
+    if (media_fd < 0) {
+        Serial.println("RTP has no socket.");
+        return false;
+    }
+    Serial.printf("RTP listening on %s port %u, jitter buffer %u ms\n",
+        address, port, jitter_ms);
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// Arrivals
+//
+
+static void reset()
+{
+    for (uint32_t i = 0; i < RTP_JITTER_SLOTS; i++) {
+        slots[i].valid = false;
+    }
+    for (uint32_t i = 0; i < RTP_PARITY_SLOTS; i++) {
+        parities[i].count = 0;
+    }
+    have_first = false;
+    started = false;
+    playing = false;
+    filling_since = 0;
+    play_offset = 0;
+    rtp_sync_restart();
+}
+
+static boolean is_here(uint16_t sequence)
+{
+    jitter_slot *slot = &slots[sequence % RTP_JITTER_SLOTS];
+    return slot->valid && (sequence==slot->sequence);
+}
+
+static void arrived(uint16_t sequence)
+{
+    if (distance(sequence, newest) > 0) {
+        newest = sequence;
+    } else {
+        stats_reordered++;
+    }
+}
+
+// if only one packet of the group is missing, XOR it back
+static void try_parity(rtp_parity *p, uint32_t now)
+{
+    int32_t missing = -1;
+    for (uint32_t i = 0; i < p->count; i++) {
+        if (!is_here(p->base + i)) {
+            if (missing >= 0) {
+                return;     // two gone, maybe the next arrival helps
+            }
+            missing = i;
+        }
+    }
+    uint16_t sequence = p->base + missing;
+    if ((missing < 0) || (started && (distance(sequence, play_sequence) < 0))) {
+        p->count = 0;       // all here, or it is too late anyway
+        return;
+    }
+
+    jitter_slot *target = &slots[sequence % RTP_JITTER_SLOTS];
+    memcpy(target->data, p->data, RTP_PACKET_SIZE);
+    uint32_t length = p->length_xor;
+    for (uint32_t i = 0; i < p->count; i++) {
+        if ((int32_t) i != missing) {
+            jitter_slot *slot = &slots[(uint16_t) (p->base + i) % RTP_JITTER_SLOTS];
+            for (uint32_t j = 0; j < slot->length; j++) {
+                target->data[j] ^= slot->data[j];
+            }
+            length ^= slot->length;
+        }
+    }
+    p->count = 0;
+    uint16_t rebuilt = (target->data[2] << 8) | target->data[3];
+    if ((length < MEDIA_OFFSET) || (length > RTP_PACKET_SIZE) ||
+        (rebuilt != sequence)) {
+        target->valid = false;
+        stats_bad++;
+        return;
+    }
+    target->valid = true;
+    target->sequence = sequence;
+    target->length = length;
+    target->arrived = now;
+    stats_recovered++;
+    arrived(sequence);
+}
+
+static void take_media(const uint8_t *data, size_t length, uint32_t from,
+    uint32_t now)
+{
+    if ((length < MEDIA_OFFSET) || (0x80 != (data[0] & 0xc0)) ||
+        (RTP_PAYLOAD_MPA != (data[1] & 0x7f))) {
+        stats_bad++;
+        return;
+    }
+    rtp_sync_setMaster(from);   // the sender keeps the time
+    uint16_t sequence = (data[2] << 8) | data[3];
+    uint32_t their_ssrc = (data[8] << 24) | (data[9] << 16) |
+        (data[10] << 8) | data[11];
+    if (have_ssrc && (their_ssrc != ssrc)) {
+        reset();    // the sender started again
+        stats_resets++;
+    }
+    ssrc = their_ssrc;
+    have_ssrc = true;
+
+    if (have_first) {
+        int32_t ahead = distance(sequence, play_sequence);
+        if (ahead < 0) {
+            if (started || (distance(newest, sequence) >= RTP_JITTER_SLOTS)) {
+                stats_late++;
+                return;
+            }
+            play_sequence = sequence;   // still filling, start from here
+        } else if (ahead >= RTP_JITTER_SLOTS) {
+            reset();    // too far ahead to hold, start again from here
+            stats_resets++;
+        }
+    }
+    if (!have_first) {
+        have_first = true;
+        play_sequence = sequence;
+        newest = sequence;
+    }
+    if (!playing && (0==filling_since)) {
+        filling_since = now;    // the first since we started, or ran dry
+    }
+
+    jitter_slot *slot = &slots[sequence % RTP_JITTER_SLOTS];
+    if (slot->valid && (sequence==slot->sequence)) {
+        stats_duplicates++;
+        return;
+    }
+    memcpy(slot->data, data, length);
+    slot->valid = true;
+    slot->sequence = sequence;
+    slot->length = length;
+    slot->arrived = now;
+    stats_received++;
+    if (sequence != newest) {
+        arrived(sequence);
+    }
+
+    for (uint32_t i = 0; i < RTP_PARITY_SLOTS; i++) {
+        rtp_parity *p = &parities[i];
+        if (p->count && ((uint16_t) (sequence - p->base) < p->count)) {
+            try_parity(p, now);
+        }
+    }
+}
+
+static void take_parity(const uint8_t *data, size_t length, uint32_t now)
+{
+    size_t header = RTP_HEADER_SIZE + RTP_FEC_HEADER_SIZE;
+    if ((length <= header) || (length > RTP_PARITY_SIZE) ||
+        (0x80 != (data[0] & 0xc0)) ||
+        (RTP_PAYLOAD_PARITY != (data[1] & 0x7f))) {
+        stats_bad++;
+        return;
+    }
+    const uint8_t *f = &data[RTP_HEADER_SIZE];
+    uint8_t count = f[2];
+    if ((0==count) || (count > RTP_FEC_MAX_GROUP)) {
+        stats_bad++;
+        return;
+    }
+    rtp_parity *p = &parities[next_parity++ % RTP_PARITY_SLOTS];
+    rtp_parity_reset(p, (f[0] << 8) | f[1]);
+    p->length_xor = (f[4] << 8) | f[5];
+    p->length = length - header;
+    memcpy(p->data, &data[header], p->length);
+    p->count = count;
+    stats_parity++;
+    if (have_first) {
+        try_parity(p, now);
+    }
+}
+
+void rtp_receiver_run()
+{
+    if (media_fd < 0) {
+        return;
+    }
+    uint32_t now = millis();
+    struct sockaddr_in from;
+    socklen_t from_length = sizeof(from);
+    int got;
+    while ((got = recvfrom(media_fd, incoming, RTP_PACKET_SIZE, MSG_DONTWAIT,
+        (struct sockaddr *) &from, &from_length)) > 0) {
+        take_media(incoming, got, from.sin_addr.s_addr, now);
+        from_length = sizeof(from);
+    }
+    if (parity_fd >= 0) {
+        while ((got = recv(parity_fd, incoming, RTP_PARITY_SIZE, MSG_DONTWAIT)) > 0) {
+            take_parity(incoming, got, now);
+        }
+    }
+    if (report_fd >= 0) {
+        while ((got = recv(report_fd, incoming, RTP_PARITY_SIZE, MSG_DONTWAIT)) > 0) {
+            rtp_sync_takeReport(incoming, got);
+        }
+    }
+    rtp_sync_run();
+}
+
+//------------------------------------------------------------------
+//
+// Playing
+//
+
+// the missing packet at play_sequence is given up on once the next
+// one we do have has waited its full jitter time
+static boolean skip_missing(uint32_t now)
+{
+    uint16_t next = play_sequence + 1;
+    while ((distance(newest, next) >= 0) && !is_here(next)) {
+        next++;
+    }
+    if (distance(newest, next) < 0) {
+        return false;
+    }
+    if ((now - slots[next % RTP_JITTER_SLOTS].arrived) < jitter_ms) {
+        return false;
+    }
+    stats_lost += (uint16_t) (next - play_sequence);
+    play_sequence = next;
+    play_offset = 0;
+    return true;
+}
+
+size_t rtp_receiver_read(uint8_t *buffer, size_t size)
+{
+    if ((NULL==slots) || !have_first) {
+        return 0;
+    }
+    uint32_t now = millis();
+    if (!playing) {
+        if ((0==filling_since) || ((now - filling_since) < jitter_ms)) {
+            return 0;
+        }
+        playing = true;
+    }
+
+    size_t copied = 0;
+    while (copied < size) {
+        if (!is_here(play_sequence)) {
+            if (distance(newest, play_sequence) < 0) {
+                // played everything, let the buffer fill again
+                playing = false;
+                filling_since = 0;
+                stats_underruns++;
+                rtp_sync_restart();
+                break;
+            }
+            if (!skip_missing(now)) {
+                break;
+            }
+            continue;
+        }
+        jitter_slot *slot = &slots[play_sequence % RTP_JITTER_SLOTS];
+        if (0==play_offset) {
+            // in sync with the other rooms, see rtp_sync.h
+            uint32_t timestamp = ((uint32_t) slot->data[4] << 24) |
+                (slot->data[5] << 16) | (slot->data[6] << 8) | slot->data[7];
+            uint32_t action = rtp_sync_check(timestamp);
+            if (RTP_SYNC_WAIT==action) {
+                break;
+            }
+            if (RTP_SYNC_SKIP==action) {
+                play_sequence++;
+                continue;
+            }
+            rtp_sync_fed(slot->data, slot->length);
+        }
+        size_t payload = slot->length - MEDIA_OFFSET;
+        size_t chunk = payload - play_offset;
+        if (chunk > (size - copied)) {
+            chunk = size - copied;
+        }
+        memcpy(&buffer[copied], &slot->data[MEDIA_OFFSET + play_offset], chunk);
+        copied += chunk;
+        play_offset += chunk;
+        if (play_offset >= payload) {
+            play_offset = 0;
+            play_sequence++;
+        }
+        started = true;
+    }
+    return copied;
+}
+
+void rtp_receiver_printStats()
+{
+    if (media_fd < 0) {
+        return;
+    }
+    Serial.printf("RTP received %u, parity %u, recovered %u, lost %u\n",
+        stats_received, stats_parity, stats_recovered, stats_lost);
+    Serial.printf("RTP late %u, duplicates %u, reordered %u, "
+        "underruns %u, resets %u, bad %u\n",
+        stats_late, stats_duplicates, stats_reordered,
+        stats_underruns, stats_resets, stats_bad);
+    rtp_sync_printStats();
+}
+
+//
+// END OF rtp_receiver.cpp
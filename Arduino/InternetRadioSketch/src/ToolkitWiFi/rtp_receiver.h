@@ -0,0 +1,55 @@
+//
+// rtp_receiver.h
+
+//
+// The listener end of rtp_output, for startup_auto_mode = multicast.
+//
+// Instead of every toolkit in a building pulling its own copy of the
+// stream from listen_icecast_url, one toolkit sends RTP to a multicast
+// group (local_rtp = 1) and the rest join the group and play it.
+//
+// UDP can lose packets and deliver them out of order, so they wait in
+// a jitter buffer of RTP_JITTER_SLOTS packets, in sequence number
+// order, for listen_rtp_jitter_ms before they are played. A packet
+// that hasn't turned up by then is rebuilt from the XOR parity (see
+// rtp_fec.h) if only one of its group is missing, or else skipped.
+// The VS1063a finds the next frame header by itself.
+//
+// With listen_rtp_sync the packets are also held until the moment the
+// master's timeline says, so every room hears the same thing at the
+// same time, see rtp_sync.h.
+//
+//  listen_rtp_address      = 239.255.77.1
+//  listen_rtp_port         = 5004
+//  listen_rtp_jitter_ms    = 200
+//
+// Everything here runs in the listener task.
+//
+
+#ifndef _RTP_RECEIVER_H_
+#define _RTP_RECEIVER_H_
+
+#include <Arduino.h>
+
+enum {
+    RTP_JITTER_SLOTS    = 32,   // ~0.8s of packets at 1152 samples/44.1kHz
+    RTP_PARITY_SLOTS    = 4,
+    RTP_JITTER_MS       = 200,
+    RTP_JITTER_MAX_MS   = 500   // has to fit in the slots
+};
+
+// join the group and open the sockets
+boolean rtp_receiver_begin();
+
+// take in whatever packets have arrived
+void rtp_receiver_run();
+
+// up to size bytes of mp3, in order, once they're due .. 0 if nothing is
+size_t rtp_receiver_read(uint8_t *buffer, size_t size);
+
+void rtp_receiver_printStats();
+
+#endif
+
+//
+// END OF rtp_receiver.h
@@ -0,0 +1,404 @@
+//
+// rtp_sync.cpp
+
+#include "rtp_sync.h"
+#include "rtp_output.h"
+#include "mp3_frame.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+
+// the time exchange .. "TKSY", type, 3 zeros, then t1, t2 and t3
+static const uint8_t magic[4] = { 'T', 'K', 'S', 'Y' };
+enum {
+    SYNC_REQUEST    = 1,
+    SYNC_REPLY      = 2
+};
+
+static boolean enabled = false;
+static int fd = -1;
+static struct sockaddr_in master;
+static boolean have_master = false;
+static int64_t delay_us = 0;
+static uint32_t begun_at = 0;
+static uint32_t next_poll = 0;
+
+// the last few exchanges, offset is the master's clock minus ours
+typedef struct {
+    int64_t offset;
+    int64_t round_trip;
+} sync_sample;
+
+static sync_sample samples[RTP_SYNC_SAMPLES];
+static uint32_t sample_count = 0;
+static boolean have_offset = false;
+static int64_t offset = 0;
+
+// the last sender report .. timestamp went out at report_clock
+static boolean have_report = false;
+static int64_t report_clock = 0;
+static uint32_t report_timestamp = 0;
+
+// what the decoder has been fed since it started, to turn its sample
+// counter back into an RTP timestamp
+typedef struct {
+    uint32_t samples_before;
+    uint32_t timestamp;
+    uint32_t sample_rate;
+} fed_frame;
+
+static fed_frame history[RTP_SYNC_HISTORY];
+static uint32_t history_count = 0;
+static uint32_t fed_samples = 0;
+static boolean restart_pending = true;
+static boolean restarted = false;
+static int32_t integral_ppm = 0;
+
+// stats
+static uint32_t stats_requests = 0;
+static uint32_t stats_replies = 0;
+static uint32_t stats_reports = 0;
+static uint32_t stats_trimmed = 0;
+static int64_t stats_round_trip = 0;    // of the sample in use
+static int32_t stats_error_us = 0;
+static int32_t stats_worst_us = 0;      // since the last printStats
+static int32_t stats_ppm = 0;
+
+int64_t rtp_sync_clock()
+{
+    return esp_timer_get_time();
+}
+
+static void put64(uint8_t *p, int64_t value)
+{
+    for (int32_t i = 7; i >= 0; i--) {
+        p[i] = value & 0xff;
+        value >>= 8;
+    }
+}
+
+static int64_t get64(const uint8_t *p)
+{
+    int64_t value = 0;
+    for (uint32_t i = 0; i < 8; i++) {
+        value = (value << 8) | p[i];
+    }
+    return value;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+//------------------------------------------------------------------
+//
+// Master
+//
+
+// t2 is when we got round to it, so the stream task's delay counts as
+// network time .. the listeners throw those exchanges away
+void rtp_sync_serve(int server_fd)
+{
+    uint8_t packet[RTP_SYNC_PACKET_SIZE];
+    struct sockaddr_in from;
+    socklen_t from_length = sizeof(from);
+    int got;
+    while ((got = recvfrom(server_fd, packet, sizeof(packet), MSG_DONTWAIT,
+        (struct sockaddr *) &from, &from_length)) > 0) {
+        int64_t t2 = rtp_sync_clock();
+        if ((RTP_SYNC_PACKET_SIZE==got) && (0==memcmp(packet, magic, 4)) &&
+            (SYNC_REQUEST==packet[4])) {
+            packet[4] = SYNC_REPLY;
+            put64(&packet[16], t2);
+            put64(&packet[24], rtp_sync_clock());
+            sendto(server_fd, packet, got, MSG_DONTWAIT,
+                (struct sockaddr *) &from, from_length);
+        }
+        from_length = sizeof(from);
+    }
+}
+
+//------------------------------------------------------------------
+//
+// Listener .. the clocks
+//
+
+boolean rtp_sync_begin(uint16_t port)
+{
+    if (fd >= 0) {
+        return true;
+    }
+    enabled = (0 != SettingItem::findUInt("listen_rtp_sync", 1));
+    if (!enabled) {
+        return false;
+    }
+    uint32_t delay_ms = SettingItem::findUInt("listen_rtp_delay_ms", RTP_SYNC_DELAY_MS);
+    if (delay_ms > RTP_SYNC_MAX_DELAY_MS) {
+        delay_ms = RTP_SYNC_MAX_DELAY_MS;
+    }
+    delay_us = (int64_t) delay_ms * 1000;
+
+    fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0) {
+        Serial.println("RTP sync has no socket.");
+        enabled = false;
+        return false;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    memset(&master, 0, sizeof(master));
+    master.sin_family = AF_INET;
+    master.sin_port = htons(port + RTP_SYNC_PORT_OFFSET);
+    begun_at = millis();
+    Serial.printf("RTP sync, playing %u ms behind the master\n", delay_ms);
+    return true;
+}
+
+void rtp_sync_setMaster(uint32_t ip)
+{
+    if (!enabled || (have_master && (ip==master.sin_addr.s_addr))) {
+        return;
+    }
+    // a new master has a new clock
+    master.sin_addr.s_addr = ip;
+    have_master = true;
+    sample_count = 0;
+    have_offset = false;
+    have_report = false;
+}
+
+void rtp_sync_takeReport(const uint8_t *data, size_t length)
+{
+    if (!enabled || (length < RTP_SR_SIZE) || (0x80 != (data[0] & 0xc0)) ||
+        (RTP_PAYLOAD_SR != data[1])) {
+        return;
+    }
+    // the NTP timestamp is the master's clock, seconds and fraction
+    uint32_t seconds = get32(&data[8]);
+    uint32_t fraction = get32(&data[12]);
+    report_clock = ((int64_t) seconds * 1000000) +
+        (int64_t) (((uint64_t) fraction * 1000000) >> 32);
+    report_timestamp = get32(&data[16]);
+    have_report = true;
+    stats_reports++;
+}
+
+static void take_reply(const uint8_t *packet)
+{
+    int64_t t4 = rtp_sync_clock();
+    int64_t t1 = get64(&packet[8]);
+    int64_t t2 = get64(&packet[16]);
+    int64_t t3 = get64(&packet[24]);
+    sync_sample *s = &samples[sample_count++ % RTP_SYNC_SAMPLES];
+    s->round_trip = (t4 - t1) - (t3 - t2);
+    s->offset = ((t2 - t1) + (t3 - t4)) / 2;
+
+    // the quickest one waited least, so it's the most even
+    uint32_t n = (sample_count < RTP_SYNC_SAMPLES) ? sample_count : RTP_SYNC_SAMPLES;
+    sync_sample *best = &samples[0];
+    for (uint32_t i = 1; i < n; i++) {
+        if (samples[i].round_trip < best->round_trip) {
+            best = &samples[i];
+        }
+    }
+    offset = best->offset;
+    have_offset = true;
+    stats_round_trip = best->round_trip;
+    stats_replies++;
+}
+
+static void take_replies()
+{
+    uint8_t packet[RTP_SYNC_PACKET_SIZE];
+    int got;
+    while ((got = recv(fd, packet, sizeof(packet), MSG_DONTWAIT)) > 0) {
+        if ((RTP_SYNC_PACKET_SIZE==got) && (0==memcmp(packet, magic, 4)) &&
+            (SYNC_REPLY==packet[4])) {
+            take_reply(packet);
+        }
+    }
+}
+
+void rtp_sync_run()
+{
+    if (!enabled) {
+        return;
+    }
+    take_replies();     // any that were too slow for the wait below
+    if (!have_master || ((int32_t) (millis() - next_poll) < 0)) {
+        return;
+    }
+    // not in step with the master's loop, so some of them catch it
+    // just as it looks
+    next_poll = millis() + RTP_SYNC_POLL_MS + (esp_random() % RTP_SYNC_POLL_MS);
+
+    uint8_t packet[RTP_SYNC_PACKET_SIZE];
+    memset(packet, 0, sizeof(packet));
+    memcpy(packet, magic, 4);
+    packet[4] = SYNC_REQUEST;
+    put64(&packet[8], rtp_sync_clock());
+    sendto(fd, packet, sizeof(packet), MSG_DONTWAIT,
+        (struct sockaddr *) &master, sizeof(master));
+    stats_requests++;
+
+    // wait for the answer here, t4 is only as good as when we look
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(fd, &fds);
+    struct timeval wait = { 0, RTP_SYNC_REPLY_MS * 1000 };
+    if (select(fd+1, &fds, NULL, NULL, &wait) > 0) {
+        take_replies();
+    }
+}
+
+//------------------------------------------------------------------
+//
+// Listener .. the timeline
+//
+
+static boolean locked()
+{
+    return have_offset && have_report;
+}
+
+// on our clock, when timestamp should be heard
+static int64_t heard_at(uint32_t timestamp)
+{
+    int32_t ticks = timestamp - report_timestamp;
+    return report_clock + (((int64_t) ticks * 1000000) / RTP_CLOCK_RATE) -
+        offset + delay_us;
+}
+
+uint32_t rtp_sync_check(uint32_t timestamp)
+{
+    if (!enabled) {
+        return RTP_SYNC_PLAY;
+    }
+    if (!locked()) {
+        // an old sender won't answer, play it as it comes
+        return ((millis() - begun_at) < RTP_SYNC_LOCK_MS) ?
+            RTP_SYNC_WAIT : RTP_SYNC_PLAY;
+    }
+    // the decoder starts on the first frame as soon as it has it, after
+    // that it holds the lead
+    int64_t lead = restart_pending ? 0 : (RTP_SYNC_LEAD_MS * 1000);
+    int64_t early = heard_at(timestamp) - lead - rtp_sync_clock();
+    if ((early > 10000000) || (early < -10000000)) {
+        have_report = false;    // from before the sender restarted
+        return RTP_SYNC_WAIT;
+    }
+    if (early > 0) {
+        return RTP_SYNC_WAIT;
+    }
+    // until the decoder starts, skipping costs nothing, so it starts on
+    // the right frame .. rateTune would take most of a minute to make
+    // up RTP_SYNC_TRIM_MS
+    int64_t trim = (restart_pending ? RTP_SYNC_START_MS : RTP_SYNC_TRIM_MS) * 1000;
+    if (-early > trim) {
+        stats_trimmed++;
+        return RTP_SYNC_SKIP;
+    }
+    return RTP_SYNC_PLAY;
+}
+
+void rtp_sync_restart()
+{
+    restart_pending = true;
+}
+
+boolean rtp_sync_restarted()
+{
+    boolean was = restarted;
+    restarted = false;
+    return was;
+}
+
+void rtp_sync_fed(const uint8_t *packet, size_t length)
+{
+    if (!enabled || (length < (RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE + MP3_HEADER_SIZE))) {
+        return;
+    }
+    const uint8_t *mpa = &packet[RTP_HEADER_SIZE];
+    if (mpa[2] | mpa[3]) {
+        return;     // the rest of a split frame
+    }
+    mp3_frame_info info;
+    if (!mp3_frame_parse(&mpa[RTP_MPA_HEADER_SIZE], &info)) {
+        return;
+    }
+    if (restart_pending) {
+        // the decoder starts counting from here
+        restart_pending = false;
+        restarted = true;
+        history_count = 0;
+        fed_samples = 0;
+    }
+    fed_frame *f = &history[history_count++ % RTP_SYNC_HISTORY];
+    f->samples_before = fed_samples;
+    f->timestamp = get32(&packet[4]);
+    f->sample_rate = info.sample_rate;
+    fed_samples += info.samples;
+}
+
+boolean rtp_sync_adjust(uint32_t sample_counter, int32_t *ppm)
+{
+    if (!enabled || !locked() || restart_pending || (0==history_count)) {
+        return false;
+    }
+    // the newest frame that started at or before the counter
+    uint32_t n = (history_count < RTP_SYNC_HISTORY) ? history_count : RTP_SYNC_HISTORY;
+    fed_frame *f = NULL;
+    for (uint32_t i = 0; i < n; i++) {
+        fed_frame *h = &history[(history_count - 1 - i) % RTP_SYNC_HISTORY];
+        if (h->samples_before <= sample_counter) {
+            f = h;
+            break;
+        }
+    }
+    if (NULL==f) {
+        return false;   // further back than we remember
+    }
+    uint32_t heard = f->timestamp + (uint32_t) (((uint64_t)
+        (sample_counter - f->samples_before) * RTP_CLOCK_RATE) / f->sample_rate);
+
+    // + we're behind and need to go faster
+    int32_t error = rtp_sync_clock() - heard_at(heard);
+    if ((error < (RTP_SYNC_TRIM_MS * 1000)) && (error > -(RTP_SYNC_TRIM_MS * 1000))) {
+        integral_ppm += error / 500;    // only near, big steps are trimmed
+        if (integral_ppm > (RTP_SYNC_MAX_PPM / 2)) {
+            integral_ppm = RTP_SYNC_MAX_PPM / 2;
+        } else if (integral_ppm < -(RTP_SYNC_MAX_PPM / 2)) {
+            integral_ppm = -(RTP_SYNC_MAX_PPM / 2);
+        }
+    }
+    int32_t tune = (error / 5) + integral_ppm;
+    if (tune > RTP_SYNC_MAX_PPM) {
+        tune = RTP_SYNC_MAX_PPM;
+    } else if (tune < -RTP_SYNC_MAX_PPM) {
+        tune = -RTP_SYNC_MAX_PPM;
+    }
+    *ppm = tune;
+
+    stats_error_us = error;
+    stats_ppm = tune;
+    if (abs(error) > abs(stats_worst_us)) {
+        stats_worst_us = error;
+    }
+    return true;
+}
+
+void rtp_sync_printStats()
+{
+    if (!enabled) {
+        return;
+    }
+    Serial.printf("RTP sync %s, requests %u, replies %u, reports %u, "
+        "round trip %d us\n", locked() ? "locked" : "not locked",
+        stats_requests, stats_replies, stats_reports, (int32_t) stats_round_trip);
+    Serial.printf("RTP sync error %d us (worst %d), rate %d ppm, trimmed %u\n",
+        stats_error_us, stats_worst_us, stats_ppm, stats_trimmed);
+    stats_worst_us = 0;
+}
+
+//
+// END OF rtp_sync.cpp
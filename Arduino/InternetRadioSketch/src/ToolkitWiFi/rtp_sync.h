@@ -0,0 +1,97 @@
+//
+// rtp_sync.h
+
+//
+// Synchronised playback for the multicast listeners.
+//
+// Each listener used to play as soon as its own buffer was ready, so
+// boxes in different rooms drifted seconds apart. Now they all play
+// each frame at the same moment on the sender's clock:
+//
+// - The sender (rtp_output) is the time master. Once a second it sends
+//   an RTCP sender report to port + 1, which says when a given RTP
+//   timestamp went out, on its clock.
+// - Each listener asks the master the time on port + 4, like PTP's
+//   delay request: t1 we ask, t2 it hears, t3 it answers, t4 we hear.
+//   Of the last RTP_SYNC_SAMPLES answers the quickest round trip gives
+//   the best offset, the slow ones waited in a queue somewhere. The
+//   listener waits for the answer (up to RTP_SYNC_REPLY_MS) so its
+//   own loop doesn't add to it.
+// - A frame is heard listen_rtp_delay_ms after the master sent it.
+//   It goes to the VS1063a RTP_SYNC_LEAD_MS before that (the first one
+//   after a restart right on time, it starts playing at once), and if it is
+//   more than RTP_SYNC_TRIM_MS late it is trimmed from the jitter
+//   buffer instead. Until the first one, anything more than
+//   RTP_SYNC_START_MS late is trimmed.
+// - The VS1063a's sample counter says what is being heard right now.
+//   The difference from where we should be turns its playback rate up
+//   or down a few hundred ppm (rateTune), which takes out the drift
+//   between the crystals without anyone hearing it.
+//
+//  listen_rtp_sync         = 1 to play in sync, 0 as it comes
+//  listen_rtp_delay_ms     = 500, the same on every box
+//
+
+#ifndef _RTP_SYNC_H_
+#define _RTP_SYNC_H_
+
+#include <Arduino.h>
+
+enum {
+    RTP_PAYLOAD_SR          = 200,      // RTCP sender report
+    RTP_SR_SIZE             = 28,
+    RTP_RTCP_PORT_OFFSET    = 1,
+    RTP_SYNC_PORT_OFFSET    = 4,
+    RTP_SYNC_PACKET_SIZE    = 32,
+    RTP_SR_INTERVAL_MS      = 1000,
+    RTP_SYNC_POLL_MS        = 250,      // to twice that
+    RTP_SYNC_REPLY_MS       = 20,       // the most we wait for one
+    RTP_SYNC_SAMPLES        = 8,
+    RTP_SYNC_LOCK_MS        = 3000,     // play unsynced if no master by then
+    RTP_SYNC_DELAY_MS       = 500,
+    RTP_SYNC_MAX_DELAY_MS   = 600,      // has to fit in the jitter buffer
+    RTP_SYNC_LEAD_MS        = 30,       // less than the VS1063a holds
+    RTP_SYNC_TRIM_MS        = 50,
+    RTP_SYNC_START_MS       = 5,
+    RTP_SYNC_ADJUST_MS      = 100,
+    RTP_SYNC_MAX_PPM        = 1000,
+    RTP_SYNC_HISTORY        = 32        // frames fed, ~0.8s
+};
+
+// rtp_sync_check() answers
+enum {
+    RTP_SYNC_WAIT,
+    RTP_SYNC_PLAY,
+    RTP_SYNC_SKIP
+};
+
+// the master's clock, and the listeners' .. microseconds since boot
+int64_t rtp_sync_clock();
+
+// master .. answer the time requests waiting on server_fd
+void rtp_sync_serve(int server_fd);
+
+// listener .. false if listen_rtp_sync = 0
+boolean rtp_sync_begin(uint16_t port);
+void rtp_sync_setMaster(uint32_t ip);       // where the RTP comes from
+void rtp_sync_takeReport(const uint8_t *data, size_t length);
+void rtp_sync_run();                        // ask the master the time
+
+// what to do with the packet at the head of the jitter buffer
+uint32_t rtp_sync_check(uint32_t timestamp);
+
+// a packet went to the decoder, and the decoder was (re)started
+void rtp_sync_fed(const uint8_t *packet, size_t length);
+void rtp_sync_restart();
+boolean rtp_sync_restarted();       // once .. clear the sample counter
+
+// the VS1063a's sample counter in, its rateTune out .. false if we
+// don't know enough yet
+boolean rtp_sync_adjust(uint32_t sample_counter, int32_t *ppm);
+
+void rtp_sync_printStats();
+
+#endif
+
+//
+// END OF rtp_sync.h
@@ -0,0 +1,581 @@
+//
+// rtp_uplink.cpp
+
+#include "rtp_uplink.h"
+#include "mp3_frame.h"
+#include "rtp_output.h"
+#include "rtp_fec.h"
+#include "rtp_sync.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+#include "lwip/dns.h"
+#include "lwip/tcpip.h"
+
+static int fd = -1;
+static struct sockaddr_in receiver;
+static boolean have_receiver = false;
+
+// remote_rtp_host is looked up in the background
+static const char *host = NULL;
+static volatile boolean dns_done = false;
+static volatile uint32_t dns_ip = 0;
+static portMUX_TYPE dns_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t dns_asked_at = 0;
+static boolean dns_asked = false;
+
+// the packets we've sent, for NACKs .. slot = sequence % history_size
+typedef struct {
+    uint16_t sequence;
+    uint16_t length;            // 0 if the slot is empty
+    uint32_t sent_ms;
+    uint32_t resent_ms;
+    boolean resent;
+} sent_packet;
+static sent_packet *history = NULL;
+static uint8_t *history_data = NULL;
+static uint32_t history_size = 0;
+
+// the part of the ring we've read, a frame at a time
+static const size_t STAGING_SIZE = 8192;
+static uint8_t staging[STAGING_SIZE];
+static size_t staged_start = 0;
+static size_t staged_end = 0;
+
+static uint8_t rtcp[RTP_UPLINK_RTCP_SIZE];
+
+// RTP header fields
+static uint16_t sequence = 0;
+static uint32_t ssrc = 0;
+static boolean marker = true;
+static uint32_t base_ts = 0;        // the timestamp at the last rate change
+static uint64_t samples = 0;        // since then
+static uint32_t sample_rate = 0;
+static uint32_t last_ts = 0;
+static uint32_t last_report = 0;
+
+// our place in the encoder ring .. cursor is the buffer, offset how
+// much of it we've read
+static uint32_t (*ring_head)() = NULL;
+static uint32_t (*ring_oldest)() = NULL;
+static uint8_t *(*ring_get)(uint32_t, size_t*) = NULL;
+static uint8_t *(*ring_filling)(uint32_t*, size_t*) = NULL;
+static boolean have_cursor = false;
+static uint32_t cursor = 0;
+static size_t offset = 0;
+static size_t ring_buffer_size = 0;
+
+// stats
+static uint32_t stats_frames = 0;
+static uint32_t stats_packets = 0;
+static uint32_t stats_bytes = 0;
+static uint32_t stats_send_errors = 0;
+static uint32_t stats_lost = 0;         // ring buffers we were too late for
+static uint32_t stats_skipped = 0;      // bytes that weren't frames
+static uint32_t stats_nacks = 0;        // RTCP NACK packets
+static uint32_t stats_requested = 0;    // sequence numbers in them
+static uint32_t stats_resent = 0;
+static uint32_t stats_too_old = 0;      // not in the history any more
+static uint32_t stats_too_soon = 0;     // sent again very recently
+static uint32_t stats_repair_total_ms = 0;
+static uint32_t stats_repair_max_ms = 0;
+static uint32_t stats_reports = 0;      // receiver reports
+static uint32_t stats_rtt_ms = 0;       // the last one
+static uint32_t stats_rtt_min_ms = 0xffffffff;
+static uint32_t stats_rtt_average_ms = 0;
+static uint32_t stats_jitter_ms = 0;
+static uint32_t stats_fraction_lost = 0;    // of 256, after repair
+static int32_t stats_cumulative_lost = 0;
+static uint32_t stats_behind_ms = 0;    // how far behind the encoder we were
+static uint32_t stats_behind_max_ms = 0;
+
+// called by lwip from its own task
+static void dns_found(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+    portENTER_CRITICAL(&dns_lock);
+    dns_ip = ipaddr ? ip_2_ip4(ipaddr)->addr : 0;
+    dns_done = true;
+    portEXIT_CRITICAL(&dns_lock);
+}
+
+boolean rtp_uplink_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*),
+    uint8_t *(*filling)(uint32_t*, size_t*))
+{
+    if ((fd >= 0) || (0==SettingItem::findUInt("remote_rtp", 0))) {
+        return (fd >= 0);
+    }
+    host = SettingItem::findString("remote_rtp_host");
+    if ((NULL==host) || (0==host[0])) {
+        Serial.println("RTP uplink has no remote_rtp_host.");
+        return false;
+    }
+    memset(&receiver, 0, sizeof(receiver));
+    receiver.sin_family = AF_INET;
+    receiver.sin_port = htons(SettingItem::findUInt("remote_rtp_port", 5004));
+
+    history_size = psramFound() ? RTP_UPLINK_HISTORY : RTP_UPLINK_HISTORY_RAM;
+    size_t size = history_size * RTP_PACKET_SIZE;
+    history = (sent_packet *) malloc(history_size * sizeof(sent_packet));
+    history_data = (uint8_t *) (psramFound() ? ps_malloc(size) : malloc(size));
+    if ((NULL==history) || (NULL==history_data)) {
+        Serial.println("No room for the RTP uplink history.");
+        free(history);
+        free(history_data);
+        history = NULL;
+        history_data = NULL;
+        return false;
+    }
+    memset(history, 0, history_size * sizeof(sent_packet));
+
+    fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0) {
+        Serial.println("RTP uplink has no socket.");
+        return false;
+    }
+    // an ephemeral port, the receiver answers wherever we came from
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    bind(fd, (struct sockaddr *) &local, sizeof(local));
+
+    ring_head = head;
+    ring_oldest = oldest;
+    ring_get = get;
+    ring_filling = filling;
+    ssrc = esp_random();
+    sequence = esp_random();    // random start, RFC 3550 5.1
+    base_ts = esp_random();
+    Serial.printf("RTP uplink to %s port %u, %u packets kept for NACKs\n",
+        host, ntohs(receiver.sin_port), history_size);
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// The receiver's address
+//
+
+static boolean find_receiver()
+{
+    if (have_receiver) {
+        return true;
+    }
+    portENTER_CRITICAL(&dns_lock);
+    boolean done = dns_done;
+    uint32_t found = dns_ip;
+    portEXIT_CRITICAL(&dns_lock);
+    if (!dns_asked || (done && (0==found) &&
+            ((millis() - dns_asked_at) > RTP_UPLINK_DNS_MS))) {
+        dns_asked = true;
+        dns_asked_at = millis();
+        done = false;
+        found = 0;
+        portENTER_CRITICAL(&dns_lock);
+        dns_done = false;
+        portEXIT_CRITICAL(&dns_lock);
+        // lwip's DNS belongs to the tcpip task
+        ip_addr_t addr;
+        LOCK_TCPIP_CORE();
+        err_t err = dns_gethostbyname(host, &addr, dns_found, NULL);
+        UNLOCK_TCPIP_CORE();
+        if (ERR_OK==err) {          // cached, or a number
+            done = true;
+            found = ip_2_ip4(&addr)->addr;
+        } else if (ERR_INPROGRESS!=err) {
+            done = true;
+        }
+        if (done) {
+            portENTER_CRITICAL(&dns_lock);
+            dns_ip = found;
+            dns_done = true;
+            portEXIT_CRITICAL(&dns_lock);
+        }
+    }
+    if (done && found) {
+        receiver.sin_addr.s_addr = found;
+        have_receiver = true;
+        Serial.printf("RTP uplink sending to %s\n", inet_ntoa(receiver.sin_addr));
+    }
+    return have_receiver;
+}
+
+//------------------------------------------------------------------
+//
+// Sending
+//
+
+static void send_packet(const uint8_t *data, size_t length)
+{
+    int sent = sendto(fd, data, length, MSG_DONTWAIT,
+        (struct sockaddr *) &receiver, sizeof(receiver));
+    if (sent < 0) {
+        stats_send_errors++;    // no WiFi, or lwip is out of buffers
+    } else {
+        stats_packets++;
+        stats_bytes += sent;
+    }
+}
+
+static void put32(uint8_t *p, uint32_t value)
+{
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) |
+        ((uint32_t) p[2] << 8) | p[3];
+}
+
+// one frame, in as many packets as it takes, each kept in the history
+static void send_frame(const uint8_t *frame, size_t length, uint32_t timestamp)
+{
+    uint32_t now = millis();
+    uint32_t done = 0;
+    while (done < length) {
+        size_t chunk = length - done;
+        if (chunk > RTP_MAX_PAYLOAD) {
+            chunk = RTP_MAX_PAYLOAD;
+        }
+        uint32_t slot = sequence % history_size;
+        uint8_t *p = &history_data[slot * RTP_PACKET_SIZE];
+        p[0] = 0x80;                            // version 2
+        p[1] = (marker ? 0x80 : 0) | RTP_PAYLOAD_MPA;
+        p[2] = sequence >> 8;
+        p[3] = sequence;
+        put32(&p[4], timestamp);
+        put32(&p[8], ssrc);
+        p[12] = 0;                              // MBZ
+        p[13] = 0;
+        p[14] = done >> 8;                      // Frag_offset
+        p[15] = done;
+        memcpy(&p[RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE], &frame[done], chunk);
+        size_t size = RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE + chunk;
+        history[slot].sequence = sequence;
+        history[slot].length = size;
+        history[slot].sent_ms = now;
+        history[slot].resent = false;
+        send_packet(p, size);
+        sequence++;
+        marker = false;
+        done += chunk;
+    }
+    stats_frames++;
+}
+
+// NTP time from our own clock .. the receiver only hands it back to us
+static void ntp_now(uint32_t *seconds, uint32_t *fraction)
+{
+    uint64_t us = esp_timer_get_time();
+    *seconds = us / 1000000;
+    *fraction = ((us % 1000000) << 32) / 1000000;
+}
+
+// sender report and CNAME, one compound packet
+static void send_report()
+{
+    uint32_t seconds;
+    uint32_t fraction;
+    ntp_now(&seconds, &fraction);
+    uint8_t *p = rtcp;
+    *p++ = 0x80;                                // version 2, no blocks
+    *p++ = RTP_PAYLOAD_SR;
+    *p++ = 0;
+    *p++ = (RTP_SR_SIZE / 4) - 1;               // length in words - 1
+    uint32_t words[6] = {
+        ssrc, seconds, fraction, last_ts, stats_packets, stats_bytes
+    };
+    for (uint32_t i = 0; i < 6; i++) {
+        put32(p, words[i]);
+        p += 4;
+    }
+
+    const char cname[] = "toolkit";
+    uint8_t *sdes = p;
+    *p++ = 0x81;                                // one chunk
+    *p++ = RTP_PAYLOAD_SDES;
+    p += 2;                                     // the length, below
+    put32(p, ssrc);
+    p += 4;
+    *p++ = 1;                                   // CNAME
+    *p++ = sizeof(cname) - 1;
+    memcpy(p, cname, sizeof(cname) - 1);
+    p += sizeof(cname) - 1;
+    *p++ = 0;                                   // the end of the items
+    while ((p - sdes) % 4) {
+        *p++ = 0;
+    }
+    uint32_t words_less_one = ((p - sdes) / 4) - 1;
+    sdes[2] = words_less_one >> 8;
+    sdes[3] = words_less_one;
+
+    sendto(fd, rtcp, p - rtcp, MSG_DONTWAIT,
+        (struct sockaddr *) &receiver, sizeof(receiver));
+    last_report = millis();
+}
+
+//------------------------------------------------------------------
+//
+// RTCP from the receiver
+//
+
+static void resend(uint16_t number)
+{
+    stats_requested++;
+    sent_packet *sent = &history[number % history_size];
+    if ((0==sent->length) || (sent->sequence != number)) {
+        stats_too_old++;
+        return;
+    }
+    uint32_t now = millis();
+    if (sent->resent && ((now - sent->resent_ms) < RTP_UPLINK_RESEND_MS)) {
+        stats_too_soon++;   // the NACK crossed the last resend
+        return;
+    }
+    sent->resent_ms = now;
+    sent->resent = true;
+    send_packet(&history_data[(number % history_size) * RTP_PACKET_SIZE],
+        sent->length);
+    stats_resent++;
+    uint32_t repair = now - sent->sent_ms;
+    stats_repair_total_ms += repair;
+    if (repair > stats_repair_max_ms) {
+        stats_repair_max_ms = repair;
+    }
+}
+
+// RFC 4585 6.2.1 .. each FCI is a lost packet and a bitmask of the 16
+// after it that are lost too
+static void handle_nack(const uint8_t *p, size_t length)
+{
+    if ((length < 12) || (get32(&p[8]) != ssrc)) {
+        return;
+    }
+    stats_nacks++;
+    for (size_t i = 12; (i + 4) <= length; i += 4) {
+        uint16_t pid = (p[i] << 8) | p[i + 1];
+        uint16_t blp = (p[i + 2] << 8) | p[i + 3];
+        resend(pid);
+        for (uint32_t b = 0; b < 16; b++) {
+            if (blp & (1 << b)) {
+                resend(pid + b + 1);
+            }
+        }
+    }
+}
+
+// the round trip from the receiver's LSR and DLSR (RFC 3550 6.4.1)
+static void handle_report(const uint8_t *p, size_t length)
+{
+    uint32_t blocks = p[0] & 0x1f;
+    for (uint32_t b = 0; b < blocks; b++) {
+        const uint8_t *block = &p[8 + (b * 24)];
+        if (((size_t) (block + 24 - p) > length) || (get32(block) != ssrc)) {
+            continue;
+        }
+        stats_reports++;
+        stats_fraction_lost = block[4];
+        int32_t lost = ((uint32_t) block[5] << 16) | (block[6] << 8) | block[7];
+        stats_cumulative_lost = (lost & 0x800000) ? (lost - 0x1000000) : lost;
+        stats_jitter_ms = get32(&block[12]) / (RTP_CLOCK_RATE / 1000);
+        uint32_t lsr = get32(&block[16]);
+        uint32_t dlsr = get32(&block[20]);
+        if (0==lsr) {
+            continue;       // no sender report yet
+        }
+        uint32_t seconds;
+        uint32_t fraction;
+        ntp_now(&seconds, &fraction);
+        uint32_t now = (seconds << 16) | (fraction >> 16);
+        uint32_t rtt = ((uint64_t) (now - lsr - dlsr) * 1000) >> 16;
+        stats_rtt_ms = rtt;
+        if (rtt < stats_rtt_min_ms) {
+            stats_rtt_min_ms = rtt;
+        }
+        stats_rtt_average_ms = stats_rtt_average_ms ?
+            ((stats_rtt_average_ms * 7) + rtt) / 8 : rtt;
+    }
+}
+
+static void read_rtcp()
+{
+    while (true) {
+        int got = recv(fd, rtcp, sizeof(rtcp), MSG_DONTWAIT);
+        if (got <= 0) {
+            return;
+        }
+        // a compound packet, walk each one in it
+        const uint8_t *p = rtcp;
+        size_t left = got;
+        while (left >= 8) {
+            size_t length = (((p[2] << 8) | p[3]) + 1) * 4;
+            if (((p[0] & 0xc0) != 0x80) || (length > left)) {
+                break;
+            }
+            if ((RTP_PAYLOAD_RTPFB==p[1]) && (RTP_FMT_NACK==(p[0] & 0x1f))) {
+                handle_nack(p, length);
+            } else if (RTP_PAYLOAD_RR==p[1]) {
+                handle_report(p, length);
+            }
+            p += length;
+            left -= length;
+        }
+    }
+}
+
+//------------------------------------------------------------------
+//
+// Frames
+//
+
+// send every whole frame we have, straight away
+static void send_frames(size_t behind)
+{
+    mp3_frame_info info;
+    while ((staged_start + MP3_HEADER_SIZE) <= staged_end) {
+        uint8_t *p = &staging[staged_start];
+        size_t available = staged_end - staged_start;
+        if (!mp3_frame_parse(p, &info)) {
+            // lost sync, skip to the next frame header
+            size_t skip = mp3_frame_find(p, available);
+            skip = skip ? skip : 1;
+            staged_start += skip;
+            stats_skipped += skip;
+            continue;
+        }
+        if (info.length > available) {
+            break;  // the rest of it hasn't been encoded yet
+        }
+        if (info.sample_rate != sample_rate) {
+            if (sample_rate) {
+                base_ts += (samples * RTP_CLOCK_RATE) / sample_rate;
+            }
+            samples = 0;
+            sample_rate = info.sample_rate;
+            marker = true;
+        }
+        last_ts = base_ts + (uint32_t) ((samples * RTP_CLOCK_RATE) / sample_rate);
+        // what's already been encoded after this frame is how late it is
+        stats_behind_ms = ((behind + available - info.length) * 8) / info.bitrate;
+        if (stats_behind_ms > stats_behind_max_ms) {
+            stats_behind_max_ms = stats_behind_ms;
+        }
+        send_frame(p, info.length, last_ts);
+        samples += info.samples;
+        staged_start += info.length;
+    }
+}
+
+// the next part of the ring .. a full buffer, or as much of the one
+// being filled as there is
+static uint8_t *next_part(size_t *length, boolean *full)
+{
+    uint8_t *data = ring_get(cursor, length);
+    if (data) {
+        *full = true;
+        ring_buffer_size = *length;
+        return data;
+    }
+    uint32_t filling;
+    data = ring_filling(&filling, length);
+    *full = false;
+    return (filling == cursor) ? data : NULL;
+}
+
+void rtp_uplink_run()
+{
+    if ((fd < 0) || (NULL==ring_get) || !find_receiver()) {
+        return;
+    }
+    read_rtcp();
+
+    uint32_t head = ring_head();
+    if (!have_cursor) {
+        // start at the live edge, the part frame there is skipped
+        size_t length;
+        boolean full;
+        cursor = head;
+        offset = next_part(&length, &full) ? length : 0;
+        have_cursor = true;
+    }
+    uint32_t oldest = ring_oldest();
+    if (cursor < oldest) {
+        // too far behind to matter live, go back to the edge
+        stats_lost += head - cursor;
+        cursor = head;
+        offset = 0;
+        staged_start = staged_end = 0;
+        marker = true;
+    }
+
+    // top up the staging buffer
+    while ((staged_end - staged_start) < MP3_MAX_FRAME_SIZE) {
+        size_t length;
+        boolean full;
+        uint8_t *data = next_part(&length, &full);
+        if ((NULL==data) || (offset > length)) {
+            break;  // overwritten, or the head moved on, catch it next time
+        }
+        if (staged_start) {
+            memmove(staging, &staging[staged_start], staged_end - staged_start);
+            staged_end -= staged_start;
+            staged_start = 0;
+        }
+        size_t part = length - offset;
+        if (part > (STAGING_SIZE - staged_end)) {
+            part = STAGING_SIZE - staged_end;
+        }
+        memcpy(&staging[staged_end], &data[offset], part);
+        staged_end += part;
+        offset += part;
+        if (full && (offset == length)) {
+            cursor++;
+            offset = 0;
+        } else {
+            break;  // the head, or no more room
+        }
+    }
+    // the whole ring buffers we haven't read yet
+    head = ring_head();
+    size_t behind = (cursor < head) ? ((head - cursor) * ring_buffer_size) : 0;
+    send_frames(behind);
+
+    if ((millis() - last_report) >= RTP_SR_INTERVAL_MS) {
+        send_report();
+    }
+}
+
+void rtp_uplink_printStats()
+{
+    if (fd < 0) {
+        return;
+    }
+    Serial.printf("RTP uplink frames %u, packets %u, bytes %u, "
+        "send errors %u, lost %u ring buffers, skipped %u bytes\n",
+        stats_frames, stats_packets, stats_bytes, stats_send_errors,
+        stats_lost, stats_skipped);
+    uint32_t repaired = stats_resent ? (stats_repair_total_ms / stats_resent) : 0;
+    Serial.printf("RTP uplink NACKs %u for %u packets, resent %u "
+        "(%u%%), %u too old, %u too soon, repair %u ms average, %u ms max\n",
+        stats_nacks, stats_requested, stats_resent,
+        stats_requested ? ((stats_resent * 100) / stats_requested) : 0,
+        stats_too_old, stats_too_soon, repaired, stats_repair_max_ms);
+    Serial.printf("RTP uplink %u reports, rtt %u ms (min %u, average %u), "
+        "jitter %u ms, lost after repair %u%% (%d packets)\n",
+        stats_reports, stats_rtt_ms,
+        (0xffffffff==stats_rtt_min_ms) ? 0 : stats_rtt_min_ms,
+        stats_rtt_average_ms, stats_jitter_ms,
+        (stats_fraction_lost * 100) / 256, stats_cumulative_lost);
+    Serial.printf("RTP uplink latency ~%u ms (%u ms behind the encoder, "
+        "max %u, plus half the round trip)\n",
+        stats_behind_ms + (stats_rtt_average_ms / 2), stats_behind_ms,
+        stats_behind_max_ms);
+}
+
+//
+// END OF rtp_uplink.cpp
@@ -0,0 +1,66 @@
+//
+// rtp_uplink.h
+
+//
+// RTP contribution uplink, for live two-way programmes.
+//
+// The icecast PUT is TCP, so one lost segment holds up everything
+// behind it and the server buffers seconds more. This sends the mp3
+// frames to one receiver (the studio) as RTP over UDP instead, in the
+// same RFC 2250 packets as rtp_output.h, as soon as each frame is
+// encoded .. it reads the ring buffer that is still being filled
+// (Streamer::getFillingBuffer) rather than waiting for a whole 4KB.
+//
+// The last RTP_UPLINK_HISTORY packets are kept. The receiver asks for
+// the ones it missed with RTCP generic NACKs (RFC 4585 6.2.1, PT 205
+// FMT 1) and they are sent again as they were, same sequence number,
+// so a loss is repaired one round trip later if the receiver's jitter
+// buffer is longer than that. RTCP shares the RTP port (RFC 5761) so
+// it comes back through the same NAT mapping.
+//
+// We send a sender report every second, and the receiver reports
+// (PT 201) that come back give the round trip time (LSR and DLSR) and
+// the loss left after repair. The stats give those, how many NACKed
+// packets were sent again or were too old, and the one way latency
+// estimate .. how long a frame waited here plus half the round trip
+// (the receiver's jitter buffer comes on top).
+//
+//  remote_rtp          = 1 to turn it on (in transmitter or relay mode)
+//  remote_rtp_host     = the receiver, a name or an IP address
+//  remote_rtp_port     = 5004 (RTP and RTCP)
+//
+// rtp_uplink_run() is called from the stream task.
+//
+
+#ifndef _RTP_UPLINK_H_
+#define _RTP_UPLINK_H_
+
+#include <Arduino.h>
+
+enum {
+    RTP_PAYLOAD_RR          = 201,      // RTCP receiver report
+    RTP_PAYLOAD_SDES        = 202,
+    RTP_PAYLOAD_RTPFB       = 205,      // RFC 4585 transport feedback
+    RTP_FMT_NACK            = 1,
+    RTP_UPLINK_HISTORY      = 64,       // ~1.7s of frames, in PSRAM
+    RTP_UPLINK_HISTORY_RAM  = 16,       // without PSRAM
+    RTP_UPLINK_RESEND_MS    = 20,       // the least between two resends
+    RTP_UPLINK_DNS_MS       = 10000,
+    RTP_UPLINK_RTCP_SIZE    = 512
+};
+
+// reads the settings, looks up remote_rtp_host and opens the socket,
+// false if it's off
+boolean rtp_uplink_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*),
+    uint8_t *(*filling)(uint32_t*, size_t*));
+
+// from the stream task .. answer NACKs, send the new frames
+void rtp_uplink_run();
+
+void rtp_uplink_printStats();
+
+#endif
+
+//
+// END OF rtp_uplink.h
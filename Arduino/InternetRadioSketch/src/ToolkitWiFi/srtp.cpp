@@ -0,0 +1,122 @@
+//
+// srtp.cpp
+
+#include "srtp.h"
+
+enum {
+    LABEL_CIPHER_KEY    = 0,
+    LABEL_AUTH_KEY      = 1,
+    LABEL_SALT          = 2
+};
+
+// AES-CM from iv, length bytes of keystream (or keystream XOR data)
+static void aes_cm(mbedtls_aes_context *aes, const uint8_t *iv,
+    uint8_t *data, size_t length)
+{
+    uint8_t counter[16];
+    uint8_t block[16];
+    size_t offset = 0;
+    memcpy(counter, iv, sizeof(counter));
+    mbedtls_aes_crypt_ctr(aes, length, &offset, counter, block, data, data);
+}
+
+// RFC 3711 4.3.1, the key derivation rate is 0 so r is always 0
+static void derive(mbedtls_aes_context *master, const uint8_t *master_salt,
+    uint8_t label, uint8_t *out, size_t length)
+{
+    uint8_t iv[16];
+    memset(iv, 0, sizeof(iv));
+    memcpy(iv, master_salt, SRTP_MASTER_SALT_SIZE);
+    iv[7] ^= label;
+    memset(out, 0, length);
+    aes_cm(master, iv, out, length);
+}
+
+boolean srtp_begin(srtp_context *srtp, const uint8_t *master_key,
+    const uint8_t *master_salt)
+{
+    mbedtls_aes_context master;
+    mbedtls_aes_init(&master);
+    mbedtls_aes_setkey_enc(&master, master_key, 128);
+    uint8_t key[SRTP_MASTER_KEY_SIZE];
+    uint8_t auth[SRTP_AUTH_KEY_SIZE];
+    derive(&master, master_salt, LABEL_CIPHER_KEY, key, sizeof(key));
+    derive(&master, master_salt, LABEL_AUTH_KEY, auth, sizeof(auth));
+    derive(&master, master_salt, LABEL_SALT, srtp->salt, sizeof(srtp->salt));
+    mbedtls_aes_free(&master);
+
+    mbedtls_aes_init(&srtp->aes);
+    mbedtls_aes_setkey_enc(&srtp->aes, key, 128);
+    mbedtls_md_init(&srtp->hmac);
+    if (0 != mbedtls_md_setup(&srtp->hmac,
+            mbedtls_md_info_from_type(MBEDTLS_MD_SHA1), 1)) {
+        mbedtls_aes_free(&srtp->aes);
+        return false;
+    }
+    mbedtls_md_hmac_starts(&srtp->hmac, auth, sizeof(auth));
+    memset(key, 0, sizeof(key));
+    memset(auth, 0, sizeof(auth));
+    srtp->roc = 0;
+    srtp->last_sequence = 0;
+    srtp->started = false;
+    return true;
+}
+
+size_t srtp_protect(srtp_context *srtp, uint8_t *packet, size_t length)
+{
+    size_t header = 12 + ((packet[0] & 0x0f) * 4);     // and the CSRCs
+    if (packet[0] & 0x10) {
+        // the extension's length is in its own 4 byte header
+        if ((header + 4) > length) {
+            return 0;
+        }
+        header += 4 + (((packet[header + 2] << 8) | packet[header + 3]) * 4);
+    }
+    if (header > length) {
+        return 0;
+    }
+    uint16_t sequence = (packet[2] << 8) | packet[3];
+    if (srtp->started && (sequence < srtp->last_sequence) &&
+            ((srtp->last_sequence - sequence) > 0x8000)) {
+        srtp->roc++;    // the sequence number wrapped
+    }
+    srtp->last_sequence = sequence;
+    srtp->started = true;
+
+    // IV = salt * 2^16 XOR SSRC * 2^64 XOR index * 2^16
+    uint8_t iv[16];
+    memset(iv, 0, sizeof(iv));
+    memcpy(iv, srtp->salt, SRTP_MASTER_SALT_SIZE);
+    for (uint32_t i = 0; i < 4; i++) {
+        iv[4 + i] ^= packet[8 + i];
+    }
+    iv[8] ^= srtp->roc >> 24;
+    iv[9] ^= srtp->roc >> 16;
+    iv[10] ^= srtp->roc >> 8;
+    iv[11] ^= srtp->roc;
+    iv[12] ^= sequence >> 8;
+    iv[13] ^= sequence;
+    aes_cm(&srtp->aes, iv, &packet[header], length - header);
+
+    // the tag covers the packet and the rollover counter
+    uint8_t roc[4] = {
+        (uint8_t) (srtp->roc >> 24), (uint8_t) (srtp->roc >> 16),
+        (uint8_t) (srtp->roc >> 8), (uint8_t) srtp->roc
+    };
+    uint8_t tag[20];
+    mbedtls_md_hmac_reset(&srtp->hmac);
+    mbedtls_md_hmac_update(&srtp->hmac, packet, length);
+    mbedtls_md_hmac_update(&srtp->hmac, roc, sizeof(roc));
+    mbedtls_md_hmac_finish(&srtp->hmac, tag);
+    memcpy(&packet[length], tag, SRTP_AUTH_TAG_SIZE);
+    return length + SRTP_AUTH_TAG_SIZE;
+}
+
+void srtp_end(srtp_context *srtp)
+{
+    mbedtls_aes_free(&srtp->aes);
+    mbedtls_md_free(&srtp->hmac);
+}
+
+//
+// END OF srtp.cpp
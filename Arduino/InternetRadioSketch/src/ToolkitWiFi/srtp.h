@@ -0,0 +1,55 @@
+//
+// srtp.h
+
+//
+// SRTP (RFC 3711) for sending, AES_CM_128_HMAC_SHA1_80 only.
+//
+// The session keys are derived from the master key and salt once, in
+// srtp_begin(). Each packet's payload is then encrypted with AES in
+// counter mode (the IV from the salt, the SSRC and the packet index)
+// and the header and payload are authenticated with HMAC-SHA1, the
+// first 10 bytes of it go on the end. The rollover counter is kept
+// here, from the sequence numbers going past.
+//
+// AES and HMAC come from the mbedtls in the ESP32 core, which uses
+// the hardware for both.
+//
+
+#ifndef _SRTP_H_
+#define _SRTP_H_
+
+#include <Arduino.h>
+#include "mbedtls/aes.h"
+#include "mbedtls/md.h"
+
+enum {
+    SRTP_MASTER_KEY_SIZE    = 16,
+    SRTP_MASTER_SALT_SIZE   = 14,
+    SRTP_AUTH_KEY_SIZE      = 20,
+    SRTP_AUTH_TAG_SIZE      = 10        // the _80 in the name
+};
+
+typedef struct {
+    mbedtls_aes_context aes;            // the session key
+    mbedtls_md_context_t hmac;          // the session auth key
+    uint8_t salt[SRTP_MASTER_SALT_SIZE];
+    uint32_t roc;                       // rollover counter
+    uint16_t last_sequence;
+    boolean started;
+} srtp_context;
+
+// derive the session keys, false if mbedtls has no memory
+boolean srtp_begin(srtp_context *srtp, const uint8_t *master_key,
+    const uint8_t *master_salt);
+
+// encrypt an RTP packet in place and add the tag .. there has to be
+// SRTP_AUTH_TAG_SIZE bytes of room after it. Returns the new length,
+// 0 if the RTP header runs past the end of the packet.
+size_t srtp_protect(srtp_context *srtp, uint8_t *packet, size_t length);
+
+void srtp_end(srtp_context *srtp);
+
+#endif
+
+//
+// END OF srtp.h
@@ -0,0 +1,200 @@
+//
+// stun.cpp
+
+#include "stun.h"
+#include "mbedtls/md.h"
+
+static uint16_t get16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static void put16(uint8_t *p, uint16_t value)
+{
+    p[0] = value >> 8;
+    p[1] = value;
+}
+
+static void put32(uint8_t *p, uint32_t value)
+{
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+boolean stun_isMessage(const uint8_t *message, size_t length)
+{
+    // the first byte is 0 to 3, RTP and RTCP start at 128
+    return (length >= STUN_HEADER_SIZE) && (message[0] < 4) &&
+        (STUN_MAGIC_COOKIE == (((uint32_t) message[4] << 24) |
+            ((uint32_t) message[5] << 16) | (message[6] << 8) | message[7])) &&
+        ((STUN_HEADER_SIZE + get16(&message[2])) <= length);
+}
+
+// the offset of the first attribute of this type, 0 if there isn't one
+static size_t find_attribute(const uint8_t *message, uint16_t type,
+    uint16_t *value_length)
+{
+    size_t end = STUN_HEADER_SIZE + get16(&message[2]);
+    size_t at = STUN_HEADER_SIZE;
+    while ((at + 4) <= end) {
+        uint16_t length = get16(&message[at + 2]);
+        if ((at + 4 + length) > end) {
+            break;
+        }
+        if (get16(&message[at]) == type) {
+            *value_length = length;
+            return at;
+        }
+        at += 4 + ((length + 3) & ~3);
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------
+//
+// MESSAGE-INTEGRITY and FINGERPRINT
+//
+
+// HMAC-SHA1 of the message up to at, with the length in the header
+// counting up to the end of a MESSAGE-INTEGRITY there
+static void integrity(uint8_t *message, size_t at, const char *password,
+    uint8_t *hmac)
+{
+    uint8_t saved[2] = { message[2], message[3] };
+    put16(&message[2], at + 4 + STUN_INTEGRITY_SIZE - STUN_HEADER_SIZE);
+    mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA1),
+        (const uint8_t *) password, strlen(password), message, at, hmac);
+    message[2] = saved[0];
+    message[3] = saved[1];
+}
+
+static boolean check_integrity(uint8_t *message, const char *password)
+{
+    uint16_t length;
+    size_t at = find_attribute(message, STUN_MESSAGE_INTEGRITY, &length);
+    if ((0==at) || (STUN_INTEGRITY_SIZE != length)) {
+        return false;
+    }
+    uint8_t hmac[STUN_INTEGRITY_SIZE];
+    integrity(message, at, password, hmac);
+    return (0==memcmp(hmac, &message[at + 4], STUN_INTEGRITY_SIZE));
+}
+
+static uint32_t crc32(const uint8_t *data, size_t length)
+{
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (uint32_t b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static size_t add_attribute(uint8_t *out, size_t at, uint16_t type,
+    const void *value, uint16_t length)
+{
+    put16(&out[at], type);
+    put16(&out[at + 2], length);
+    memcpy(&out[at + 4], value, length);
+    size_t padded = (length + 3) & ~3;
+    memset(&out[at + 4 + length], 0, padded - length);
+    return at + 4 + padded;
+}
+
+// MESSAGE-INTEGRITY, then FINGERPRINT, and the final length
+static size_t finish(uint8_t *out, size_t at, const char *password)
+{
+    uint8_t hmac[STUN_INTEGRITY_SIZE];
+    integrity(out, at, password, hmac);
+    at = add_attribute(out, at, STUN_MESSAGE_INTEGRITY, hmac, sizeof(hmac));
+    put16(&out[2], at + 8 - STUN_HEADER_SIZE);
+    uint8_t fingerprint[4];
+    put32(fingerprint, crc32(out, at) ^ 0x5354554e);
+    return add_attribute(out, at, STUN_FINGERPRINT, fingerprint, 4);
+}
+
+static void make_header(uint8_t *out, uint16_t type, const uint8_t *transaction)
+{
+    put16(&out[0], type);
+    put16(&out[2], 0);
+    put32(&out[4], STUN_MAGIC_COOKIE);
+    memcpy(&out[8], transaction, STUN_TRANSACTION_SIZE);
+}
+
+//------------------------------------------------------------------
+//
+// Checks
+//
+
+boolean stun_checkRequest(uint8_t *message, size_t length,
+    const char *ufrag, const char *password, boolean *use_candidate)
+{
+    if (!stun_isMessage(message, length) ||
+            (STUN_BINDING_REQUEST != get16(message))) {
+        return false;
+    }
+    uint16_t name_length;
+    size_t name = find_attribute(message, STUN_USERNAME, &name_length);
+    size_t ufrag_length = strlen(ufrag);
+    if ((0==name) || (name_length <= ufrag_length) ||
+            (0 != memcmp(&message[name + 4], ufrag, ufrag_length)) ||
+            (':' != message[name + 4 + ufrag_length])) {
+        return false;
+    }
+    if (!check_integrity(message, password)) {
+        return false;
+    }
+    uint16_t ignored;
+    *use_candidate = (0 != find_attribute(message, STUN_USE_CANDIDATE, &ignored));
+    return true;
+}
+
+size_t stun_makeResponse(const uint8_t *request, const struct sockaddr_in *from,
+    const char *password, uint8_t *out)
+{
+    make_header(out, STUN_BINDING_SUCCESS, &request[8]);
+    uint8_t mapped[8];
+    mapped[0] = 0;
+    mapped[1] = 0x01;                           // IPv4
+    put16(&mapped[2], ntohs(from->sin_port) ^ (STUN_MAGIC_COOKIE >> 16));
+    put32(&mapped[4], ntohl(from->sin_addr.s_addr) ^ STUN_MAGIC_COOKIE);
+    size_t at = add_attribute(out, STUN_HEADER_SIZE, STUN_XOR_MAPPED_ADDRESS,
+        mapped, sizeof(mapped));
+    return finish(out, at, password);
+}
+
+size_t stun_makeRequest(const char *username, const char *password,
+    uint32_t priority, uint64_t tie_breaker, uint8_t *transaction,
+    uint8_t *out)
+{
+    for (uint32_t i = 0; i < STUN_TRANSACTION_SIZE; i += 4) {
+        put32(&transaction[i], esp_random());
+    }
+    make_header(out, STUN_BINDING_REQUEST, transaction);
+    size_t at = add_attribute(out, STUN_HEADER_SIZE, STUN_USERNAME,
+        username, strlen(username));
+    uint8_t value[8];
+    put32(value, priority);
+    at = add_attribute(out, at, STUN_PRIORITY, value, 4);
+    put32(value, tie_breaker >> 32);
+    put32(&value[4], tie_breaker);
+    at = add_attribute(out, at, STUN_ICE_CONTROLLING, value, 8);
+    at = add_attribute(out, at, STUN_USE_CANDIDATE, "", 0);
+    return finish(out, at, password);
+}
+
+boolean stun_checkResponse(uint8_t *message, size_t length,
+    const uint8_t *transaction, const char *password)
+{
+    return stun_isMessage(message, length) &&
+        (STUN_BINDING_SUCCESS == get16(message)) &&
+        (0==memcmp(&message[8], transaction, STUN_TRANSACTION_SIZE)) &&
+        check_integrity(message, password);
+}
+
+//
+// END OF stun.cpp
@@ -0,0 +1,67 @@
+//
+// stun.h
+
+//
+// The STUN (RFC 5389) that ICE (RFC 8445) needs, for whip_output.
+//
+// ICE checks are STUN binding requests with short term credentials ..
+// USERNAME is "receiver's ufrag:sender's ufrag" and MESSAGE-INTEGRITY
+// is an HMAC-SHA1 keyed with the receiver's ice-pwd. Every message we
+// make ends with a FINGERPRINT (a CRC32) so it can't be mistaken for
+// RTP on the same port.
+//
+// An ICE-lite agent only answers checks. stun_makeRequest() is for
+// when the other end is ICE-lite too, and we have to ask.
+//
+
+#ifndef _STUN_H_
+#define _STUN_H_
+
+#include <Arduino.h>
+#include "lwip/sockets.h"
+
+enum {
+    STUN_HEADER_SIZE        = 20,
+    STUN_MAX_SIZE           = 548,
+    STUN_MAGIC_COOKIE       = 0x2112a442,
+    STUN_BINDING_REQUEST    = 0x0001,
+    STUN_BINDING_SUCCESS    = 0x0101,
+    STUN_USERNAME           = 0x0006,
+    STUN_MESSAGE_INTEGRITY  = 0x0008,
+    STUN_XOR_MAPPED_ADDRESS = 0x0020,
+    STUN_PRIORITY           = 0x0024,
+    STUN_USE_CANDIDATE      = 0x0025,
+    STUN_FINGERPRINT        = 0x8028,
+    STUN_ICE_CONTROLLING    = 0x802a,
+    STUN_INTEGRITY_SIZE     = 20,
+    STUN_TRANSACTION_SIZE   = 12
+};
+
+// a STUN message rather than RTP or RTCP (RFC 7983)
+boolean stun_isMessage(const uint8_t *message, size_t length);
+
+// a binding request for us .. USERNAME starts "ufrag:" and it was
+// signed with password. use_candidate is set if it nominates the pair.
+boolean stun_checkRequest(uint8_t *message, size_t length,
+    const char *ufrag, const char *password, boolean *use_candidate);
+
+// the success response to request, from is where it came from ..
+// returns the length made in out (STUN_MAX_SIZE)
+size_t stun_makeResponse(const uint8_t *request, const struct sockaddr_in *from,
+    const char *password, uint8_t *out);
+
+// a nominating binding request as the controlling agent, with a new
+// transaction ID (copied to transaction)
+size_t stun_makeRequest(const char *username, const char *password,
+    uint32_t priority, uint64_t tie_breaker, uint8_t *transaction,
+    uint8_t *out);
+
+// the success response to our request with this transaction ID, signed
+// with password
+boolean stun_checkResponse(uint8_t *message, size_t length,
+    const uint8_t *transaction, const char *password);
+
+#endif
+
+//
+// END OF stun.h
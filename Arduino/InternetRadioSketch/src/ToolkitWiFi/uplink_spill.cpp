@@ -0,0 +1,290 @@
+//
+// uplink_spill.cpp
+
+#include "uplink_spill.h"
+#include "../ToolkitFiles/ToolkitFiles.h"
+
+typedef struct {
+    uint32_t first;     // sequence of the first buffer in the file
+    uint32_t count;     // buffers written so far
+    uint16_t lengths[SPILL_SEGMENT_BLOCKS];
+} spill_segment;
+
+static spill_segment segments[SPILL_MAX_SEGMENTS];
+static uint32_t number_of_segments = 0;     // 0 when spilling is off
+static uint32_t tail = 0;       // the oldest segment in use
+static uint32_t used = 0;       // segments in use, the last one is open
+static File write_file;         // the newest segment
+static File read_file;          // a full segment being read back
+static uint32_t read_segment = SPILL_MAX_SEGMENTS;
+static uint32_t next_to_spill = 0;
+
+static uint32_t (*ring_head)() = NULL;
+static uint32_t (*ring_oldest)() = NULL;
+static uint8_t *(*ring_get)(uint32_t, size_t*) = NULL;
+
+// the writer and the uplink take turns, LittleFS would make them
+// anyway but this keeps the segment table in step with the files
+static SemaphoreHandle_t spill_lock = NULL;
+
+// stats
+static uint32_t blocks_written = 0;
+static uint32_t blocks_read = 0;
+static uint32_t blocks_dropped = 0;     // log full, oldest segment dropped
+static uint32_t blocks_missed = 0;      // overwritten before we got to them
+static uint32_t write_errors = 0;
+
+static const char *segment_path(uint32_t index, char *path)
+{
+    sprintf(path, "/spill_%02u.mp3", index);
+    return path;
+}
+
+static spill_segment *newest()
+{
+    return &segments[(tail + used - 1) % number_of_segments];
+}
+
+static void drop_oldest()
+{
+    if (tail==read_segment) {
+        read_file.close();
+        read_segment = SPILL_MAX_SEGMENTS;
+    }
+    if (1==used) {
+        write_file.close();
+    }
+    tail = (tail + 1) % number_of_segments;
+    used--;
+}
+
+boolean spill_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*))
+{
+    if (NULL==spill_lock) {
+        spill_lock = xSemaphoreCreateMutex();
+    }
+    spill_end();
+
+    // a log from before a restart is no use, the sequence numbers
+    // start again from 0
+    char path[24];
+    for (uint32_t i = 0; i < SPILL_MAX_SEGMENTS; i++) {
+        if (ToolkitFiles::fileExists(segment_path(i, path))) {
+            ToolkitFiles::fileRemove(path);
+        }
+    }
+
+    // leave a quarter of the free space for everything else, and a
+    // block per file for the LittleFS metadata
+    size_t segment_bytes = (SPILL_SEGMENT_BLOCKS + 1) *
+        ToolkitFiles::FLASH_BLOCK_SIZE;
+    uint32_t fits = ((ToolkitFiles::freeBytes() / 4) * 3) / segment_bytes;
+    if (fits > SPILL_MAX_SEGMENTS) {
+        fits = SPILL_MAX_SEGMENTS;
+    }
+    if (fits < 2) {
+        Serial.println("Uplink spill .. not enough flash for a log");
+        return false;
+    }
+
+    xSemaphoreTake(spill_lock, portMAX_DELAY);
+    ring_head = head;
+    ring_oldest = oldest;
+    ring_get = get;
+    tail = 0;
+    used = 0;
+    next_to_spill = 0;
+    number_of_segments = fits;
+    xSemaphoreGive(spill_lock);
+
+    Serial.printf("Uplink spill .. %u segments of %u buffers on flash\n",
+        fits, SPILL_SEGMENT_BLOCKS);
+    return true;
+}
+
+void spill_end()
+{
+    if (NULL==spill_lock) {
+        return;
+    }
+    xSemaphoreTake(spill_lock, portMAX_DELAY);
+    write_file.close();
+    read_file.close();
+    read_segment = SPILL_MAX_SEGMENTS;
+    used = 0;
+    number_of_segments = 0;
+    xSemaphoreGive(spill_lock);
+}
+
+// add one ring buffer to the end of the log, with the lock held
+static void append(uint32_t sequence, const uint8_t *data, size_t length)
+{
+    spill_segment *s = (used > 0) ? newest() : NULL;
+    if ((NULL==s) || !write_file || (SPILL_SEGMENT_BLOCKS==s->count) ||
+        ((s->first + s->count) != sequence)) {
+        // start the next segment
+        write_file.close();
+        if (used==number_of_segments) {
+            blocks_dropped += segments[tail].count;
+            drop_oldest();
+        }
+        used++;
+        uint32_t index = (tail + used - 1) % number_of_segments;
+        char path[24];
+        write_file = ToolkitFiles::fileOpen(segment_path(index, path), FILE_WRITE);
+        s = &segments[index];
+        s->first = sequence;
+        s->count = 0;
+        if (!write_file) {
+            write_errors++;
+            used--;
+            return;
+        }
+    }
+
+    // always a whole block, the ring slot is at least that big
+    // (anything past length is left over from before, and ignored)
+    size_t actual = write_file.write(data, ToolkitFiles::FLASH_BLOCK_SIZE);
+    write_file.flush();
+    if (ToolkitFiles::FLASH_BLOCK_SIZE != actual) {
+        write_errors++;
+        write_file.close();     // the next buffer starts a new segment
+        if (0==s->count) {
+            used--;
+        }
+        return;
+    }
+    s->lengths[s->count] = length;
+    s->count++;
+    blocks_written++;
+}
+
+void spill_run(uint32_t needed)
+{
+    if ((0==number_of_segments) || (NULL==ring_get)) {
+        return;
+    }
+
+    // let go of everything the uplink has delivered
+    xSemaphoreTake(spill_lock, portMAX_DELAY);
+    while ((used > 0) &&
+        ((segments[tail].first + segments[tail].count) <= needed)) {
+        drop_oldest();
+    }
+    xSemaphoreGive(spill_lock);
+
+    // copy out what the encoder is about to overwrite
+    uint32_t head = ring_head();
+    uint32_t oldest = ring_oldest();
+    if ((next_to_spill < needed) || (next_to_spill > head)) {
+        next_to_spill = needed;
+    }
+    while ((next_to_spill < head) && (next_to_spill < (oldest + SPILL_LEAD))) {
+        if (next_to_spill < oldest) {
+            blocks_missed += oldest - next_to_spill;
+            next_to_spill = oldest;
+            continue;
+        }
+        size_t length;
+        uint8_t *data = ring_get(next_to_spill, &length);
+        if (data && (length <= ToolkitFiles::FLASH_BLOCK_SIZE)) {
+            xSemaphoreTake(spill_lock, portMAX_DELAY);
+            append(next_to_spill, data, length);
+            xSemaphoreGive(spill_lock);
+        } else {
+            blocks_missed++;
+        }
+        next_to_spill++;
+        oldest = ring_oldest();
+    }
+}
+
+uint32_t spill_find(uint32_t sequence)
+{
+    uint32_t found = 0xffffffff;
+    if (0==number_of_segments) {
+        return found;
+    }
+    xSemaphoreTake(spill_lock, portMAX_DELAY);
+    for (uint32_t i = 0; i < used; i++) {
+        spill_segment *s = &segments[(tail + i) % number_of_segments];
+        if ((s->first + s->count) > sequence) {
+            found = (s->first > sequence) ? s->first : sequence;
+            break;
+        }
+    }
+    xSemaphoreGive(spill_lock);
+    return found;
+}
+
+size_t spill_read(uint32_t sequence, uint8_t *buffer, size_t size)
+{
+    if (0==number_of_segments) {
+        return 0;
+    }
+    size_t length = 0;
+    xSemaphoreTake(spill_lock, portMAX_DELAY);
+    for (uint32_t i = 0; i < used; i++) {
+        uint32_t index = (tail + i) % number_of_segments;
+        spill_segment *s = &segments[index];
+        if ((sequence < s->first) || (sequence >= (s->first + s->count))) {
+            continue;
+        }
+        uint32_t block = sequence - s->first;
+        if (s->lengths[block] > size) {
+            break;
+        }
+
+        // full segments stay open for the next read, the one still
+        // being written is opened each time so we see the new blocks
+        boolean writing = (i==(used-1));
+        File f;
+        if (writing) {
+            char path[24];
+            f = ToolkitFiles::fileOpen(segment_path(index, path), FILE_READ);
+        } else {
+            if ((index!=read_segment) || !read_file) {
+                char path[24];
+                read_file.close();
+                read_file = ToolkitFiles::fileOpen(segment_path(index, path), FILE_READ);
+                read_segment = index;
+            }
+            f = read_file;
+        }
+        if (f && f.seek(block * ToolkitFiles::FLASH_BLOCK_SIZE)) {
+            length = f.read(buffer, s->lengths[block]);
+            if (length==s->lengths[block]) {
+                blocks_read++;
+            } else {
+                length = 0;
+            }
+        }
+        if (writing) {
+            f.close();
+        }
+        break;
+    }
+    xSemaphoreGive(spill_lock);
+    return length;
+}
+
+void spill_printStats()
+{
+    if (0==number_of_segments) {
+        return;
+    }
+    uint32_t buffers = 0;
+    for (uint32_t i = 0; i < used; i++) {
+        buffers += segments[(tail + i) % number_of_segments].count;
+    }
+    Serial.printf("Uplink spill %u of %u segments, %u buffers on flash\n",
+        used, number_of_segments, buffers);
+    Serial.printf("Uplink spill written %u, read back %u, dropped %u, "
+        "missed %u, errors %u\n",
+        blocks_written, blocks_read, blocks_dropped, blocks_missed,
+        write_errors);
+}
+
+//
+// END OF uplink_spill.cpp
@@ -0,0 +1,62 @@
+//
+// uplink_spill.h
+
+//
+// Store and forward for the icecast uplink.
+//
+// The encoder ring only holds so much (3 seconds, or a minute with
+// PSRAM). When the uplink is down for longer than that, the buffers it
+// hasn't sent yet are copied to flash just before the encoder comes
+// round and overwrites them, and the uplink reads them back from there
+// when it reconnects.
+//
+// The log is a ring of segment files on the LittleFS partition
+// (/spill_00.mp3, /spill_01.mp3 ..), each holding up to
+// SPILL_SEGMENT_BLOCKS ring buffers back to back. One ring buffer is
+// one whole flash block, so every write is a full block and a file
+// never has a part block to rewrite. The number of segments is fixed
+// at spill_begin() from the free space, so the log can't fill the
+// partition. When it is full the oldest segment is dropped (and its
+// buffers count as lost).
+//
+// spill_run() does all the writing, from its own low priority task, so
+// the flash never holds up the stream task. The uplink only reads.
+//
+
+#ifndef _UPLINK_SPILL_H_
+#define _UPLINK_SPILL_H_
+
+#include <Arduino.h>
+
+enum {
+    SPILL_SEGMENT_BLOCKS    = 16,   // ring buffers per segment file
+    SPILL_MAX_SEGMENTS      = 32,
+    SPILL_LEAD              = 4     // spill when this close to being overwritten
+};
+
+// clear out any old log and size the new one from the free space
+// (the same ring functions as ToolkitWiFi_Uplink::setSource)
+// returns false if there is no room for it
+boolean spill_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*));
+
+// stop spilling and forget the log
+void spill_end();
+
+// from the spill task .. needed is the first buffer the uplink hasn't
+// delivered yet, anything before it is dropped from the log
+void spill_run(uint32_t needed);
+
+// the first buffer at or after sequence that is in the log,
+// or 0xffffffff if there isn't one
+uint32_t spill_find(uint32_t sequence);
+
+// read one buffer back, returns its length (0 if it isn't in the log)
+size_t spill_read(uint32_t sequence, uint8_t *buffer, size_t size);
+
+void spill_printStats();
+
+#endif
+
+//
+// END OF uplink_spill.h
@@ -16,9 +16,11 @@ enum {
     WS_KEY_LEN = 24,
     WS_MS_LEN = 36,
     WS_REPLY_KEY_LEN = 30,
-    WS_HS_ACCEPTLEN = 130
+    WS_HS_ACCEPTLEN = 192
 };
 
+#define WS_HS_PROTOCOL  "\r\nSec-WebSocket-Protocol: "
+
 #define MAGIC_STRING   "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
 
 #define WS_HS_ACCEPT                       \
@@ -28,28 +30,8 @@ enum {
     "Sec-WebSocket-Accept: "
 
 
-static char ws_key_from_client[WS_KEY_LEN];
-
-const char *websocket_isWSHeader(char *request_buffer, int request_length)
-{
-    char *header = strstr(request_buffer, "Sec-WebSocket-Key");
-    if (header) {
-        header += 19;   // length of search string + 2 for the : and space
-        int remaining = request_length - (header - request_buffer);
-        if (remaining < WS_KEY_LEN) {
-            return 0;   // some kind of incomplete header packet error
-        }
-        memcpy(ws_key_from_client, header, WS_KEY_LEN);
-        return ws_key_from_client;
-    }
-    return 0;
-}
-// the key (if found) is 24 bytes stored statically .. otherwise return is 0
-
-const char *websocket_getClientKey()
-{
-    return ws_key_from_client;
-}
+// The Sec-WebSocket-Key is found by the HTTP request parser
+// (see http_request.cpp)
 
 static const unsigned char base64_table[65] =
 	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
@@ -125,12 +107,21 @@ static const char *websocket_replyKey(const char *wsKey)
 }
 // the reply key is 28 bytes stored statically
 
-char *websocket_handshake(const char *wsKey, uint32_t *reply_length)
+char *websocket_handshake(const char *wsKey, const char *protocol,
+    uint32_t *reply_length)
 {
     char *hsresponse = (char *) calloc(WS_HS_ACCEPTLEN, 1);
-	strcpy(hsresponse, WS_HS_ACCEPT);
-	strcat(hsresponse, websocket_replyKey(wsKey));
-	strcat(hsresponse, "\r\n\r\n");
+    const char *key = websocket_replyKey(wsKey);
+    int length = -1;
+    if (protocol) {
+        length = snprintf(hsresponse, WS_HS_ACCEPTLEN,
+            WS_HS_ACCEPT "%s" WS_HS_PROTOCOL "%s\r\n\r\n", key, protocol);
+    }
+    // a protocol that doesn't fit is left out, and the browser will
+    // refuse the connection .. better than a cut off reply
+    if ((length < 0) || (length >= WS_HS_ACCEPTLEN)) {
+        snprintf(hsresponse, WS_HS_ACCEPTLEN, WS_HS_ACCEPT "%s\r\n\r\n", key);
+    }
     *reply_length = strlen(hsresponse);
     return hsresponse;
 }
@@ -149,7 +140,10 @@ static void mask(uint8_t *data, uint8_t *masks, uint32_t size)
 //    printf("\n");
 }
 
-// returns total length of frame (headers + data) or 0 for error
+// returns total length of frame (headers + data),
+// 0 if the whole frame hasn't arrived yet, or WS_FRAME_BAD
+#define WS_FRAME_BAD 0xffffffff
+
 static uint32_t websocket_parse_frame(websocket_frame_info *wfi,
     const char *buffer, uint32_t buffer_length)
 {
@@ -167,7 +161,7 @@ static uint32_t websocket_parse_frame(websocket_frame_info *wfi,
 
     if (0x80 != (b[1] & 0x80)) {
         printf("websocket frame .. no mask bit!\n");
-        return 0;
+        return WS_FRAME_BAD;
     }
     wfi->dataSize = b[1] & 0x7f;
 // printf("datasize 7 bits %u\n", wfi->dataSize);
@@ -179,12 +173,12 @@ static uint32_t websocket_parse_frame(websocket_frame_info *wfi,
         wfi->dataSize += b[3];
     } else if (127 == wfi->dataSize) {
         printf("websocket frame .. payload is too big!");
-        return 0;
+        return WS_FRAME_BAD;
     }
 // printf("data size = %u\n", wfi->dataSize);
 
     if (buffer_length < (wfi->dataSize + 4 + headerSize)) {
-        printf("websocket frame .. to short after parsing payload length!\n");
+        // the rest is still on its way
         return 0;
     }
 
@@ -201,39 +195,52 @@ static uint32_t websocket_parse_frame(websocket_frame_info *wfi,
 //
 
 // We actually want to send all the settings at once
-// and then maybe some control messages once in a while
-// So we need to be able to handle payloads up to 1200 bytes
+// and then maybe some control messages once in a while.
+// The settings are built in the connection's own frame buffer,
+// the small messages are built on the stack (they can come from
+// other tasks, i.e. websocket_broadcast() from the pin controls)
 //
-#define PACKET_MAX_LENGTH 2048
+#define SMALL_PAYLOAD_LENGTH 125
 
-static char packet[PACKET_MAX_LENGTH];
+static size_t websocket_frameHeader(char *header, size_t payload_len)
+{
+    header[0] = 0x81;   // FIN | TEXT
+    if (payload_len <= SMALL_PAYLOAD_LENGTH) {
+        header[1] = payload_len;
+        return 2;
+    }
+    header[1] = 126; // magic number for a 16 bit payload length
+    header[2] = (char) (payload_len >> 8);
+    header[3] = (char) (payload_len & 0xff);
+    return 4;
+}
 
 static void websocket_sendString(ToolkitWiFi_Client *twfc, const char *str)
 {
     size_t payload_len = strlen(str);
-    if (payload_len > (PACKET_MAX_LENGTH-4)) {
-        payload_len = PACKET_MAX_LENGTH-4; }
-    size_t header_len = 2;
-    packet[0] = 0x81;   // FIN | TEXT
-    if (payload_len <= 125) {
-        packet[1] = payload_len;
+    if (payload_len > 0xffff) {
+        payload_len = 0xffff; }
+    char packet[4 + SMALL_PAYLOAD_LENGTH];
+    size_t header_len = websocket_frameHeader(packet, payload_len);
+    if (payload_len <= SMALL_PAYLOAD_LENGTH) {
+        memcpy(&packet[header_len], str, payload_len);
+        twfc->client->write(packet, header_len + payload_len);
     } else {
-        packet[1] = 126; // magic number for a 16 bit payload length
-        size_t msB = payload_len >> 8;
-        size_t lsB = payload_len & 0xff;
-        packet[2] = (char) msB;
-        packet[3] = (char) lsB;
-        header_len = 4;
+        twfc->client->write(packet, header_len);
+        twfc->client->write(str, payload_len);
     }
-
-    memcpy(&packet[header_len], str, payload_len);
-    size_t packet_len = header_len + payload_len;
-    twfc->client->write(packet, packet_len);
 }
 
 void websocket_sendSettings(ToolkitWiFi_Client *twfc)
 {
-    size_t payload_len = SettingItem::saveAll(&packet[4], PACKET_MAX_LENGTH-4);
+    // use the space after any frames that are still coming in
+    char *packet = twfc->buffer + twfc->buffer_used;
+    size_t space = twfc->buffer_size - twfc->buffer_used;
+    if ((NULL==twfc->buffer) || (space <= 4)) {
+        Serial.println("WS - no room to send the settings!");
+        return;
+    }
+    size_t payload_len = SettingItem::saveAll(&packet[4], space-4);
     packet[0] = 0x81;
     packet[1] = 126; // 16 bit payload length
     size_t msB = payload_len >> 8;
@@ -253,14 +260,16 @@ static void websocket_echoToOthers(ToolkitWiFi_Client *twfc,
 {
     for (uint16_t i = 0; i < ToolkitWiFi_Client::MAX_CLIENTS; i++) {
         ToolkitWiFi_Client *t = &ToolkitWiFi_Client::_client_list[i];
-        if (t != twfc) {
+        // only look at websockets .. mp3 streams belong to the stream task
+        if ((t != twfc) && (ToolkitWiFi_Client::TYPE_WEBSOCKET==t->type)) {
             if (NULL != t->client) {
                 if (!t->client->connected()) {
                     t->closeClient();
                     //    Serial.println("Client closed itself");
-                } else if (ToolkitWiFi_Client::TYPE_WEBSOCKET==t->type) {
-                    static char s[64];
-                    sprintf(s,"%s %s\n", name, value);
+                } else {
+                    // names and values are up to 32 characters each
+                    char s[80];
+                    snprintf(s, sizeof(s), "%s %s\n", name, value);
                     websocket_sendString(t, s);
                 }
             }
@@ -270,14 +279,17 @@ static void websocket_echoToOthers(ToolkitWiFi_Client *twfc,
 
 boolean websocket_handleIncoming(
     ToolkitWiFi_Client *twfc,
-    const char *buffer, size_t size)
+    char *buffer, size_t size, size_t *used)
 {
-    static websocket_frame_info wfi;
+    websocket_frame_info wfi;
     int remaining = size;
+    *used = 0;
 
     uint32_t framesize = websocket_parse_frame(&wfi, buffer, remaining);
     while ((framesize) && (remaining > 0)) {
-        if (8 == wfi.opcode) {
+        if (WS_FRAME_BAD == framesize) {
+            return false;
+        } else if (8 == wfi.opcode) {
             framesize = 0;
             remaining = 0;
             // Serial.println("WebSocket has closed");
@@ -299,6 +311,8 @@ boolean websocket_handleIncoming(
                             //Serial.println(name);
                             if (0==strcmp("$RESET", name)) {
                                 ESP.restart();
+                            } else if (0==strcmp("$STATS", name)) {
+                                ToolkitWiFi_Server::printStats();
                             }
                         } else { // setting
                             SettingItem::updateOrAdd(name, value);
@@ -311,6 +325,7 @@ boolean websocket_handleIncoming(
             }
             buffer = buffer + framesize;
             remaining = remaining - framesize;
+            *used += framesize;
             framesize = websocket_parse_frame(&wfi, buffer, remaining);
         }
     } // end while()
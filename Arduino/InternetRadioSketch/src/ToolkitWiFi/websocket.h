@@ -14,22 +14,22 @@ typedef struct {
 } websocket_frame_info;
 
 //
-// WS Handshake
-const char *websocket_isWSHeader(char *request_buffer, int request_length);
-    // the key (if found) is 24 bytes stored statically .. otherwise return is 0
-const char *websocket_getClientKey();
-
-char *websocket_handshake(const char *wsKey, uint32_t *reply_length);
+// WS Handshake .. protocol is the subprotocol we agreed to, or NULL
+char *websocket_handshake(const char *wsKey, const char *protocol,
+    uint32_t *reply_length);
 
 //
 // Toolkit - send to the browser
 //void websocket_sendString(ToolkitWiFi_Client *twfc, const char *str);
+// sent from the connection's websocket buffer
 void websocket_sendSettings(ToolkitWiFi_Client *twfc);
 
 //
 // Handle incoming packets
+// used is set to the bytes in complete frames, a partial frame
+// at the end is left for next time. Returns false to close.
 boolean websocket_handleIncoming(ToolkitWiFi_Client *twfc,
-    const char *buffer, size_t size);
+    char *buffer, size_t size, size_t *used);
 
 //
 // Send a setting to all WS clients
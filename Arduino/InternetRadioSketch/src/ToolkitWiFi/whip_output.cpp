@@ -0,0 +1,710 @@
+//
+// whip_output.cpp
+
+#include "whip_output.h"
+#include "srtp.h"
+#include "stun.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+#include "lwip/dns.h"
+#include "lwip/tcpip.h"
+
+static const char *state_names[WHIP_STATES] = {
+    "IDLE", "DNS", "CONNECTING", "SENDING", "AWAITING", "ICE", "MEDIA", "BACKOFF"
+};
+
+static int state = WHIP_IDLE;
+static uint32_t state_started = 0;
+static volatile boolean media_on = false;   // the Opus task sends
+
+// remote_whip_url, split up
+static char host[64];
+static uint16_t port = 80;
+static char path[128];
+static uint32_t channels = 2;
+
+// the lookup, in the background
+static volatile boolean dns_done = false;
+static volatile uint32_t dns_ip = 0;
+static portMUX_TYPE dns_lock = portMUX_INITIALIZER_UNLOCKED;
+static boolean dns_asked = false;
+static uint32_t server_ip = 0;
+
+// the offer and answer
+static int tcp_fd = -1;
+static char *http = NULL;
+static size_t http_length = 0;
+static size_t http_done = 0;
+static uint32_t local_ip = 0;       // as the server sees us, from the TCP socket
+
+// ICE
+static int udp_fd = -1;
+static uint16_t udp_port = 0;
+static char local_ufrag[WHIP_UFRAG_LENGTH + 1];
+static char local_pwd[WHIP_PWD_LENGTH + 1];
+static char remote_ufrag[64];
+static char remote_pwd[128];
+static char check_username[WHIP_UFRAG_LENGTH + 64 + 2];
+static boolean remote_lite = false;
+static boolean have_candidate = false;
+static struct sockaddr_in candidate;        // the server's, from the answer
+static struct sockaddr_in media_to;
+static uint32_t last_consent = 0;
+static uint32_t last_check = 0;
+static uint8_t transaction[STUN_TRANSACTION_SIZE];
+static uint64_t tie_breaker = 0;
+static uint8_t udp_in[WHIP_PACKET_SIZE];
+static uint8_t stun_out[STUN_MAX_SIZE];
+
+// SRTP, the master key and salt are in the offer
+static srtp_context srtp;
+static boolean srtp_ready = false;
+static uint8_t master[SRTP_MASTER_KEY_SIZE + SRTP_MASTER_SALT_SIZE];
+
+// RTP, only the Opus task touches these once media_on
+static uint8_t rtp_packet[WHIP_PACKET_SIZE];
+static uint8_t payload_type = WHIP_PAYLOAD_OPUS;
+static uint16_t sequence = 0;
+static uint32_t timestamp = 0;
+static uint32_t ssrc = 0;
+static boolean marker = true;
+
+// stats
+static uint32_t stats_offers = 0;
+static uint32_t stats_failures = 0;
+static const char *stats_last_failure = "";
+static uint32_t stats_checks_answered = 0;
+static uint32_t stats_checks_sent = 0;
+static uint32_t stats_checks_bad = 0;       // not for us, or not signed right
+static uint32_t stats_dropped = 0;          // RTP or RTCP from the server
+static uint32_t stats_packets = 0;
+static uint32_t stats_bytes = 0;
+static uint32_t stats_send_errors = 0;
+static uint32_t stats_not_ready = 0;        // packets before ICE was done
+static uint32_t stats_too_big = 0;
+static uint64_t stats_srtp_us = 0;
+static uint32_t stats_srtp_worst_us = 0;
+
+static void enter(int new_state)
+{
+    state = new_state;
+    state_started = millis();
+    Serial.printf("WHIP %s\n", state_names[state]);
+}
+
+static void close_tcp()
+{
+    if (tcp_fd >= 0) {
+        close(tcp_fd);
+        tcp_fd = -1;
+    }
+}
+
+// start again after WHIP_BACKOFF_MS .. the Opus task has long finished
+// with the SRTP keys by the time the next offer makes new ones
+static void fail(const char *reason)
+{
+    media_on = false;
+    close_tcp();
+    stats_failures++;
+    stats_last_failure = reason;
+    Serial.printf("WHIP %s\n", reason);
+    enter(WHIP_BACKOFF);
+}
+
+// http://host[:port][/path]
+static boolean parse_url(const char *url)
+{
+    if (0==strncmp(url, "https://", 8)) {
+        Serial.println("WHIP over https isn't supported, use http or a TLS proxy.");
+        return false;
+    }
+    if (0 != strncmp(url, "http://", 7)) {
+        return false;
+    }
+    url += 7;
+    size_t length = strcspn(url, ":/");
+    if ((0==length) || (length >= sizeof(host))) {
+        return false;
+    }
+    memcpy(host, url, length);
+    host[length] = 0;
+    url += length;
+    port = 80;
+    if (':'==*url) {
+        port = atoi(++url);
+        url += strspn(url, "0123456789");
+    }
+    snprintf(path, sizeof(path), "%s", ('/'==*url) ? url : "/");
+    return true;
+}
+
+boolean whip_begin(uint32_t channel_count)
+{
+    if ((WHIP_IDLE != state) || (0==SettingItem::findUInt("remote_whip", 0))) {
+        return (WHIP_IDLE != state);
+    }
+    if (0==channel_count) {
+        Serial.println("WHIP needs codec = opus.");
+        return false;
+    }
+    const char *url = SettingItem::findString("remote_whip_url");
+    if ((NULL==url) || !parse_url(url)) {
+        Serial.println("WHIP needs remote_whip_url = http://host:port/path");
+        return false;
+    }
+    http = (char *) malloc(WHIP_HTTP_SIZE);
+    if (NULL==http) {
+        Serial.println("WHIP has no memory.");
+        return false;
+    }
+    channels = channel_count;
+    Serial.printf("WHIP to %s port %u %s\n", host, port, path);
+    enter(WHIP_DNS);
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// The offer
+//
+
+static void random_string(char *out, size_t length)
+{
+    static const char chars[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    for (size_t i = 0; i < length; i++) {
+        out[i] = chars[esp_random() % (sizeof(chars) - 1)];
+    }
+    out[length] = 0;
+}
+
+static const char base64_table[65] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// length has to be a multiple of 3 (the key and salt are 30 bytes)
+static void base64(const uint8_t *in, size_t length, char *out)
+{
+    for (size_t i = 0; i < length; i += 3) {
+        *out++ = base64_table[in[i] >> 2];
+        *out++ = base64_table[((in[i] & 0x03) << 4) | (in[i + 1] >> 4)];
+        *out++ = base64_table[((in[i + 1] & 0x0f) << 2) | (in[i + 2] >> 6)];
+        *out++ = base64_table[in[i + 2] & 0x3f];
+    }
+    *out = 0;
+}
+
+// new credentials and keys for every offer
+static boolean make_offer()
+{
+    random_string(local_ufrag, WHIP_UFRAG_LENGTH);
+    random_string(local_pwd, WHIP_PWD_LENGTH);
+    for (size_t i = 0; i < sizeof(master); i++) {
+        master[i] = esp_random();
+    }
+    if (srtp_ready) {
+        srtp_end(&srtp);
+    }
+    srtp_ready = srtp_begin(&srtp, master, &master[SRTP_MASTER_KEY_SIZE]);
+    if (!srtp_ready) {
+        return false;
+    }
+    char key[((sizeof(master) / 3) * 4) + 1];
+    base64(master, sizeof(master), key);
+    ssrc = esp_random();
+    sequence = esp_random();
+    timestamp = esp_random();
+    tie_breaker = ((uint64_t) esp_random() << 32) | esp_random();
+
+    struct in_addr address;
+    address.s_addr = local_ip;
+    char ip[16];
+    snprintf(ip, sizeof(ip), "%s", inet_ntoa(address));
+
+    // the SDP first, after room for the headers
+    const size_t HEADER_ROOM = 512;
+    char *sdp = &http[HEADER_ROOM];
+    int sdp_length = snprintf(sdp, WHIP_HTTP_SIZE - HEADER_ROOM,
+        "v=0\r\n"
+        "o=- %u 2 IN IP4 %s\r\n"
+        "s=Wave Farm Toolkit\r\n"
+        "t=0 0\r\n"
+        "a=ice-lite\r\n"
+        "a=group:BUNDLE 0\r\n"
+        "m=audio %u RTP/SAVPF %u\r\n"
+        "c=IN IP4 %s\r\n"
+        "a=mid:0\r\n"
+        "a=sendonly\r\n"
+        "a=rtcp-mux\r\n"
+        "a=ice-ufrag:%s\r\n"
+        "a=ice-pwd:%s\r\n"
+        "a=crypto:1 AES_CM_128_HMAC_SHA1_80 inline:%s\r\n"
+        "a=rtpmap:%u opus/48000/2\r\n"
+        "a=fmtp:%u minptime=10;sprop-stereo=%u\r\n"
+        "a=ssrc:%u cname:toolkit\r\n"
+        "a=candidate:1 1 UDP 2130706431 %s %u typ host\r\n"
+        "a=end-of-candidates\r\n",
+        ssrc, ip, udp_port, WHIP_PAYLOAD_OPUS, ip, local_ufrag, local_pwd,
+        key, WHIP_PAYLOAD_OPUS, WHIP_PAYLOAD_OPUS, (2==channels) ? 1 : 0,
+        ssrc, ip, udp_port);
+    memset(key, 0, sizeof(key));
+
+    const char *token = SettingItem::findString("remote_whip_token");
+    char authorization[160] = "";
+    if (token && token[0]) {
+        snprintf(authorization, sizeof(authorization),
+            "Authorization: Bearer %s\r\n", token);
+    }
+    int header_length = snprintf(http, HEADER_ROOM,
+        "POST %s HTTP/1.1\r\n"
+        "Host: %s:%u\r\n"
+        "%s"
+        "Content-Type: application/sdp\r\n"
+        "Content-Length: %d\r\n"
+        "Connection: close\r\n"
+        "\r\n", path, host, port, authorization, sdp_length);
+    if ((sdp_length >= (int) (WHIP_HTTP_SIZE - HEADER_ROOM)) ||
+            (header_length >= (int) HEADER_ROOM)) {
+        return false;
+    }
+    memmove(&http[header_length], sdp, sdp_length);
+    http_length = header_length + sdp_length;
+    http_done = 0;
+    payload_type = WHIP_PAYLOAD_OPUS;
+    stats_offers++;
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// The answer
+//
+
+// the server's ICE details, and the payload type if it changed it
+static boolean parse_answer(char *sdp)
+{
+    remote_ufrag[0] = 0;
+    remote_pwd[0] = 0;
+    remote_lite = false;
+    have_candidate = false;
+    char c_address[16] = "";
+    uint32_t m_port = 0;
+    char *save;
+    for (char *line = strtok_r(sdp, "\r\n", &save); line;
+            line = strtok_r(NULL, "\r\n", &save)) {
+        char ip[48];
+        char transport[8];
+        uint32_t component;
+        uint32_t number;
+        if (0==strncmp(line, "a=ice-ufrag:", 12)) {
+            snprintf(remote_ufrag, sizeof(remote_ufrag), "%s", &line[12]);
+        } else if (0==strncmp(line, "a=ice-pwd:", 10)) {
+            snprintf(remote_pwd, sizeof(remote_pwd), "%s", &line[10]);
+        } else if (0==strcmp(line, "a=ice-lite")) {
+            remote_lite = true;
+        } else if ((4==sscanf(line, "a=candidate:%*s %u %7s %*u %47s %u typ",
+                    &component, transport, ip, &number)) &&
+                !have_candidate && (1==component) &&
+                (0==strcasecmp(transport, "udp")) &&
+                inet_aton(ip, &candidate.sin_addr)) {
+            candidate.sin_family = AF_INET;
+            candidate.sin_port = htons(number);
+            have_candidate = true;
+        } else if (1==sscanf(line, "a=rtpmap:%u opus/48000", &number)) {
+            payload_type = number;
+        } else if (1==sscanf(line, "c=IN IP4 %15s", c_address)) {
+            // the fallback, if there are no candidates
+        } else if ((1==sscanf(line, "m=audio %u", &m_port)) && (0==m_port)) {
+            Serial.println("WHIP server turned the audio down.");
+            return false;
+        }
+    }
+    if (!have_candidate && m_port && inet_aton(c_address, &candidate.sin_addr)) {
+        candidate.sin_family = AF_INET;
+        candidate.sin_port = htons(m_port);
+        have_candidate = true;
+    }
+    if ((0==remote_ufrag[0]) || (0==remote_pwd[0])) {
+        return false;
+    }
+    snprintf(check_username, sizeof(check_username), "%s:%s",
+        remote_ufrag, local_ufrag);
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// Steps
+//
+
+// called by lwip from its own task
+static void dns_found(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+    portENTER_CRITICAL(&dns_lock);
+    dns_ip = ipaddr ? ip_2_ip4(ipaddr)->addr : 0;
+    dns_done = true;
+    portEXIT_CRITICAL(&dns_lock);
+}
+
+static void step_dns()
+{
+    if (!dns_asked) {
+        dns_asked = true;
+        portENTER_CRITICAL(&dns_lock);
+        dns_done = false;
+        portEXIT_CRITICAL(&dns_lock);
+        // lwip's DNS belongs to the tcpip task
+        ip_addr_t addr;
+        LOCK_TCPIP_CORE();
+        err_t err = dns_gethostbyname(host, &addr, dns_found, NULL);
+        UNLOCK_TCPIP_CORE();
+        if (ERR_OK==err) {          // cached, or a number
+            portENTER_CRITICAL(&dns_lock);
+            dns_ip = ip_2_ip4(&addr)->addr;
+            dns_done = true;
+            portEXIT_CRITICAL(&dns_lock);
+        } else if (ERR_INPROGRESS!=err) {
+            dns_asked = false;
+            fail("DNS error");
+            return;
+        }
+    }
+    portENTER_CRITICAL(&dns_lock);
+    boolean done = dns_done;
+    uint32_t found = dns_ip;
+    portEXIT_CRITICAL(&dns_lock);
+    if (done) {
+        dns_asked = false;
+        if (0==found) {
+            fail("DNS lookup failed");
+        } else {
+            server_ip = found;
+            enter(WHIP_CONNECTING);
+        }
+    } else if ((millis() - state_started) > WHIP_HTTP_TIMEOUT_MS) {
+        dns_asked = false;
+        fail("DNS timeout");
+    }
+}
+
+static boolean open_udp()
+{
+    if (udp_fd >= 0) {
+        return true;
+    }
+    udp_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (udp_fd < 0) {
+        return false;
+    }
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    socklen_t length = sizeof(local);
+    if ((bind(udp_fd, (struct sockaddr *) &local, sizeof(local)) < 0) ||
+            (getsockname(udp_fd, (struct sockaddr *) &local, &length) < 0)) {
+        close(udp_fd);
+        udp_fd = -1;
+        return false;
+    }
+    udp_port = ntohs(local.sin_port);
+    return true;
+}
+
+static void step_connecting()
+{
+    if (tcp_fd < 0) {
+        tcp_fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (tcp_fd < 0) {
+            fail("has no socket");
+            return;
+        }
+        fcntl(tcp_fd, F_SETFL, fcntl(tcp_fd, F_GETFL, 0) | O_NONBLOCK);
+        struct sockaddr_in server;
+        memset(&server, 0, sizeof(server));
+        server.sin_family = AF_INET;
+        server.sin_port = htons(port);
+        server.sin_addr.s_addr = server_ip;
+        if ((connect(tcp_fd, (struct sockaddr *) &server, sizeof(server)) < 0) &&
+            (EINPROGRESS != errno)) {
+            fail("connect error");
+            return;
+        }
+    }
+
+    // writable once the connect has finished, one way or the other
+    fd_set fds;
+    FD_ZERO(&fds);
+    FD_SET(tcp_fd, &fds);
+    struct timeval no_wait = { 0, 0 };
+    if (select(tcp_fd+1, NULL, &fds, NULL, &no_wait) > 0) {
+        int error = 0;
+        socklen_t error_length = sizeof(error);
+        getsockopt(tcp_fd, SOL_SOCKET, SO_ERROR, &error, &error_length);
+        if (error) {
+            fail("connect refused");
+            return;
+        }
+        // our candidate is the address the server sees us on
+        struct sockaddr_in local;
+        socklen_t length = sizeof(local);
+        getsockname(tcp_fd, (struct sockaddr *) &local, &length);
+        local_ip = local.sin_addr.s_addr;
+        if (!open_udp()) {
+            fail("has no UDP socket");
+        } else if (!make_offer()) {
+            fail("couldn't make the offer");
+        } else {
+            enter(WHIP_SENDING);
+        }
+    } else if ((millis() - state_started) > WHIP_HTTP_TIMEOUT_MS) {
+        fail("connect timeout");
+    }
+}
+
+static void step_sending()
+{
+    int sent = send(tcp_fd, &http[http_done], http_length - http_done,
+        MSG_DONTWAIT);
+    if (sent > 0) {
+        http_done += sent;
+    } else if ((EAGAIN!=errno) && (EWOULDBLOCK!=errno)) {
+        fail("send error");
+        return;
+    }
+    if (http_done >= http_length) {
+        http_done = 0;
+        enter(WHIP_AWAITING);
+    } else if ((millis() - state_started) > WHIP_HTTP_TIMEOUT_MS) {
+        fail("send timeout");
+    }
+}
+
+static void step_awaiting()
+{
+    boolean closed = false;
+    int got = recv(tcp_fd, &http[http_done], WHIP_HTTP_SIZE - 1 - http_done,
+        MSG_DONTWAIT);
+    if (got > 0) {
+        http_done += got;
+    } else if ((0==got) || ((EAGAIN!=errno) && (EWOULDBLOCK!=errno))) {
+        closed = true;
+    }
+    http[http_done] = 0;
+
+    // wait for the whole answer, Content-Length or the close
+    char *body = strstr(http, "\r\n\r\n");
+    if (body) {
+        body += 4;
+        const char *length = strcasestr(http, "\r\nContent-Length:");
+        size_t wanted = length ? atoi(&length[17]) : 0;
+        if (closed || (length && ((size_t) (&http[http_done] - body) >= wanted))) {
+            close_tcp();
+            uint32_t status = 0;
+            sscanf(http, "HTTP/%*s %u", &status);
+            if ((200 != status) && (201 != status)) {
+                Serial.printf("WHIP server said %u\n", status);
+                fail("offer refused");
+            } else if (!parse_answer(body)) {
+                fail("answer has no ICE details");
+            } else {
+                Serial.printf("WHIP answer, %s ICE, payload %u\n",
+                    remote_lite ? "lite" : "full", payload_type);
+                last_check = 0;
+                enter(WHIP_ICE);
+            }
+            return;
+        }
+    }
+    if (closed) {
+        fail("closed before the answer");
+    } else if (http_done >= (WHIP_HTTP_SIZE - 1)) {
+        fail("answer too big");
+    } else if ((millis() - state_started) > WHIP_HTTP_TIMEOUT_MS) {
+        fail("answer timeout");
+    }
+}
+
+static void start_media(const struct sockaddr_in *to)
+{
+    if (WHIP_MEDIA==state) {
+        return;
+    }
+    media_to = *to;
+    marker = true;
+    __sync_synchronize();   // the address before the flag
+    media_on = true;
+    Serial.printf("WHIP sending to %s:%u\n", inet_ntoa(to->sin_addr),
+        ntohs(to->sin_port));
+    enter(WHIP_MEDIA);
+}
+
+// STUN checks and answers, anything else is dropped
+static void read_udp()
+{
+    while (true) {
+        struct sockaddr_in from;
+        socklen_t from_length = sizeof(from);
+        int got = recvfrom(udp_fd, udp_in, sizeof(udp_in), MSG_DONTWAIT,
+            (struct sockaddr *) &from, &from_length);
+        if (got <= 0) {
+            return;
+        }
+        if (!stun_isMessage(udp_in, got)) {
+            stats_dropped++;
+            continue;
+        }
+        boolean use_candidate = false;
+        if (stun_checkRequest(udp_in, got, local_ufrag, local_pwd, &use_candidate)) {
+            size_t length = stun_makeResponse(udp_in, &from, local_pwd, stun_out);
+            sendto(udp_fd, stun_out, length, MSG_DONTWAIT,
+                (struct sockaddr *) &from, sizeof(from));
+            stats_checks_answered++;
+            last_consent = millis();
+            if (use_candidate && !remote_lite) {
+                start_media(&from);
+            }
+        } else if (remote_lite &&
+                stun_checkResponse(udp_in, got, transaction, remote_pwd)) {
+            last_consent = millis();
+            start_media(&candidate);
+        } else {
+            stats_checks_bad++;
+        }
+    }
+}
+
+// when the server is ICE-lite we're the controlling agent
+static void send_check()
+{
+    uint32_t interval = (WHIP_MEDIA==state) ? WHIP_CONSENT_MS : WHIP_CHECK_MS;
+    if (!remote_lite || !have_candidate || ((millis() - last_check) < interval)) {
+        return;
+    }
+    last_check = millis();
+    // peer reflexive priority, RFC 8445 7.1.1
+    uint32_t priority = (110 << 24) | (65535 << 8) | 255;
+    size_t length = stun_makeRequest(check_username, remote_pwd, priority,
+        tie_breaker, transaction, stun_out);
+    sendto(udp_fd, stun_out, length, MSG_DONTWAIT,
+        (struct sockaddr *) &candidate, sizeof(candidate));
+    stats_checks_sent++;
+}
+
+void whip_run()
+{
+    switch (state) {
+        case WHIP_IDLE:
+            return;
+        case WHIP_DNS:
+            step_dns();
+            break;
+        case WHIP_CONNECTING:
+            step_connecting();
+            break;
+        case WHIP_SENDING:
+            step_sending();
+            break;
+        case WHIP_AWAITING:
+            step_awaiting();
+            break;
+        case WHIP_ICE:
+            read_udp();
+            send_check();
+            if ((WHIP_ICE==state) &&
+                    ((millis() - state_started) > WHIP_ICE_TIMEOUT_MS)) {
+                fail("ICE timeout");
+            }
+            break;
+        case WHIP_MEDIA:
+            read_udp();
+            send_check();
+            if ((millis() - last_consent) > WHIP_CONSENT_LOST_MS) {
+                fail("consent lost");
+            }
+            break;
+        case WHIP_BACKOFF:
+            if (udp_fd >= 0) {
+                read_udp();     // keep the socket empty
+            }
+            if ((millis() - state_started) > WHIP_BACKOFF_MS) {
+                enter(WHIP_DNS);
+            }
+            break;
+    }
+}
+
+//------------------------------------------------------------------
+//
+// Media .. the Opus task
+//
+
+void whip_sendOpus(const uint8_t *packet, size_t length, uint32_t samples)
+{
+    if (WHIP_IDLE==state) {
+        return;
+    }
+    if (!media_on) {
+        stats_not_ready++;
+        return;
+    }
+    if ((12 + length + SRTP_AUTH_TAG_SIZE) > sizeof(rtp_packet)) {
+        stats_too_big++;
+        return;
+    }
+    uint8_t *p = rtp_packet;
+    p[0] = 0x80;                                // version 2
+    p[1] = (marker ? 0x80 : 0) | payload_type;
+    p[2] = sequence >> 8;
+    p[3] = sequence;
+    p[4] = timestamp >> 24;
+    p[5] = timestamp >> 16;
+    p[6] = timestamp >> 8;
+    p[7] = timestamp;
+    p[8] = ssrc >> 24;
+    p[9] = ssrc >> 16;
+    p[10] = ssrc >> 8;
+    p[11] = ssrc;
+    memcpy(&p[12], packet, length);
+    marker = false;
+    sequence++;
+    timestamp += samples;
+
+    int64_t start = esp_timer_get_time();
+    size_t size = srtp_protect(&srtp, p, 12 + length);
+    uint32_t us = esp_timer_get_time() - start;
+    stats_srtp_us += us;
+    if (us > stats_srtp_worst_us) {
+        stats_srtp_worst_us = us;
+    }
+    int sent = sendto(udp_fd, p, size, MSG_DONTWAIT,
+        (struct sockaddr *) &media_to, sizeof(media_to));
+    if (sent < 0) {
+        stats_send_errors++;
+    } else {
+        stats_packets++;
+        stats_bytes += sent;
+    }
+}
+
+void whip_printStats()
+{
+    if (WHIP_IDLE==state) {
+        return;
+    }
+    Serial.printf("WHIP %s, %u offers, %u failures (last: %s)\n",
+        state_names[state], stats_offers, stats_failures, stats_last_failure);
+    Serial.printf("WHIP ICE %u checks answered, %u sent, %u bad, "
+        "%u other packets dropped\n", stats_checks_answered,
+        stats_checks_sent, stats_checks_bad, stats_dropped);
+    Serial.printf("WHIP media %u packets, %u bytes, %u send errors, "
+        "%u before ICE, %u too big, SRTP %u us average, %u us worst\n",
+        stats_packets, stats_bytes, stats_send_errors, stats_not_ready,
+        stats_too_big,
+        stats_packets ? (uint32_t) (stats_srtp_us / stats_packets) : 0,
+        stats_srtp_worst_us);
+}
+
+//
+// END OF whip_output.cpp
@@ -0,0 +1,84 @@
+//
+// whip_output.h
+
+//
+// A send only WebRTC publisher (WHIP, RFC 9725), for codec = opus.
+//
+// Browsers play WebRTC with well under a second of delay, so a remote
+// studio can hear us that quickly through any WHIP server that passes
+// the stream on. We POST an SDP offer (audio, sendonly, Opus) to
+// remote_whip_url and its answer tells us where to send.
+//
+// We are ICE-lite (RFC 8445 2.5). The offer has one host candidate,
+// our UDP socket, and we answer the server's STUN checks on it (see
+// stun.h). The address the nominating check came from is where the
+// media goes. If the server is ICE-lite as well we send the checks
+// ourselves, to the first UDP candidate in the answer, and keep
+// sending one every WHIP_CONSENT_MS so it knows we're still here.
+// No checks (or answers) for WHIP_CONSENT_LOST_MS and we start again
+// with a new offer. The old session isn't DELETEd, the server drops it
+// when its consent checks stop being answered.
+//
+// The packets are Opus over RTP (RFC 7587), SRTP protected (see
+// srtp.h). The keys go in the offer as an a=crypto line (SDES,
+// RFC 4568), mbedtls in the ESP32 core can't do the DTLS-SRTP
+// handshake, so the server has to accept SDES keying and the offer
+// has to go over http, or a TLS proxy on the LAN. There's no receive
+// path .. anything that isn't STUN is read and dropped, and no RTCP
+// is sent.
+//
+//  remote_whip         = 1 to turn it on (needs codec = opus)
+//  remote_whip_url     = http://host:port/whip/endpoint
+//  remote_whip_token   = the Bearer token, if the server wants one
+//
+// whip_run() is called from the stream task, whip_sendOpus() from the
+// Opus task.
+//
+
+#ifndef _WHIP_OUTPUT_H_
+#define _WHIP_OUTPUT_H_
+
+#include <Arduino.h>
+
+enum {
+    WHIP_IDLE = 0,
+    WHIP_DNS,
+    WHIP_CONNECTING,
+    WHIP_SENDING,
+    WHIP_AWAITING,
+    WHIP_ICE,
+    WHIP_MEDIA,
+    WHIP_BACKOFF,
+    WHIP_STATES
+};
+
+enum {
+    WHIP_HTTP_SIZE          = 4096,     // the offer, then the answer
+    WHIP_PACKET_SIZE        = 1500,
+    WHIP_UFRAG_LENGTH       = 8,
+    WHIP_PWD_LENGTH         = 24,
+    WHIP_PAYLOAD_OPUS       = 111,      // unless the answer says
+    WHIP_HTTP_TIMEOUT_MS    = 5000,
+    WHIP_ICE_TIMEOUT_MS     = 10000,
+    WHIP_CHECK_MS           = 50,       // when the server is ICE-lite
+    WHIP_CONSENT_MS         = 5000,
+    WHIP_CONSENT_LOST_MS    = 30000,
+    WHIP_BACKOFF_MS         = 5000
+};
+
+// reads the settings, false if it's off or the stream isn't Opus
+// (channels is 0)
+boolean whip_begin(uint32_t channels);
+
+// from the stream task .. the offer and answer, then ICE
+void whip_run();
+
+// from the Opus task .. one packet of samples at 48kHz
+void whip_sendOpus(const uint8_t *packet, size_t length, uint32_t samples);
+
+void whip_printStats();
+
+#endif
+
+//
+// END OF whip_output.h
@@ -0,0 +1,355 @@
+//
+// ws_audio.cpp
+
+#include "ws_audio.h"
+#include "mp3_frame.h"
+#include "../ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+
+static boolean enabled = false;
+static uint32_t lag_ms = WS_AUDIO_LAG_MS;
+
+// our place in the encoder ring, only kept while someone is listening
+static uint32_t (*ring_head)() = NULL;
+static uint32_t (*ring_oldest)() = NULL;
+static uint8_t *(*ring_get)(uint32_t, size_t*) = NULL;
+static boolean have_cursor = false;
+static uint32_t cursor = 0;
+
+// ring buffers are copied in here and cut into frames
+static const size_t STAGING_SIZE = 8192;
+static uint8_t *staging = NULL;
+static size_t staged_start = 0;
+static size_t staged_end = 0;
+
+// the frames that were cut, each one in one piece in history
+typedef struct {
+    uint32_t offset;
+    uint32_t length;
+    uint32_t timestamp;     // in samples
+    uint32_t at;            // millis() when it was cut
+} ws_audio_frame;
+
+static uint8_t *history = NULL;
+static size_t history_end = 0;
+static ws_audio_frame frames[WS_AUDIO_FRAMES];
+static uint32_t oldest_frame = 0;
+static uint32_t next_frame = 0;     // the number the next one gets
+static uint32_t timestamp = 0;
+
+typedef struct {
+    ToolkitWiFi_Client *twfc;
+    int fd;
+    uint32_t frame;         // the next one to send
+    boolean in_message;     // part of frame has gone out
+    uint8_t head[4 + WS_AUDIO_HEADER_SIZE];
+    size_t head_length;
+    size_t sent;            // of head + the frame
+} ws_audio_client;
+
+static ws_audio_client clients[WS_AUDIO_MAX_CLIENTS];
+static uint32_t num_clients = 0;
+
+// stats
+static uint32_t stats_clients = 0;
+static uint32_t stats_most_clients = 0;
+static uint32_t stats_frames_cut = 0;
+static uint32_t stats_frames_sent = 0;
+static uint32_t stats_dropped = 0;      // frames skipped for lagging clients
+static uint32_t stats_skips = 0;        //  .. how many times
+static uint32_t stats_blocked = 0;      // sends that didn't fit
+static uint32_t stats_stuck = 0;        // closed half way through a frame
+static uint32_t stats_lost = 0;         // ring buffers we were too late for
+static uint32_t stats_skipped = 0;      // bytes that weren't frames
+
+boolean ws_audio_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*))
+{
+    if (enabled || (0==SettingItem::findUInt("local_ws_audio", 1))) {
+        return enabled;
+    }
+    size_t size = STAGING_SIZE + WS_AUDIO_HISTORY_SIZE;
+    uint8_t *memory = (uint8_t *) (psramFound() ? ps_malloc(size) : malloc(size));
+    if (NULL==memory) {
+        Serial.println("WS audio has no memory.");
+        return false;
+    }
+    staging = memory;
+    history = memory + STAGING_SIZE;
+    lag_ms = SettingItem::findUInt("local_ws_audio_lag_ms", WS_AUDIO_LAG_MS);
+    ring_head = head;
+    ring_oldest = oldest;
+    ring_get = get;
+    enabled = true;
+    return true;
+}
+
+const char *ws_audio_protocol(const char *requested)
+{
+    // the browser may offer a list, i.e. "toolkit-audio, other"
+    if (!enabled || (NULL==requested) || !strstr(requested, WS_AUDIO_PROTOCOL)) {
+        return NULL;
+    }
+    return WS_AUDIO_PROTOCOL;
+}
+
+boolean ws_audio_addClient(ToolkitWiFi_Client *twfc)
+{
+    if (!enabled || (num_clients >= WS_AUDIO_MAX_CLIENTS)) {
+        return false;
+    }
+    ws_audio_client *c = &clients[num_clients++];
+    c->twfc = twfc;
+    c->fd = twfc->client->fd();
+    // a frame at a time, as soon as we have it
+    int on = 1;
+    setsockopt(c->fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    c->frame = (next_frame > oldest_frame) ? (next_frame - 1) : next_frame;
+    c->in_message = false;
+    c->sent = 0;
+    stats_clients++;
+    if (num_clients > stats_most_clients) {
+        stats_most_clients = num_clients;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// Cutting the frames
+//
+
+static boolean overlaps(ws_audio_frame *f, size_t offset, size_t length)
+{
+    return (f->offset < (offset + length)) && (offset < (f->offset + f->length));
+}
+
+static void keep_frame(const uint8_t *data, size_t length, uint32_t samples)
+{
+    if ((history_end + length) > WS_AUDIO_HISTORY_SIZE) {
+        history_end = 0;
+    }
+    // the frames it lands on are gone
+    while ((oldest_frame < next_frame) &&
+            (((next_frame - oldest_frame) >= WS_AUDIO_FRAMES) ||
+            overlaps(&frames[oldest_frame % WS_AUDIO_FRAMES], history_end, length))) {
+        oldest_frame++;
+    }
+    ws_audio_frame *f = &frames[next_frame % WS_AUDIO_FRAMES];
+    f->offset = history_end;
+    f->length = length;
+    f->timestamp = timestamp;
+    f->at = millis();
+    memcpy(&history[history_end], data, length);
+    history_end += length;
+    timestamp += samples;
+    next_frame++;
+    stats_frames_cut++;
+}
+
+static void cut_frames()
+{
+    mp3_frame_info info;
+    while ((staged_start + MP3_HEADER_SIZE) <= staged_end) {
+        uint8_t *p = &staging[staged_start];
+        size_t available = staged_end - staged_start;
+        if (!mp3_frame_parse(p, &info)) {
+            // lost sync, skip to the next frame header
+            size_t skip = mp3_frame_find(p, available);
+            skip = skip ? skip : 1;
+            staged_start += skip;
+            stats_skipped += skip;
+            continue;
+        }
+        if (info.length > available) {
+            break;  // the rest of the frame is in the next ring buffer
+        }
+        keep_frame(p, info.length, info.samples);
+        staged_start += info.length;
+    }
+}
+
+static void read_ring()
+{
+    uint32_t head = ring_head();
+    if (!have_cursor) {
+        cursor = (head > 0) ? (head - 1) : 0;
+        staged_start = staged_end = 0;
+        oldest_frame = next_frame;  // what's left is from before
+        have_cursor = true;
+    }
+    uint32_t oldest = ring_oldest();
+    if (cursor < oldest) {
+        stats_lost += oldest - cursor;
+        cursor = oldest;
+        staged_start = staged_end = 0;
+    }
+    while (cursor < head) {
+        size_t length;
+        uint8_t *data = ring_get(cursor, &length);
+        if (NULL==data) {
+            break;  // overwritten since we looked, catch it next time
+        }
+        if (staged_start) {
+            memmove(staging, &staging[staged_start], staged_end - staged_start);
+            staged_end -= staged_start;
+            staged_start = 0;
+        }
+        if ((staged_end + length) > STAGING_SIZE) {
+            break;
+        }
+        memcpy(&staging[staged_end], data, length);
+        staged_end += length;
+        cursor++;
+        cut_frames();
+    }
+}
+
+//------------------------------------------------------------------
+//
+// Sending
+//
+
+static void start_message(ws_audio_client *c)
+{
+    ws_audio_frame *f = &frames[c->frame % WS_AUDIO_FRAMES];
+    size_t payload = WS_AUDIO_HEADER_SIZE + f->length;
+    uint8_t *p = c->head;
+    *p++ = 0x82;            // FIN | BINARY
+    if (payload <= 125) {   // the shortest length that fits, browsers check
+        *p++ = payload;
+    } else {
+        *p++ = 126;         // 16 bit payload length
+        *p++ = payload >> 8;
+        *p++ = payload;
+    }
+    uint32_t words[2] = { c->frame, f->timestamp };
+    for (uint32_t i = 0; i < 2; i++) {
+        *p++ = words[i] >> 24;
+        *p++ = words[i] >> 16;
+        *p++ = words[i] >> 8;
+        *p++ = words[i];
+    }
+    c->head_length = p - c->head;
+    c->sent = 0;
+    c->in_message = true;
+}
+
+// the next frame to start on, skipping ahead if we're too far behind
+static boolean pick_frame(ws_audio_client *c)
+{
+    if (c->frame < oldest_frame) {
+        c->frame = oldest_frame;
+    }
+    if (c->frame >= next_frame) {
+        return false;
+    }
+    uint32_t newest = next_frame - 1;
+    if ((c->frame < newest) &&
+            ((millis() - frames[c->frame % WS_AUDIO_FRAMES].at) > lag_ms)) {
+        stats_dropped += newest - c->frame;
+        stats_skips++;
+        c->frame = newest;
+    }
+    start_message(c);
+    return true;
+}
+
+// false if the client has to go
+static boolean send_frames(ws_audio_client *c)
+{
+    while (true) {
+        if (!c->in_message) {
+            if (!pick_frame(c)) {
+                return true;    // it has everything
+            }
+        } else if (c->frame < oldest_frame) {
+            stats_stuck++;      // the rest of it has gone
+            return false;
+        }
+        ws_audio_frame *f = &frames[c->frame % WS_AUDIO_FRAMES];
+        const uint8_t *data;
+        size_t length;
+        if (c->sent < c->head_length) {
+            data = &c->head[c->sent];
+            length = c->head_length - c->sent;
+        } else {
+            size_t done = c->sent - c->head_length;
+            data = &history[f->offset + done];
+            length = f->length - done;
+        }
+        int sent = ::send(c->fd, data, length, MSG_DONTWAIT);
+        if (sent < 0) {
+            if ((EAGAIN==errno) || (EWOULDBLOCK==errno)) {
+                stats_blocked++;
+                return true;    // the socket is full, try again next time
+            }
+            return false;
+        }
+        c->sent += sent;
+        c->twfc->bytes_sent += sent;
+        if (c->sent == (c->head_length + f->length)) {
+            c->in_message = false;
+            c->frame++;
+            stats_frames_sent++;
+        }
+    }
+}
+
+// The browser only ever sends us a close (or a pong), so anything that
+// comes in is read and dropped, and a close frame ends it.
+static boolean still_open(ws_audio_client *c)
+{
+    uint8_t incoming[64];
+    int got = recv(c->fd, incoming, sizeof(incoming), MSG_DONTWAIT);
+    if (0==got) {
+        return false;
+    } else if (got < 0) {
+        return (EAGAIN==errno) || (EWOULDBLOCK==errno);
+    }
+    return (0x08 != (incoming[0] & 0x0f));
+}
+
+void ws_audio_run()
+{
+    if (!enabled) {
+        return;
+    }
+    if (0==num_clients) {
+        have_cursor = false;    // start from the live edge next time
+        return;
+    }
+    read_ring();
+
+    uint32_t i = 0;
+    while (i < num_clients) {
+        ws_audio_client *c = &clients[i];
+        if (still_open(c) && send_frames(c)) {
+            // how old the frame it's waiting on is
+            c->twfc->lag_ms = (c->frame < next_frame) ?
+                (millis() - frames[c->frame % WS_AUDIO_FRAMES].at) : 0;
+            i++;
+        } else {
+            c->twfc->closeClient();
+            clients[i] = clients[--num_clients];
+        }
+    }
+}
+
+void ws_audio_printStats()
+{
+    if (!enabled) {
+        return;
+    }
+    Serial.printf("WS audio clients %u now, %u in all, %u at most\n",
+        num_clients, stats_clients, stats_most_clients);
+    Serial.printf("WS audio frames %u cut, %u sent, %u dropped in %u skips, "
+        "%u blocked sends, %u stuck\n", stats_frames_cut, stats_frames_sent,
+        stats_dropped, stats_skips, stats_blocked, stats_stuck);
+    Serial.printf("WS audio lost %u ring buffers, skipped %u bytes\n",
+        stats_lost, stats_skipped);
+}
+
+//
+// END OF ws_audio.cpp
@@ -0,0 +1,71 @@
+//
+// ws_audio.h
+
+//
+// Low latency monitoring in the browser, over a websocket.
+//
+// <audio src="stream.mp3"> is no good for checking levels while the
+// gain is being turned, the browser buffers seconds of it before it
+// plays. Instead the page opens a websocket with the subprotocol
+// "toolkit-audio" and we push it the mp3 frames as they come out of
+// the encoder, one binary message per frame:
+//
+//  [ frame number (4) | timestamp in samples (4) | the mp3 frame ]
+//
+// both big endian. The frames are whole, so they can go straight into
+// a MediaSource "audio/mpeg" buffer or a WebCodecs decoder. A gap in
+// the frame numbers is audio we dropped, the timestamp says where the
+// next frame goes (see startMonitor() in toolkit.js).
+//
+// A new monitor starts at the newest frame. Frames are sent without
+// blocking, a send that doesn't fit in the socket is picked up where
+// it stopped next time. A monitor that falls more than
+// local_ws_audio_lag_ms behind (a phone on a busy WiFi) skips to the
+// newest frame rather than hear old audio, so the delay stays under a
+// second. One that stops taking anything in the middle of a frame
+// until that frame has gone from the history is closed.
+//
+//  local_ws_audio          = 1, 0 turns it off
+//  local_ws_audio_lag_ms   = 250
+//
+// The frames are cut from the encoder ring once, into a short history
+// that all the monitors read. Everything here runs in the stream task.
+//
+
+#ifndef _WS_AUDIO_H_
+#define _WS_AUDIO_H_
+
+#include <Arduino.h>
+#include "ToolkitWiFi_Client.h"
+
+#define WS_AUDIO_PROTOCOL   "toolkit-audio"
+
+enum {
+    WS_AUDIO_MAX_CLIENTS    = 4,
+    WS_AUDIO_HISTORY_SIZE   = 24576,    // ~1.5s at 128kbps
+    WS_AUDIO_FRAMES         = 64,       // ~1.7s at 1152 samples/44.1kHz
+    WS_AUDIO_HEADER_SIZE    = 8,
+    WS_AUDIO_LAG_MS         = 250
+};
+
+// reads the settings, false if it's off
+boolean ws_audio_begin(uint32_t (*head)(), uint32_t (*oldest)(),
+    uint8_t *(*get)(uint32_t, size_t*));
+
+// the subprotocol to answer a websocket request with, or NULL if it
+// didn't ask for ours
+const char *ws_audio_protocol(const char *requested);
+
+// from the stream task .. a monitor that has had the handshake,
+// false if there's no room for it
+boolean ws_audio_addClient(ToolkitWiFi_Client *twfc);
+
+// from the stream task .. cut new frames and send them out
+void ws_audio_run();
+
+void ws_audio_printStats();
+
+#endif
+
+//
+// END OF ws_audio.h
@@ -0,0 +1,161 @@
+//
+// bench_asset_cache.cpp
+
+//
+// The web files from the flash before and after the RAM cache
+// (user-046). A browser opening the page asks for /, toolkit.js,
+// toolkit.css and favicon.ico, and that's cycled here over data/ in
+// stubs/files.cpp, with its model of LittleFS (1.5ms an open or a
+// lookup, 0.4ms a kB read) added to the time the CPU took.
+//
+// "before" is what http_handleGetRequest() did with the flash: / was
+// opened as /index.html, other files were looked for then opened, and
+// each was read out in 1k reads. favicon.ico isn't there, so that was
+// a failed open every time. "after" is send_file()'s asset_cache_fetch().
+// Both copy what they'd send into the same buffer, and have to send the
+// same bytes.
+//
+
+#include <Arduino.h>
+#include <time.h>
+#include "asset_cache.h"
+#include "test_files.h"
+#include "../src/ToolkitFiles/ToolkitFiles.h"
+
+enum {
+    CHUNK           = 1024,     // http_file.cpp's max_size
+    ROUNDS          = 200000,
+    FLASH_ROUNDS    = 500       // before, where the flash is all the time
+};
+
+typedef struct {
+    const char *url;
+    const char *path;           // on the flash
+    boolean looked_for;         // before, fileExists() first
+} request;
+
+static const request page[] = {
+    { "/",              "/index.html",  false },
+    { "/toolkit.js",    "/toolkit.js",  true },
+    { "/toolkit.css",   "/toolkit.css", true },
+    { "/favicon.ico",   "/favicon.ico", false }
+};
+static const uint32_t REQUESTS = sizeof(page) / sizeof(page[0]);
+
+static uint8_t *load(const char *name, size_t *size)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "../data/%s", name);
+    FILE *f = fopen(path, "rb");
+    if (NULL==f) {
+        printf("no %s\n", path);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = (uint8_t *) malloc(*size);
+    *size = fread(data, 1, *size, f);
+    fclose(f);
+    return data;
+}
+
+static double seconds()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + (t.tv_nsec / 1e9);
+}
+
+static char out[64 * 1024];
+static uint64_t bytes_out = 0;
+
+static void send(const void *data, size_t length)
+{
+    memcpy(out, data, length);
+    bytes_out += length;
+}
+
+static void stream(File *f, char *buffer)
+{
+    size_t actual;
+    while ((actual = f->readBytes(buffer, CHUNK)) > 0) {
+        send(buffer, actual);
+    }
+    f->close();
+}
+
+static void before(const request *r, char *buffer)
+{
+    if (r->looked_for && !ToolkitFiles::fileExists(r->path)) {
+        return;
+    }
+    File f = ToolkitFiles::fileOpen(r->path, FILE_READ);
+    if (f) {
+        stream(&f, buffer);
+    }
+}
+
+static void after(const request *r, char *buffer)
+{
+    size_t size;
+    const char *etag;
+    File f;
+    const uint8_t *cached = asset_cache_fetch(r->path, &size, &etag, &f);
+    if (cached) {
+        send(cached, size);
+    } else if (f) {
+        stream(&f, buffer);
+    }
+}
+
+static double run(const char *name, boolean cache, uint32_t rounds)
+{
+    char buffer[CHUNK];
+    bytes_out = 0;
+    uint32_t opens = test_file_opens + test_file_failed_opens + test_file_lookups;
+    uint64_t flash_us = test_flash_us();
+    double start = seconds();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < REQUESTS; i++) {
+            if (cache) {
+                after(&page[i], buffer);
+            } else {
+                before(&page[i], buffer);
+            }
+        }
+    }
+    double cpu = seconds() - start;
+    double flash = (test_flash_us() - flash_us) / 1e6;
+    double requests = (double) rounds * REQUESTS;
+    opens = test_file_opens + test_file_failed_opens + test_file_lookups - opens;
+    printf("%-7s %10.0f requests/s %8.1f bytes/request, %u flash opens "
+        "(%.3fs CPU, %.3fs flash)\n", name, requests / (cpu + flash),
+        bytes_out / requests, opens, cpu, flash);
+    return bytes_out / requests;
+}
+
+int main()
+{
+    size_t size;
+    uint8_t *index = load("index.html", &size);
+    test_file_set("/index.html", index, size);
+    uint8_t *js = load("toolkit.js", &size);
+    test_file_set("/toolkit.js", js, size);
+    uint8_t *css = load("toolkit.css", &size);
+    test_file_set("/toolkit.css", css, size);
+    asset_cache_begin();
+
+    printf("/, toolkit.js, toolkit.css and favicon.ico\n");
+    double without = run("before", false, FLASH_ROUNDS);
+    double with = run("after", true, ROUNDS);
+    if (without != with) {
+        printf("not the same bytes\n");
+        return 1;
+    }
+    asset_cache_printStats();
+    return 0;
+}
+
+//
+// END OF bench_asset_cache.cpp
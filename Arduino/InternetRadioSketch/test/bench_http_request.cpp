@@ -0,0 +1,199 @@
+//
+// bench_http_request.cpp
+
+//
+// The request parser before and after the incremental one (user-028).
+//
+// "before" is whatisit() and websocket_isWSHeader() as they were: each
+// read from the socket is taken to be one whole request, cut up with
+// strtok. "after" is http_request. Both are fed the same segments, a
+// browser's GET each time, and count the requests they got right
+// (method and path), requests a second and bytes copied (out of the
+// socket, plus anything moved down the buffer).
+//
+
+#include <Arduino.h>
+#include <time.h>
+#include "http_request.h"
+
+static const char browser_get[] =
+    "GET /toolkit.js HTTP/1.1\r\n"
+    "Host: 192.168.4.1\r\n"
+    "Connection: keep-alive\r\n"
+    "User-Agent: Mozilla/5.0 (Linux; Android 14; Pixel 8) AppleWebKit/537.36 "
+        "(KHTML, like Gecko) Chrome/128.0.0.0 Mobile Safari/537.36\r\n"
+    "Accept: */*\r\n"
+    "Referer: http://192.168.4.1/\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Accept-Language: en-GB,en;q=0.9\r\n"
+    "If-None-Match: \"6f81ad50beccf6ab\"\r\n"
+    "\r\n";
+
+enum {
+    MAX_PACKET_SIZE = 1024,
+    WS_KEY_LEN      = 24,
+    ROUNDS          = 200000
+};
+
+//------------------------------------------------------------------
+//
+// before
+
+static uint64_t old_copied = 0;
+static char ws_key_from_client[WS_KEY_LEN];
+
+static const char *old_isWSHeader(char *request_buffer, int request_length)
+{
+    char *header = strstr(request_buffer, "Sec-WebSocket-Key");
+    if (header) {
+        header += 19;
+        int remaining = request_length - (header - request_buffer);
+        if (remaining < WS_KEY_LEN) {
+            return 0;
+        }
+        memcpy(ws_key_from_client, header, WS_KEY_LEN);
+        old_copied += WS_KEY_LEN;
+        return ws_key_from_client;
+    }
+    return 0;
+}
+
+// true if it found a GET for /toolkit.js
+static boolean old_whatisit(char *buffer, size_t size)
+{
+    buffer[size] = 0;
+    char *get = strtok(buffer, " ");
+    if ((NULL==get) || (0 != strcmp("GET", get))) {
+        return false;
+    }
+    size_t getsize = strlen(get) + 1;
+    buffer = get + getsize;
+    size = size - getsize;
+    if (old_isWSHeader(buffer, size)) {
+        return false;
+    }
+    char *path = strtok(NULL, " ");
+    return path && (0==strcmp("/toolkit.js", path));
+}
+
+static char http_buffer[MAX_PACKET_SIZE];
+
+static uint32_t old_segment(const char *data, size_t length)
+{
+    if (length > (MAX_PACKET_SIZE - 1)) {
+        length = MAX_PACKET_SIZE - 1;
+    }
+    memcpy(http_buffer, data, length);      // readBytes()
+    old_copied += length;
+    return old_whatisit(http_buffer, length) ? 1 : 0;
+}
+
+//------------------------------------------------------------------
+//
+// after
+
+static char request_buffer[MAX_PACKET_SIZE];
+static http_request request;
+static uint64_t new_copied = 0;
+
+static uint32_t new_segment(const char *data, size_t length)
+{
+    uint32_t found = 0;
+    char *where;
+    size_t space = http_request_space(&request, &where);
+    if (length > space) {
+        length = space;
+    }
+    memcpy(where, data, length);            // readBytes()
+    new_copied += length;
+    http_request_add(&request, length);
+    while (HTTP_REQUEST_COMPLETE==http_request_parse(&request)) {
+        if ((HTTP_METHOD_GET==request.method) &&
+                (0==strcmp("/toolkit.js", request.path))) {
+            found++;
+        }
+        size_t moved = request.used - request.header_length;
+        http_request_next(&request, 0);
+        new_copied += moved;
+    }
+    return found;
+}
+
+//------------------------------------------------------------------
+
+static double seconds()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + (t.tv_nsec / 1e9);
+}
+
+// segments of one round, and the requests in them
+typedef struct {
+    const char *name;
+    char data[4][MAX_PACKET_SIZE];
+    size_t length[4];
+    uint32_t count;
+    uint32_t requests;
+} workload;
+
+static void run(const workload *w)
+{
+    for (uint32_t after = 0; after < 2; after++) {
+        uint64_t found = 0;
+        old_copied = 0;
+        new_copied = 0;
+        http_request_init(&request, request_buffer, sizeof(request_buffer));
+        double start = seconds();
+        for (uint32_t round = 0; round < ROUNDS; round++) {
+            for (uint32_t i = 0; i < w->count; i++) {
+                found += after ? new_segment(w->data[i], w->length[i]) :
+                    old_segment(w->data[i], w->length[i]);
+            }
+        }
+        double elapsed = seconds() - start;
+        uint64_t expected = (uint64_t) ROUNDS * w->requests;
+        uint64_t copied = after ? new_copied : old_copied;
+        printf("%-22s %-6s %7.1f%% right %10.0f requests/s %6.1f bytes copied/request\n",
+            w->name, after ? "after" : "before", 100.0 * found / expected,
+            expected / elapsed, (double) copied / expected);
+    }
+}
+
+int main()
+{
+    size_t length = sizeof(browser_get) - 1;
+    static workload whole, split, pipelined;
+
+    whole.name = "one per segment";
+    memcpy(whole.data[0], browser_get, length);
+    whole.length[0] = length;
+    whole.count = 1;
+    whole.requests = 1;
+
+    // a slow link, the header comes in two, cut in the path
+    split.name = "split in two";
+    memcpy(split.data[0], browser_get, 10);
+    split.length[0] = 10;
+    memcpy(split.data[1], &browser_get[10], length - 10);
+    split.length[1] = length - 10;
+    split.count = 2;
+    split.requests = 1;
+
+    // a browser reusing the connection for the page's files
+    pipelined.name = "two pipelined";
+    memcpy(pipelined.data[0], browser_get, length);
+    memcpy(&pipelined.data[0][length], browser_get, length);
+    pipelined.length[0] = 2 * length;
+    pipelined.count = 1;
+    pipelined.requests = 2;
+
+    printf("%u byte GET, %u rounds\n", (unsigned) length, ROUNDS);
+    run(&whole);
+    run(&split);
+    run(&pipelined);
+    return 0;
+}
+
+//
+// END OF bench_http_request.cpp
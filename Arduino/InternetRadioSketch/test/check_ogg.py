@@ -0,0 +1,61 @@
+#
+# check_ogg.py
+#
+# Reads the stream test_ogg_opus writes with mutagen's Ogg and Opus
+# readers, not ours. Each page has to come back byte for byte when
+# mutagen writes it out again with its own CRC, and OggOpus has to
+# find the OpusHead and the length from the last granule position.
+#
+# With a second file, the WAV opusdec made from the stream, that has to
+# have the same length and channels (ogg_reference's real Opus).
+#
+#   python3 check_ogg.py build/test_ogg_opus.opus
+#   python3 check_ogg.py build/ogg_reference.opus build/ogg_reference.wav
+#
+
+import struct
+import sys
+import wave
+
+from mutagen.ogg import OggPage
+from mutagen.oggopus import OggOpus
+
+def main(path, wav_path=None):
+    data = open(path, "rb").read()
+    pages = []
+    with open(path, "rb") as f:
+        while f.tell() < len(data):
+            start = f.tell()
+            page = OggPage(f)
+            if page.write() != data[start:f.tell()]:
+                print("%s: page %d doesn't match mutagen's" % (path, page.sequence))
+                return 1
+            pages.append(page)
+
+    packets = OggPage.to_packets(pages)
+    pre_skip = struct.unpack("<H", packets[0][10:12])[0]
+    opus = OggOpus(path)
+    granule = pages[-1].position
+    expected = (granule - pre_skip) / 48000.0
+    if (opus.info.channels != 2) or (abs(opus.info.length - expected) > 1e-6):
+        print("%s: %d channels, %.3fs, expected 2 and %.3fs" % (path,
+            opus.info.channels, opus.info.length, expected))
+        return 1
+    print("%s: %d pages, %d packets, %d channels, %.3fs, ok" % (path,
+        len(pages), len(packets) - 2, opus.info.channels, opus.info.length))
+
+    if wav_path:
+        w = wave.open(wav_path, "rb")
+        if (w.getnchannels() != 2) or (w.getnframes() != granule - pre_skip):
+            print("%s: %d channels, %d samples, expected 2 and %d" % (wav_path,
+                w.getnchannels(), w.getnframes(), granule - pre_skip))
+            return 1
+        print("%s: %d samples, %.3fs, ok" % (wav_path, w.getnframes(),
+            w.getnframes() / 48000.0))
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main(*sys.argv[1:3]))
+
+#
+# END OF check_ogg.py
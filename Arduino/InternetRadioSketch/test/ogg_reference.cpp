@@ -0,0 +1,241 @@
+//
+// ogg_reference.cpp
+
+//
+// Real Opus through opus_stream and ogg_opus (user-043), decoded by
+// libopusfile, which is not ours. test_ogg_opus checks the pages with
+// packets that are random bytes. Here opus_stream.cpp is built with
+// USE_OPUS_ENCODER=1 against the host's libopus, and a VS1063a stand in
+// hands it what the real one does for codec = opus: a 44 byte RIFF
+// header, then 48kHz stereo PCM, a FIFO's worth at a time. That's a
+// 1kHz tone on the left and 440Hz on the right for FRAMES 20ms frames,
+// and a bit more that never makes a whole frame.
+//
+// The stream written to the file has to open with op_test_file(), with
+// the channels and the pre-skip libopus asks for. op_pcm_total() and
+// what op_read() gives back have to be the samples that went in less
+// the pre-skip, and the decoded audio has to line up with the input
+// sample for sample (a RIFF header left in would shift it 11 samples).
+//
+//   ./build/ogg_reference build/ogg_reference.opus
+//
+// "make ogg-reference" builds it (it needs libopus and libopusfile,
+// with pkg-config) and puts the file through check_ogg.py and opusdec.
+//
+
+#include "test.h"
+#include "../src/ToolkitVLSI/opus_stream.h"
+#include "ogg_opus.h"
+#include <math.h>
+#include <opus.h>
+#include <opusfile.h>
+
+enum {
+    CHANNELS        = 2,
+    FRAMES          = 250,      // 5s, 50 pages
+    EXTRA           = 500,      // per channel, less than a frame
+    INPUT_FRAMES    = (FRAMES * OPUS_STREAM_FRAME_SAMPLES) + EXTRA,
+    HEADER_SIZE     = 44,
+    FIFO_SAMPLES    = 1024,     // what one read of the VS1063a gets at most
+    SKIP_SAMPLES    = OPUS_STREAM_FRAME_SAMPLES,    // the decoder settling
+    MAX_LAG         = 20,
+    MIN_SNR_DB      = 12        // lined up, a shifted tone is ~0dB
+};
+
+// the VS1063a .. only encoder_getSamples() gets called
+ToolkitVLSI::ToolkitVLSI(int8_t cs, int8_t dcs, int8_t dreq)
+{
+    _cs = cs;
+    _dcs = dcs;
+    _dreq = dreq;
+    spi_dev_ctrl = NULL;
+    spi_dev_data = NULL;
+}
+
+ToolkitVLSI::~ToolkitVLSI()
+{
+}
+
+ToolkitVS1063::ToolkitVS1063(int8_t cs, int8_t dcs, int8_t dreq)
+    : ToolkitVLSI(cs, dcs, dreq)
+{
+}
+
+static int16_t input[INPUT_FRAMES * CHANNELS];
+static int16_t vs_stream[(HEADER_SIZE / 2) + (INPUT_FRAMES * CHANNELS)];
+static size_t vs_length = 0;
+static size_t vs_read = 0;
+static size_t vs_fifo = 0;
+
+uint16_t ToolkitVS1063::encoder_getSamples(int16_t *where, uint16_t where_samples)
+{
+    size_t got = vs_length - vs_read;
+    if (got > vs_fifo) {
+        got = vs_fifo;
+    }
+    if (got > where_samples) {
+        got = where_samples;
+    }
+    memcpy(where, &vs_stream[vs_read], got * sizeof(int16_t));
+    vs_read += got;
+    vs_fifo -= got;
+    return got;
+}
+
+// what the WHIP publisher would have been sent
+static uint32_t whip_packets = 0;
+
+void whip_sendOpus(const uint8_t *packet, size_t length, uint32_t samples)
+{
+    CHECK(OPUS_STREAM_FRAME_SAMPLES==samples);
+    whip_packets++;
+}
+
+static FILE *out = NULL;
+
+static void write_page(const uint8_t *page, size_t length)
+{
+    CHECK(length==fwrite(page, 1, length, out));
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+// the WAV file the VS1063a starts its PCM with
+static void make_vs_stream()
+{
+    uint8_t header[HEADER_SIZE];
+    memset(header, 0, sizeof(header));
+    memcpy(&header[0], "RIFF", 4);
+    put32(&header[4], 0xffffffff);
+    memcpy(&header[8], "WAVEfmt ", 8);
+    put32(&header[16], 16);
+    header[20] = 1;                     // PCM
+    header[22] = CHANNELS;
+    put32(&header[24], OPUS_STREAM_RATE);
+    put32(&header[28], OPUS_STREAM_RATE * CHANNELS * 2);
+    header[32] = CHANNELS * 2;
+    header[34] = 16;
+    memcpy(&header[36], "data", 4);
+    put32(&header[40], 0xffffffff);
+    memcpy(vs_stream, header, sizeof(header));
+
+    for (uint32_t i = 0; i < INPUT_FRAMES; i++) {
+        input[(i * 2)] = 8000 * sin((2 * M_PI * 1000 * i) / OPUS_STREAM_RATE);
+        input[(i * 2) + 1] = 8000 * sin((2 * M_PI * 440 * i) / OPUS_STREAM_RATE);
+    }
+    memcpy(&vs_stream[HEADER_SIZE / 2], input, sizeof(input));
+    vs_length = (HEADER_SIZE / 2) + (INPUT_FRAMES * CHANNELS);
+}
+
+static int16_t decoded[INPUT_FRAMES * CHANNELS];
+
+int main(int argc, char **argv)
+{
+    const char *path = (argc > 1) ? argv[1] : "build/ogg_reference.opus";
+    make_vs_stream();
+
+    // what libopus will ask for, as opus_stream_begin() sets it up
+    int error;
+    OpusEncoder *e = opus_encoder_create(OPUS_STREAM_RATE, CHANNELS,
+        OPUS_APPLICATION_AUDIO, &error);
+    CHECK(OPUS_OK==error);
+    opus_encoder_ctl(e, OPUS_SET_COMPLEXITY(OPUS_STREAM_COMPLEXITY));
+    opus_int32 lookahead = 0;
+    opus_encoder_ctl(e, OPUS_GET_LOOKAHEAD(&lookahead));
+    opus_encoder_destroy(e);
+
+    out = fopen(path, "wb");
+    CHECK(NULL != out);
+    if (NULL==out) {
+        return TEST_END();
+    }
+    CHECK(opus_stream_begin(CHANNELS, write_page));
+    uint8_t headers[OGG_OPUS_HEADERS_SIZE];
+    size_t length = ogg_opus_headers(headers, sizeof(headers));
+    CHECK(length > 0);
+    write_page(headers, length);
+
+    // the encoder task and the Opus task taking turns
+    ToolkitVS1063 vs(0, 0, 0);
+    while (vs_read < vs_length) {
+        vs_fifo = FIFO_SAMPLES;
+        opus_stream_capture(&vs);
+        opus_stream_run();
+    }
+    opus_stream_printStats();
+    fclose(out);
+    CHECK(FRAMES==whip_packets);
+
+    OggOpusFile *of = op_test_file(path, &error);
+    CHECK(NULL != of);
+    if (NULL==of) {
+        printf("op_test_file: %d\n", error);
+        return TEST_END();
+    }
+    CHECK(0==op_test_open(of));
+    const OpusHead *head = op_head(of, -1);
+    CHECK(CHANNELS==head->channel_count);
+    CHECK((uint32_t) lookahead==head->pre_skip);
+    CHECK(OPUS_STREAM_RATE==head->input_sample_rate);
+
+    ogg_int64_t total = op_pcm_total(of, -1);
+    ogg_int64_t expected = (FRAMES * OPUS_STREAM_FRAME_SAMPLES) - head->pre_skip;
+    CHECK(total==expected);
+
+    size_t samples = 0;
+    while (samples < INPUT_FRAMES) {
+        int got = op_read(of, &decoded[samples * CHANNELS],
+            (INPUT_FRAMES - samples) * CHANNELS, NULL);
+        CHECK(got >= 0);
+        if (got <= 0) {
+            break;
+        }
+        samples += got;
+    }
+    op_free(of);
+    CHECK((ogg_int64_t) samples==total);
+    printf("%s: %u samples, %.3fs decoded, %.3fs went in (pre-skip %u)\n",
+        path, (unsigned) samples, (double) samples / OPUS_STREAM_RATE,
+        (double) INPUT_FRAMES / OPUS_STREAM_RATE, head->pre_skip);
+
+    // decoded sample n is input sample n
+    if (samples > (SKIP_SAMPLES + MAX_LAG)) {
+        int best_lag = 0;
+        double best = 0;
+        for (int lag = -MAX_LAG; lag <= MAX_LAG; lag++) {
+            double sum = 0;
+            for (size_t i = SKIP_SAMPLES; i < (samples - MAX_LAG); i++) {
+                for (uint32_t c = 0; c < CHANNELS; c++) {
+                    sum += (double) decoded[(i * CHANNELS) + c] *
+                        input[((i + lag) * CHANNELS) + c];
+                }
+            }
+            if (sum > best) {
+                best = sum;
+                best_lag = lag;
+            }
+        }
+        double signal = 0;
+        double noise = 0;
+        for (size_t i = SKIP_SAMPLES * CHANNELS; i < (samples * CHANNELS); i++) {
+            double diff = (double) decoded[i] - input[i];
+            signal += (double) input[i] * input[i];
+            noise += diff * diff;
+        }
+        double snr = 10 * log10(signal / (noise + 1));
+        printf("%s: best lined up %d samples off, %.1fdB SNR\n", path,
+            best_lag, snr);
+        CHECK(0==best_lag);
+        CHECK(snr >= MIN_SNR_DB);
+    }
+    return TEST_END();
+}
+
+//
+// END OF ogg_reference.cpp
@@ -0,0 +1,61 @@
+//
+// Arduino.h .. just enough of the ESP32 core for the host tests
+
+#ifndef _TEST_ARDUINO_H_
+#define _TEST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+typedef bool boolean;
+
+class HardwareSerial
+{
+    public:
+        int printf(const char *format, ...)
+            __attribute__((format(printf, 2, 3)));
+        void println(const char *text);
+};
+
+extern HardwareSerial Serial;
+
+// the tests set these .. micros() is test_millis and test_us past it
+extern uint32_t test_millis;
+extern uint32_t test_us;
+extern boolean test_psram;
+
+// what's been printed to Serial since test_serial_clear(), and
+// whether it goes to stdout as well
+extern char test_serial[4096];
+extern boolean test_serial_echo;
+void test_serial_clear();
+
+uint32_t millis();
+uint32_t micros();
+int64_t esp_timer_get_time();
+void delay(uint32_t ms);
+uint32_t esp_random();
+boolean psramFound();
+void *ps_malloc(size_t size);
+
+// the tests run on one thread, so the spinlocks have nothing to do
+typedef struct {
+    int unused;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    {0}
+#define portENTER_CRITICAL(mux)         ((void) (mux))
+#define portEXIT_CRITICAL(mux)          ((void) (mux))
+
+// nor any other task to wait for
+#define portTICK_PERIOD_MS              1
+static inline void vTaskDelay(uint32_t ticks) {}
+
+#endif
+
+//
+// END OF Arduino.h
@@ -0,0 +1,66 @@
+//
+// FS.h .. a read only File over bytes in memory, for the host tests
+
+#ifndef _TEST_FS_H_
+#define _TEST_FS_H_
+
+#include <Arduino.h>
+
+#define FILE_READ       "r"
+#define FILE_WRITE      "w"
+#define FILE_APPEND     "a"
+
+// every byte read from any File (see test_flash_us() in files.cpp)
+extern uint64_t test_file_bytes_read;
+
+class File
+{
+    public:
+        File() : data(NULL), length(0), at(0) {}
+        File(const uint8_t *bytes, size_t size) :
+            data(bytes), length(size), at(0) {}
+
+        operator bool() const { return NULL != data; }
+        size_t size() const { return length; }
+        size_t position() const { return at; }
+        int available() const { return length - at; }
+        bool seek(uint32_t position)
+        {
+            if (position > length) {
+                return false;
+            }
+            at = position;
+            return true;
+        }
+        size_t read(uint8_t *buffer, size_t size)
+        {
+            if (size > (length - at)) {
+                size = length - at;
+            }
+            memcpy(buffer, &data[at], size);
+            at += size;
+            test_file_bytes_read += size;
+            return size;
+        }
+        size_t readBytes(char *buffer, size_t size)
+        {
+            return read((uint8_t *) buffer, size);
+        }
+        size_t write(const uint8_t *buffer, size_t size) { return 0; }
+        void close() { data = NULL; }
+
+        // there are no directories
+        bool isDirectory() const { return false; }
+        File openNextFile() { return File(); }
+        const char *name() const { return ""; }
+
+    private:
+        const uint8_t *data;
+        size_t length;
+        size_t at;
+};
+
+#endif
+
+//
+// END OF FS.h
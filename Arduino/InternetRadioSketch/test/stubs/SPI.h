@@ -0,0 +1,22 @@
+//
+// SPI.h .. only so ToolkitVLSI.h compiles, nothing here talks SPI
+
+#ifndef _TEST_SPI_H_
+#define _TEST_SPI_H_
+
+#include <Arduino.h>
+
+class SPISettings
+{
+    public:
+        SPISettings(uint32_t clock, uint8_t order, uint8_t mode) {}
+};
+
+class SPIClass
+{
+};
+
+#endif
+
+//
+// END OF SPI.h
@@ -0,0 +1,55 @@
+//
+// WiFi.h .. a WiFiClient that keeps what the code under test sends it,
+// and has nothing to read
+
+#ifndef _TEST_WIFI_H_
+#define _TEST_WIFI_H_
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+class WiFiClient
+{
+    public:
+        enum {
+            KEPT = 64 * 1024        // the first this many bytes sent
+        };
+
+        WiFiClient() : sent(0) {}
+
+        int printf(const char *format, ...)
+            __attribute__((format(printf, 2, 3)))
+        {
+            char text[2048];
+            va_list args;
+            va_start(args, format);
+            int length = vsnprintf(text, sizeof(text), format, args);
+            va_end(args);
+            return write(text, length);
+        }
+        size_t write(const char *data, size_t size)
+        {
+            if (sent < KEPT) {
+                memcpy(&out[sent], data, ((sent + size) > KEPT) ? (KEPT - sent) : size);
+            }
+            sent += size;
+            return size;
+        }
+        size_t write(const uint8_t *data, size_t size)
+        {
+            return write((const char *) data, size);
+        }
+        operator bool() { return true; }
+        uint8_t connected() { return 1; }
+        int available() { return 0; }
+        size_t readBytes(char *buffer, size_t size) { return 0; }
+        void stop() {}
+
+        size_t sent;
+        char out[KEPT];
+};
+
+#endif
+
+//
+// END OF WiFi.h
@@ -0,0 +1,99 @@
+//
+// files.cpp .. ToolkitFiles over files in memory, for the host tests
+
+#include "test_files.h"
+#include "../../src/ToolkitFiles/ToolkitFiles.h"
+
+enum {
+    TEST_FILES      = 64,
+    FLASH_OPEN_US   = 1500,     // LittleFS on the ESP32, an open or a lookup
+    FLASH_KB_US     = 400       // and reading
+};
+
+typedef struct {
+    char path[64];
+    const uint8_t *data;
+    size_t size;
+} test_file;
+
+static test_file files[TEST_FILES];
+
+uint32_t test_file_opens = 0;
+uint32_t test_file_failed_opens = 0;
+uint32_t test_file_lookups = 0;
+
+static test_file *find(const char *path)
+{
+    for (uint32_t i = 0; i < TEST_FILES; i++) {
+        if (files[i].data && (0==strcmp(path, files[i].path))) {
+            return &files[i];
+        }
+    }
+    return NULL;
+}
+
+void test_file_set(const char *path, const uint8_t *data, size_t size)
+{
+    test_file *f = find(path);
+    if (NULL==f) {
+        for (uint32_t i = 0; (i < TEST_FILES) && (NULL==f); i++) {
+            if (NULL==files[i].data) {
+                f = &files[i];
+            }
+        }
+    }
+    snprintf(f->path, sizeof(f->path), "%s", path);
+    f->data = data;
+    f->size = size;
+}
+
+void test_file_clear()
+{
+    memset(files, 0, sizeof(files));
+    test_file_opens = 0;
+    test_file_failed_opens = 0;
+    test_file_lookups = 0;
+    test_file_bytes_read = 0;
+}
+
+uint64_t test_flash_us()
+{
+    uint64_t opens = test_file_opens + test_file_failed_opens + test_file_lookups;
+    return (opens * FLASH_OPEN_US) + ((test_file_bytes_read * FLASH_KB_US) / 1024);
+}
+
+boolean ToolkitFiles::fileExists(const char *path)
+{
+    test_file_lookups++;
+    return NULL != find(path);
+}
+
+File ToolkitFiles::fileOpen(const char *path, const char *mode)
+{
+    test_file *f = find(path);
+    if ((NULL==f) || strcmp(mode, FILE_READ)) {
+        test_file_failed_opens++;
+        return File();
+    }
+    test_file_opens++;
+    return File(f->data, f->size);
+}
+
+// the flash here is read only, apart from taking files away
+boolean ToolkitFiles::fileWrite(const char *path, const char *buffer,
+    size_t size, boolean append)
+{
+    return false;
+}
+
+boolean ToolkitFiles::fileRemove(const char *path)
+{
+    test_file *f = find(path);
+    if (f) {
+        f->data = NULL;
+    }
+    return NULL != f;
+}
+
+//
+// END OF files.cpp
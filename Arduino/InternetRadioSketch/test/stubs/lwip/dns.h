@@ -0,0 +1,37 @@
+//
+// lwip/dns.h .. the part of lwip's DNS the sketch uses, the tests
+// answer dns_gethostbyname() themselves
+
+#ifndef _TEST_LWIP_DNS_H_
+#define _TEST_LWIP_DNS_H_
+
+#include <stdint.h>
+
+typedef int8_t err_t;
+
+enum {
+    ERR_OK          = 0,
+    ERR_INPROGRESS  = -5,
+    ERR_ARG         = -16
+};
+
+typedef struct {
+    uint32_t addr;
+} ip4_addr_t;
+
+typedef struct {
+    ip4_addr_t ip4;
+} ip_addr_t;
+
+#define ip_2_ip4(ipaddr) (&((ipaddr)->ip4))
+
+typedef void (*dns_found_callback)(const char *name, const ip_addr_t *ipaddr,
+    void *callback_arg);
+
+err_t dns_gethostbyname(const char *hostname, ip_addr_t *addr,
+    dns_found_callback found, void *callback_arg);
+
+#endif
+
+//
+// END OF lwip/dns.h
@@ -0,0 +1,19 @@
+//
+// lwip/sockets.h .. the host's own sockets have the same names, and
+// errno comes with them as it does with lwip
+
+#ifndef _TEST_LWIP_SOCKETS_H_
+#define _TEST_LWIP_SOCKETS_H_
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <sys/select.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#endif
+
+//
+// END OF lwip/sockets.h
@@ -0,0 +1,13 @@
+//
+// lwip/tcpip.h .. the tests have no tcpip task, so nothing to lock
+
+#ifndef _TEST_LWIP_TCPIP_H_
+#define _TEST_LWIP_TCPIP_H_
+
+#define LOCK_TCPIP_CORE()
+#define UNLOCK_TCPIP_CORE()
+
+#endif
+
+//
+// END OF lwip/tcpip.h
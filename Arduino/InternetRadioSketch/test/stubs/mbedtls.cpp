@@ -0,0 +1,146 @@
+//
+// mbedtls.cpp .. mbedtls AES and HMAC over OpenSSL's libcrypto, for the
+// host tests that link the sketch's crypto (link with -lcrypto)
+
+#include <string.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include "mbedtls/aes.h"
+#include "mbedtls/md.h"
+
+void mbedtls_aes_init(mbedtls_aes_context *ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key,
+    unsigned int keybits)
+{
+    if ((128 != keybits) && (192 != keybits) && (256 != keybits)) {
+        return -1;
+    }
+    memcpy(ctx->key, key, keybits / 8);
+    ctx->bits = keybits;
+    return 0;
+}
+
+static void encrypt_block(const mbedtls_aes_context *ctx,
+    const uint8_t *in, uint8_t *out)
+{
+    const EVP_CIPHER *cipher = (128==ctx->bits) ? EVP_aes_128_ecb() :
+        (192==ctx->bits) ? EVP_aes_192_ecb() : EVP_aes_256_ecb();
+    EVP_CIPHER_CTX *evp = EVP_CIPHER_CTX_new();
+    int length = 0;
+    EVP_EncryptInit_ex(evp, cipher, NULL, ctx->key, NULL);
+    EVP_CIPHER_CTX_set_padding(evp, 0);
+    EVP_EncryptUpdate(evp, out, &length, in, 16);
+    EVP_CIPHER_CTX_free(evp);
+}
+
+// as mbedtls does it .. stream_block holds the keystream, nc_off how
+// much of it is used up, and the whole 128 bit counter counts up
+int mbedtls_aes_crypt_ctr(mbedtls_aes_context *ctx, size_t length,
+    size_t *nc_off, unsigned char nonce_counter[16],
+    unsigned char stream_block[16], const unsigned char *input,
+    unsigned char *output)
+{
+    size_t n = *nc_off;
+    for (size_t i = 0; i < length; i++) {
+        if (0==n) {
+            encrypt_block(ctx, nonce_counter, stream_block);
+            for (int c = 15; c >= 0; c--) {
+                if (0 != ++nonce_counter[c]) {
+                    break;
+                }
+            }
+        }
+        output[i] = input[i] ^ stream_block[n];
+        n = (n + 1) & 0x0f;
+    }
+    *nc_off = n;
+    return 0;
+}
+
+void mbedtls_aes_free(mbedtls_aes_context *ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+static const mbedtls_md_info_t sha1_info = { MBEDTLS_MD_SHA1 };
+
+const mbedtls_md_info_t *mbedtls_md_info_from_type(mbedtls_md_type_t type)
+{
+    return (MBEDTLS_MD_SHA1==type) ? &sha1_info : NULL;
+}
+
+void mbedtls_md_init(mbedtls_md_context_t *ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+int mbedtls_md_setup(mbedtls_md_context_t *ctx, const mbedtls_md_info_t *info,
+    int hmac)
+{
+    if ((NULL==info) || !hmac) {
+        return -1;
+    }
+    ctx->info = info;
+    return 0;
+}
+
+int mbedtls_md_hmac_starts(mbedtls_md_context_t *ctx, const unsigned char *key,
+    size_t keylen)
+{
+    if (keylen > sizeof(ctx->key)) {
+        return -1;
+    }
+    memcpy(ctx->key, key, keylen);
+    ctx->key_length = keylen;
+    ctx->data_length = 0;
+    return 0;
+}
+
+int mbedtls_md_hmac_update(mbedtls_md_context_t *ctx,
+    const unsigned char *input, size_t ilen)
+{
+    if ((ctx->data_length + ilen) > sizeof(ctx->data)) {
+        return -1;
+    }
+    memcpy(&ctx->data[ctx->data_length], input, ilen);
+    ctx->data_length += ilen;
+    return 0;
+}
+
+int mbedtls_md_hmac_finish(mbedtls_md_context_t *ctx, unsigned char *output)
+{
+    unsigned int length = 0;
+    HMAC(EVP_sha1(), ctx->key, ctx->key_length, ctx->data, ctx->data_length,
+        output, &length);
+    return 0;
+}
+
+int mbedtls_md_hmac_reset(mbedtls_md_context_t *ctx)
+{
+    ctx->data_length = 0;
+    return 0;
+}
+
+int mbedtls_md_hmac(const mbedtls_md_info_t *info, const unsigned char *key,
+    size_t keylen, const unsigned char *input, size_t ilen,
+    unsigned char *output)
+{
+    unsigned int length = 0;
+    if (NULL==info) {
+        return -1;
+    }
+    HMAC(EVP_sha1(), key, keylen, input, ilen, output, &length);
+    return 0;
+}
+
+void mbedtls_md_free(mbedtls_md_context_t *ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+//
+// END OF mbedtls.cpp
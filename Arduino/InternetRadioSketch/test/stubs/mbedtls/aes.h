@@ -0,0 +1,28 @@
+//
+// mbedtls/aes.h .. the calls srtp.cpp makes, done with OpenSSL for the
+// host tests (see mbedtls.cpp). The key is kept where a test can see it.
+
+#ifndef _TEST_MBEDTLS_AES_H_
+#define _TEST_MBEDTLS_AES_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    uint8_t key[32];
+    unsigned int bits;
+} mbedtls_aes_context;
+
+void mbedtls_aes_init(mbedtls_aes_context *ctx);
+int mbedtls_aes_setkey_enc(mbedtls_aes_context *ctx, const unsigned char *key,
+    unsigned int keybits);
+int mbedtls_aes_crypt_ctr(mbedtls_aes_context *ctx, size_t length,
+    size_t *nc_off, unsigned char nonce_counter[16],
+    unsigned char stream_block[16], const unsigned char *input,
+    unsigned char *output);
+void mbedtls_aes_free(mbedtls_aes_context *ctx);
+
+#endif
+
+//
+// END OF mbedtls/aes.h
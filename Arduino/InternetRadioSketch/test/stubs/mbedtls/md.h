@@ -0,0 +1,47 @@
+//
+// mbedtls/md.h .. HMAC-SHA1 the way srtp.cpp and stun.cpp use it, done
+// with OpenSSL for the host tests (see mbedtls.cpp). The key is kept
+// where a test can see it.
+
+#ifndef _TEST_MBEDTLS_MD_H_
+#define _TEST_MBEDTLS_MD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum {
+    MBEDTLS_MD_NONE = 0,
+    MBEDTLS_MD_SHA1 = 4
+} mbedtls_md_type_t;
+
+typedef struct {
+    mbedtls_md_type_t type;
+} mbedtls_md_info_t;
+
+typedef struct {
+    const mbedtls_md_info_t *info;
+    uint8_t key[64];
+    size_t key_length;
+    uint8_t data[4096];         // what's been added since the reset
+    size_t data_length;
+} mbedtls_md_context_t;
+
+const mbedtls_md_info_t *mbedtls_md_info_from_type(mbedtls_md_type_t type);
+void mbedtls_md_init(mbedtls_md_context_t *ctx);
+int mbedtls_md_setup(mbedtls_md_context_t *ctx, const mbedtls_md_info_t *info,
+    int hmac);
+int mbedtls_md_hmac_starts(mbedtls_md_context_t *ctx, const unsigned char *key,
+    size_t keylen);
+int mbedtls_md_hmac_update(mbedtls_md_context_t *ctx,
+    const unsigned char *input, size_t ilen);
+int mbedtls_md_hmac_finish(mbedtls_md_context_t *ctx, unsigned char *output);
+int mbedtls_md_hmac_reset(mbedtls_md_context_t *ctx);
+int mbedtls_md_hmac(const mbedtls_md_info_t *info, const unsigned char *key,
+    size_t keylen, const unsigned char *input, size_t ilen,
+    unsigned char *output);
+void mbedtls_md_free(mbedtls_md_context_t *ctx);
+
+#endif
+
+//
+// END OF mbedtls/md.h
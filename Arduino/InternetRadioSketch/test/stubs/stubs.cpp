@@ -0,0 +1,90 @@
+//
+// stubs.cpp .. the ESP32 core functions the host tests link against
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+HardwareSerial Serial;
+
+uint32_t test_millis = 0;
+uint32_t test_us = 0;
+boolean test_psram = true;
+uint64_t test_file_bytes_read = 0;
+
+char test_serial[4096];
+boolean test_serial_echo = true;
+static size_t serial_length = 0;
+
+void test_serial_clear()
+{
+    serial_length = 0;
+    test_serial[0] = 0;
+}
+
+static void serial_add(const char *text)
+{
+    snprintf(&test_serial[serial_length], sizeof(test_serial) - serial_length,
+        "%s", text);
+    serial_length = strlen(test_serial);
+}
+
+int HardwareSerial::printf(const char *format, ...)
+{
+    char text[1024];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (test_serial_echo) {
+        fputs(text, stdout);
+    }
+    serial_add(text);
+    return length;
+}
+
+void HardwareSerial::println(const char *text)
+{
+    if (test_serial_echo) {
+        puts(text);
+    }
+    serial_add(text);
+    serial_add("\n");
+}
+
+uint32_t millis()
+{
+    return test_millis;
+}
+
+uint32_t micros()
+{
+    return (test_millis * 1000) + test_us;
+}
+
+int64_t esp_timer_get_time()
+{
+    return ((int64_t) test_millis * 1000) + test_us;
+}
+
+void delay(uint32_t ms)
+{
+    test_millis += ms;
+}
+
+uint32_t esp_random()
+{
+    return ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+}
+
+boolean psramFound()
+{
+    return test_psram;
+}
+
+void *ps_malloc(size_t size)
+{
+    return malloc(size);
+}
+
+//
+// END OF stubs.cpp
@@ -0,0 +1,26 @@
+//
+// test_files.h .. the flash for the host tests, files in memory
+// (see files.cpp, which has ToolkitFiles over them)
+
+#ifndef _TEST_FILES_H_
+#define _TEST_FILES_H_
+
+#include <Arduino.h>
+
+// path holds data (not copied, it has to stay put), NULL data removes it
+void test_file_set(const char *path, const uint8_t *data, size_t size);
+void test_file_clear();
+
+// ToolkitFiles::fileOpen() calls, the ones that found a file and not
+extern uint32_t test_file_opens;
+extern uint32_t test_file_failed_opens;
+// and fileExists() calls
+extern uint32_t test_file_lookups;
+
+// how long LittleFS would have taken over all that, in microseconds
+uint64_t test_flash_us();
+
+#endif
+
+//
+// END OF test_files.h
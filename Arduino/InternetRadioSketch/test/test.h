@@ -0,0 +1,53 @@
+//
+// test.h
+
+//
+// Host tests for the parts of the sketch that are plain code (parsers,
+// packet formats, crypto, caches). Each test_xxx.cpp is a program of
+// its own, built against the stubs/ here instead of the ESP32 core.
+// CHECK() prints what failed and carries on, TEST_END() is the exit
+// code. See the Makefile.
+//
+
+#ifndef _TEST_H_
+#define _TEST_H_
+
+#include <Arduino.h>
+
+static uint32_t test_checks = 0;
+static uint32_t test_failures = 0;
+
+#define CHECK(x) do { \
+        test_checks++; \
+        if (!(x)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #x); \
+            test_failures++; \
+        } \
+    } while (0)
+
+#define CHECK_BYTES(a, b, length) CHECK(0==memcmp((a), (b), (length)))
+
+#define TEST_END() \
+    (printf("%s: %u checks, %u failed\n", __FILE__, test_checks, \
+        test_failures), (test_failures ? 1 : 0))
+
+// "0a1b.." to bytes, returns how many
+static inline size_t test_hex(const char *hex, uint8_t *out)
+{
+    size_t length = 0;
+    while (hex[0] && hex[1]) {
+        if (' '==hex[0]) {
+            hex++;
+            continue;
+        }
+        char byte[3] = { hex[0], hex[1], 0 };
+        out[length++] = (uint8_t) strtoul(byte, NULL, 16);
+        hex += 2;
+    }
+    return length;
+}
+
+#endif
+
+//
+// END OF test.h
@@ -0,0 +1,364 @@
+//
+// test_asset_cache.cpp
+
+//
+// The RAM cache of web files (user-046) over a flash in memory
+// (stubs/files.cpp). Whether a fetch was a hit is told by whether it
+// opened the file. A model of a byte budgeted LRU, written here, has
+// to agree with it fetch by fetch, and the bytes the cache reports
+// holding must never go over the budget. Then the ETags, files that
+// aren't there, uploads over cached files, and the setting.
+//
+
+#include "test.h"
+#include "asset_cache.h"
+#include "test_files.h"
+#include "../src/ToolkitFiles/ToolkitSettings.h"
+#include <openssl/sha.h>
+
+enum {
+    FILES   = 12,
+    BUDGET  = 16 * 1024
+};
+
+static uint8_t contents[FILES][BUDGET];
+static size_t sizes[FILES];
+static char paths[FILES][16];
+
+static void cache_kb(const char *kb)
+{
+    SettingItem::updateOrAdd("local_asset_cache_kb", kb);
+}
+
+// the bytes the cache says it holds, and its budget
+static void cache_bytes(uint32_t *used, uint32_t *budget)
+{
+    uint32_t files;
+    uint32_t missing;
+    test_serial_clear();
+    asset_cache_printStats();
+    *used = *budget = 0xffffffff;
+    CHECK(4==sscanf(test_serial, "Asset cache %u files (%u missing), %u of %u bytes",
+        &files, &missing, used, budget));
+}
+
+// fetch path, true if it came from RAM (the flash wasn't opened)
+static boolean hit(const char *path, const uint8_t **data, size_t *size)
+{
+    uint32_t opens = test_file_opens + test_file_failed_opens;
+    const char *etag = NULL;
+    File file;
+    *data = asset_cache_fetch(path, size, &etag, &file);
+    // a file that isn't kept comes back open, for streaming
+    CHECK((NULL==*data) || !file);
+    if (file) {
+        file.close();
+    }
+    return (opens==(test_file_opens + test_file_failed_opens));
+}
+
+static void make_files(size_t largest)
+{
+    test_file_clear();
+    for (uint32_t i = 0; i < FILES; i++) {
+        snprintf(paths[i], sizeof(paths[i]), "/file%u.js", i);
+        sizes[i] = 1 + (esp_random() % largest);
+        for (size_t j = 0; j < sizes[i]; j++) {
+            contents[i][j] = (uint8_t) esp_random();
+        }
+        test_file_set(paths[i], contents[i], sizes[i]);
+    }
+}
+
+// a byte budgeted LRU, as asset_cache.h describes it
+typedef struct {
+    boolean cached;
+    uint32_t last_used;
+} model_entry;
+
+static void test_lru_model()
+{
+    cache_kb("16");
+    CHECK(asset_cache_begin());
+    make_files(BUDGET / 2 + 1024);     // some of them too big to keep
+
+    model_entry model[FILES];
+    memset(model, 0, sizeof(model));
+    size_t model_used = 0;
+    uint32_t clock = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+
+    for (uint32_t n = 0; n < 5000; n++) {
+        // a few files asked for much more than the rest, like a page
+        // and its script and style
+        uint32_t i = (esp_random() % 3) ? (esp_random() % 3) :
+            (esp_random() % FILES);
+        const uint8_t *data;
+        size_t size = 0;
+        boolean was_hit = hit(paths[i], &data, &size);
+
+        boolean expect_hit = model[i].cached;
+        if (model[i].cached) {
+            model[i].last_used = ++clock;
+        } else if (sizes[i] <= (BUDGET / 2)) {
+            while ((model_used + sizes[i]) > BUDGET) {
+                int32_t oldest = -1;
+                for (uint32_t j = 0; j < FILES; j++) {
+                    if (model[j].cached && ((oldest < 0) ||
+                            (model[j].last_used < model[oldest].last_used))) {
+                        oldest = j;
+                    }
+                }
+                model[oldest].cached = false;
+                model_used -= sizes[oldest];
+            }
+            model[i].cached = true;
+            model[i].last_used = ++clock;
+            model_used += sizes[i];
+        }
+        CHECK(was_hit==expect_hit);
+        if (was_hit) {
+            hits++;
+        } else {
+            misses++;
+        }
+
+        if (sizes[i] <= (BUDGET / 2)) {
+            CHECK(data != NULL);
+            CHECK(size==sizes[i]);
+            CHECK(data && (0==memcmp(data, contents[i], sizes[i])));
+        } else {
+            CHECK(NULL==data);      // streamed from the flash instead
+        }
+
+        uint32_t used;
+        uint32_t budget;
+        cache_bytes(&used, &budget);
+        CHECK(BUDGET==budget);
+        CHECK(used <= budget);
+        CHECK(used==model_used);
+    }
+    printf("  %u hits, %u misses\n", hits, misses);
+}
+
+// the basic cases, by hand
+static void test_eviction_order()
+{
+    cache_kb("16");
+    asset_cache_begin();
+    test_file_clear();
+    static uint8_t quarter[BUDGET / 4];
+    const char *names[5] = { "/a", "/b", "/c", "/d", "/e" };
+    for (uint32_t i = 0; i < 5; i++) {
+        test_file_set(names[i], quarter, sizeof(quarter));
+    }
+    const uint8_t *data;
+    size_t size;
+    for (uint32_t i = 0; i < 4; i++) {
+        CHECK(!hit(names[i], &data, &size));
+    }
+    CHECK(hit("/a", &data, &size));         // b is the oldest now
+    CHECK(!hit("/e", &data, &size));        // so b goes
+    CHECK(hit("/a", &data, &size));
+    CHECK(hit("/c", &data, &size));
+    CHECK(hit("/d", &data, &size));
+    CHECK(hit("/e", &data, &size));
+    CHECK(!hit("/b", &data, &size));        // a is the oldest now
+    CHECK(!hit("/a", &data, &size));
+
+    // exactly half the budget is kept, a byte over isn't
+    static uint8_t half[(BUDGET / 2) + 1];
+    test_file_set("/half", half, BUDGET / 2);
+    test_file_set("/over", half, (BUDGET / 2) + 1);
+    CHECK(!hit("/half", &data, &size) && data);
+    CHECK(hit("/half", &data, &size));
+    CHECK(!hit("/over", &data, &size) && (NULL==data));
+
+    // an empty file is sent from the flash
+    test_file_set("/empty", half, 0);
+    CHECK(!hit("/empty", &data, &size) && (NULL==data));
+}
+
+// a file too big to keep is opened once, and handed back to stream
+static void test_too_big()
+{
+    cache_kb("16");
+    asset_cache_begin();
+    test_file_clear();
+    static uint8_t big[BUDGET];
+    for (size_t i = 0; i < sizeof(big); i++) {
+        big[i] = (uint8_t) i;
+    }
+    test_file_set("/big.js", big, sizeof(big));
+    for (uint32_t n = 1; n <= 3; n++) {
+        size_t size = 0;
+        const char *etag = NULL;
+        File file;
+        CHECK(NULL==asset_cache_fetch("/big.js", &size, &etag, &file));
+        CHECK(n==test_file_opens);
+        CHECK(file && (sizeof(big)==file.size()) && (0==file.position()));
+        static uint8_t read[BUDGET];
+        CHECK(sizeof(big)==file.read(read, sizeof(read)));
+        CHECK_BYTES(read, big, sizeof(big));
+        file.close();
+    }
+}
+
+// more files than entries, small enough for all to fit by bytes
+static void test_entries()
+{
+    cache_kb("16");
+    asset_cache_begin();
+    test_file_clear();
+    static uint8_t small[100];
+    char names[ASSET_CACHE_ENTRIES + 4][16];
+    const uint8_t *data;
+    size_t size;
+    for (uint32_t i = 0; i < (ASSET_CACHE_ENTRIES + 4); i++) {
+        snprintf(names[i], sizeof(names[i]), "/small%u", i);
+        test_file_set(names[i], small, sizeof(small));
+        CHECK(!hit(names[i], &data, &size));
+    }
+    // the last ASSET_CACHE_ENTRIES are there, the first ones aren't
+    for (uint32_t i = ASSET_CACHE_ENTRIES + 3; i >= 4; i--) {
+        CHECK(hit(names[i], &data, &size));
+    }
+    CHECK(!hit(names[0], &data, &size));
+    uint32_t used;
+    uint32_t budget;
+    cache_bytes(&used, &budget);
+    CHECK((ASSET_CACHE_ENTRIES * sizeof(small))==used);
+
+    // a path too long to keep isn't kept
+    char longest[ASSET_CACHE_PATH_SIZE + 1];
+    memset(longest, 'x', ASSET_CACHE_PATH_SIZE);
+    longest[0] = '/';
+    longest[ASSET_CACHE_PATH_SIZE] = 0;
+    test_file_set(longest, small, sizeof(small));
+    const char *etag;
+    File file;
+    CHECK(NULL==asset_cache_fetch(longest, &size, &etag, &file));
+    CHECK(!file);
+}
+
+static void test_missing_and_invalidate()
+{
+    cache_kb("16");
+    asset_cache_begin();
+    test_file_clear();
+    const uint8_t *data;
+    size_t size;
+
+    // asked for every page load, and not there
+    CHECK(!asset_cache_isMissing("/favicon.ico"));
+    CHECK(!hit("/favicon.ico", &data, &size) && (NULL==data));
+    CHECK(1==test_file_failed_opens);
+    CHECK(asset_cache_isMissing("/favicon.ico"));
+    CHECK(hit("/favicon.ico", &data, &size) && (NULL==data));
+    CHECK(1==test_file_failed_opens);
+
+    // then uploaded
+    static const uint8_t icon[] = "not really an icon";
+    test_file_set("/favicon.ico", icon, sizeof(icon));
+    asset_cache_invalidate("/favicon.ico");
+    CHECK(!asset_cache_isMissing("/favicon.ico"));
+    CHECK(!hit("/favicon.ico", &data, &size));
+    CHECK(data && (sizeof(icon)==size) && (0==memcmp(icon, data, size)));
+
+    // and uploaded over .. the new one, with a new ETag
+    const char *etag;
+    File file;
+    asset_cache_fetch("/favicon.ico", &size, &etag, &file);
+    char old_etag[ASSET_ETAG_SIZE];
+    strcpy(old_etag, etag);
+    static const uint8_t icon2[] = "a different icon";
+    test_file_set("/favicon.ico", icon2, sizeof(icon2));
+    CHECK(hit("/favicon.ico", &data, &size));       // the cache doesn't know
+    asset_cache_invalidate("/favicon.ico");
+    CHECK(!hit("/favicon.ico", &data, &size));
+    CHECK(data && (sizeof(icon2)==size) && (0==memcmp(icon2, data, size)));
+    asset_cache_fetch("/favicon.ico", &size, &etag, &file);
+    CHECK(0 != strcmp(old_etag, etag));
+}
+
+// the first 8 bytes of the SHA-1, quoted
+static void test_etags()
+{
+    cache_kb("16");
+    asset_cache_begin();
+    test_file_clear();
+    static const uint8_t abc[] = { 'a', 'b', 'c' };
+    test_file_set("/abc.txt", abc, sizeof(abc));
+    size_t size;
+    const char *etag = NULL;
+    File file;
+    CHECK(asset_cache_fetch("/abc.txt", &size, &etag, &file));
+    CHECK(etag && (0==strcmp("\"a9993e364706816a\"", etag)));
+
+    // and for something bigger, against OpenSSL's
+    make_files(BUDGET / 2);
+    for (uint32_t i = 0; i < FILES; i++) {
+        uint8_t digest[SHA_DIGEST_LENGTH];
+        SHA1(contents[i], sizes[i], digest);
+        char expected[ASSET_ETAG_SIZE];
+        snprintf(expected, sizeof(expected), "\"%02x%02x%02x%02x%02x%02x%02x%02x\"",
+            digest[0], digest[1], digest[2], digest[3],
+            digest[4], digest[5], digest[6], digest[7]);
+        CHECK(asset_cache_fetch(paths[i], &size, &etag, &file));
+        CHECK(0==strcmp(expected, etag));
+    }
+}
+
+static void test_settings()
+{
+    const uint8_t *data;
+    size_t size;
+    static uint8_t css[13 * 1024];
+    test_file_clear();
+    test_file_set("/big.css", css, sizeof(css));
+    uint32_t used;
+    uint32_t budget;
+
+    // without PSRAM it's held to ASSET_CACHE_RAM_KB
+    cache_kb("128");
+    test_psram = false;
+    asset_cache_begin();
+    cache_bytes(&used, &budget);
+    CHECK((ASSET_CACHE_RAM_KB * 1024)==budget);
+    CHECK(!hit("/big.css", &data, &size) && (NULL==data));
+
+    test_psram = true;
+    asset_cache_begin();
+    cache_bytes(&used, &budget);
+    CHECK((128 * 1024)==budget);
+    CHECK(!hit("/big.css", &data, &size) && data);
+    CHECK(hit("/big.css", &data, &size) && data);
+
+    // off
+    cache_kb("0");
+    CHECK(!asset_cache_begin());
+    uint32_t opens = test_file_opens;
+    const char *etag;
+    File file;
+    CHECK(NULL==asset_cache_fetch("/big.css", &size, &etag, &file));
+    CHECK(opens==test_file_opens);
+    CHECK(!asset_cache_isMissing("/nothing"));
+}
+
+int main()
+{
+    test_serial_echo = false;
+    test_lru_model();
+    test_eviction_order();
+    test_too_big();
+    test_entries();
+    test_missing_and_invalidate();
+    test_etags();
+    test_settings();
+    test_serial_echo = true;
+    return TEST_END();
+}
+
+//
+// END OF test_asset_cache.cpp
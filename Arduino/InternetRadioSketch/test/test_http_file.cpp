@@ -0,0 +1,267 @@
+//
+// test_http_file.cpp
+
+//
+// Gzipped pages (user-047), the bytes on air for a page load. A
+// browser's GETs for /, toolkit.js, toolkit.css and favicon.ico go
+// through the request parser and http_handleGetRequest(), and what it
+// writes to the WiFiClient (stubs/WiFi.h) is counted, headers and all.
+// A gzipped body has to inflate to what the same GET gets without
+// gzip.
+//
+// The flash (stubs/files.cpp) holds data/ as make_data.py leaves it,
+// the page.gz files as well, which have to be the gzipped pages built
+// into the sketch. Then with nothing on the flash, so it's
+// the pages built into the sketch. Then with a toolkit.css on the flash
+// that isn't the built in one, when it's the flash's toolkit.css.gz
+// that has to go. A browser that refuses gzip (q=0) gets plain pages.
+//
+
+#include "test.h"
+#include "http_file.h"
+#include "http_request.h"
+#include "hls_segmenter.h"
+#include "default_files.h"
+#include "asset_cache.h"
+#include "test_files.h"
+#include <zlib.h>
+
+enum {
+    REQUEST_SIZE    = 1024,
+    IO_SIZE         = 1024,
+    FILE_SIZE       = 64 * 1024
+};
+
+// no HLS here
+boolean hls_isPath(const char *path)
+{
+    return false;
+}
+
+boolean hls_handleGetRequest(ToolkitWiFi_Client *twfc, const char *path,
+    char *buffer, size_t max_size)
+{
+    return false;
+}
+
+static const char *page_load[] = {
+    "/", "/toolkit.js", "/toolkit.css", "/favicon.ico"
+};
+static const uint32_t REQUESTS = sizeof(page_load) / sizeof(page_load[0]);
+
+typedef struct {
+    char name[32];
+    uint8_t data[FILE_SIZE];
+    size_t size;
+} data_file;
+
+static data_file files[12];
+static uint32_t file_count = 0;
+
+// data/name onto the flash as /name
+static data_file *load(const char *name)
+{
+    data_file *f = &files[file_count++];
+    char path[64];
+    snprintf(path, sizeof(path), "../data/%s", name);
+    FILE *in = fopen(path, "rb");
+    CHECK(NULL != in);
+    f->size = in ? fread(f->data, 1, sizeof(f->data), in) : 0;
+    if (in) {
+        fclose(in);
+    }
+    snprintf(f->name, sizeof(f->name), "/%s", name);
+    test_file_set(f->name, f->data, f->size);
+    return f;
+}
+
+// a new boot, with what's on the flash now
+static void boot()
+{
+    asset_cache_begin();
+    default_files_begin();
+    http_file_begin();
+}
+
+typedef struct {
+    uint32_t status;
+    boolean gzip;
+    size_t on_air;          // all of it, headers too
+    const char *body;
+    size_t body_length;
+} response;
+
+static ToolkitWiFi_Client twfc;
+static char request_buffer[REQUEST_SIZE];
+static char io[IO_SIZE];
+
+static void get(const char *path, const char *accept_encoding, response *out)
+{
+    http_request r;
+    http_request_init(&r, request_buffer, sizeof(request_buffer));
+    char *where;
+    size_t space = http_request_space(&r, &where);
+    size_t length = snprintf(where, space,
+        "GET %s HTTP/1.1\r\n"
+        "Host: 192.168.4.1\r\n"
+        "User-Agent: Mozilla/5.0 (Linux; Android 14; Pixel 8)\r\n"
+        "Accept: */*\r\n"
+        "%s%s%s"
+        "\r\n", path, accept_encoding ? "Accept-Encoding: " : "",
+        accept_encoding ? accept_encoding : "", accept_encoding ? "\r\n" : "");
+    http_request_add(&r, length);
+    CHECK(HTTP_REQUEST_COMPLETE==http_request_parse(&r));
+
+    twfc.openClient();
+    http_handleGetRequest(&twfc, &r, r.path, NULL, 0, io, sizeof(io));
+    WiFiClient *c = twfc.client;
+    c->out[(c->sent < WiFiClient::KEPT) ? c->sent : (WiFiClient::KEPT - 1)] = 0;
+    out->on_air = c->sent;
+    out->status = 0;
+    sscanf(c->out, "HTTP/1.1 %u", &out->status);
+    const char *end = strstr(c->out, "\n\n");
+    CHECK(NULL != end);
+    out->body = end ? end + 2 : c->out;
+    out->body_length = c->sent - (out->body - c->out);
+    const char *content_length = strstr(c->out, "\nContent-Length: ");
+    CHECK(content_length && (out->body_length==(size_t) atoi(&content_length[17])));
+    const char *gzip = strstr(c->out, "\nContent-Encoding: gzip\n");
+    out->gzip = gzip && (gzip < end);
+}
+
+// gzip to what it was
+static size_t inflate_gzip(const char *in, size_t length, uint8_t *out, size_t size)
+{
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    CHECK(Z_OK==inflateInit2(&z, 16 + MAX_WBITS));
+    z.next_in = (Bytef *) in;
+    z.avail_in = length;
+    z.next_out = out;
+    z.avail_out = size;
+    CHECK(Z_STREAM_END==inflate(&z, Z_FINISH));
+    size_t got = size - z.avail_out;
+    inflateEnd(&z);
+    return got;
+}
+
+static uint8_t plain_body[FILE_SIZE];
+static uint8_t inflated[FILE_SIZE];
+
+// one page load with and without gzip, the bytes on air for each
+static void page(const char *what, const char *accept_encoding,
+    size_t *plain_on_air, size_t *gzip_on_air)
+{
+    *plain_on_air = 0;
+    *gzip_on_air = 0;
+    for (uint32_t i = 0; i < REQUESTS; i++) {
+        response plain;
+        get(page_load[i], NULL, &plain);
+        CHECK(!plain.gzip);
+        memcpy(plain_body, plain.body, plain.body_length);
+        *plain_on_air += plain.on_air;
+        twfc.closeClient();
+
+        response gz;
+        get(page_load[i], accept_encoding, &gz);
+        CHECK(gz.status==plain.status);
+        *gzip_on_air += gz.on_air;
+        if (200==gz.status) {
+            CHECK(gz.gzip);
+            size_t length = inflate_gzip(gz.body, gz.body_length,
+                inflated, sizeof(inflated));
+            CHECK(length==plain.body_length);
+            CHECK_BYTES(inflated, plain_body, plain.body_length);
+        } else {
+            CHECK(404==gz.status);
+            CHECK(!gz.gzip);
+        }
+        twfc.closeClient();
+    }
+    printf("%s: %u bytes on air plain, %u with gzip (%u%% less)\n", what,
+        (unsigned) *plain_on_air, (unsigned) *gzip_on_air,
+        (unsigned) (100 - ((100 * *gzip_on_air) / *plain_on_air)));
+}
+
+int main()
+{
+    static const char *pages[] = {
+        "index.html", "toolkit.js", "toolkit.css", "upload.html", "kiosk.html"
+    };
+    for (uint32_t i = 0; i < (sizeof(pages) / sizeof(pages[0])); i++) {
+        char gz[32];
+        data_file *page = load(pages[i]);
+        snprintf(gz, sizeof(gz), "%s.gz", pages[i]);
+        data_file *page_gz = load(gz);
+
+        // make_data.py's page.gz is the gzip built into the sketch
+        const default_asset *a = default_files_lookup(page->name);
+        CHECK(a && (a->gz_length==page_gz->size));
+        CHECK(a && (0==memcmp(a->gz, page_gz->data, page_gz->size)));
+    }
+    const char *browser = "gzip, deflate";
+
+    // data/ as it is, the same pages as the sketch's
+    boot();
+    size_t plain, gzip;
+    page("data/ on the flash", browser, &plain, &gzip);
+    CHECK((100 * gzip) < (40 * plain));
+    size_t built_in_plain = plain;
+    size_t built_in_gzip = gzip;
+
+    // the same without the flash
+    test_file_clear();
+    boot();
+    page("nothing on the flash", browser, &plain, &gzip);
+    CHECK(plain==built_in_plain);
+    CHECK(gzip==built_in_gzip);
+
+    // a toolkit.css of the flash's own, with its own .gz
+    static char css[FILE_SIZE];
+    data_file *original = load("toolkit.css");
+    size_t css_length = snprintf(css, sizeof(css), "%.*s\n/* changed */\n",
+        (int) original->size, (const char *) original->data);
+    test_file_set("/toolkit.css", (const uint8_t *) css, css_length);
+    static uint8_t css_gz[FILE_SIZE];
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    CHECK(Z_OK==deflateInit2(&z, 9, Z_DEFLATED, 16 + MAX_WBITS, 8,
+        Z_DEFAULT_STRATEGY));
+    z.next_in = (Bytef *) css;
+    z.avail_in = css_length;
+    z.next_out = css_gz;
+    z.avail_out = sizeof(css_gz);
+    CHECK(Z_STREAM_END==deflate(&z, Z_FINISH));
+    size_t css_gz_length = sizeof(css_gz) - z.avail_out;
+    deflateEnd(&z);
+    test_file_set("/toolkit.css.gz", css_gz, css_gz_length);
+    boot();
+    uint32_t opens = test_file_opens;
+    response r;
+    get("/toolkit.css", browser, &r);
+    CHECK(200==r.status);
+    CHECK(r.gzip);
+    CHECK(r.body_length==css_gz_length);
+    CHECK_BYTES(r.body, css_gz, css_gz_length);
+    CHECK(test_file_opens==(opens + 1));
+    twfc.closeClient();
+    get("/toolkit.css", NULL, &r);
+    CHECK(!r.gzip);
+    CHECK(r.body_length==css_length);
+    CHECK_BYTES(r.body, css, css_length);
+    twfc.closeClient();
+
+    // gzip refused, or not asked for at all
+    get("/toolkit.css", "gzip;q=0, deflate", &r);
+    CHECK(!r.gzip);
+    CHECK(r.body_length==css_length);
+    twfc.closeClient();
+    get("/toolkit.js", "identity", &r);
+    CHECK(200==r.status);
+    CHECK(!r.gzip);
+    twfc.closeClient();
+    return TEST_END();
+}
+
+//
+// END OF test_http_file.cpp
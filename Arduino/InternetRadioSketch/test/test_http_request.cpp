@@ -0,0 +1,219 @@
+//
+// test_http_request.cpp
+
+//
+// The incremental parser has to put a request back together however
+// TCP cuts it up, so every request here is fed split at every byte,
+// and one byte at a time.
+//
+
+#include "test.h"
+#include "http_request.h"
+
+static const char get_request[] =
+    "GET /music/take1.mp3 HTTP/1.1\r\n"
+    "Host: 192.168.4.1\r\n"
+    "Accept-Encoding: gzip, deflate, br\r\n"
+    "If-None-Match: \"0123456789abcdef\", \"fedcba9876543210\"\r\n"
+    "Range: bytes=1000-\r\n"
+    "If-Range: \"0123456789abcdef\"\r\n"
+    "\r\n";
+
+static const char post_request[] =
+    "POST /upload HTTP/1.0\r\n"
+    "Content-Length: 10\r\n"
+    "Connection: keep-alive\r\n"
+    "\r\n"
+    "0123456789";
+
+static char buffer[1024];
+
+static void check_get(const http_request *r)
+{
+    CHECK(HTTP_REQUEST_COMPLETE==r->state);
+    CHECK(HTTP_METHOD_GET==r->method);
+    CHECK(r->path && (0==strcmp("/music/take1.mp3", r->path)));
+    CHECK(r->keep_alive);
+    CHECK(r->accepts_gzip);
+    CHECK(r->if_none_match &&
+        (0==strcmp("\"0123456789abcdef\", \"fedcba9876543210\"", r->if_none_match)));
+    CHECK(r->range && (0==strcmp("bytes=1000-", r->range)));
+    CHECK(r->if_range && (0==strcmp("\"0123456789abcdef\"", r->if_range)));
+    CHECK(r->header_length==(sizeof(get_request) - 1));
+}
+
+static void check_post(const http_request *r)
+{
+    CHECK(HTTP_REQUEST_COMPLETE==r->state);
+    CHECK(HTTP_METHOD_POST==r->method);
+    CHECK(r->path && (0==strcmp("/upload", r->path)));
+    CHECK(r->keep_alive);
+    CHECK(!r->accepts_gzip);
+    CHECK(NULL==r->range);
+    CHECK(10==r->content_length);
+}
+
+// text in pieces of the given sizes, parsing after each .. like the
+// socket reads, no more than there's room for
+static uint32_t feed(http_request *r, const char *text, size_t length,
+    const size_t *pieces, uint32_t count)
+{
+    size_t at = 0;
+    uint32_t state = HTTP_REQUEST_INCOMPLETE;
+    for (uint32_t i = 0; (i < count) && (at < length); i++) {
+        char *where;
+        size_t space = http_request_space(r, &where);
+        size_t piece = pieces[i];
+        if (piece > (length - at)) {
+            piece = length - at;
+        }
+        if (piece > space) {
+            piece = space;
+        }
+        memcpy(where, &text[at], piece);
+        http_request_add(r, piece);
+        at += piece;
+        state = http_request_parse(r);
+    }
+    return state;
+}
+
+static void test_split(const char *text, size_t length,
+    void (*check)(const http_request *), size_t header_length)
+{
+    http_request r;
+    for (size_t split = 1; split < length; split++) {
+        http_request_init(&r, buffer, sizeof(buffer));
+        size_t pieces[2] = { split, length - split };
+        char *where;
+        http_request_space(&r, &where);
+        memcpy(where, text, split);
+        http_request_add(&r, split);
+        uint32_t state = http_request_parse(&r);
+        CHECK(state==((split >= header_length) ?
+            HTTP_REQUEST_COMPLETE : HTTP_REQUEST_INCOMPLETE));
+        http_request_init(&r, buffer, sizeof(buffer));
+        feed(&r, text, length, pieces, 2);
+        check(&r);
+        CHECK(r.body_length==(length - header_length));
+    }
+
+    // and one byte at a time
+    http_request_init(&r, buffer, sizeof(buffer));
+    size_t ones[2048];
+    for (size_t i = 0; i < length; i++) {
+        ones[i] = 1;
+    }
+    feed(&r, text, length, ones, length);
+    check(&r);
+}
+
+// two requests back to back on one connection, cut anywhere
+static void test_pipelined()
+{
+    char both[512];
+    size_t get_length = sizeof(get_request) - 1;
+    size_t post_length = sizeof(post_request) - 1;
+    memcpy(both, get_request, get_length);
+    memcpy(&both[get_length], post_request, post_length);
+    size_t length = get_length + post_length;
+
+    http_request r;
+    for (size_t split = 1; split < length; split++) {
+        http_request_init(&r, buffer, sizeof(buffer));
+        size_t pieces[2] = { split, length - split };
+        feed(&r, both, length, pieces, 2);
+        check_get(&r);
+        http_request_next(&r, 0);
+        CHECK(HTTP_REQUEST_COMPLETE==http_request_parse(&r));
+        check_post(&r);
+        CHECK(10==r.body_length);
+        CHECK(0==memcmp("0123456789", r.body, 10));
+        http_request_next(&r, r.body_length);
+        CHECK(0==r.used);
+    }
+}
+
+static void test_other_cases()
+{
+    http_request r;
+
+    // stray newlines in front, and HTTP/1.0 isn't kept alive
+    http_request_init(&r, buffer, sizeof(buffer));
+    const char *text = "\r\n\r\nGET / HTTP/1.0\r\n\r\n";
+    size_t all[1] = { strlen(text) };
+    CHECK(HTTP_REQUEST_COMPLETE==feed(&r, text, strlen(text), all, 1));
+    CHECK(0==strcmp("/", r.path));
+    CHECK(!r.keep_alive);
+
+    // Connection: close on 1.1
+    http_request_init(&r, buffer, sizeof(buffer));
+    text = "GET /index.html HTTP/1.1\r\nConnection: close\r\n\r\n";
+    all[0] = strlen(text);
+    feed(&r, text, strlen(text), all, 1);
+    CHECK(!r.keep_alive);
+
+    // bare \n line ends
+    http_request_init(&r, buffer, sizeof(buffer));
+    text = "GET /x HTTP/1.1\nRange: bytes=-500\n\n";
+    all[0] = strlen(text);
+    CHECK(HTTP_REQUEST_COMPLETE==feed(&r, text, strlen(text), all, 1));
+    CHECK(r.range && (0==strcmp("bytes=-500", r.range)));
+
+    // Accept-Encoding, by token rather than anywhere in the value
+    static const struct {
+        const char *value;
+        boolean gzip;
+    } codings[] = {
+        { "gzip", true },
+        { "GZIP", true },
+        { "deflate, Gzip ;q=0.5", true },
+        { "x-gzip", false },
+        { "x-gzip, deflate", false },
+        { "gzip;q=0", false },
+        { "gzip; q=0.000, br", false },
+        { "br, gzip;q=0, *", false },
+        { "*;q=1", true },
+        { "*", true },
+        { "*;q=0", false },
+        { "gzip, *;q=0", true },
+        { "identity", false },
+        { "", false }
+    };
+    for (uint32_t i = 0; i < sizeof(codings)/sizeof(codings[0]); i++) {
+        char request[128];
+        snprintf(request, sizeof(request),
+            "GET / HTTP/1.1\r\nAccept-Encoding: %s\r\n\r\n", codings[i].value);
+        http_request_init(&r, buffer, sizeof(buffer));
+        all[0] = strlen(request);
+        CHECK(HTTP_REQUEST_COMPLETE==feed(&r, request, strlen(request), all, 1));
+        CHECK(codings[i].gzip==r.accepts_gzip);
+    }
+
+    // no path
+    http_request_init(&r, buffer, sizeof(buffer));
+    text = "GET\r\n\r\n";
+    all[0] = strlen(text);
+    CHECK(HTTP_REQUEST_BAD==feed(&r, text, strlen(text), all, 1));
+
+    // a header that never ends
+    char small[64];
+    http_request_init(&r, small, sizeof(small));
+    text = "GET / HTTP/1.1\r\nCookie: aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\r\n";
+    all[0] = strlen(text);
+    CHECK(HTTP_REQUEST_TOO_BIG==feed(&r, text, strlen(text), all, 1));
+}
+
+int main()
+{
+    size_t get_length = sizeof(get_request) - 1;
+    size_t post_length = sizeof(post_request) - 1;
+    test_split(get_request, get_length, check_get, get_length);
+    test_split(post_request, post_length, check_post, post_length - 10);
+    test_pipelined();
+    test_other_cases();
+    return TEST_END();
+}
+
+//
+// END OF test_http_request.cpp
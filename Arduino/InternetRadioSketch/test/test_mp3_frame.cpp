@@ -0,0 +1,229 @@
+//
+// test_mp3_frame.cpp
+
+//
+// Frame lengths for MPEG 1, 2 and 2.5, layers I, II and III (user-038).
+// Known lengths first (the figures in ISO 11172-3 / 13818-3 and what
+// encoders write), then every header against the slot formula worked
+// out here the other way round, then walking a stream with junk in it.
+//
+
+#include "test.h"
+#include "mp3_frame.h"
+
+enum {
+    MPEG_25 = 0,
+    MPEG_2  = 2,
+    MPEG_1  = 3
+};
+
+static void make_header(uint8_t *header, uint32_t version, uint32_t layer,
+    uint32_t bitrate_index, uint32_t rate_index, uint32_t padding,
+    uint32_t mode)
+{
+    header[0] = 0xff;
+    header[1] = 0xe0 | (version << 3) | ((4 - layer) << 1) | 0x01;
+    header[2] = (bitrate_index << 4) | (rate_index << 2) | (padding << 1);
+    header[3] = mode << 6;
+}
+
+typedef struct {
+    uint32_t version;
+    uint32_t layer;
+    uint32_t bitrate_index;
+    uint32_t rate_index;
+    uint32_t padding;
+    uint32_t bitrate;
+    uint32_t sample_rate;
+    uint32_t length;
+    uint32_t samples;
+} known_frame;
+
+static const known_frame known[] = {
+    // MPEG 1
+    { MPEG_1, 3,  9, 0, 0, 128, 44100,  417, 1152 },
+    { MPEG_1, 3,  9, 0, 1, 128, 44100,  418, 1152 },
+    { MPEG_1, 3, 14, 1, 0, 320, 48000,  960, 1152 },
+    { MPEG_1, 3,  1, 2, 0,  32, 32000,  144, 1152 },
+    { MPEG_1, 2, 10, 1, 0, 192, 48000,  576, 1152 },
+    { MPEG_1, 2, 14, 0, 0, 384, 44100, 1253, 1152 },
+    { MPEG_1, 1,  1, 0, 0,  32, 44100,   32,  384 },
+    { MPEG_1, 1,  1, 0, 1,  32, 44100,   36,  384 },
+    { MPEG_1, 1, 14, 2, 0, 448, 32000,  672,  384 },
+    // MPEG 2
+    { MPEG_2, 3,  8, 0, 0,  64, 22050,  208,  576 },
+    { MPEG_2, 3,  1, 2, 0,   8, 16000,   36,  576 },
+    { MPEG_2, 3, 14, 2, 1, 160, 16000,  721,  576 },
+    { MPEG_2, 2, 14, 2, 0, 160, 16000, 1440, 1152 },
+    { MPEG_2, 2,  1, 1, 0,   8, 24000,   48, 1152 },
+    { MPEG_2, 1, 14, 1, 0, 256, 24000,  512,  384 },
+    // MPEG 2.5
+    { MPEG_25, 3,  1, 2, 0,   8,  8000,   72,  576 },
+    { MPEG_25, 3, 14, 2, 0, 160,  8000, 1440,  576 },
+    { MPEG_25, 2, 14, 2, 1, 160,  8000, 2881, 1152 },
+    { MPEG_25, 1,  1, 0, 0,  32, 11025,  136,  384 }
+};
+
+static void test_known()
+{
+    for (uint32_t i = 0; i < (sizeof(known) / sizeof(known[0])); i++) {
+        const known_frame *k = &known[i];
+        uint8_t header[MP3_HEADER_SIZE];
+        make_header(header, k->version, k->layer, k->bitrate_index,
+            k->rate_index, k->padding, 1);
+        mp3_frame_info info;
+        CHECK(mp3_frame_parse(header, &info));
+        CHECK(info.layer==k->layer);
+        CHECK(info.bitrate==k->bitrate);
+        CHECK(info.sample_rate==k->sample_rate);
+        CHECK(info.length==k->length);
+        CHECK(info.samples==k->samples);
+        CHECK(info.channels==2);
+        if (info.length != k->length) {
+            printf("  known[%u] length %u, not %u\n", i, info.length, k->length);
+        }
+    }
+    // the largest there is
+    CHECK(2881==MP3_MAX_FRAME_SIZE);
+}
+
+// every valid header, against bytes = slots * slot size, where a
+// layer I slot is 4 bytes and the slots per frame are
+// samples / 8 * bitrate / sample rate (floored) plus the padding slot
+static void test_every_header()
+{
+    static const uint32_t rates[4][3] = {
+        { 11025, 12000, 8000 }, { 0, 0, 0 },
+        { 22050, 24000, 16000 }, { 44100, 48000, 32000 }
+    };
+    static const uint32_t mpeg1_kbps[3][16] = {
+        { 0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 0 },
+        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 0 },
+        { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0 }
+    };
+    static const uint32_t lsf_kbps[3][16] = {
+        { 0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256, 0 },
+        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0 },
+        { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0 }
+    };
+    uint32_t largest = 0;
+    uint32_t valid = 0;
+    for (uint32_t version = 0; version < 4; version++) {
+        for (uint32_t layer = 1; layer <= 3; layer++) {
+            for (uint32_t b = 0; b < 16; b++) {
+                for (uint32_t r = 0; r < 4; r++) {
+                    for (uint32_t pad = 0; pad < 2; pad++) {
+                        for (uint32_t mode = 0; mode < 4; mode++) {
+                            uint8_t header[MP3_HEADER_SIZE];
+                            make_header(header, version, layer, b, r, pad, mode);
+                            mp3_frame_info info;
+                            boolean ok = mp3_frame_parse(header, &info);
+                            boolean expect_ok = (version != 1) && (r != 3) &&
+                                (b != 0) && (b != 15);
+                            CHECK(ok==expect_ok);
+                            if (!ok || !expect_ok) {
+                                continue;
+                            }
+                            valid++;
+                            uint32_t kbps = (MPEG_1==version) ?
+                                mpeg1_kbps[layer-1][b] : lsf_kbps[layer-1][b];
+                            uint32_t rate = rates[version][r];
+                            uint32_t samples = (1==layer) ? 384 :
+                                ((3==layer) && (MPEG_1 != version)) ? 576 : 1152;
+                            uint32_t slot = (1==layer) ? 4 : 1;
+                            uint32_t slots = ((samples / 8) * kbps * 1000 /
+                                slot / rate) + pad;
+                            CHECK(info.length==(slots * slot));
+                            CHECK(info.samples==samples);
+                            CHECK(info.bitrate==kbps);
+                            CHECK(info.sample_rate==rate);
+                            CHECK(info.channels==((3==mode) ? 1 : 2));
+                            CHECK(info.length <= MP3_MAX_FRAME_SIZE);
+                            if (info.length > largest) {
+                                largest = info.length;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    CHECK(3 * 3 * 14 * 3 * 2 * 4==valid);
+    CHECK(MP3_MAX_FRAME_SIZE==largest);
+
+    // not frames .. layer bits 00, no sync
+    uint8_t header[MP3_HEADER_SIZE] = { 0xff, 0xf9, 0x90, 0x40 };
+    mp3_frame_info info;
+    CHECK(!mp3_frame_parse(header, &info));
+    header[1] = 0xdb;
+    CHECK(!mp3_frame_parse(header, &info));
+    header[0] = 0xfe;
+    header[1] = 0xfb;
+    CHECK(!mp3_frame_parse(header, &info));
+}
+
+// frames of different kinds with junk between, as the encoder ring
+// would have them after a restart
+static void test_find()
+{
+    static uint8_t stream[16384];
+    static const uint32_t frames[][3] = {     // version, layer, bitrate index
+        { MPEG_1, 3, 9 }, { MPEG_1, 3, 9 }, { MPEG_2, 3, 8 },
+        { MPEG_25, 3, 1 }, { MPEG_1, 2, 10 }, { MPEG_1, 1, 1 }
+    };
+    uint32_t count = sizeof(frames) / sizeof(frames[0]);
+    size_t offsets[8];
+    size_t length = 0;
+
+    // junk in front that has 0xff in it but no sync
+    static const uint8_t junk[] = { 0x00, 0xff, 0x00, 0xff, 0x1f, 0x12, 0xff };
+    memcpy(stream, junk, sizeof(junk));
+    length = sizeof(junk);
+    for (uint32_t i = 0; i < count; i++) {
+        offsets[i] = length;
+        make_header(&stream[length], frames[i][0], frames[i][1], frames[i][2],
+            0, 0, 1);
+        mp3_frame_info info;
+        CHECK(mp3_frame_parse(&stream[length], &info));
+        // frame bodies that are all zero, so no false sync in them
+        memset(&stream[length + MP3_HEADER_SIZE], 0, info.length - MP3_HEADER_SIZE);
+        length += info.length;
+        if (2==i) {
+            stream[length++] = 0x42;    // a stray byte between frames
+        }
+    }
+
+    size_t at = 0;
+    uint32_t found = 0;
+    while (at < length) {
+        size_t next = at + mp3_frame_find(&stream[at], length - at);
+        if (next >= length) {
+            break;
+        }
+        CHECK(found < count);
+        CHECK(next==offsets[found]);
+        mp3_frame_info info;
+        CHECK(mp3_frame_parse(&stream[next], &info));
+        at = next + info.length;
+        found++;
+    }
+    CHECK(found==count);
+
+    // a sync cut off at the end is left for next time
+    uint8_t tail[] = { 0x00, 0x00, 0xff, 0xfb };
+    CHECK(2==mp3_frame_find(tail, sizeof(tail)));
+    CHECK(2==mp3_frame_find(tail, 3));
+    uint8_t none[] = { 0x00, 0x01, 0x02 };
+    CHECK(3==mp3_frame_find(none, sizeof(none)));
+}
+
+int main()
+{
+    test_known();
+    test_every_header();
+    test_find();
+    return TEST_END();
+}
+
+//
+// END OF test_mp3_frame.cpp
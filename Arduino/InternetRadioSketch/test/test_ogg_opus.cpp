@@ -0,0 +1,272 @@
+//
+// test_ogg_opus.cpp
+
+//
+// The Ogg pages ogg_opus makes for the icecast PUT (user-043), read
+// back by a page reader written here from RFC 3533 and RFC 7845: the
+// CRC (worked out a bit at a time, and checked against the CRC's own
+// check value), the header fields, sequence numbers, granule
+// positions, and the segment tables, which have to give back every
+// packet as it went in.
+//
+// With a file name it also writes the stream there, so it can be put
+// through a reference reader .. "make ogg-reference" does that with
+// check_ogg.py (mutagen). Readers that decode need real Opus packets,
+// ogg_reference.cpp makes those with libopus.
+//
+
+#include "test.h"
+#include "ogg_opus.h"
+
+enum {
+    PRE_SKIP    = 312,      // what libopus reports at 48kHz
+    SAMPLES     = 960,      // 20ms
+    PACKETS     = 2000,
+    STREAM_SIZE = 4 * 1024 * 1024
+};
+
+static uint8_t stream[STREAM_SIZE];
+static size_t stream_length = 0;
+static uint32_t writes = 0;
+
+static void write_page(const uint8_t *page, size_t length)
+{
+    CHECK((stream_length + length) <= STREAM_SIZE);
+    memcpy(&stream[stream_length], page, length);
+    stream_length += length;
+    writes++;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+// RFC 3533 6, one bit at a time
+static uint32_t ogg_crc(const uint8_t *data, size_t length)
+{
+    uint32_t crc = 0;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint32_t) data[i] << 24;
+        for (uint32_t b = 0; b < 8; b++) {
+            crc = (crc & 0x80000000) ? ((crc << 1) ^ 0x04c11db7) : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+// the packets that went in
+static uint8_t packets[PACKETS][1275];
+static size_t lengths[PACKETS];
+
+typedef struct {
+    uint32_t pages;
+    uint32_t packets;
+    uint32_t serial;
+    uint64_t last_granule;
+    uint32_t channels;
+    uint32_t pre_skip;
+} read_result;
+
+// read the whole stream back, checking as it goes
+static void read_stream(const uint8_t *s, size_t length, read_result *r)
+{
+    memset(r, 0, sizeof(*r));
+    size_t at = 0;
+    uint64_t samples = 0;
+    static uint8_t packet[8192];
+    size_t packet_length = 0;
+    while (at < length) {
+        const uint8_t *p = &s[at];
+        CHECK((at + OGG_PAGE_HEADER_SIZE) <= length);
+        CHECK(0==memcmp("OggS", p, 4));
+        CHECK(0==p[4]);
+        uint32_t type = p[5];
+        uint64_t granule = get32(&p[6]) | ((uint64_t) get32(&p[10]) << 32);
+        uint32_t serial = get32(&p[14]);
+        uint32_t sequence = get32(&p[18]);
+        uint32_t crc = get32(&p[22]);
+        uint32_t count = p[26];
+        size_t body = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            body += p[OGG_PAGE_HEADER_SIZE + i];
+        }
+        size_t page_length = OGG_PAGE_HEADER_SIZE + count + body;
+        CHECK((at + page_length) <= length);
+        if ((at + page_length) > length) {
+            return;
+        }
+
+        // the CRC is over the page with its own field zeroed
+        static uint8_t copy[OGG_PAGE_HEADER_SIZE + 255 + (255 * 255)];
+        memcpy(copy, p, page_length);
+        memset(&copy[22], 0, 4);
+        CHECK(crc==ogg_crc(copy, page_length));
+
+        CHECK(sequence==r->pages);
+        if (0==r->pages) {
+            r->serial = serial;
+            CHECK(0x02==type);          // beginning of stream
+        } else {
+            CHECK(serial==r->serial);
+            CHECK(0==type);             // nothing carries over a page
+        }
+        CHECK(count > 0);
+        // no packet runs on to the next page
+        CHECK(p[OGG_PAGE_HEADER_SIZE + count - 1] < 255);
+        CHECK(body <= ((r->pages < 2) ? 255 : (size_t) OGG_OPUS_PAGE_SIZE));
+
+        const uint8_t *data = &p[OGG_PAGE_HEADER_SIZE + count];
+        uint32_t page_packets = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            uint8_t lacing = p[OGG_PAGE_HEADER_SIZE + i];
+            memcpy(&packet[packet_length], data, lacing);
+            packet_length += lacing;
+            data += lacing;
+            if (lacing < 255) {
+                // a whole packet
+                if (0==r->pages) {
+                    // RFC 7845 5.1
+                    CHECK(19==packet_length);
+                    CHECK(0==memcmp("OpusHead", packet, 8));
+                    CHECK(1==packet[8]);
+                    r->channels = packet[9];
+                    r->pre_skip = packet[10] | (packet[11] << 8);
+                    CHECK(48000==get32(&packet[12]));
+                    CHECK((0==packet[16]) && (0==packet[17]) && (0==packet[18]));
+                } else if (1==r->pages) {
+                    // RFC 7845 5.2
+                    CHECK(0==memcmp("OpusTags", packet, 8));
+                    uint32_t vendor = get32(&packet[8]);
+                    CHECK(packet_length==(8 + 4 + vendor + 4));
+                    CHECK(0==get32(&packet[12 + vendor]));
+                } else {
+                    CHECK(r->packets < PACKETS);
+                    CHECK(packet_length==lengths[r->packets]);
+                    CHECK_BYTES(packet, packets[r->packets], packet_length);
+                    samples += SAMPLES;
+                    r->packets++;
+                }
+                packet_length = 0;
+                page_packets++;
+            }
+        }
+        if (r->pages < 2) {
+            CHECK(0==granule);
+            CHECK(1==page_packets);
+        } else {
+            // the samples at the end of the last packet on the page
+            CHECK(granule==samples);
+            CHECK(page_packets <= OGG_OPUS_PAGE_PACKETS);
+            r->last_granule = granule;
+        }
+        r->pages++;
+        at += page_length;
+    }
+}
+
+static void test_crc()
+{
+    // the check value for this CRC (CRC-32 poly 04c11db7, init 0,
+    // not reflected, no final XOR)
+    CHECK(0x89a1897f==ogg_crc((const uint8_t *) "123456789", 9));
+}
+
+static void test_stream(const char *file)
+{
+    CHECK(!ogg_opus_begin(0, PRE_SKIP));
+    CHECK(!ogg_opus_begin(3, PRE_SKIP));
+    CHECK(ogg_opus_begin(2, PRE_SKIP));
+    CHECK(ogg_opus_isOn());
+    CHECK(0==strcmp("audio/ogg", ogg_opus_contentType()));
+
+    // the headers, for a listener that joins late
+    uint8_t small[16];
+    CHECK(0==ogg_opus_headers(small, sizeof(small)));
+    stream_length = ogg_opus_headers(stream, OGG_OPUS_HEADERS_SIZE);
+    CHECK(stream_length > 0);
+    CHECK(stream_length <= OGG_OPUS_HEADERS_SIZE);
+
+    // packet lengths around the lacing edges, up to the largest Opus
+    // packet there is, and some of every size in between
+    static const size_t edges[] = {
+        0, 1, 254, 255, 256, 509, 510, 511, 764, 765, 1274, 1275
+    };
+    uint32_t edge_count = sizeof(edges) / sizeof(edges[0]);
+    for (uint32_t n = 0; n < PACKETS; n++) {
+        lengths[n] = (n < (edge_count * 4)) ? edges[n % edge_count] :
+            (esp_random() % 1276);
+        for (size_t i = 0; i < lengths[n]; i++) {
+            packets[n][i] = (uint8_t) esp_random();
+        }
+        ogg_opus_addPacket(packets[n], lengths[n], SAMPLES, write_page);
+    }
+    // too big for a page, dropped
+    static uint8_t huge[OGG_OPUS_PAGE_SIZE + 1];
+    uint32_t before = writes;
+    ogg_opus_addPacket(huge, sizeof(huge), SAMPLES, write_page);
+    CHECK(before==writes);
+
+    read_result r;
+    read_stream(stream, stream_length, &r);
+    CHECK(2==r.channels);
+    CHECK(PRE_SKIP==r.pre_skip);
+    // pages go out every OGG_OPUS_PAGE_PACKETS, a last part page waits
+    uint32_t whole = PACKETS - (PACKETS % OGG_OPUS_PAGE_PACKETS);
+    CHECK(r.packets >= (whole - OGG_OPUS_PAGE_PACKETS));
+    CHECK(r.last_granule==((uint64_t) r.packets * SAMPLES));
+    printf("  %u packets in %u pages, %u bytes, granule %llu\n", r.packets,
+        r.pages, (unsigned) stream_length, (unsigned long long) r.last_granule);
+
+    if (file) {
+        FILE *f = fopen(file, "wb");
+        CHECK(f != NULL);
+        if (f) {
+            fwrite(stream, 1, stream_length, f);
+            fclose(f);
+            printf("  wrote %s, %u channels, pre-skip %u, %llu samples\n",
+                file, r.channels, r.pre_skip,
+                (unsigned long long) r.last_granule);
+        }
+    }
+
+    // and a damaged byte would have been caught
+    uint32_t length = OGG_PAGE_HEADER_SIZE + stream[26] + stream[27];
+    uint8_t copy[OGG_OPUS_HEADERS_SIZE];
+    memcpy(copy, stream, length);
+    uint32_t crc = get32(&copy[22]);
+    memset(&copy[22], 0, 4);
+    CHECK(crc==ogg_crc(copy, length));
+    copy[length - 1] ^= 0x01;
+    CHECK(crc != ogg_crc(copy, length));
+}
+
+static void test_mono()
+{
+    stream_length = 0;
+    CHECK(ogg_opus_begin(1, 0));
+    stream_length = ogg_opus_headers(stream, sizeof(stream));
+    for (uint32_t n = 0; n < 10; n++) {
+        lengths[n] = 100;
+        memset(packets[n], n, 100);
+        ogg_opus_addPacket(packets[n], 100, SAMPLES, write_page);
+    }
+    read_result r;
+    read_stream(stream, stream_length, &r);
+    CHECK(1==r.channels);
+    CHECK(0==r.pre_skip);
+    CHECK(4==r.pages);
+    CHECK(10==r.packets);
+    CHECK((10 * SAMPLES)==r.last_granule);
+}
+
+int main(int argc, char **argv)
+{
+    test_crc();
+    test_stream((argc > 1) ? argv[1] : NULL);
+    test_mono();
+    return TEST_END();
+}
+
+//
+// END OF test_ogg_opus.cpp
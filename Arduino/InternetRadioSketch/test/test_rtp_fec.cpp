@@ -0,0 +1,219 @@
+//
+// test_rtp_fec.cpp
+
+//
+// The XOR parity (user-040) from the receiving end. RTP packets are
+// made as rtp_output makes them, the parity packet is laid out as
+// rtp_fec.h says, and a receiver here drops packets and rebuilds them.
+// A group that loses one packet must come back byte for byte, sequence
+// number and all. A group that loses two can't, and the receiver must
+// be able to tell.
+//
+
+#include "test.h"
+#include "rtp_fec.h"
+
+enum {
+    PACKETS     = 4000
+};
+
+static uint8_t packets[PACKETS][RTP_PACKET_SIZE];
+static size_t lengths[PACKETS];
+
+static void make_packet(uint32_t n, uint16_t sequence, uint32_t timestamp)
+{
+    uint8_t *p = packets[n];
+    p[0] = 0x80;
+    p[1] = RTP_PAYLOAD_MPA;
+    p[2] = sequence >> 8;
+    p[3] = sequence;
+    p[4] = timestamp >> 24;
+    p[5] = timestamp >> 16;
+    p[6] = timestamp >> 8;
+    p[7] = timestamp;
+    memcpy(&p[8], "\x12\x34\x56\x78", 4);      // SSRC
+    memset(&p[RTP_HEADER_SIZE], 0, RTP_MPA_HEADER_SIZE);
+    // mp3 runs of all sorts of lengths, some full, some a frame's tail
+    size_t payload = 1 + (esp_random() % RTP_MAX_PAYLOAD);
+    if (0==(n % 3)) {
+        payload = RTP_MAX_PAYLOAD;
+    }
+    for (size_t i = 0; i < payload; i++) {
+        p[RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE + i] = (uint8_t) esp_random();
+    }
+    lengths[n] = RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE + payload;
+}
+
+// the parity packet on the wire, as rtp_output's send_parity() does it
+static size_t parity_packet(const rtp_parity *parity, uint8_t *out)
+{
+    memset(out, 0, RTP_HEADER_SIZE);
+    out[0] = 0x80;
+    out[1] = RTP_PAYLOAD_PARITY;
+    uint8_t *p = &out[RTP_HEADER_SIZE];
+    *p++ = parity->base >> 8;
+    *p++ = parity->base;
+    *p++ = parity->count;
+    *p++ = 0;
+    *p++ = parity->length_xor >> 8;
+    *p++ = parity->length_xor;
+    *p++ = 0;
+    *p++ = 0;
+    memcpy(p, parity->data, parity->length);
+    return RTP_HEADER_SIZE + RTP_FEC_HEADER_SIZE + parity->length;
+}
+
+// a receiver's repair .. given the parity packet and which of the
+// group arrived, rebuild the one that didn't. False if it can't.
+static boolean recover(const uint8_t *parity, size_t parity_length,
+    uint32_t first, const boolean *arrived, uint8_t *out, size_t *out_length)
+{
+    const uint8_t *fec = &parity[RTP_HEADER_SIZE];
+    uint32_t count = fec[2];
+    uint16_t length_xor = (fec[4] << 8) | fec[5];
+    size_t data_length = parity_length - RTP_HEADER_SIZE - RTP_FEC_HEADER_SIZE;
+
+    uint32_t missing = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!arrived[i]) {
+            missing++;
+        }
+    }
+    if (1 != missing) {
+        return false;
+    }
+    uint8_t rebuilt[RTP_PACKET_SIZE];
+    memset(rebuilt, 0, sizeof(rebuilt));
+    memcpy(rebuilt, &fec[RTP_FEC_HEADER_SIZE], data_length);
+    for (uint32_t i = 0; i < count; i++) {
+        if (arrived[i]) {
+            for (size_t j = 0; j < lengths[first + i]; j++) {
+                rebuilt[j] ^= packets[first + i][j];
+            }
+            length_xor ^= lengths[first + i];
+        }
+    }
+    if ((length_xor < RTP_HEADER_SIZE) || (length_xor > data_length)) {
+        return false;
+    }
+    memcpy(out, rebuilt, length_xor);
+    *out_length = length_xor;
+    return true;
+}
+
+static uint8_t wire[RTP_PARITY_SIZE];
+static rtp_parity parity;
+
+static void test_groups(uint32_t group, uint32_t loss_percent)
+{
+    uint16_t first_sequence = esp_random();
+    for (uint32_t n = 0; n < PACKETS; n++) {
+        make_packet(n, first_sequence + n, 1234 + (n * 2351));
+    }
+
+    uint32_t ones = 0;
+    uint32_t recovered = 0;
+    uint32_t unrecoverable = 0;
+    for (uint32_t first = 0; (first + group) <= PACKETS; first += group) {
+        uint16_t base = first_sequence + first;
+        rtp_parity_reset(&parity, base);
+        for (uint32_t i = 0; i < group; i++) {
+            rtp_parity_add(&parity, packets[first + i], lengths[first + i]);
+        }
+        CHECK(parity.count==group);
+        size_t wire_length = parity_packet(&parity, wire);
+        CHECK(wire_length <= RTP_PARITY_SIZE);
+
+        // the receiver finds the group from the parity header
+        const uint8_t *fec = &wire[RTP_HEADER_SIZE];
+        CHECK(base==(uint16_t) ((fec[0] << 8) | fec[1]));
+        CHECK(group==fec[2]);
+
+        boolean arrived[RTP_FEC_MAX_GROUP];
+        uint32_t lost = 0;
+        uint32_t which = 0;
+        for (uint32_t i = 0; i < group; i++) {
+            arrived[i] = ((esp_random() % 100) >= loss_percent);
+            if (!arrived[i]) {
+                lost++;
+                which = i;
+            }
+        }
+        uint8_t out[RTP_PACKET_SIZE];
+        size_t out_length = 0;
+        boolean ok = recover(wire, wire_length, first, arrived, out, &out_length);
+        CHECK(ok==(1==lost));
+        if (1==lost) {
+            ones++;
+            CHECK(out_length==lengths[first + which]);
+            CHECK_BYTES(out, packets[first + which], lengths[first + which]);
+            // it's a whole RTP packet, sequence number and all
+            uint16_t sequence = (out[2] << 8) | out[3];
+            CHECK(sequence==(uint16_t) (base + which));
+            if (ok && (out_length==lengths[first + which]) &&
+                    (0==memcmp(out, packets[first + which], out_length))) {
+                recovered++;
+            }
+        } else if (lost > 1) {
+            unrecoverable++;
+        }
+    }
+    CHECK(recovered==ones);
+    printf("  group %2u, %2u%% loss: %u groups lost one and all came back, "
+        "%u lost more\n", group, loss_percent, ones, unrecoverable);
+}
+
+static void test_edges()
+{
+    // each packet of a group lost in turn, when the lengths differ
+    // the most (a full packet and a one byte tail)
+    rtp_parity_reset(&parity, 65535);
+    lengths[0] = RTP_PACKET_SIZE;
+    lengths[1] = RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE + 1;
+    memset(packets[0], 0xa5, lengths[0]);
+    memset(packets[1], 0x5a, lengths[1]);
+    packets[0][2] = 0xff;   // 65535 then 0
+    packets[0][3] = 0xff;
+    packets[1][2] = 0x00;
+    packets[1][3] = 0x00;
+    rtp_parity_add(&parity, packets[0], lengths[0]);
+    rtp_parity_add(&parity, packets[1], lengths[1]);
+    CHECK(RTP_PACKET_SIZE==parity.length);
+    size_t wire_length = parity_packet(&parity, wire);
+    CHECK(RTP_PARITY_SIZE==wire_length);
+    for (uint32_t lost = 0; lost < 2; lost++) {
+        boolean arrived[2] = { lost != 0, lost != 1 };
+        uint8_t out[RTP_PACKET_SIZE];
+        size_t out_length;
+        CHECK(recover(wire, wire_length, 0, arrived, out, &out_length));
+        CHECK(out_length==lengths[lost]);
+        CHECK_BYTES(out, packets[lost], lengths[lost]);
+    }
+
+    // nothing lost, nothing to do
+    boolean all[2] = { true, true };
+    uint8_t out[RTP_PACKET_SIZE];
+    size_t out_length;
+    CHECK(!recover(wire, wire_length, 0, all, out, &out_length));
+
+    // a packet longer than any rtp_output sends is clipped, not overrun
+    static uint8_t big[RTP_PACKET_SIZE + 100];
+    memset(big, 0x11, sizeof(big));
+    rtp_parity_reset(&parity, 0);
+    rtp_parity_add(&parity, big, sizeof(big));
+    CHECK(RTP_PACKET_SIZE==parity.length);
+    CHECK(RTP_PACKET_SIZE==parity.length_xor);
+}
+
+int main()
+{
+    test_groups(1, 10);
+    test_groups(4, 5);
+    test_groups(4, 20);
+    test_groups(RTP_FEC_MAX_GROUP, 3);
+    test_edges();
+    return TEST_END();
+}
+
+//
+// END OF test_rtp_fec.cpp
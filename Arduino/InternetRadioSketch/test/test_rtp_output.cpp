@@ -0,0 +1,494 @@
+//
+// test_rtp_output.cpp
+
+//
+// The RTP sender (user-039) over loopback. rtp_output reads an mp3
+// stream out of a ring like the encoder's and sends it to 127.0.0.1,
+// where a receiver written here from RFC 3550 and RFC 2250 checks every
+// packet: the header, the sequence numbers, a 90kHz timestamp per
+// frame, the fragments of frames too big for one packet, the parity
+// groups, the sender reports, and that each frame goes out when it is
+// due. The frames it puts back together have to be the ones that went
+// in.
+//
+// The same packets then go on to rtp_receiver (user-040) through a
+// network made here that loses, holds back and repeats some of them.
+// What it plays has to be the stream byte for byte, less the one
+// group that loses two packets, which the parity can't bring back.
+//
+
+#include "test.h"
+#include "rtp_output.h"
+#include "rtp_receiver.h"
+#include "rtp_fec.h"
+#include "rtp_sync.h"
+#include "mp3_frame.h"
+#include "../src/ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+
+enum {
+    FRAMES          = 500,
+    STREAM_SIZE     = 400 * 1024,
+    RING_SLOTS      = 64,
+    RING_BUFFER     = 512,
+    JUNK            = 7,        // bytes between two frames
+    HISTORY         = 64,       // media packets kept for the parity check
+    HOLD_MS         = 5
+};
+
+//------------------------------------------------------------------
+//
+// The stream, and the encoder's ring it comes out of
+//
+
+static uint8_t stream[STREAM_SIZE];
+static size_t stream_length = 0;
+static size_t frame_at[FRAMES];
+static mp3_frame_info frames[FRAMES];
+static uint32_t frame_count = 0;
+
+static uint32_t ring_written = 0;
+
+// MPEG-1 Layer III frames, byte2 has the bitrate and sample rate
+static void add_frames(uint32_t count, uint8_t byte2)
+{
+    for (uint32_t n = 0; n < count; n++) {
+        uint8_t *p = &stream[stream_length];
+        p[0] = 0xff;
+        p[1] = 0xfb;
+        p[2] = byte2 | ((n % 3) ? 0 : 0x02);    // some padded
+        p[3] = 0x00;
+        CHECK(mp3_frame_parse(p, &frames[frame_count]));
+        for (size_t i = MP3_HEADER_SIZE; i < frames[frame_count].length; i++) {
+            p[i] = (uint8_t) esp_random();
+        }
+        frame_at[frame_count++] = stream_length;
+        stream_length += frames[frame_count - 1].length;
+    }
+}
+
+static void make_stream()
+{
+    add_frames(300, 0x90);                  // 128kbit/s, 44.1kHz, 417 bytes
+    memset(&stream[stream_length], 0, JUNK);
+    stream_length += JUNK;
+    add_frames(100, 0xe8);                  // 320kbit/s, 32kHz, 1440 bytes
+    add_frames(100, 0x94);                  // 128kbit/s, 48kHz, 384 bytes
+    CHECK(FRAMES==frame_count);
+    CHECK(stream_length <= STREAM_SIZE);
+}
+
+static uint32_t ring_head()
+{
+    return ring_written;
+}
+
+static uint32_t ring_oldest()
+{
+    return (ring_written > RING_SLOTS) ? (ring_written - RING_SLOTS) : 0;
+}
+
+static uint8_t *ring_get(uint32_t n, size_t *length)
+{
+    if ((n < ring_oldest()) || (n >= ring_written)) {
+        return NULL;
+    }
+    size_t at = n * RING_BUFFER;
+    *length = ((stream_length - at) < RING_BUFFER) ? (stream_length - at) : RING_BUFFER;
+    return &stream[at];
+}
+
+//------------------------------------------------------------------
+//
+// The receiver here
+//
+
+static int media_fd = -1;
+static int report_fd = -1;
+static int parity_fd = -1;
+
+static boolean have_first = false;
+static uint16_t first_sequence = 0;
+static uint16_t next_sequence = 0;
+static uint32_t ssrc = 0;
+static uint32_t media_packets = 0;
+static uint32_t media_bytes = 0;
+
+static uint32_t frames_done = 0;
+static size_t frame_offset = 0;
+static uint32_t frame_timestamp = 0;
+static double frame_due_us = 0;         // when the one being put together was due
+static uint32_t first_ms = 0;
+
+static uint8_t history[HISTORY][RTP_PACKET_SIZE];
+static size_t history_length[HISTORY];
+
+static boolean have_parity = false;
+static uint16_t next_parity = 0;
+static uint32_t parity_packets = 0;
+
+static uint32_t reports = 0;
+static uint32_t last_report_ms = 0;
+
+static uint16_t get16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static int open_socket(uint16_t port)
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    CHECK(fd >= 0);
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr.s_addr = inet_addr("127.0.0.1");
+    CHECK(0==bind(fd, (struct sockaddr *) &local, sizeof(local)));
+    return fd;
+}
+
+static void check_media(const uint8_t *p, size_t length)
+{
+    CHECK(length > (RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE));
+    CHECK(length <= RTP_PACKET_SIZE);
+    CHECK(0x80==p[0]);
+    CHECK(RTP_PAYLOAD_MPA==(p[1] & 0x7f));
+    boolean marker = (0 != (p[1] & 0x80));
+    uint16_t sequence = get16(&p[2]);
+    uint32_t timestamp = get32(&p[4]);
+    if (!have_first) {
+        have_first = true;
+        first_sequence = next_sequence = sequence;
+        ssrc = get32(&p[8]);
+    }
+    CHECK(sequence==next_sequence);
+    CHECK(ssrc==get32(&p[8]));
+    next_sequence = sequence + 1;
+    memcpy(history[sequence % HISTORY], p, length);
+    history_length[sequence % HISTORY] = length;
+    media_packets++;
+    media_bytes += length;
+
+    // RFC 2250 3.5, MBZ and where in the frame this starts
+    CHECK((0==p[12]) && (0==p[13]));
+    CHECK(get16(&p[14])==frame_offset);
+    CHECK(frames_done < FRAMES);
+    if (frames_done >= FRAMES) {
+        return;
+    }
+    mp3_frame_info *info = &frames[frames_done];
+    if (0==frame_offset) {
+        if (0==frames_done) {
+            first_ms = millis();
+            frame_due_us = millis() * 1000.0;
+        } else {
+            mp3_frame_info *last = &frames[frames_done - 1];
+            int32_t step = timestamp - frame_timestamp;
+            double expected = ((double) last->samples * RTP_CLOCK_RATE) / last->sample_rate;
+            CHECK((step >= (expected - 1)) && (step <= (expected + 1)));
+            frame_due_us += ((double) last->samples * 1000000) / last->sample_rate;
+        }
+        frame_timestamp = timestamp;
+        // a new stream, or a new sample rate, starts with the marker
+        boolean rate_change = (frames_done > 0) &&
+            (info->sample_rate != frames[frames_done - 1].sample_rate);
+        CHECK(marker==((0==frames_done) || rate_change));
+        // out when due, and not much later
+        double late = (millis() * 1000.0) - frame_due_us;
+        CHECK((late > -1) && (late < 1000));
+    } else {
+        CHECK(!marker);
+        CHECK(timestamp==frame_timestamp);
+    }
+
+    size_t payload = length - RTP_HEADER_SIZE - RTP_MPA_HEADER_SIZE;
+    CHECK((frame_offset + payload) <= info->length);
+    if ((frame_offset + payload) > info->length) {
+        return;
+    }
+    CHECK_BYTES(&p[RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE],
+        &stream[frame_at[frames_done] + frame_offset], payload);
+    frame_offset += payload;
+    if (frame_offset < info->length) {
+        CHECK(RTP_MAX_PAYLOAD==payload);    // only the last one is short
+    } else {
+        frame_offset = 0;
+        frames_done++;
+    }
+}
+
+// the XOR of the group, see rtp_fec.h
+static void check_parity(const uint8_t *p, size_t length, uint32_t group)
+{
+    size_t header = RTP_HEADER_SIZE + RTP_FEC_HEADER_SIZE;
+    CHECK(length > header);
+    CHECK(0x80==p[0]);
+    CHECK(RTP_PAYLOAD_PARITY==p[1]);
+    CHECK(ssrc==get32(&p[8]));
+    uint16_t sequence = get16(&p[2]);
+    if (have_parity) {
+        CHECK(sequence==next_parity);
+    }
+    have_parity = true;
+    next_parity = sequence + 1;
+
+    const uint8_t *f = &p[RTP_HEADER_SIZE];
+    uint16_t base = get16(f);
+    CHECK(base==(uint16_t) (first_sequence + (parity_packets * group)));
+    CHECK(group==f[2]);
+    CHECK((0==f[3]) && (0==f[6]) && (0==f[7]));
+    uint8_t data[RTP_PACKET_SIZE];
+    memset(data, 0, sizeof(data));
+    uint16_t length_xor = 0;
+    size_t longest = 0;
+    for (uint32_t i = 0; i < group; i++) {
+        uint16_t n = base + i;
+        size_t l = history_length[n % HISTORY];
+        CHECK(n==get16(&history[n % HISTORY][2]));
+        for (size_t j = 0; j < l; j++) {
+            data[j] ^= history[n % HISTORY][j];
+        }
+        length_xor ^= l;
+        longest = (l > longest) ? l : longest;
+    }
+    CHECK(length_xor==get16(&f[4]));
+    CHECK((header + longest)==length);
+    CHECK_BYTES(&p[header], data, longest);
+    parity_packets++;
+}
+
+// RFC 3550 6.4.1, the frame just sent went out at the NTP time
+static void check_report(const uint8_t *p, size_t length)
+{
+    CHECK(RTP_SR_SIZE==length);
+    CHECK(0x80==p[0]);
+    CHECK(RTP_PAYLOAD_SR==p[1]);
+    CHECK((0==p[2]) && (((RTP_SR_SIZE / 4) - 1)==p[3]));
+    CHECK(ssrc==get32(&p[4]));
+    double clock = (get32(&p[8]) * 1000000.0) +
+        ((get32(&p[12]) * 1000000.0) / 4294967296.0);
+    CHECK((clock > (frame_due_us - 1)) && (clock < (frame_due_us + 1)));
+    CHECK(frame_timestamp==get32(&p[16]));
+    CHECK(get32(&p[20])==(media_packets + parity_packets));
+    uint32_t bytes = get32(&p[24]);
+    CHECK(bytes > media_bytes);
+    if (reports) {
+        CHECK((millis() - last_report_ms) >= RTP_SR_INTERVAL_MS);
+        CHECK((millis() - last_report_ms) < (RTP_SR_INTERVAL_MS + 40));
+    }
+    last_report_ms = millis();
+    reports++;
+}
+
+//------------------------------------------------------------------
+//
+// The network to rtp_receiver
+//
+
+typedef struct {
+    uint32_t due;
+    uint16_t port;
+    size_t length;
+    uint8_t data[RTP_PARITY_SIZE];
+} held_packet;
+
+static int send_fd = -1;
+static uint16_t receiver_port = 0;
+static held_packet held[8];
+static uint32_t held_count = 0;
+
+static uint32_t dropped = 0;
+static uint32_t repeated = 0;
+static uint32_t held_back = 0;
+
+// what rtp_receiver should play
+static uint8_t expected[STREAM_SIZE];
+static size_t expected_length = 0;
+static uint8_t played[STREAM_SIZE];
+static size_t played_length = 0;
+
+static void deliver(const uint8_t *data, size_t length, uint16_t port)
+{
+    struct sockaddr_in to;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_port = htons(port);
+    to.sin_addr.s_addr = inet_addr("127.0.0.1");
+    CHECK((int) length==sendto(send_fd, data, length, 0,
+        (struct sockaddr *) &to, sizeof(to)));
+}
+
+// every 23rd packet is lost, but never two of one parity group .. 401
+// and 402 are, one group. Every 29th comes 5ms late, behind the ones
+// after it, and every 31st comes twice.
+static void network_media(const uint8_t *data, size_t length)
+{
+    uint32_t n = (uint16_t) (get16(&data[2]) - first_sequence);
+    boolean gone = (401==n) || (402==n);
+    if (!gone) {
+        memcpy(&expected[expected_length], &data[RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE],
+            length - RTP_HEADER_SIZE - RTP_MPA_HEADER_SIZE);
+        expected_length += length - RTP_HEADER_SIZE - RTP_MPA_HEADER_SIZE;
+    }
+    if (gone || (5==(n % 23))) {
+        dropped++;
+        return;
+    }
+    if ((7==(n % 29)) && (held_count < 8)) {
+        held_packet *h = &held[held_count++];
+        h->due = millis() + HOLD_MS;
+        h->port = receiver_port;
+        h->length = length;
+        memcpy(h->data, data, length);
+        held_back++;
+        return;
+    }
+    deliver(data, length, receiver_port);
+    if (3==(n % 31)) {
+        deliver(data, length, receiver_port);
+        repeated++;
+    }
+}
+
+static void network_run()
+{
+    for (uint32_t i = 0; i < held_count; ) {
+        if ((int32_t) (millis() - held[i].due) >= 0) {
+            deliver(held[i].data, held[i].length, held[i].port);
+            held[i] = held[--held_count];
+        } else {
+            i++;
+        }
+    }
+}
+
+static void play()
+{
+    rtp_receiver_run();
+    size_t got;
+    while ((played_length < STREAM_SIZE) &&
+        ((got = rtp_receiver_read(&played[played_length], 32)) > 0)) {
+        played_length += got;
+    }
+}
+
+//------------------------------------------------------------------
+
+static uint32_t stat(const char *name)
+{
+    const char *at = strstr(test_serial, name);
+    CHECK(at != NULL);
+    return at ? strtoul(at + strlen(name), NULL, 10) : 0xffffffff;
+}
+
+static void set(const char *name, uint32_t value)
+{
+    char text[16];
+    snprintf(text, sizeof(text), "%u", value);
+    SettingItem::updateOrAdd(name, text);
+}
+
+int main()
+{
+    make_stream();
+
+    // five ports for the sender (media, RTCP, parity, -, sync), three
+    // for rtp_receiver
+    uint16_t port = 20000 + ((getpid() % 4000) * 10);
+    receiver_port = port + 5;
+    media_fd = open_socket(port);
+    report_fd = open_socket(port + RTP_RTCP_PORT_OFFSET);
+    parity_fd = open_socket(port + RTP_FEC_PORT_OFFSET);
+    send_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    SettingItem::updateOrAdd("local_rtp_address", "127.0.0.1");
+    set("local_rtp_port", port);
+    set("local_rtp_fec", 4);
+    SettingItem::updateOrAdd("listen_rtp_address", "127.0.0.1");
+    set("listen_rtp_port", receiver_port);
+    set("listen_rtp_sync", 0);
+
+    CHECK(!rtp_begin(ring_head, ring_oldest, ring_get));   // local_rtp is off
+    set("local_rtp", 1);
+    CHECK(rtp_begin(ring_head, ring_oldest, ring_get));
+    CHECK(rtp_receiver_begin());
+    rtp_run();      // the ring is empty, start from its beginning
+
+    uint8_t packet[RTP_PARITY_SIZE + 1];
+    uint32_t end = 0;
+    for (test_millis = 0; test_millis < 30000; test_millis++) {
+        // the encoder keeps a few kB ahead of what has gone out
+        size_t sent = (frames_done < FRAMES) ? frame_at[frames_done] : stream_length;
+        while (((ring_written * RING_BUFFER) < (sent + 8192)) &&
+            ((ring_written * RING_BUFFER) < stream_length)) {
+            ring_written++;
+        }
+
+        rtp_run();
+        int got;
+        while ((got = recv(media_fd, packet, sizeof(packet), MSG_DONTWAIT)) > 0) {
+            check_media(packet, got);
+            network_media(packet, got);
+        }
+        while ((got = recv(parity_fd, packet, sizeof(packet), MSG_DONTWAIT)) > 0) {
+            check_parity(packet, got, 4);
+            deliver(packet, got, receiver_port + RTP_FEC_PORT_OFFSET);
+        }
+        while ((got = recv(report_fd, packet, sizeof(packet), MSG_DONTWAIT)) > 0) {
+            check_report(packet, got);
+        }
+        network_run();
+        play();
+
+        if ((0==end) && (FRAMES==frames_done)) {
+            end = test_millis + 1000;   // for the jitter buffer to empty
+        }
+        if (end && (test_millis >= end)) {
+            break;
+        }
+    }
+
+    CHECK(FRAMES==frames_done);
+    CHECK(RTP_PREBUFFER_MS==first_ms);
+    CHECK((media_packets / 4)==parity_packets);
+    CHECK(reports >= 12);
+    printf("  %u frames in %u packets, %u parity, %u reports, %u ms\n",
+        frames_done, media_packets, parity_packets, reports, test_millis);
+
+    test_serial_echo = false;
+    test_serial_clear();
+    rtp_printStats();
+    CHECK(frames_done==stat("RTP frames "));
+    CHECK(0==stat("send errors "));
+    CHECK(0==stat("RTP lost "));
+    CHECK(JUNK==stat("skipped "));
+    CHECK(0==stat("resyncs "));
+
+    // everything but the two the parity couldn't cover
+    CHECK(expected_length==played_length);
+    CHECK_BYTES(played, expected, expected_length);
+    test_serial_clear();
+    rtp_receiver_printStats();
+    // a packet held back can be rebuilt before it turns up, and then
+    // it's a duplicate
+    uint32_t recovered = stat("recovered ");
+    CHECK(recovered >= (dropped - 2));
+    CHECK((recovered - (dropped - 2))==(stat("duplicates ") - repeated));
+    CHECK(2==stat("lost "));
+    CHECK(held_back <= stat("reordered "));
+    CHECK(0==stat("late "));
+    CHECK(0==stat("resets "));
+    CHECK(0==stat("bad "));
+    return TEST_END();
+}
+
+//
+// END OF test_rtp_output.cpp
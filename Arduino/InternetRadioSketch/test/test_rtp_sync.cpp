@@ -0,0 +1,392 @@
+//
+// test_rtp_sync.cpp
+
+//
+// Synchronised playback (user-041), simulated. The master here sends
+// 44.1kHz frames, a sender report a second, and answers rtp_sync's
+// time requests over loopback, as rtp_output does. Each listener runs
+// in a process of its own (rtp_sync keeps its state in statics) with
+// a clock set off from the master's, a crystal that runs fast or slow,
+// network delays that differ each way, and some answers that wait in
+// a queue. Its decoder plays at its own crystal's rate, turned by what
+// rtp_sync_adjust() says.
+//
+// What it hears is compared with what the master says should be heard
+// at that moment, listen_rtp_delay_ms after it went out. Every box
+// has to be within a millisecond or two of that, and of each other,
+// and end up with its rate turned by about as much as its crystal is
+// off.
+//
+
+#include "test.h"
+#include "rtp_sync.h"
+#include "rtp_output.h"
+#include "../src/ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+#include <sys/wait.h>
+
+enum {
+    STEP_US         = 250,
+    RUN_MS          = 30000,
+    MEASURE_FROM_MS = 15000,
+    MEASURE_EVERY_MS = 100,
+    SAMPLES         = (RUN_MS - MEASURE_FROM_MS) / MEASURE_EVERY_MS,
+    DELAY_MS        = 500,
+    FRAME_SAMPLES   = 1152,
+    SAMPLE_RATE     = 44100,
+    FRAMES          = (RUN_MS * SAMPLE_RATE / 1000 / FRAME_SAMPLES) + 1,
+    NO_SAMPLE       = 0x7fffffff
+};
+
+static const uint32_t TS0 = 0xfffe0000;     // wraps early on
+
+typedef struct {
+    const char *name;
+    int64_t offset_us;      // its clock when the master's reads 0
+    int32_t drift_ppm;      // + its crystal is fast
+    uint32_t out_us;        // to the master
+    uint32_t back_us;
+    uint32_t queue_every;   // every nth answer waits ..
+    uint32_t queue_us;      //  .. this long in a queue
+    uint32_t join_ms;
+} node;
+
+static const node nodes[] = {
+    { "near",           5000000,      0,  500,  500, 0,     0,    0 },
+    { "fast, queued",   123456789,  100, 2000, 2000, 3, 30000,    0 },
+    { "slow, one-sided", 3600000000LL, -150, 1500, 3500, 5, 80000, 2000 },
+    { "late",           60000000,    40,  800,  800, 4, 15000, 9200 }
+};
+static const uint32_t NODES = sizeof(nodes) / sizeof(nodes[0]);
+
+static uint32_t frame_timestamp(uint32_t k)
+{
+    return TS0 + (uint32_t) (((uint64_t) k * FRAME_SAMPLES * RTP_CLOCK_RATE) / SAMPLE_RATE);
+}
+
+// when the master sent frame k, on its clock
+static int64_t frame_sent(uint32_t k)
+{
+    return ((int64_t) k * FRAME_SAMPLES * 1000000) / SAMPLE_RATE;
+}
+
+static void put32(uint8_t *p, uint32_t value)
+{
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+static void put64(uint8_t *p, int64_t value)
+{
+    put32(p, value >> 32);
+    put32(&p[4], value);
+}
+
+//------------------------------------------------------------------
+//
+// One listener, on its own
+//
+
+typedef struct {
+    int64_t due;            // master clock
+    size_t length;
+    uint8_t data[RTP_SYNC_PACKET_SIZE];
+    struct sockaddr_in to;
+} reply;
+
+static const node *n = NULL;
+static int64_t master_us = 0;
+
+// its clock, from the master's
+static void set_clock()
+{
+    int64_t local = n->offset_us + master_us + ((master_us * n->drift_ppm) / 1000000);
+    test_millis = local / 1000;
+    test_us = local % 1000;
+}
+
+// how far from the master's timeline it may be
+static int32_t node_allowed(const node *n)
+{
+    return (abs((int32_t) n->out_us - (int32_t) n->back_us) / 2) + 1000;
+}
+
+static void run_node(uint16_t port, int32_t *errors)
+{
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        errors[i] = NO_SAMPLE;
+    }
+
+    // the master's end of the time exchange
+    int master_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    fcntl(master_fd, F_SETFL, fcntl(master_fd, F_GETFL, 0) | O_NONBLOCK);
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port + RTP_SYNC_PORT_OFFSET);
+    local.sin_addr.s_addr = inet_addr("127.0.0.1");
+    CHECK(0==bind(master_fd, (struct sockaddr *) &local, sizeof(local)));
+    reply replies[8];
+    uint32_t reply_count = 0;
+    uint32_t requests = 0;
+
+    boolean joined = false;
+    uint32_t head = 0;              // the next frame for the decoder
+    uint32_t next_report = 0;       // frame the next report is about
+    int64_t report_due = -1;
+    uint8_t report[RTP_SR_SIZE];
+
+    // the decoder
+    boolean playing = false;
+    int64_t first_played = 0;
+    uint32_t first_frame = 0;
+    double counter = 0;
+    uint32_t fed = 0;               // samples since it started
+    int32_t tune = 0;
+    uint32_t last_adjust = 0;
+    uint32_t trimmed = 0;           // once it was playing
+
+    for (master_us = 0; master_us < ((int64_t) RUN_MS * 1000); master_us += STEP_US) {
+        set_clock();
+
+        if (!joined && (master_us >= ((int64_t) n->join_ms * 1000))) {
+            // the first frame that arrives from now on
+            while (frame_sent(head) + n->out_us < master_us) {
+                head++;
+            }
+            CHECK(rtp_sync_begin(port));
+            joined = true;
+        }
+        // the master's sender report, once a second, about the frame
+        // it just sent
+        if ((next_report < FRAMES) && (frame_sent(next_report) <= master_us)) {
+            int64_t clock = frame_sent(next_report);
+            memset(report, 0, sizeof(report));
+            report[0] = 0x80;
+            report[1] = RTP_PAYLOAD_SR;
+            report[3] = (RTP_SR_SIZE / 4) - 1;
+            put32(&report[8], clock / 1000000);
+            put32(&report[12], (uint32_t) (((uint64_t) (clock % 1000000) << 32) / 1000000));
+            put32(&report[16], frame_timestamp(next_report));
+            report_due = joined ? (master_us + n->out_us) : -1;
+            next_report += (SAMPLE_RATE / FRAME_SAMPLES) + 1;
+        }
+        if (!joined) {
+            continue;
+        }
+
+        // the answers that have got here
+        for (uint32_t i = 0; i < reply_count; ) {
+            if (replies[i].due <= master_us) {
+                sendto(master_fd, replies[i].data, replies[i].length, 0,
+                    (struct sockaddr *) &replies[i].to, sizeof(replies[i].to));
+                replies[i] = replies[--reply_count];
+            } else {
+                i++;
+            }
+        }
+
+        // rtp_receiver_run() .. the frames say who the master is, then
+        // the reports
+        if (frame_sent(head) + n->out_us <= master_us) {
+            rtp_sync_setMaster(inet_addr("127.0.0.1"));
+        }
+        if ((report_due >= 0) && (report_due <= master_us)) {
+            rtp_sync_takeReport(report, sizeof(report));
+            report_due = -1;
+        }
+        rtp_sync_run();
+
+        // the master answers, its t2 when the request gets there
+        uint8_t packet[64];
+        struct sockaddr_in from;
+        socklen_t from_length = sizeof(from);
+        int got;
+        while ((got = recvfrom(master_fd, packet, sizeof(packet), 0,
+            (struct sockaddr *) &from, &from_length)) > 0) {
+            CHECK(RTP_SYNC_PACKET_SIZE==got);
+            CHECK(0==memcmp(packet, "TKSY\x01", 5));
+            requests++;
+            if (reply_count < 8) {
+                reply *r = &replies[reply_count++];
+                int64_t t2 = master_us + n->out_us;
+                int64_t t3 = t2 + 20;
+                memcpy(r->data, packet, got);
+                r->data[4] = 2;
+                put64(&r->data[16], t2);
+                put64(&r->data[24], t3);
+                r->length = got;
+                r->to = from;
+                r->due = t3 + n->back_us;
+                if (n->queue_every && (0==(requests % n->queue_every))) {
+                    r->due += n->queue_us;
+                }
+            }
+            from_length = sizeof(from);
+        }
+
+        // rtp_receiver_read() .. the frames that have arrived, as
+        // rtp_sync_check() says
+        while ((head < FRAMES) && ((frame_sent(head) + n->out_us) <= master_us)) {
+            uint32_t action = rtp_sync_check(frame_timestamp(head));
+            if (RTP_SYNC_WAIT==action) {
+                break;
+            }
+            if (RTP_SYNC_PLAY==action) {
+                uint8_t mpa[RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE + 4];
+                memset(mpa, 0, sizeof(mpa));
+                mpa[0] = 0x80;
+                mpa[1] = RTP_PAYLOAD_MPA;
+                put32(&mpa[4], frame_timestamp(head));
+                memcpy(&mpa[RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE], "\xff\xfb\x90\x00", 4);
+                rtp_sync_fed(mpa, sizeof(mpa));
+                if (rtp_sync_restarted()) {
+                    // the decoder counts from this frame
+                    CHECK(!playing);
+                    playing = true;
+                    first_played = master_us;
+                    first_frame = head;
+                    counter = 0;
+                }
+                fed += FRAME_SAMPLES;
+            }
+            if (RTP_SYNC_SKIP==action) {
+                trimmed += playing ? 1 : 0;
+            }
+            head++;
+        }
+
+        // the decoder plays on its own crystal, turned by tune
+        if (playing) {
+            double local_step = STEP_US * (1.0 + (n->drift_ppm / 1e6));
+            counter += (SAMPLE_RATE * local_step / 1e6) * (1.0 + (tune / 1e6));
+            CHECK(counter <= fed);      // it never runs dry
+            if ((millis() - last_adjust) >= RTP_SYNC_ADJUST_MS) {
+                last_adjust = millis();
+                int32_t ppm;
+                if (rtp_sync_adjust((uint32_t) counter, &ppm)) {
+                    tune = ppm;
+                }
+            }
+        }
+
+        // what is heard now, against what should be
+        if (playing && (0==(master_us % (MEASURE_EVERY_MS * 1000))) &&
+            (master_us >= (MEASURE_FROM_MS * 1000LL))) {
+            double heard = ((first_frame * (double) FRAME_SAMPLES) + counter) *
+                RTP_CLOCK_RATE / SAMPLE_RATE;
+            double should = ((master_us - (DELAY_MS * 1000.0)) * RTP_CLOCK_RATE) / 1e6;
+            uint32_t i = (master_us / 1000 - MEASURE_FROM_MS) / MEASURE_EVERY_MS;
+            errors[i] = (int32_t) (((heard - should) * 1e6) / RTP_CLOCK_RATE);
+        }
+    }
+
+    // half the difference in the delays each way is more than anything
+    // can see, and a step of the simulation on top
+    int32_t allowed = node_allowed(n);
+
+    // the first frame went to the decoder when it was due, however
+    // long it took to lock
+    CHECK(playing);
+    int64_t due = frame_sent(first_frame) + (DELAY_MS * 1000);
+    int32_t start_error = first_played - due;
+    CHECK(abs(start_error) <= (allowed + STEP_US));
+    CHECK(0==trimmed);
+
+    test_serial_clear();
+    rtp_sync_printStats();
+    CHECK(NULL != strstr(test_serial, "RTP sync locked"));
+    // the decoder's rate makes up for its crystal
+    int32_t made_up = tune + n->drift_ppm;
+    CHECK((made_up > -30) && (made_up < 30));
+
+    int32_t worst = 0;
+    for (uint32_t i = 0; i < SAMPLES; i++) {
+        CHECK(errors[i] != NO_SAMPLE);
+        if (abs(errors[i]) > abs(worst)) {
+            worst = errors[i];
+        }
+    }
+    CHECK(abs(worst) <= allowed);
+    printf("  %-16s started %+6d us, worst %+6d us (allowed %d), rate %+5d ppm, "
+        "%u time requests\n", n->name, start_error, worst, allowed, tune, requests);
+    close(master_fd);
+}
+
+//------------------------------------------------------------------
+
+int main()
+{
+    SettingItem::updateOrAdd("listen_rtp_sync", "1");
+    char delay[16];
+    snprintf(delay, sizeof(delay), "%u", DELAY_MS);
+    SettingItem::updateOrAdd("listen_rtp_delay_ms", delay);
+    test_serial_echo = false;
+
+    // every box at once, each with its own rtp_sync
+    uint16_t port = 20000 + ((getpid() % 4000) * 10);
+    int pipes[NODES][2];
+    pid_t pids[NODES];
+    fflush(stdout);
+    for (uint32_t i = 0; i < NODES; i++) {
+        CHECK(0==pipe(pipes[i]));
+        pids[i] = fork();
+        if (0==pids[i]) {
+            n = &nodes[i];
+            static int32_t errors[SAMPLES];
+            run_node(port + (i * 5), errors);
+            CHECK(sizeof(errors)==write(pipes[i][1], errors, sizeof(errors)));
+            fflush(stdout);
+            _exit(test_failures ? 1 : 0);
+        }
+        close(pipes[i][1]);
+    }
+
+    static int32_t errors[NODES][SAMPLES];
+    for (uint32_t i = 0; i < NODES; i++) {
+        size_t got = 0;
+        ssize_t r;
+        while ((got < sizeof(errors[i])) &&
+            ((r = read(pipes[i][0], (uint8_t *) errors[i] + got, sizeof(errors[i]) - got)) > 0)) {
+            got += r;
+        }
+        CHECK(sizeof(errors[i])==got);
+        int status = 0;
+        CHECK(pids[i]==waitpid(pids[i], &status, 0));
+        CHECK(WIFEXITED(status) && (0==WEXITSTATUS(status)));
+    }
+
+    // and the rooms with each other
+    int32_t spread = 0;
+    for (uint32_t s = 0; s < SAMPLES; s++) {
+        int32_t low = errors[0][s];
+        int32_t high = errors[0][s];
+        for (uint32_t i = 1; i < NODES; i++) {
+            low = (errors[i][s] < low) ? errors[i][s] : low;
+            high = (errors[i][s] > high) ? errors[i][s] : high;
+        }
+        spread = ((high - low) > spread) ? (high - low) : spread;
+    }
+    // no further apart than the two that may be furthest out
+    int32_t first = 0;
+    int32_t second = 0;
+    for (uint32_t i = 0; i < NODES; i++) {
+        int32_t allowed = node_allowed(&nodes[i]);
+        if (allowed > first) {
+            second = first;
+            first = allowed;
+        } else if (allowed > second) {
+            second = allowed;
+        }
+    }
+    CHECK(spread <= (first + second));
+    printf("  %u boxes within %d us of each other (allowed %d)\n", NODES,
+        spread, first + second);
+    return TEST_END();
+}
+
+//
+// END OF test_rtp_sync.cpp
@@ -0,0 +1,553 @@
+//
+// test_rtp_uplink.cpp
+
+//
+// The RTP contribution uplink (user-044) against a studio receiver
+// written here from RFC 3550 and RFC 4585. The encoder fills the ring
+// 16 bytes a millisecond, and each frame has to go out in the same
+// millisecond its last byte is encoded. The network between them takes
+// 15ms each way and loses every 17th packet (one of them twice). The
+// receiver asks for what it missed with generic NACKs, again every 60ms
+// while it's still missing, and sends receiver reports. It has to end
+// up with every packet, the frames byte for byte, and the uplink has
+// to work out the 30ms round trip. A NACK sent twice is only answered
+// once, and one for a packet long gone isn't answered at all.
+//
+// remote_rtp_host is a name, so the uplink waits for the lookup, which
+// answers later as lwip's task would.
+//
+
+#include "test.h"
+#include "rtp_uplink.h"
+#include "rtp_output.h"
+#include "rtp_sync.h"
+#include "rtp_fec.h"
+#include "mp3_frame.h"
+#include "../src/ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+#include "lwip/dns.h"
+
+enum {
+    FRAMES          = 400,
+    STREAM_SIZE     = FRAMES * 418,
+    RING_SLOTS      = 16,
+    RING_BUFFER     = 4096,
+    BYTES_PER_MS    = 16,       // 128kbit/s
+    NETWORK_MS      = 15,       // each way
+    RENACK_MS       = 60,
+    REPORT_MS       = 500,
+    DNS_MS          = 300,      // when the lookup answers
+    PACKETS         = 1024,
+    QUEUE           = 64
+};
+
+static const uint32_t STUDIO_SSRC = 0x53545544;
+
+//------------------------------------------------------------------
+//
+// The encoder
+//
+
+static uint8_t stream[STREAM_SIZE];
+static size_t stream_length = 0;
+static size_t frame_at[FRAMES];
+static size_t written = 0;
+
+static void make_stream()
+{
+    for (uint32_t n = 0; n < FRAMES; n++) {
+        uint8_t *p = &stream[stream_length];
+        p[0] = 0xff;
+        p[1] = 0xfb;
+        p[2] = 0x90 | ((n % 3) ? 0 : 0x02);
+        p[3] = 0x00;
+        mp3_frame_info info;
+        CHECK(mp3_frame_parse(p, &info));
+        // nothing in the frame looks like a frame sync
+        for (size_t i = MP3_HEADER_SIZE; i < info.length; i++) {
+            p[i] = esp_random() & 0x7f;
+        }
+        frame_at[n] = stream_length;
+        stream_length += info.length;
+    }
+}
+
+// as Streamer's
+static uint32_t ring_head()
+{
+    return written / RING_BUFFER;
+}
+
+static uint32_t ring_oldest()
+{
+    uint32_t window = RING_SLOTS - 2;
+    return (ring_head() > window) ? (ring_head() - window) : 0;
+}
+
+static uint8_t *ring_get(uint32_t n, size_t *length)
+{
+    *length = 0;
+    if ((n >= ring_head()) || (n < ring_oldest())) {
+        return NULL;
+    }
+    *length = RING_BUFFER;
+    return &stream[n * RING_BUFFER];
+}
+
+static uint8_t *ring_filling(uint32_t *n, size_t *length)
+{
+    *n = ring_head();
+    *length = written % RING_BUFFER;
+    return &stream[*n * RING_BUFFER];
+}
+
+//------------------------------------------------------------------
+//
+// lwip's DNS, answering a while later from its own task
+//
+
+static dns_found_callback dns_callback = NULL;
+static void *dns_arg = NULL;
+static uint32_t dns_asks = 0;
+
+err_t dns_gethostbyname(const char *hostname, ip_addr_t *addr,
+    dns_found_callback found, void *callback_arg)
+{
+    dns_asks++;
+    struct in_addr numeric;
+    if (inet_aton(hostname, &numeric)) {
+        addr->ip4.addr = numeric.s_addr;
+        return ERR_OK;
+    }
+    CHECK(0==strcmp("studio.example", hostname));
+    dns_callback = found;
+    dns_arg = callback_arg;
+    return ERR_INPROGRESS;
+}
+
+static void dns_answer()
+{
+    ip_addr_t addr;
+    addr.ip4.addr = inet_addr("127.0.0.1");
+    dns_callback("studio.example", &addr, dns_arg);
+    dns_callback = NULL;
+}
+
+//------------------------------------------------------------------
+//
+// The network, NETWORK_MS each way
+//
+
+typedef struct {
+    uint32_t due;
+    size_t length;
+    uint8_t data[RTP_PACKET_SIZE];
+} queued;
+
+typedef struct {
+    queued packets[QUEUE];
+    uint32_t count;
+} network_link;
+
+static network_link to_studio;
+static network_link to_uplink;
+static int studio_fd = -1;
+static struct sockaddr_in uplink_address;
+
+static void queue(network_link *l, const uint8_t *data, size_t length)
+{
+    CHECK(l->count < QUEUE);
+    CHECK(length <= RTP_PACKET_SIZE);
+    if ((l->count >= QUEUE) || (length > RTP_PACKET_SIZE)) {
+        return;
+    }
+    queued *q = &l->packets[l->count++];
+    q->due = millis() + NETWORK_MS;
+    q->length = length;
+    memcpy(q->data, data, length);
+}
+
+// the next one that has got there, in the order they were sent
+static boolean arrived(network_link *l, queued *out)
+{
+    if ((0==l->count) || ((int32_t) (millis() - l->packets[0].due) < 0)) {
+        return false;
+    }
+    *out = l->packets[0];
+    memmove(&l->packets[0], &l->packets[1], (--l->count) * sizeof(queued));
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// The studio
+//
+
+static uint16_t get16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void put32(uint8_t *p, uint32_t value)
+{
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+// on the wire, as the uplink sent them
+static boolean have_first = false;
+static uint16_t first_sequence = 0;
+static uint32_t ssrc = 0;
+static uint32_t first_frame = 0;        // of the stream, the first one sent
+static uint32_t frames_sent = 0;
+static uint32_t last_timestamp = 0;
+static uint32_t packets_sent = 0;
+static uint32_t bytes_sent = 0;
+static uint8_t sends[PACKETS];          // how often each went out
+static uint32_t dropped = 0;
+
+// what got to the studio
+static boolean have[PACKETS];
+static uint8_t payload[PACKETS][RTP_MAX_PAYLOAD];
+static size_t payload_length[PACKETS];
+static uint16_t fragment[PACKETS];
+static int32_t highest = -1;
+static uint32_t nacked_at[PACKETS];
+static uint32_t nacks = 0;
+static uint32_t sr_lsr = 0;
+static uint32_t sr_arrived = 0;
+static uint32_t last_rr = 0;
+static uint32_t sender_reports = 0;
+
+static uint32_t sequence_number(const uint8_t *p)
+{
+    return (uint16_t) (get16(&p[2]) - first_sequence);
+}
+
+// from the uplink, before the network
+static void check_sent(const uint8_t *p, size_t length)
+{
+    if (RTP_PAYLOAD_SR==p[1]) {
+        // SR, then SDES with the CNAME
+        CHECK(length==(RTP_SR_SIZE + 20));
+        CHECK((0x80==p[0]) && (0==p[2]) && (((RTP_SR_SIZE / 4) - 1)==p[3]));
+        CHECK(ssrc==get32(&p[4]));
+        double clock = (get32(&p[8]) * 1000000.0) +
+            ((get32(&p[12]) * 1000000.0) / 4294967296.0);
+        CHECK((clock > ((millis() * 1000.0) - 1)) && (clock < ((millis() * 1000.0) + 1)));
+        CHECK(last_timestamp==get32(&p[16]));
+        CHECK(packets_sent==get32(&p[20]));
+        CHECK(bytes_sent==get32(&p[24]));
+        const uint8_t *sdes = &p[RTP_SR_SIZE];
+        CHECK((0x81==sdes[0]) && (RTP_PAYLOAD_SDES==sdes[1]) && (4==get16(&sdes[2])));
+        CHECK(ssrc==get32(&sdes[4]));
+        CHECK((1==sdes[8]) && (7==sdes[9]) && (0==memcmp(&sdes[10], "toolkit", 7)));
+        CHECK((0==sdes[17]) && (0==sdes[18]) && (0==sdes[19]));
+        return;
+    }
+
+    CHECK((length > (RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE)) && (length <= RTP_PACKET_SIZE));
+    CHECK((0x80==p[0]) && (RTP_PAYLOAD_MPA==(p[1] & 0x7f)));
+    if (!have_first) {
+        have_first = true;
+        first_sequence = get16(&p[2]);
+        ssrc = get32(&p[8]);
+        // the live edge when the lookup answered, less the frame that
+        // was part way through
+        while (frame_at[first_frame] < (DNS_MS * BYTES_PER_MS)) {
+            first_frame++;
+        }
+    }
+    CHECK(ssrc==get32(&p[8]));
+    uint32_t n = sequence_number(p);
+    CHECK(n < PACKETS);
+    if (n >= PACKETS) {
+        return;
+    }
+    packets_sent++;
+    bytes_sent += length;
+    if (sends[n]++) {
+        return;     // sent again, for a NACK
+    }
+
+    // a frame a packet, the first time straight after its last byte
+    uint32_t frame = first_frame + frames_sent;
+    CHECK(n==frames_sent);
+    CHECK(frame < FRAMES);
+    if (frame >= FRAMES) {
+        return;
+    }
+    mp3_frame_info info;
+    mp3_frame_parse(&stream[frame_at[frame]], &info);
+    size_t end = frame_at[frame] + info.length;
+    CHECK(millis()==((end + BYTES_PER_MS - 1) / BYTES_PER_MS));
+    uint32_t timestamp = get32(&p[4]);
+    if (frames_sent) {
+        int32_t step = timestamp - last_timestamp;
+        CHECK((2351==step) || (2352==step));    // 1152 samples at 44.1kHz
+    }
+    CHECK(((p[1] & 0x80) != 0)==(0==frames_sent));
+    last_timestamp = timestamp;
+    frames_sent++;
+}
+
+// every 17th is lost, and the first time it's sent again too for one
+static boolean lose(const uint8_t *p)
+{
+    if (RTP_PAYLOAD_SR==p[1]) {
+        return false;
+    }
+    uint32_t n = sequence_number(p);
+    if ((n < PACKETS) && (8==(n % 17)) && ((1==sends[n]) || ((25==n) && (2==sends[n])))) {
+        dropped++;
+        return true;
+    }
+    return false;
+}
+
+static void send_rtcp(const uint8_t *p, size_t length)
+{
+    queue(&to_uplink, p, length);
+}
+
+// RFC 4585 6.2.1, the missing ones as PID and a bitmask of the 16 after
+static void send_nack(const uint32_t *missing, uint32_t count)
+{
+    uint8_t p[RTP_UPLINK_RTCP_SIZE];
+    size_t length = 12;
+    uint16_t pid = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint16_t sequence = first_sequence + missing[i];
+        if ((length > 12) && ((uint16_t) (sequence - pid - 1) < 16)) {
+            uint16_t blp = get16(&p[length - 2]) | (1 << (uint16_t) (sequence - pid - 1));
+            p[length - 2] = blp >> 8;
+            p[length - 1] = blp;
+            continue;
+        }
+        pid = sequence;
+        p[length++] = pid >> 8;
+        p[length++] = pid;
+        p[length++] = 0;
+        p[length++] = 0;
+    }
+    p[0] = 0x80 | RTP_FMT_NACK;
+    p[1] = RTP_PAYLOAD_RTPFB;
+    p[2] = 0;
+    p[3] = (length / 4) - 1;
+    put32(&p[4], STUDIO_SSRC);
+    put32(&p[8], ssrc);
+    send_rtcp(p, length);
+    nacks++;
+}
+
+static void nack_missing()
+{
+    uint32_t missing[64];
+    uint32_t count = 0;
+    for (int32_t n = 0; (n < highest) && (count < 64); n++) {
+        if (!have[n] && ((0==nacked_at[n]) || ((millis() - nacked_at[n]) >= RENACK_MS))) {
+            missing[count++] = n;
+            nacked_at[n] = millis();
+        }
+    }
+    if (count) {
+        send_nack(missing, count);
+        if ((1==count) && (42==missing[0])) {
+            send_nack(missing, count);  // the same again, crossing it
+        }
+    }
+}
+
+// RFC 3550 6.4.2, one block about the uplink
+static void send_rr()
+{
+    uint8_t p[32];
+    p[0] = 0x81;
+    p[1] = RTP_PAYLOAD_RR;
+    p[2] = 0;
+    p[3] = 7;
+    put32(&p[4], STUDIO_SSRC);
+    put32(&p[8], ssrc);
+    put32(&p[12], 0);                           // nothing lost after repair
+    put32(&p[16], first_sequence + highest);
+    put32(&p[20], 2 * (RTP_CLOCK_RATE / 1000)); // 2ms of jitter
+    put32(&p[24], sr_lsr);
+    put32(&p[28], ((millis() - sr_arrived) * 65536) / 1000);
+    send_rtcp(p, sizeof(p));
+    last_rr = millis();
+}
+
+static void studio_receive(const uint8_t *p, size_t length)
+{
+    if (RTP_PAYLOAD_SR==p[1]) {
+        sr_lsr = (get32(&p[8]) << 16) | (get32(&p[12]) >> 16);
+        sr_arrived = millis();
+        sender_reports++;
+        return;
+    }
+    uint32_t n = sequence_number(p);
+    if (n >= PACKETS) {
+        return;
+    }
+    CHECK(!have[n]);    // nothing is sent again unless it was lost
+    have[n] = true;
+    payload_length[n] = length - RTP_HEADER_SIZE - RTP_MPA_HEADER_SIZE;
+    memcpy(payload[n], &p[RTP_HEADER_SIZE + RTP_MPA_HEADER_SIZE], payload_length[n]);
+    fragment[n] = get16(&p[14]);
+    if ((int32_t) n > highest) {
+        highest = n;
+    }
+}
+
+//------------------------------------------------------------------
+
+// the stats line with text in it
+static const char *line(const char *text)
+{
+    const char *at = strstr(test_serial, text);
+    CHECK(at != NULL);
+    if (NULL==at) {
+        return "";
+    }
+    while ((at > test_serial) && (at[-1] != '\n')) {
+        at--;
+    }
+    return at;
+}
+
+int main()
+{
+    make_stream();
+    uint16_t port = 20000 + ((getpid() % 4000) * 10);
+    studio_fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    fcntl(studio_fd, F_SETFL, fcntl(studio_fd, F_GETFL, 0) | O_NONBLOCK);
+    struct sockaddr_in local;
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr.s_addr = inet_addr("127.0.0.1");
+    CHECK(0==bind(studio_fd, (struct sockaddr *) &local, sizeof(local)));
+
+    char text[16];
+    snprintf(text, sizeof(text), "%u", port);
+    SettingItem::updateOrAdd("remote_rtp_port", text);
+    CHECK(!rtp_uplink_begin(ring_head, ring_oldest, ring_get, ring_filling));
+    SettingItem::updateOrAdd("remote_rtp", "1");
+    CHECK(!rtp_uplink_begin(ring_head, ring_oldest, ring_get, ring_filling));
+    SettingItem::updateOrAdd("remote_rtp_host", "studio.example");
+    CHECK(rtp_uplink_begin(ring_head, ring_oldest, ring_get, ring_filling));
+
+    uint8_t packet[RTP_UPLINK_RTCP_SIZE + RTP_PACKET_SIZE];
+    uint32_t end = (stream_length / BYTES_PER_MS) + 1000;
+    boolean asked_old = false;
+    for (test_millis = 1; test_millis < end; test_millis++) {
+        written = test_millis * BYTES_PER_MS;
+        written = (written > stream_length) ? stream_length : written;
+        if ((DNS_MS==test_millis) && dns_callback) {
+            dns_answer();
+        }
+
+        rtp_uplink_run();
+
+        struct sockaddr_in from;
+        socklen_t from_length = sizeof(from);
+        int got;
+        while ((got = recvfrom(studio_fd, packet, sizeof(packet), MSG_DONTWAIT,
+            (struct sockaddr *) &from, &from_length)) > 0) {
+            uplink_address = from;
+            check_sent(packet, got);
+            if (!lose(packet)) {
+                queue(&to_studio, packet, got);
+            }
+            from_length = sizeof(from);
+        }
+
+        queued q;
+        while (arrived(&to_studio, &q)) {
+            studio_receive(q.data, q.length);
+        }
+        nack_missing();
+        if (sender_reports && ((millis() - last_rr) >= REPORT_MS)) {
+            send_rr();
+        }
+        // and once, long after, for the first packet
+        if (!asked_old && (millis() >= (end - 100))) {
+            uint32_t first = 0;
+            send_nack(&first, 1);
+            asked_old = true;
+        }
+        while (arrived(&to_uplink, &q)) {
+            sendto(studio_fd, q.data, q.length, 0,
+                (struct sockaddr *) &uplink_address, sizeof(uplink_address));
+        }
+    }
+
+    // asked once for the name, and the frames from the live edge on
+    CHECK(1==dns_asks);
+    CHECK(frames_sent==(FRAMES - first_frame));
+    CHECK(sender_reports >= 9);
+
+    // every packet got there in the end, and the frames are whole
+    CHECK(highest==(int32_t) (frames_sent - 1));
+    uint32_t frame = first_frame;
+    for (int32_t n = 0; n <= highest; n++, frame++) {
+        CHECK(have[n]);
+        CHECK(0==fragment[n]);
+        CHECK(payload_length[n]==((frame < (FRAMES - 1)) ? frame_at[frame + 1] :
+            stream_length) - frame_at[frame]);
+        CHECK_BYTES(payload[n], &stream[frame_at[frame]], payload_length[n]);
+    }
+
+    test_serial_echo = false;
+    test_serial_clear();
+    rtp_uplink_printStats();
+    test_serial_echo = true;
+    printf("%s", test_serial);
+    uint32_t frames, packets, bytes, errors, lost, skipped;
+    CHECK(6==sscanf(line("RTP uplink frames"), "RTP uplink frames %u, packets %u, "
+        "bytes %u, send errors %u, lost %u ring buffers, skipped %u bytes",
+        &frames, &packets, &bytes, &errors, &lost, &skipped));
+    CHECK(frames_sent==frames);
+    CHECK(packets_sent==packets);
+    CHECK(0==errors);
+    CHECK(0==lost);
+    CHECK((frame_at[first_frame] - (DNS_MS * BYTES_PER_MS))==skipped);
+
+    uint32_t nack_packets, requested, resent, percent, too_old, too_soon;
+    CHECK(6==sscanf(line("RTP uplink NACKs"), "RTP uplink NACKs %u for %u packets, "
+        "resent %u (%u%%), %u too old, %u too soon", &nack_packets, &requested,
+        &resent, &percent, &too_old, &too_soon));
+    CHECK(nacks==nack_packets);
+    CHECK(dropped==resent);
+    CHECK(1==too_old);
+    CHECK(1==too_soon);
+    CHECK((resent + too_old + too_soon)==requested);
+
+    uint32_t reports, rtt, rtt_min, rtt_average, jitter, fraction;
+    int32_t cumulative;
+    CHECK(7==sscanf(line(" reports, rtt "), "RTP uplink %u reports, rtt %u ms (min %u, "
+        "average %u), jitter %u ms, lost after repair %u%% (%d packets)",
+        &reports, &rtt, &rtt_min, &rtt_average, &jitter, &fraction, &cumulative));
+    CHECK((rtt >= ((2 * NETWORK_MS) - 1)) && (rtt <= (2 * NETWORK_MS)));
+    CHECK((rtt_min >= ((2 * NETWORK_MS) - 1)) && (rtt_average <= (2 * NETWORK_MS)));
+    CHECK(2==jitter);
+    CHECK((0==fraction) && (0==cumulative));
+
+    uint32_t latency, behind, behind_max;
+    CHECK(3==sscanf(line("RTP uplink latency"), "RTP uplink latency ~%u ms "
+        "(%u ms behind the encoder, max %u", &latency, &behind, &behind_max));
+    CHECK(behind_max <= 1);         // never behind the encoder
+    CHECK(latency==(behind + (rtt_average / 2)));
+    return TEST_END();
+}
+
+//
+// END OF test_rtp_uplink.cpp
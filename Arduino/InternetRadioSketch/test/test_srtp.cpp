@@ -0,0 +1,233 @@
+//
+// test_srtp.cpp
+
+//
+// SRTP for WHIP (user-045) against the RFC 3711 test vectors: the
+// AES-CM keystream of Appendix B.2, the session keys Appendix B.3
+// derives from its master key and salt, and a packet protected with
+// that master key as libsrtp's own test driver protects it. Then
+// packets across a rollover, with CSRCs and a header extension,
+// against AES-CTR and HMAC-SHA1 done here straight from OpenSSL, and
+// RTP headers that run off the end of the packet.
+//
+// mbedtls isn't on the host, stubs/mbedtls.cpp does its calls with
+// OpenSSL and keeps the keys where this can look at them.
+//
+
+#include "test.h"
+#include "srtp.h"
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+static uint8_t master_key[SRTP_MASTER_KEY_SIZE];
+static uint8_t master_salt[SRTP_MASTER_SALT_SIZE];
+
+static void b3_master()
+{
+    test_hex("E1F97A0D3E018BE0D64FA32C06DE4139", master_key);
+    test_hex("0EC675AD498AFEEBB6960B3AABE6", master_salt);
+}
+
+// RFC 3711 B.2, AES-CM keystream .. a packet of zeros with SSRC, ROC
+// and sequence number 0 comes out as the keystream itself
+static void test_b2_keystream()
+{
+    srtp_context srtp;
+    b3_master();
+    CHECK(srtp_begin(&srtp, master_key, master_salt));
+    uint8_t key[16];
+    test_hex("2B7E151628AED2A6ABF7158809CF4F3C", key);
+    mbedtls_aes_setkey_enc(&srtp.aes, key, 128);
+    test_hex("F0F1F2F3F4F5F6F7F8F9FAFBFCFD", srtp.salt);
+
+    uint8_t packet[12 + 48 + SRTP_AUTH_TAG_SIZE];
+    memset(packet, 0, sizeof(packet));
+    packet[0] = 0x80;
+    CHECK((sizeof(packet))==srtp_protect(&srtp, packet, 12 + 48));
+    uint8_t expected[48];
+    test_hex("E03EAD0935C95E80E166B16DD92B4EB4"
+        "D23513162B02D0F72A43A2FE4A5F97AB"
+        "41E95B3BB0A2E8DD477901E4FCA894C0", expected);
+    CHECK_BYTES(&packet[12], expected, 48);
+    srtp_end(&srtp);
+}
+
+// RFC 3711 B.3, key derivation
+static void test_b3_derivation()
+{
+    srtp_context srtp;
+    b3_master();
+    CHECK(srtp_begin(&srtp, master_key, master_salt));
+    uint8_t key[16];
+    uint8_t auth[20];
+    uint8_t salt[14];
+    test_hex("C61E7A93744F39EE10734AFE3FF7A087", key);
+    test_hex("CEBE321F6FF7716B6FD4AB49AF256A156D38BAA4", auth);
+    test_hex("30CBBC08863D8C85D49DB34A9AE1", salt);
+    CHECK(128==srtp.aes.bits);
+    CHECK_BYTES(srtp.aes.key, key, 16);
+    CHECK(20==srtp.hmac.key_length);
+    CHECK_BYTES(srtp.hmac.key, auth, 20);
+    CHECK_BYTES(srtp.salt, salt, 14);
+    srtp_end(&srtp);
+}
+
+// libsrtp's test/srtp_driver.c, srtp_aes_cm_128_hmac_sha1_80 with the
+// B.3 master key and salt
+static void test_libsrtp_packet()
+{
+    srtp_context srtp;
+    b3_master();
+    CHECK(srtp_begin(&srtp, master_key, master_salt));
+    uint8_t packet[64];
+    size_t length = test_hex("800f1234decafbadcafebabe"
+        "abababababababababababababababab", packet);
+    uint8_t expected[64];
+    size_t expected_length = test_hex("800f1234decafbadcafebabe"
+        "4e55dc4ce79978d88ca4d215949d2402" "b78d6acc99ea179b8dbb", expected);
+    CHECK(expected_length==srtp_protect(&srtp, packet, length));
+    CHECK_BYTES(packet, expected, expected_length);
+    srtp_end(&srtp);
+}
+
+//------------------------------------------------------------------
+//
+// the same again, straight from OpenSSL
+
+static void reference_protect(const uint8_t *key, const uint8_t *auth,
+    const uint8_t *salt, uint32_t roc, uint8_t *packet, size_t header,
+    size_t length)
+{
+    uint16_t sequence = (packet[2] << 8) | packet[3];
+    uint8_t iv[16];
+    memset(iv, 0, sizeof(iv));
+    memcpy(iv, salt, 14);
+    for (uint32_t i = 0; i < 4; i++) {
+        iv[4 + i] ^= packet[8 + i];
+    }
+    uint64_t index = ((uint64_t) roc << 16) | sequence;
+    for (uint32_t i = 0; i < 6; i++) {
+        iv[13 - i] ^= (uint8_t) (index >> (8 * i));
+    }
+    EVP_CIPHER_CTX *evp = EVP_CIPHER_CTX_new();
+    int out = 0;
+    EVP_EncryptInit_ex(evp, EVP_aes_128_ctr(), NULL, key, iv);
+    EVP_EncryptUpdate(evp, &packet[header], &out, &packet[header],
+        length - header);
+    EVP_CIPHER_CTX_free(evp);
+
+    uint8_t authenticated[2048];
+    memcpy(authenticated, packet, length);
+    authenticated[length] = roc >> 24;
+    authenticated[length + 1] = roc >> 16;
+    authenticated[length + 2] = roc >> 8;
+    authenticated[length + 3] = roc;
+    uint8_t tag[20];
+    unsigned int tag_length = 0;
+    HMAC(EVP_sha1(), auth, 20, authenticated, length + 4, tag, &tag_length);
+    memcpy(&packet[length], tag, SRTP_AUTH_TAG_SIZE);
+}
+
+static void test_rollover()
+{
+    srtp_context srtp;
+    b3_master();
+    CHECK(srtp_begin(&srtp, master_key, master_salt));
+    uint8_t key[16];
+    uint8_t auth[20];
+    uint8_t salt[14];
+    memcpy(key, srtp.aes.key, 16);
+    memcpy(auth, srtp.hmac.key, 20);
+    memcpy(salt, srtp.salt, 14);
+
+    uint32_t roc = 0;
+    uint16_t sequence = 65530;
+    for (uint32_t n = 0; n < 20; n++, sequence++) {
+        if (0==sequence) {
+            roc++;
+        }
+        uint8_t packet[1500];
+        uint8_t expected[1500];
+        // plain, two CSRCs, or a two word header extension
+        uint32_t kind = n % 3;
+        size_t header = 12;
+        packet[0] = 0x80;
+        if (1==kind) {
+            packet[0] |= 0x02;
+            header += 8;
+        } else if (2==kind) {
+            packet[0] |= 0x10;
+            header += 4 + 8;
+        }
+        packet[1] = 111;
+        packet[2] = sequence >> 8;
+        packet[3] = sequence;
+        memcpy(&packet[4], "\x00\x01\xe2\x40" "\x12\x34\x56\x78", 8);
+        for (size_t i = 12; i < header; i++) {
+            packet[i] = i;
+        }
+        if (2==kind) {
+            packet[12] = 0xbe;
+            packet[13] = 0xde;
+            packet[14] = 0;
+            packet[15] = 2;
+        }
+        size_t length = header + 20 + (n * 37);
+        for (size_t i = header; i < length; i++) {
+            packet[i] = (uint8_t) esp_random();
+        }
+        memcpy(expected, packet, length);
+        reference_protect(key, auth, salt, roc, expected, header, length);
+        CHECK((length + SRTP_AUTH_TAG_SIZE)==srtp_protect(&srtp, packet, length));
+        CHECK_BYTES(packet, expected, length + SRTP_AUTH_TAG_SIZE);
+    }
+    CHECK(1==srtp.roc);
+    srtp_end(&srtp);
+}
+
+// headers that say they're longer than the packet .. each is in a
+// buffer of exactly its length, so running the ASan build finds any
+// read past it
+static void test_short_headers()
+{
+    srtp_context srtp;
+    b3_master();
+    CHECK(srtp_begin(&srtp, master_key, master_salt));
+
+    static const char *packets[] = {
+        "800f1234decafbadcafeba",                   // 11 bytes
+        "820f1234decafbadcafebabe00000001",         // 2 CSRCs, room for 1
+        "900f1234decafbadcafebabe",                 // extension, no header
+        "900f1234decafbadcafebabebede",             //  .. half of it
+        "900f1234decafbadcafebabebede0002000000",   //  .. says 2 words, has 0
+        "9f0f1234decafbadcafebabe"                  // 15 CSRCs and an extension
+    };
+    for (uint32_t i = 0; i < (sizeof(packets) / sizeof(packets[0])); i++) {
+        uint8_t bytes[64];
+        size_t length = test_hex(packets[i], bytes);
+        uint8_t *exact = (uint8_t *) malloc(length);
+        memcpy(exact, bytes, length);
+        CHECK(0==srtp_protect(&srtp, exact, length));
+        CHECK_BYTES(exact, bytes, length);
+        free(exact);
+    }
+
+    // an extension header and nothing after it is fine
+    uint8_t packet[16 + SRTP_AUTH_TAG_SIZE];
+    test_hex("900f1234decafbadcafebabebede0000", packet);
+    CHECK((16 + SRTP_AUTH_TAG_SIZE)==srtp_protect(&srtp, packet, 16));
+    srtp_end(&srtp);
+}
+
+int main()
+{
+    test_b2_keystream();
+    test_b3_derivation();
+    test_libsrtp_packet();
+    test_rollover();
+    test_short_headers();
+    return TEST_END();
+}
+
+//
+// END OF test_srtp.cpp
@@ -0,0 +1,208 @@
+//
+// test_stun.cpp
+
+//
+// The STUN for WHIP's ICE (user-045) against the RFC 5769 test vectors:
+// the sample request (2.1) has to pass stun_checkRequest() and the
+// sample IPv4 response (2.2) stun_checkResponse(). What we make is
+// checked field by field, the XOR-MAPPED-ADDRESS against the sample
+// response's, MESSAGE-INTEGRITY against OpenSSL's HMAC-SHA1 and
+// FINGERPRINT against zlib's CRC-32 XOR 0x5354554e.
+//
+
+#include "test.h"
+#include "stun.h"
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <zlib.h>
+
+static const char password[] = "VOkJxbRl1RmTxUk/WvJxBt";
+
+// RFC 5769 2.1, USERNAME "evtj:h6vY"
+static const char sample_request[] =
+    "000100582112a442b7e7a701bc34d686fa87dfae"
+    "80220010" "5354554e207465737420636c69656e74"       // SOFTWARE
+    "00240004" "6e0001ff"                               // PRIORITY
+    "80290008" "932ff9b151263b36"                       // ICE-CONTROLLED
+    "00060009" "6576746a3a68367659202020"               // USERNAME
+    "00080014" "9aeaa70cbfd8cb56781ef2b5b2d3f249c1b571a2"
+    "80280004" "e57a3bcf";
+
+// RFC 5769 2.2, from 192.0.2.1 port 32853
+static const char sample_response[] =
+    "0101003c2112a442b7e7a701bc34d686fa87dfae"
+    "8022000b" "7465737420766563746f7220"               // SOFTWARE
+    "00200008" "0001a147e112a643"                       // XOR-MAPPED-ADDRESS
+    "00080014" "2b91f599fd9e90c38c7489f92af9ba53f06be7d7"
+    "80280004" "c07d4c96";
+
+static uint16_t get16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+// checks the last two attributes of a message we made, independently
+static void check_signed(const uint8_t *message, size_t length,
+    const char *key)
+{
+    CHECK(0==(length % 4));
+    CHECK((size_t) (STUN_HEADER_SIZE + get16(&message[2]))==length);
+    CHECK(STUN_MAGIC_COOKIE==get32(&message[4]));
+
+    // FINGERPRINT, the CRC of everything before it
+    size_t fingerprint = length - 8;
+    CHECK(STUN_FINGERPRINT==get16(&message[fingerprint]));
+    CHECK(4==get16(&message[fingerprint + 2]));
+    uint32_t crc = crc32(0, message, fingerprint) ^ 0x5354554e;
+    CHECK(crc==get32(&message[fingerprint + 4]));
+
+    // MESSAGE-INTEGRITY, with the length as if it were the last
+    size_t integrity = fingerprint - 4 - STUN_INTEGRITY_SIZE;
+    CHECK(STUN_MESSAGE_INTEGRITY==get16(&message[integrity]));
+    CHECK(STUN_INTEGRITY_SIZE==get16(&message[integrity + 2]));
+    uint8_t copy[STUN_MAX_SIZE];
+    memcpy(copy, message, integrity);
+    copy[2] = (integrity + 4 + STUN_INTEGRITY_SIZE - STUN_HEADER_SIZE) >> 8;
+    copy[3] = (integrity + 4 + STUN_INTEGRITY_SIZE - STUN_HEADER_SIZE);
+    uint8_t hmac[20];
+    unsigned int hmac_length = 0;
+    HMAC(EVP_sha1(), key, strlen(key), copy, integrity, hmac, &hmac_length);
+    CHECK_BYTES(&message[integrity + 4], hmac, STUN_INTEGRITY_SIZE);
+}
+
+// the offset of an attribute's header, 0 if it isn't there
+static size_t find(const uint8_t *message, size_t length, uint16_t type)
+{
+    size_t at = STUN_HEADER_SIZE;
+    while ((at + 4) <= length) {
+        if (get16(&message[at])==type) {
+            return at;
+        }
+        at += 4 + ((get16(&message[at + 2]) + 3) & ~3);
+    }
+    return 0;
+}
+
+static void test_sample_request()
+{
+    uint8_t request[STUN_MAX_SIZE];
+    size_t length = test_hex(sample_request, request);
+    CHECK(108==length);
+    CHECK(stun_isMessage(request, length));
+    CHECK(!stun_isMessage(request, length - 1));
+    CHECK(!stun_isMessage(request, STUN_HEADER_SIZE - 1));
+
+    boolean use_candidate = true;
+    CHECK(stun_checkRequest(request, length, "evtj", password, &use_candidate));
+    CHECK(!use_candidate);
+    // checking it mustn't change it
+    uint8_t again[STUN_MAX_SIZE];
+    test_hex(sample_request, again);
+    CHECK_BYTES(request, again, length);
+
+    CHECK(!stun_checkRequest(request, length, "h6vY", password, &use_candidate));
+    CHECK(!stun_checkRequest(request, length, "evt", password, &use_candidate));
+    CHECK(!stun_checkRequest(request, length, "evtj", "VOkJxbRl1RmTxUk/WvJxBu",
+        &use_candidate));
+    // a changed byte under the HMAC
+    request[30] ^= 0x01;
+    CHECK(!stun_checkRequest(request, length, "evtj", password, &use_candidate));
+    request[30] ^= 0x01;
+    // an attribute that says it runs past the end
+    request[42] = 0xff;
+    CHECK(!stun_checkRequest(request, length, "evtj", password, &use_candidate));
+    // RTP isn't STUN
+    request[0] = 0x80;
+    CHECK(!stun_isMessage(request, length));
+}
+
+static void test_sample_response()
+{
+    uint8_t response[STUN_MAX_SIZE];
+    size_t length = test_hex(sample_response, response);
+    CHECK(80==length);
+    uint8_t transaction[STUN_TRANSACTION_SIZE];
+    test_hex("b7e7a701bc34d686fa87dfae", transaction);
+    CHECK(stun_checkResponse(response, length, transaction, password));
+    CHECK(!stun_checkResponse(response, length, transaction, "wrong"));
+    transaction[0] ^= 0x01;
+    CHECK(!stun_checkResponse(response, length, transaction, password));
+}
+
+// our response to the sample request, from the sample response's address
+static void test_make_response()
+{
+    uint8_t request[STUN_MAX_SIZE];
+    test_hex(sample_request, request);
+    struct sockaddr_in from;
+    memset(&from, 0, sizeof(from));
+    from.sin_family = AF_INET;
+    from.sin_port = htons(32853);
+    from.sin_addr.s_addr = inet_addr("192.0.2.1");
+
+    uint8_t out[STUN_MAX_SIZE];
+    size_t length = stun_makeResponse(request, &from, password, out);
+    CHECK(length <= STUN_MAX_SIZE);
+    CHECK(STUN_BINDING_SUCCESS==get16(out));
+    CHECK_BYTES(&out[8], &request[8], STUN_TRANSACTION_SIZE);
+
+    uint8_t sample[STUN_MAX_SIZE];
+    size_t sample_length = test_hex(sample_response, sample);
+    size_t ours = find(out, length, STUN_XOR_MAPPED_ADDRESS);
+    size_t theirs = find(sample, sample_length, STUN_XOR_MAPPED_ADDRESS);
+    CHECK(ours && theirs);
+    CHECK_BYTES(&out[ours], &sample[theirs], 12);
+    check_signed(out, length, password);
+    CHECK(stun_checkResponse(out, length, &request[8], password));
+}
+
+static void test_make_request()
+{
+    uint8_t transaction[STUN_TRANSACTION_SIZE];
+    uint8_t out[STUN_MAX_SIZE];
+    size_t length = stun_makeRequest("evtj:h6vY", password, 0x6e0001ff,
+        0x932ff9b151263b36ULL, transaction, out);
+    CHECK(length <= STUN_MAX_SIZE);
+    CHECK(STUN_BINDING_REQUEST==get16(out));
+    CHECK_BYTES(&out[8], transaction, STUN_TRANSACTION_SIZE);
+
+    size_t at = find(out, length, STUN_USERNAME);
+    CHECK(at && (9==get16(&out[at + 2])) &&
+        (0==memcmp("evtj:h6vY", &out[at + 4], 9)));
+    at = find(out, length, STUN_PRIORITY);
+    CHECK(at && (4==get16(&out[at + 2])) && (0x6e0001ff==get32(&out[at + 4])));
+    at = find(out, length, STUN_ICE_CONTROLLING);
+    CHECK(at && (8==get16(&out[at + 2])));
+    CHECK(at && (0x932ff9b1==get32(&out[at + 4])) &&
+        (0x51263b36==get32(&out[at + 8])));
+    at = find(out, length, STUN_USE_CANDIDATE);
+    CHECK(at && (0==get16(&out[at + 2])));
+    check_signed(out, length, password);
+
+    // and the other end takes it, nominated
+    boolean use_candidate = false;
+    CHECK(stun_checkRequest(out, length, "evtj", password, &use_candidate));
+    CHECK(use_candidate);
+
+    // a new transaction each time
+    uint8_t second[STUN_TRANSACTION_SIZE];
+    stun_makeRequest("evtj:h6vY", password, 1, 2, second, out);
+    CHECK(0 != memcmp(transaction, second, STUN_TRANSACTION_SIZE));
+}
+
+int main()
+{
+    test_sample_request();
+    test_sample_response();
+    test_make_response();
+    test_make_request();
+    return TEST_END();
+}
+
+//
+// END OF test_stun.cpp
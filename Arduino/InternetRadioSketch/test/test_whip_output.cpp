@@ -0,0 +1,781 @@
+//
+// test_whip_output.cpp
+
+//
+// WHIP (user-045) end to end against a WHIP endpoint written here, on
+// loopback sockets through the stubs. The endpoint takes the offer over
+// HTTP, answers it, does its side of ICE and takes the media apart
+// with AES-CTR and HMAC-SHA1 straight from OpenSSL, with session keys
+// it derives itself (RFC 3711 4.3) from the a=crypto line of the
+// offer. Its STUN is made and checked here too, from RFC 5389.
+//
+// In order: nothing listening on the endpoint's port (the client backs
+// off and tries again), the endpoint refusing the offer, a full ICE
+// endpoint that nominates with USE-CANDIDATE, then goes quiet until
+// the client gives up on consent, and an ICE-lite one that the client
+// checks. 250 packets each time, every one has to decrypt and
+// authenticate, with the answer's payload type, the offer's SSRC, no
+// gaps in the sequence and 960 more samples on the timestamp each time.
+//
+
+#include "test.h"
+#include "whip_output.h"
+#include "srtp.h"
+#include "stun.h"
+#include "../src/ToolkitFiles/ToolkitSettings.h"
+
+#include "lwip/sockets.h"
+#include "lwip/dns.h"
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <zlib.h>
+
+enum {
+    PACKETS         = 250,
+    PACKET_MS       = 20,
+    SAMPLES         = 960,
+    AUTH_TAG        = 10,
+    REQUEST_SIZE    = 8192
+};
+
+static uint32_t dns_asks = 0;
+
+err_t dns_gethostbyname(const char *hostname, ip_addr_t *addr,
+    dns_found_callback found, void *callback_arg)
+{
+    dns_asks++;
+    struct in_addr numeric;
+    if (inet_aton(hostname, &numeric)) {
+        addr->ip4.addr = numeric.s_addr;
+        return ERR_OK;
+    }
+    return ERR_ARG;
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void put16(uint8_t *p, uint16_t value)
+{
+    p[0] = value >> 8;
+    p[1] = value;
+}
+
+static void put32(uint8_t *p, uint32_t value)
+{
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+// the serial line that has this in it
+static const char *line(const char *text)
+{
+    const char *at = strstr(test_serial, text);
+    if (NULL==at) {
+        return "";
+    }
+    while ((at > test_serial) && (at[-1] != '\n')) {
+        at--;
+    }
+    return at;
+}
+
+// the state, as whip_printStats() has it
+static const char *whip_state()
+{
+    static char name[16];
+    test_serial_echo = false;
+    test_serial_clear();
+    whip_printStats();
+    test_serial_echo = true;
+    name[0] = 0;
+    sscanf(test_serial, "WHIP %15[A-Z]", name);
+    return name;
+}
+
+//------------------------------------------------------------------
+//
+// SRTP, from RFC 3711
+//
+
+typedef struct {
+    uint8_t key[16];
+    uint8_t auth[20];
+    uint8_t salt[14];
+} session_keys;
+
+static void aes_ctr(const uint8_t *key, const uint8_t *iv, const uint8_t *in,
+    uint8_t *out, size_t length)
+{
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    int out_length = 0;
+    EVP_EncryptInit_ex(ctx, EVP_aes_128_ctr(), NULL, key, iv);
+    EVP_EncryptUpdate(ctx, out, &out_length, in, length);
+    EVP_CIPHER_CTX_free(ctx);
+}
+
+// 4.3.1 with a key derivation rate of 0, the label goes in at byte 7
+static void derive(const uint8_t *master_key, const uint8_t *master_salt,
+    uint8_t label, uint8_t *out, size_t length)
+{
+    uint8_t iv[16];
+    memset(iv, 0, sizeof(iv));
+    memcpy(iv, master_salt, 14);
+    iv[7] ^= label;
+    uint8_t zeros[32];
+    memset(zeros, 0, sizeof(zeros));
+    aes_ctr(master_key, iv, zeros, out, length);
+}
+
+static void session(const uint8_t *master_key, const uint8_t *master_salt,
+    session_keys *keys)
+{
+    derive(master_key, master_salt, 0, keys->key, sizeof(keys->key));
+    derive(master_key, master_salt, 1, keys->auth, sizeof(keys->auth));
+    derive(master_key, master_salt, 2, keys->salt, sizeof(keys->salt));
+}
+
+// the derivation above against Appendix B.3
+static void test_derivation()
+{
+    uint8_t master_key[16];
+    uint8_t master_salt[14];
+    test_hex("E1F97A0D3E018BE0D64FA32C06DE4139", master_key);
+    test_hex("0EC675AD498AFEEBB6960B3AABE6", master_salt);
+    session_keys keys;
+    session(master_key, master_salt, &keys);
+    uint8_t expected[20];
+    test_hex("C61E7A93744F39EE10734AFE3FF7A087", expected);
+    CHECK_BYTES(keys.key, expected, 16);
+    test_hex("CEBE321F6FF7716B6FD4AB49AF256A156D38BAA4", expected);
+    CHECK_BYTES(keys.auth, expected, 20);
+    test_hex("30CBBC08863D8C85D49DB34A9AE1", expected);
+    CHECK_BYTES(keys.salt, expected, 14);
+}
+
+// checks the tag, then decrypts the payload in place
+static boolean unprotect(const session_keys *keys, uint32_t roc,
+    uint8_t *packet, size_t length)
+{
+    if (length < (12 + AUTH_TAG)) {
+        return false;
+    }
+    size_t protected_length = length - AUTH_TAG;
+    uint8_t with_roc[WHIP_PACKET_SIZE + 4];
+    memcpy(with_roc, packet, protected_length);
+    put32(&with_roc[protected_length], roc);
+    uint8_t tag[20];
+    unsigned int tag_length = 0;
+    HMAC(EVP_sha1(), keys->auth, sizeof(keys->auth), with_roc,
+        protected_length + 4, tag, &tag_length);
+    if (0 != memcmp(tag, &packet[protected_length], AUTH_TAG)) {
+        return false;
+    }
+
+    // IV = (salt * 2^16) XOR (SSRC * 2^64) XOR (index * 2^16)
+    uint64_t index = ((uint64_t) roc << 16) | get16(&packet[2]);
+    uint8_t iv[16];
+    memset(iv, 0, sizeof(iv));
+    memcpy(iv, keys->salt, 14);
+    for (int i = 0; i < 4; i++) {
+        iv[4 + i] ^= packet[8 + i];
+    }
+    for (int i = 0; i < 6; i++) {
+        iv[8 + i] ^= (uint8_t) (index >> (40 - (8 * i)));
+    }
+    aes_ctr(keys->key, iv, &packet[12], &packet[12], protected_length - 12);
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// STUN, from RFC 5389 and RFC 8445
+//
+
+static size_t add_attribute(uint8_t *out, size_t at, uint16_t type,
+    const void *value, uint16_t length)
+{
+    put16(&out[at], type);
+    put16(&out[at + 2], length);
+    memcpy(&out[at + 4], value, length);
+    size_t padded = (length + 3) & ~3;
+    memset(&out[at + 4 + length], 0, padded - length);
+    return at + 4 + padded;
+}
+
+static size_t sign(uint8_t *out, size_t at, const char *key)
+{
+    put16(&out[2], at + 4 + STUN_INTEGRITY_SIZE - STUN_HEADER_SIZE);
+    uint8_t hmac[20];
+    unsigned int hmac_length = 0;
+    HMAC(EVP_sha1(), key, strlen(key), out, at, hmac, &hmac_length);
+    at = add_attribute(out, at, STUN_MESSAGE_INTEGRITY, hmac, sizeof(hmac));
+    put16(&out[2], at + 8 - STUN_HEADER_SIZE);
+    uint8_t fingerprint[4];
+    put32(fingerprint, crc32(0, out, at) ^ 0x5354554e);
+    return add_attribute(out, at, STUN_FINGERPRINT, fingerprint, 4);
+}
+
+static void header(uint8_t *out, uint16_t type, const uint8_t *transaction)
+{
+    put16(&out[0], type);
+    put16(&out[2], 0);
+    put32(&out[4], STUN_MAGIC_COOKIE);
+    memcpy(&out[8], transaction, STUN_TRANSACTION_SIZE);
+}
+
+// the offset of an attribute's header, 0 if it isn't there
+static size_t find(const uint8_t *message, size_t length, uint16_t type)
+{
+    size_t at = STUN_HEADER_SIZE;
+    while ((at + 4) <= length) {
+        if (type==get16(&message[at])) {
+            return at;
+        }
+        at += 4 + ((get16(&message[at + 2]) + 3) & ~3);
+    }
+    return 0;
+}
+
+// FINGERPRINT last, MESSAGE-INTEGRITY before it and keyed with key
+static boolean signed_by(const uint8_t *message, size_t length, const char *key)
+{
+    if ((length < (STUN_HEADER_SIZE + 32)) ||
+            ((STUN_HEADER_SIZE + get16(&message[2])) != length)) {
+        return false;
+    }
+    size_t fingerprint = length - 8;
+    if ((STUN_FINGERPRINT != get16(&message[fingerprint])) ||
+            ((crc32(0, message, fingerprint) ^ 0x5354554e) !=
+                get32(&message[fingerprint + 4]))) {
+        return false;
+    }
+    size_t integrity = fingerprint - 4 - STUN_INTEGRITY_SIZE;
+    if (STUN_MESSAGE_INTEGRITY != get16(&message[integrity])) {
+        return false;
+    }
+    uint8_t copy[STUN_MAX_SIZE];
+    memcpy(copy, message, integrity);
+    put16(&copy[2], integrity + 4 + STUN_INTEGRITY_SIZE - STUN_HEADER_SIZE);
+    uint8_t hmac[20];
+    unsigned int hmac_length = 0;
+    HMAC(EVP_sha1(), key, strlen(key), copy, integrity, hmac, &hmac_length);
+    return 0==memcmp(&message[integrity + 4], hmac, STUN_INTEGRITY_SIZE);
+}
+
+//------------------------------------------------------------------
+//
+// The endpoint
+//
+
+static int listen_fd = -1;
+static int http_fd = -1;
+static int media_fd = -1;
+static uint16_t http_port = 0;
+static struct sockaddr_in media_address;
+
+static char request[REQUEST_SIZE];
+static size_t request_length = 0;
+
+// from the offer
+static char offer_ufrag[64];
+static char offer_pwd[128];
+static uint32_t offer_ssrc = 0;
+static struct sockaddr_in offer_candidate;
+static session_keys keys;
+static uint8_t last_master[30];
+
+// how the endpoint answers
+static const char *endpoint_ufrag = "";
+static const char *endpoint_pwd = "";
+
+static int make_socket(int type, uint16_t *port, struct sockaddr_in *address)
+{
+    int fd = socket(AF_INET, type, 0);
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    memset(address, 0, sizeof(*address));
+    address->sin_family = AF_INET;
+    address->sin_addr.s_addr = inet_addr("127.0.0.1");
+    socklen_t length = sizeof(*address);
+    CHECK(0==bind(fd, (struct sockaddr *) address, sizeof(*address)));
+    CHECK(0==getsockname(fd, (struct sockaddr *) address, &length));
+    *port = ntohs(address->sin_port);
+    return fd;
+}
+
+// a millisecond of the client, then the endpoint's TCP side
+static void step()
+{
+    test_millis++;
+    whip_run();
+    if ((http_fd < 0) && (listen_fd >= 0)) {
+        http_fd = accept(listen_fd, NULL, NULL);
+        if (http_fd >= 0) {
+            fcntl(http_fd, F_SETFL, fcntl(http_fd, F_GETFL, 0) | O_NONBLOCK);
+            request_length = 0;
+        }
+    }
+    if (http_fd >= 0) {
+        int got = recv(http_fd, &request[request_length],
+            sizeof(request) - 1 - request_length, MSG_DONTWAIT);
+        if (got > 0) {
+            request_length += got;
+        }
+        request[request_length] = 0;
+        usleep(20);     // the kernel's side of loopback is in real time
+    }
+}
+
+// the whole request is in, headers and Content-Length of SDP
+static const char *offer_body()
+{
+    const char *body = strstr(request, "\r\n\r\n");
+    const char *length = strcasestr(request, "\r\nContent-Length:");
+    if ((NULL==body) || (NULL==length) ||
+            ((size_t) (&request[request_length] - (body + 4)) <
+                (size_t) atoi(&length[17]))) {
+        return NULL;
+    }
+    return body + 4;
+}
+
+static boolean step_until_offer(uint32_t limit)
+{
+    for (uint32_t i = 0; i < limit; i++) {
+        step();
+        if (offer_body()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static boolean step_until_state(const char *name, uint32_t limit)
+{
+    for (uint32_t i = 0; i < limit; i++) {
+        step();
+        if (0==strcmp(whip_state(), name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void reply(const char *response)
+{
+    CHECK(strlen(response)==(size_t) send(http_fd, response, strlen(response), 0));
+    close(http_fd);
+    http_fd = -1;
+    request_length = 0;
+    request[0] = 0;
+}
+
+// the request line, the headers, and what the endpoint needs from the SDP
+static void read_offer()
+{
+    CHECK(0==strncmp(request, "POST /whip/endpoint HTTP/1.1\r\n", 30));
+    CHECK(NULL != strstr(request, "\r\nHost: 127.0.0.1:"));
+    CHECK(NULL != strstr(request, "\r\nAuthorization: Bearer s3cret\r\n"));
+    CHECK(NULL != strstr(request, "\r\nContent-Type: application/sdp\r\n"));
+    const char *body = offer_body();
+    CHECK(atoi(&strcasestr(request, "\r\nContent-Length:")[17])==
+        (int) (&request[request_length] - body));
+
+    char sdp[REQUEST_SIZE];
+    snprintf(sdp, sizeof(sdp), "%s", body);
+    offer_ufrag[0] = 0;
+    offer_pwd[0] = 0;
+    offer_ssrc = 0;
+    memset(&offer_candidate, 0, sizeof(offer_candidate));
+    boolean have_key = false;
+    boolean lite = false;
+    boolean opus = false;
+    uint32_t m_port = 0;
+    char c_address[16] = "";
+    char *save;
+    for (char *at = strtok_r(sdp, "\r\n", &save); at;
+            at = strtok_r(NULL, "\r\n", &save)) {
+        char key[64];
+        char ip[48];
+        uint32_t number;
+        if (1==sscanf(at, "a=ice-ufrag:%63s", offer_ufrag)) {
+        } else if (1==sscanf(at, "a=ice-pwd:%127s", offer_pwd)) {
+        } else if (0==strcmp(at, "a=ice-lite")) {
+            lite = true;
+        } else if (1==sscanf(at, "a=crypto:1 AES_CM_128_HMAC_SHA1_80 inline:%63s", key)) {
+            uint8_t master[33];
+            CHECK(40==strlen(key));
+            CHECK(30==EVP_DecodeBlock(master, (const uint8_t *) key, 40));
+            CHECK(0 != memcmp(master, last_master, 30));    // new every offer
+            memcpy(last_master, master, 30);
+            session(master, &master[16], &keys);
+            have_key = true;
+        } else if (2==sscanf(at, "a=candidate:1 1 UDP %*u %47s %u typ host", ip, &number)) {
+            offer_candidate.sin_family = AF_INET;
+            offer_candidate.sin_port = htons(number);
+            CHECK(inet_aton(ip, &offer_candidate.sin_addr));
+        } else if (1==sscanf(at, "a=ssrc:%u cname:", &number)) {
+            offer_ssrc = number;
+        } else if (0==strcmp(at, "a=rtpmap:111 opus/48000/2")) {
+            opus = true;
+        } else if (1==sscanf(at, "m=audio %u RTP/SAVPF 111", &m_port)) {
+        } else if (1==sscanf(at, "c=IN IP4 %15s", c_address)) {
+        }
+    }
+    CHECK(8==strlen(offer_ufrag));
+    CHECK(24==strlen(offer_pwd));
+    CHECK(have_key && lite && opus);
+    CHECK(0==strcmp("127.0.0.1", c_address));
+    CHECK(offer_candidate.sin_addr.s_addr==inet_addr("127.0.0.1"));
+    CHECK(m_port && (m_port==ntohs(offer_candidate.sin_port)));
+}
+
+static void answer(int status, const char *lines, boolean content_length)
+{
+    char sdp[1024];
+    int sdp_length = snprintf(sdp, sizeof(sdp),
+        "v=0\r\n"
+        "o=- 1 1 IN IP4 127.0.0.1\r\n"
+        "s=-\r\n"
+        "t=0 0\r\n"
+        "%s"
+        "m=audio %u RTP/SAVPF 96\r\n"
+        "c=IN IP4 127.0.0.1\r\n"
+        "a=ice-ufrag:%s\r\n"
+        "a=ice-pwd:%s\r\n"
+        "a=candidate:1 1 udp 2130706431 127.0.0.1 %u typ host\r\n",
+        lines, ntohs(media_address.sin_port), endpoint_ufrag, endpoint_pwd,
+        ntohs(media_address.sin_port));
+    char response[2048];
+    char length[40] = "";
+    if (content_length) {
+        snprintf(length, sizeof(length), "Content-Length: %d\r\n", sdp_length);
+    }
+    snprintf(response, sizeof(response),
+        "HTTP/1.1 %u %s\r\n"
+        "Content-Type: application/sdp\r\n"
+        "Location: /whip/endpoint/1\r\n"
+        "%s"
+        "\r\n%s", status, (201==status) ? "Created" : "OK", length, sdp);
+    reply(response);
+}
+
+// the nominating check a full ICE endpoint sends, signed with key
+static uint8_t check_transaction[STUN_TRANSACTION_SIZE];
+
+static void send_check(const char *key)
+{
+    uint8_t message[STUN_MAX_SIZE];
+    for (int i = 0; i < STUN_TRANSACTION_SIZE; i++) {
+        check_transaction[i] = rand();
+    }
+    header(message, STUN_BINDING_REQUEST, check_transaction);
+    char username[160];
+    snprintf(username, sizeof(username), "%s:%s", offer_ufrag, endpoint_ufrag);
+    size_t at = add_attribute(message, STUN_HEADER_SIZE, STUN_USERNAME,
+        username, strlen(username));
+    uint8_t value[8];
+    put32(value, 1853824767);
+    at = add_attribute(message, at, STUN_PRIORITY, value, 4);
+    put32(value, 0x01020304);
+    put32(&value[4], 0x05060708);
+    at = add_attribute(message, at, STUN_ICE_CONTROLLING, value, 8);
+    at = add_attribute(message, at, STUN_USE_CANDIDATE, "", 0);
+    at = sign(message, at, key);
+    CHECK(at==(size_t) sendto(media_fd, message, at, 0,
+        (struct sockaddr *) &offer_candidate, sizeof(offer_candidate)));
+}
+
+// a success response to us, from the client's own address
+static boolean check_response(const uint8_t *message, size_t length,
+    const struct sockaddr_in *from)
+{
+    if ((STUN_BINDING_SUCCESS != get16(message)) ||
+            (0 != memcmp(&message[8], check_transaction, STUN_TRANSACTION_SIZE)) ||
+            (from->sin_port != offer_candidate.sin_port) ||
+            !signed_by(message, length, offer_pwd)) {
+        return false;
+    }
+    size_t mapped = find(message, length, STUN_XOR_MAPPED_ADDRESS);
+    return mapped && (8==get16(&message[mapped + 2])) &&
+        ((get16(&message[mapped + 6]) ^ (STUN_MAGIC_COOKIE >> 16))==
+            ntohs(media_address.sin_port)) &&
+        ((get32(&message[mapped + 8]) ^ STUN_MAGIC_COOKIE)==
+            ntohl(media_address.sin_addr.s_addr));
+}
+
+// a check from the client to an ICE-lite endpoint, answered if it's right
+static boolean answer_check(const uint8_t *message, size_t length,
+    const struct sockaddr_in *from)
+{
+    char username[160];
+    snprintf(username, sizeof(username), "%s:%s", endpoint_ufrag, offer_ufrag);
+    size_t name = find(message, length, STUN_USERNAME);
+    if ((STUN_BINDING_REQUEST != get16(message)) || (0==name) ||
+            (strlen(username) != get16(&message[name + 2])) ||
+            (0 != memcmp(&message[name + 4], username, strlen(username))) ||
+            !find(message, length, STUN_ICE_CONTROLLING) ||
+            !find(message, length, STUN_USE_CANDIDATE) ||
+            !find(message, length, STUN_PRIORITY) ||
+            !signed_by(message, length, endpoint_pwd)) {
+        return false;
+    }
+    uint8_t response[STUN_MAX_SIZE];
+    header(response, STUN_BINDING_SUCCESS, &message[8]);
+    uint8_t mapped[8];
+    mapped[0] = 0;
+    mapped[1] = 0x01;
+    put16(&mapped[2], ntohs(from->sin_port) ^ (STUN_MAGIC_COOKIE >> 16));
+    put32(&mapped[4], ntohl(from->sin_addr.s_addr) ^ STUN_MAGIC_COOKIE);
+    size_t at = add_attribute(response, STUN_HEADER_SIZE,
+        STUN_XOR_MAPPED_ADDRESS, mapped, sizeof(mapped));
+    at = sign(response, at, endpoint_pwd);
+    sendto(media_fd, response, at, 0, (struct sockaddr *) from, sizeof(*from));
+    return true;
+}
+
+//------------------------------------------------------------------
+//
+// The media
+//
+
+typedef struct {
+    uint32_t packets;
+    uint32_t bad;               // didn't authenticate
+    uint32_t wrong;             // header or payload not what was sent
+    uint32_t markers;
+    uint32_t stun_responses;
+    uint32_t stun_checks;
+    uint32_t stun_bad;
+    uint32_t consent_checks;    // the checks once the media was going
+} received;
+
+static uint8_t sent_payload[PACKETS][400];
+static size_t sent_length[PACKETS];
+static uint32_t roc = 0;
+static uint32_t first_sequence = 0;
+static uint32_t first_timestamp = 0;
+static uint32_t last_sequence = 0;
+
+static void receive(received *r, uint8_t expected_type)
+{
+    uint8_t packet[WHIP_PACKET_SIZE];
+    struct sockaddr_in from;
+    socklen_t from_length = sizeof(from);
+    int got;
+    while ((got = recvfrom(media_fd, packet, sizeof(packet), MSG_DONTWAIT,
+            (struct sockaddr *) &from, &from_length)) > 0) {
+        from_length = sizeof(from);
+        if (0==(packet[0] & 0xc0)) {
+            if (check_response(packet, got, &from)) {
+                r->stun_responses++;
+            } else if (answer_check(packet, got, &from)) {
+                r->stun_checks++;
+                r->consent_checks += r->packets ? 1 : 0;
+            } else {
+                r->stun_bad++;
+            }
+            continue;
+        }
+        CHECK(from.sin_port==offer_candidate.sin_port);
+
+        // the sequence number might roll over
+        uint16_t sequence = get16(&packet[2]);
+        if (r->packets && (sequence < (last_sequence & 0xffff))) {
+            roc++;
+        }
+        if (!unprotect(&keys, roc, packet, got)) {
+            r->bad++;
+            continue;
+        }
+        if (0==r->packets) {
+            first_sequence = sequence;
+            first_timestamp = get32(&packet[4]);
+        }
+        last_sequence = sequence;
+        uint32_t n = r->packets++;
+        r->markers += (packet[1] & 0x80) ? 1 : 0;
+        boolean right = (n < PACKETS) && (0x80==packet[0]) &&
+            (expected_type==(packet[1] & 0x7f)) &&
+            (((n ? 0 : 0x80) | expected_type)==packet[1]) &&
+            (sequence==(uint16_t) (first_sequence + n)) &&
+            (get32(&packet[4])==(first_timestamp + (n * SAMPLES))) &&
+            (get32(&packet[8])==offer_ssrc) &&
+            ((size_t) got==(12 + sent_length[n] + AUTH_TAG)) &&
+            (0==memcmp(&packet[12], sent_payload[n], sent_length[n]));
+        r->wrong += right ? 0 : 1;
+    }
+}
+
+// PACKETS of Opus from the encoder task, one every PACKET_MS
+static void send_media(received *r, uint8_t expected_type)
+{
+    roc = 0;
+    for (int n = 0; n < PACKETS; n++) {
+        sent_length[n] = 20 + (rand() % 380);
+        for (size_t i = 0; i < sent_length[n]; i++) {
+            sent_payload[n][i] = rand();
+        }
+        whip_sendOpus(sent_payload[n], sent_length[n], SAMPLES);
+        for (int ms = 0; ms < PACKET_MS; ms++) {
+            step();
+            receive(r, expected_type);
+        }
+    }
+}
+
+static void check_media(const received *r)
+{
+    CHECK(PACKETS==r->packets);
+    CHECK(0==r->bad);
+    CHECK(0==r->wrong);
+    CHECK(1==r->markers);
+}
+
+//------------------------------------------------------------------
+
+int main()
+{
+    test_derivation();
+
+    struct sockaddr_in http_address;
+    listen_fd = make_socket(SOCK_STREAM, &http_port, &http_address);
+    uint16_t media_port;
+    media_fd = make_socket(SOCK_DGRAM, &media_port, &media_address);
+
+    // the settings it needs
+    CHECK(!whip_begin(2));
+    SettingItem::updateOrAdd("remote_whip", "1");
+    CHECK(!whip_begin(2));
+    SettingItem::updateOrAdd("remote_whip_url", "https://127.0.0.1/whip");
+    CHECK(!whip_begin(2));
+    char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%u/whip/endpoint", http_port);
+    SettingItem::updateOrAdd("remote_whip_url", url);
+    SettingItem::updateOrAdd("remote_whip_token", "s3cret");
+    CHECK(!whip_begin(0));
+    CHECK(whip_begin(2));
+    CHECK(whip_begin(2));       // once is enough
+    uint8_t early[100];
+    memset(early, 0, sizeof(early));
+    whip_sendOpus(early, sizeof(early), SAMPLES);
+
+    // bound but not listening, so the connect is refused .. and again
+    // WHIP_BACKOFF_MS later
+    CHECK(step_until_state("BACKOFF", 100));
+    CHECK(NULL != strstr(line("failures (last:"), "(last: connect "));
+    uint32_t failed_at = test_millis;
+    CHECK(step_until_state("CONNECTING", WHIP_BACKOFF_MS + 100));
+    CHECK(test_millis >= (failed_at + WHIP_BACKOFF_MS));
+    CHECK(test_millis <= (failed_at + WHIP_BACKOFF_MS + 10));
+    CHECK(2==dns_asks);
+    CHECK(0==listen(listen_fd, 4));
+    fcntl(listen_fd, F_SETFL, fcntl(listen_fd, F_GETFL, 0) | O_NONBLOCK);
+
+    // refused, back off, and a new offer
+    CHECK(step_until_offer(WHIP_BACKOFF_MS + 1000));
+    read_offer();
+    reply("HTTP/1.1 403 Forbidden\r\nContent-Length: 0\r\n\r\n");
+    CHECK(step_until_state("BACKOFF", 1000));
+    CHECK(NULL != strstr(line("failures (last:"), "(last: offer refused)"));
+
+    // full ICE: the endpoint nominates, the client answers it
+    CHECK(step_until_offer(WHIP_BACKOFF_MS + 1000));
+    read_offer();
+    endpoint_ufrag = "full";
+    endpoint_pwd = "fullfullfullfullfullfull";
+    answer(201, "a=rtpmap:96 opus/48000/2\r\n", true);
+    CHECK(step_until_state("ICE", 1000));
+    CHECK(NULL != strstr(test_serial, "WHIP ICE 0 checks answered, 0 sent"));
+    received full;
+    memset(&full, 0, sizeof(full));
+    send_check("not the password");
+    for (int i = 0; i < 100; i++) {
+        step();
+        receive(&full, 96);
+    }
+    CHECK(0==strcmp("ICE", whip_state()));
+    CHECK(0==full.stun_responses);
+    send_check(offer_pwd);
+    for (int i = 0; i < 10; i++) {
+        step();
+        receive(&full, 96);
+    }
+    CHECK(0==strcmp("MEDIA", whip_state()));
+    CHECK(1==full.stun_responses);
+    send_media(&full, 96);
+    check_media(&full);
+    CHECK(0==full.stun_checks);         // it's the endpoint's job
+    CHECK(0==full.stun_bad);
+
+    // the endpoint stops checking, the client gives up on it
+    uint32_t last_check_at = test_millis - (PACKETS * PACKET_MS) - 10;
+    CHECK(step_until_state("BACKOFF", WHIP_CONSENT_LOST_MS));
+    CHECK(NULL != strstr(line("failures (last:"), "(last: consent lost)"));
+    CHECK((test_millis - last_check_at) > WHIP_CONSENT_LOST_MS);
+    CHECK((test_millis - last_check_at) <= (WHIP_CONSENT_LOST_MS + 20));
+
+    // ICE-lite: the client checks the endpoint, the answer has no
+    // Content-Length and no rtpmap, the payload type stays 111
+    CHECK(step_until_offer(WHIP_BACKOFF_MS + 1000));
+    read_offer();
+    endpoint_ufrag = "lite";
+    endpoint_pwd = "litelitelitelitelitelite";
+    answer(200, "a=ice-lite\r\n", false);
+    received lite;
+    memset(&lite, 0, sizeof(lite));
+    for (int i = 0; (i < 1000) && (0==lite.stun_checks); i++) {
+        step();
+        receive(&lite, WHIP_PAYLOAD_OPUS);
+    }
+    CHECK(1==lite.stun_checks);
+    step();
+    CHECK(0==strcmp("MEDIA", whip_state()));
+    send_media(&lite, WHIP_PAYLOAD_OPUS);
+    check_media(&lite);
+    // and consent, every WHIP_CONSENT_MS while the media goes
+    CHECK(((PACKETS * PACKET_MS) / WHIP_CONSENT_MS)==lite.consent_checks);
+    CHECK(0==lite.stun_bad);
+
+    test_serial_echo = false;
+    test_serial_clear();
+    whip_printStats();
+    test_serial_echo = true;
+    printf("%s", test_serial);
+    uint32_t offers, failures;
+    CHECK(2==sscanf(line("WHIP MEDIA,"), "WHIP MEDIA, %u offers, %u failures",
+        &offers, &failures));
+    CHECK(3==offers);
+    CHECK(3==failures);
+    uint32_t answered, checks_sent, checks_bad, dropped;
+    CHECK(4==sscanf(line("WHIP ICE "), "WHIP ICE %u checks answered, %u sent, "
+        "%u bad, %u other packets dropped", &answered, &checks_sent,
+        &checks_bad, &dropped));
+    CHECK(1==answered);
+    CHECK(lite.stun_checks==checks_sent);
+    CHECK(1==checks_bad);               // signed with the wrong password
+    CHECK(0==dropped);
+    uint32_t packets, bytes, errors, not_ready, too_big;
+    CHECK(5==sscanf(line("WHIP media "), "WHIP media %u packets, %u bytes, "
+        "%u send errors, %u before ICE, %u too big", &packets, &bytes,
+        &errors, &not_ready, &too_big));
+    CHECK((2 * PACKETS)==packets);
+    CHECK(0==errors);
+    CHECK(1==not_ready);
+    CHECK(0==too_big);
+    return TEST_END();
+}
+
+//
+// END OF test_whip_output.cpp